@@ -7,6 +7,16 @@
 #define STB_VORBIS_NO_STDIO
 #include "stb_vorbis/stb_vorbis.c"
 
+#if RETRO_USE_THREADED_STREAMS || RETRO_USE_SFX_CACHE
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#endif
+#if RETRO_USE_THREADED_STREAMS
+#include <atomic>
+#include <chrono>
+#endif
+
 stb_vorbis *vorbisInfo = NULL;
 stb_vorbis_alloc vorbisAlloc;
 
@@ -15,14 +25,65 @@ using namespace RSDK;
 SFXInfo RSDK::sfxList[SFX_COUNT];
 ChannelInfo RSDK::channels[CHANNEL_COUNT];
 
+#if RETRO_USE_SFX_LOOKUP
+uint16 RSDK::sfxChannelMask[SFX_COUNT];
+uint16 sfxLookup[SFX_LOOKUP_SIZE]; // sfx slot + 1, 0 if the entry is empty
+#endif
+
 char streamFilePath[0x40];
 uint8 *streamBuffer    = NULL;
 int32 streamBufferSize = 0;
 int32 streamStartPos   = 0;
 int32 streamLoopPoint  = 0;
 
+#if RETRO_USE_THREADED_STREAMS
+StreamBlock streamBlocks[STREAM_BLOCK_COUNT];
+std::atomic<uint32> streamReadBlock(0);
+std::atomic<uint32> streamWriteBlock(0);
+std::atomic<uint32> streamPlayLoc(0);
+std::atomic<bool32> streamPlayLocValid(false);
+
+// everything below is guarded by streamDecoderMutex (as is vorbisInfo while the decoder thread is running)
+bool32 streamLooping     = false;
+bool32 streamDecoding    = false;
+bool32 streamDecoderQuit = false;
+
+std::thread streamDecoderThread;
+std::mutex streamDecoderMutex;
+std::condition_variable streamDecoderSignal;
+#endif
+
+#if RETRO_USE_INCREMENTAL_STREAMS
+FileInfo streamFile;
+uint8 *streamWindow       = NULL;
+int32 streamWindowPos     = 0;
+int32 streamWindowSize    = 0;
+bool32 streamPushdata     = false;
+float **streamFrame       = NULL;
+int32 streamFrameChannels = 0;
+int32 streamFrameSamples  = 0;
+int32 streamFramePos      = 0;
+int32 streamSeekSample    = -1;
+int32 streamSeekOffset    = -1;
+#endif
+
 float speedMixAmounts[0x400];
 
+#if RETRO_USE_SFX_CACHE
+SFXCacheEntry RSDK::sfxCache[SFXCACHE_COUNT];
+uint32 RSDK::sfxCacheHits   = 0;
+uint32 RSDK::sfxCacheMisses = 0;
+uint32 sfxCacheTimer        = 0;
+size_t sfxCacheUsage        = 0;
+
+// everything below is guarded by sfxCacheMutex (as is the state of every cache entry, and the buffer/length/sfx/speed of any that are queued or building)
+bool32 sfxCacheQuit = false;
+
+std::thread sfxCacheThread;
+std::mutex sfxCacheMutex;
+std::condition_variable sfxCacheSignal;
+#endif
+
 #if RETRO_AUDIODEVICE_XAUDIO
 #include "XAudio/XAudioDevice.cpp"
 #elif RETRO_AUDIODEVICE_NX
@@ -31,6 +92,8 @@ float speedMixAmounts[0x400];
 #include "SDL2/SDL2AudioDevice.cpp"
 #elif RETRO_AUDIODEVICE_OBOE
 #include "Oboe/OboeAudioDevice.cpp"
+#elif RETRO_AUDIODEVICE_NULL
+#include "Null/NullAudioDevice.cpp"
 #endif
 
 uint8 AudioDeviceBase::initializedAudioChannels = false;
@@ -40,20 +103,336 @@ uint8 AudioDeviceBase::audioFocus               = 0;
 int32 AudioDeviceBase::mixBufferID = 0;
 float AudioDeviceBase::mixBuffer[3][MIX_BUFFER_SIZE];
 
-void RSDK::UpdateStreamBuffer(ChannelInfo *channel)
+void AudioDeviceBase::MixChannels(SAMPLE_FORMAT *stream, int32 length)
+{
+    SAMPLE_FORMAT *streamF    = stream;
+    SAMPLE_FORMAT *streamEndF = stream + length;
+
+    for (int32 c = 0; c < CHANNEL_COUNT; ++c) {
+        ChannelInfo *channel = &channels[c];
+
+        switch (channel->state) {
+            default:
+            case CHANNEL_IDLE: break;
+
+            case CHANNEL_SFX: {
+                SAMPLE_FORMAT *sfxBuffer = &channel->samplePtr[channel->bufferPos];
+
+                // somehow it can get here and not have any data to play, causing a crash. This should fix that
+                if (!sfxBuffer)
+                    continue;
+
+                float volL = channel->volume, volR = channel->volume;
+                if (channel->pan < 0.0)
+                    volL = (1.0 + channel->pan) * channel->volume;
+                else
+                    volR = (1.0 - channel->pan) * channel->volume;
+
+                float panL = volL * engine.soundFXVolume;
+                float panR = volR * engine.soundFXVolume;
+
+#if RETRO_USE_SFX_CACHE
+                // nothing to resample (the sfx cache may have already done it), so the samples can be mixed as-is
+                if (channel->speed == TO_FIXED(1)) {
+                    MixUnresampledSfx(channel, streamF, streamEndF, panL, panR);
+                    break;
+                }
+#endif
+
+                uint32 speedPercent       = 0;
+                SAMPLE_FORMAT *curStreamF = streamF;
+                while (curStreamF < streamEndF && streamF < streamEndF) {
+                    SAMPLE_FORMAT sample = (sfxBuffer[1] - *sfxBuffer) * speedMixAmounts[speedPercent >> 6] + *sfxBuffer;
+
+                    speedPercent += channel->speed;
+                    sfxBuffer += FROM_FIXED(speedPercent);
+                    channel->bufferPos += FROM_FIXED(speedPercent);
+                    speedPercent &= 0xFFFF;
+
+                    curStreamF[0] += sample * panR;
+                    curStreamF[1] += sample * panL;
+                    curStreamF += 2;
+
+                    if (channel->bufferPos >= channel->sampleLength) {
+                        if (channel->loop == 0xFFFFFFFF) {
+                            channel->state   = CHANNEL_IDLE;
+                            channel->soundID = -1;
+                            break;
+                        }
+                        else {
+                            channel->bufferPos -= channel->sampleLength;
+                            channel->bufferPos += channel->loop;
+
+                            sfxBuffer = &channel->samplePtr[channel->bufferPos];
+                        }
+                    }
+                }
+
+                break;
+            }
+
+            case CHANNEL_STREAM: {
+                SAMPLE_FORMAT *streamBuffer = &channel->samplePtr[channel->bufferPos];
+
+                // somehow it can get here and not have any data to play, causing a crash. This should fix that
+                if (!streamBuffer)
+                    continue;
+
+                float volL = channel->volume, volR = channel->volume;
+                if (channel->pan < 0.0)
+                    volL = (1.0 + channel->pan) * channel->volume;
+                else
+                    volR = (1.0 - channel->pan) * channel->volume;
+
+                float panL = volL * engine.streamVolume;
+                float panR = volR * engine.streamVolume;
+
+                uint32 speedPercent       = 0;
+                SAMPLE_FORMAT *curStreamF = streamF;
+                while (curStreamF < streamEndF && streamF < streamEndF) {
+                    speedPercent += channel->speed;
+                    int32 next = FROM_FIXED(speedPercent);
+                    speedPercent &= 0xFFFF;
+
+                    curStreamF[0] += panR * *streamBuffer;
+                    curStreamF[1] += panL * streamBuffer[next];
+                    curStreamF += 2;
+
+                    streamBuffer += next * 2;
+                    channel->bufferPos += next * 2;
+
+                    if (channel->bufferPos >= channel->sampleLength) {
+                        channel->bufferPos -= channel->sampleLength;
+
+                        streamBuffer = &channel->samplePtr[channel->bufferPos];
+
+                        UpdateStreamBuffer(channel);
+                    }
+                }
+                break;
+            }
+
+            case CHANNEL_LOADING_STREAM: break;
+        }
+    }
+}
+
+#if RETRO_USE_INCREMENTAL_STREAMS
+// moves whatever's left in the window to the front & tops it up from the file, returns how many new bytes were read
+int32 FillStreamWindow()
+{
+    int32 remaining = streamWindowSize - streamWindowPos;
+    if (streamWindowPos)
+        memmove(streamWindow, &streamWindow[streamWindowPos], remaining);
+
+    streamWindowPos  = 0;
+    streamWindowSize = remaining;
+
+    int32 count = MIN(STREAM_WINDOW_SIZE - remaining, streamFile.fileSize - streamFile.readPos);
+    if (count <= 0)
+        return 0;
+
+    int32 bytesRead = (int32)ReadBytes(&streamFile, &streamWindow[remaining], count);
+    streamWindowSize += bytesRead;
+    return bytesRead;
+}
+
+bool32 OpenStreamPushdata()
+{
+    if (vorbisInfo) {
+        vorbis_deinit(vorbisInfo);
+        if (!vorbisInfo->alloc.alloc_buffer)
+            free(vorbisInfo);
+        vorbisInfo = NULL;
+    }
+
+    Seek_Set(&streamFile, 0);
+    streamWindowPos    = 0;
+    streamWindowSize   = 0;
+    streamFrameSamples = 0;
+    streamFramePos     = 0;
+
+    // keep feeding it more of the file until it's got all the headers
+    while (FillStreamWindow()) {
+        int32 used  = 0;
+        int32 error = 0;
+
+        vorbisInfo = stb_vorbis_open_pushdata(streamWindow, streamWindowSize, &used, &error, &vorbisAlloc);
+        if (vorbisInfo) {
+            streamWindowPos = used;
+            return true;
+        }
+
+        if (error != VORBIS_need_more_data)
+            break;
+    }
+
+    return false;
+}
+
+// decodes the next frame in the window, returns false once we've reached the end of the file
+bool32 DecodeStreamFrame()
+{
+    streamFrameSamples = 0;
+    streamFramePos     = 0;
+
+    if (!vorbisInfo)
+        return false;
+
+    while (true) {
+        int32 samples = 0;
+        int32 used    = stb_vorbis_decode_frame_pushdata(vorbisInfo, &streamWindow[streamWindowPos], streamWindowSize - streamWindowPos,
+                                                      &streamFrameChannels, &streamFrame, &samples);
+        streamWindowPos += used;
+
+        if (!used) {
+            if (!FillStreamWindow())
+                return false;
+        }
+        else if (samples) {
+            streamFrameSamples = samples;
+            return true;
+        }
+    }
+}
+
+// pushdata equivalent of stb_vorbis_get_samples_float_interleaved with 2 channels
+int32 ReadStreamSamples(float *buffer, int32 sampleCount)
+{
+    int32 samples = 0;
+
+    while (samples < sampleCount) {
+        if (streamFramePos >= streamFrameSamples && !DecodeStreamFrame())
+            break;
+
+        int32 count  = MIN(sampleCount - samples, streamFrameSamples - streamFramePos);
+        float *left  = &streamFrame[0][streamFramePos];
+        float *right = streamFrameChannels > 1 ? &streamFrame[1][streamFramePos] : NULL;
+
+        for (int32 s = 0; s < count; ++s) {
+            *buffer++ = left[s];
+            *buffer++ = right ? right[s] : 0.0f;
+        }
+
+        streamFramePos += count;
+        samples += count;
+    }
+
+    return samples;
+}
+
+// finds the page to resume decoding from to reach "sample", -1 means we need to start over from the top of the file
+int32 FindStreamPage(uint32 sample)
+{
+    if ((int32)sample == streamSeekSample)
+        return streamSeekOffset;
+
+    // the decoder skips the page we resume from & needs a packet to warm back up, so stay a couple pages behind the target
+    int32 pageOffsets[3] = { -1, -1, -1 };
+
+    uint8 header[27];
+    uint8 segments[0x100];
+
+    Seek_Set(&streamFile, 0);
+    while (ReadBytes(&streamFile, header, sizeof(header)) == sizeof(header) && !memcmp(header, "OggS", 4)) {
+        int32 pageOffset = streamFile.readPos - (int32)sizeof(header);
+
+        int64 granulePos = 0;
+        for (int32 b = 7; b >= 0; --b) granulePos = (granulePos << 8) | header[6 + b];
+
+        int32 bodySize = 0;
+        ReadBytes(&streamFile, segments, header[26]);
+        for (int32 s = 0; s < header[26]; ++s) bodySize += segments[s];
+
+        // headers have a granule position of 0, and -1 means no packets finish on this page
+        if (granulePos > 0) {
+            if (granulePos >= sample)
+                break;
+
+            pageOffsets[0] = pageOffsets[1];
+            pageOffsets[1] = pageOffsets[2];
+            pageOffsets[2] = pageOffset;
+        }
+
+        if (streamFile.readPos + bodySize >= streamFile.fileSize)
+            break;
+
+        Seek_Cur(&streamFile, bodySize);
+    }
+
+    streamSeekSample = (int32)sample;
+    streamSeekOffset = pageOffsets[0];
+    return streamSeekOffset;
+}
+
+bool32 SeekStreamPushdata(uint32 sample)
+{
+    int32 pageOffset = FindStreamPage(sample);
+
+    if (pageOffset < 0 || !vorbisInfo) {
+        if (!OpenStreamPushdata())
+            return false;
+    }
+    else {
+        stb_vorbis_flush_pushdata(vorbisInfo);
+
+        Seek_Set(&streamFile, pageOffset);
+        streamWindowPos  = 0;
+        streamWindowSize = 0;
+    }
+
+    // pushdata can't seek by itself, so decode (and throw away) frames until we reach the one holding "sample"
+    while (DecodeStreamFrame()) {
+        if (!vorbisInfo->current_loc_valid)
+            continue;
+
+        uint32 frameEnd = vorbisInfo->current_loc;
+        if (frameEnd > sample) {
+            uint32 frameStart = frameEnd - streamFrameSamples;
+            streamFramePos    = sample > frameStart ? sample - frameStart : 0;
+            return true;
+        }
+    }
+
+    return false;
+}
+#endif
+
+inline int32 GetStreamSamples(float *buffer, int32 count)
+{
+#if RETRO_USE_INCREMENTAL_STREAMS
+    if (streamPushdata)
+        return ReadStreamSamples(buffer, count / 2) * 2;
+#endif
+
+    return stb_vorbis_get_samples_float_interleaved(vorbisInfo, 2, buffer, count) * 2;
+}
+
+inline bool32 SeekStreamLoop()
+{
+#if RETRO_USE_INCREMENTAL_STREAMS
+    if (streamPushdata)
+        return SeekStreamPushdata(streamLoopPoint);
+#endif
+
+    return stb_vorbis_seek_frame(vorbisInfo, streamLoopPoint);
+}
+
+// fills a MIX_BUFFER_SIZE buffer with stream samples, returns false if the stream ended and isn't looping
+bool32 DecodeStreamSamples(float *samplePtr, bool32 loop)
 {
-    int32 bufferRemaining = 0x800;
-    float *buffer         = channel->samplePtr;
+    bool32 playing        = true;
+    int32 bufferRemaining = MIX_BUFFER_SIZE;
+    float *buffer         = samplePtr;
 
-    for (int32 s = 0; s < 0x800;) {
-        int32 samples = stb_vorbis_get_samples_float_interleaved(vorbisInfo, 2, buffer, bufferRemaining) * 2;
+    for (int32 s = 0; s < MIX_BUFFER_SIZE;) {
+        int32 samples = GetStreamSamples(buffer, bufferRemaining);
         if (!samples) {
-            if (channel->loop == 1 && stb_vorbis_seek_frame(vorbisInfo, streamLoopPoint)) {
+            if (loop && SeekStreamLoop()) {
                 // we're looping & the seek was successful, get more samples
             }
             else {
-                channel->state   = CHANNEL_IDLE;
-                channel->soundID = -1;
+                playing = false;
                 memset(buffer, 0, sizeof(float) * bufferRemaining);
 
                 break;
@@ -62,17 +441,113 @@ void RSDK::UpdateStreamBuffer(ChannelInfo *channel)
 
         s += samples;
         buffer += samples;
-        bufferRemaining = 0x800 - s;
+        bufferRemaining = MIX_BUFFER_SIZE - s;
     }
 
-    for (int32 i = 0; i < 0x800; i += 4) {
-        float *sampleBuffer = &channel->samplePtr[i];
+    for (int32 i = 0; i < MIX_BUFFER_SIZE; i += 4) {
+        float *sampleBuffer = &samplePtr[i];
 
         sampleBuffer[0] = sampleBuffer[0] * 0.5;
         sampleBuffer[1] = sampleBuffer[1] * 0.5;
         sampleBuffer[2] = sampleBuffer[2] * 0.5;
         sampleBuffer[3] = sampleBuffer[3] * 0.5;
     }
+
+    return playing;
+}
+
+#if RETRO_USE_THREADED_STREAMS
+void DecodeStreamBlock(StreamBlock *block)
+{
+    block->finished = !DecodeStreamSamples(block->samples, streamLooping);
+    block->loc      = vorbisInfo ? vorbisInfo->current_loc : 0;
+    block->locValid = vorbisInfo ? vorbisInfo->current_loc_valid : false;
+
+    if (block->finished)
+        streamDecoding = false;
+}
+
+void StreamDecoderThread()
+{
+    std::unique_lock<std::mutex> lock(streamDecoderMutex);
+
+    while (!streamDecoderQuit) {
+        uint32 writeBlock = streamWriteBlock.load(std::memory_order_relaxed);
+
+        if (!streamDecoding || writeBlock - streamReadBlock.load(std::memory_order_acquire) >= STREAM_BLOCK_COUNT) {
+            // the mixer signals us whenever it frees up a block, the timeout only covers a signal landing before we started waiting
+            streamDecoderSignal.wait_for(lock, std::chrono::milliseconds(10));
+            continue;
+        }
+
+        DecodeStreamBlock(&streamBlocks[writeBlock % STREAM_BLOCK_COUNT]);
+        streamWriteBlock.store(writeBlock + 1, std::memory_order_release);
+    }
+}
+
+void RSDK::ReleaseStreamDecoder()
+{
+    if (streamDecoderThread.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(streamDecoderMutex);
+            streamDecoderQuit = true;
+            streamDecoding    = false;
+        }
+
+        streamDecoderSignal.notify_all();
+        streamDecoderThread.join();
+    }
+
+#if RETRO_USE_INCREMENTAL_STREAMS
+    if (streamFile.file)
+        CloseFile(&streamFile);
+    streamPushdata = false;
+#endif
+}
+#endif
+
+void RSDK::UpdateStreamBuffer(ChannelInfo *channel)
+{
+#if RETRO_USE_THREADED_STREAMS
+    // runs on the audio thread, so all we do here is copy out whatever the decoder has ready
+    uint32 readBlock = streamReadBlock.load(std::memory_order_relaxed);
+#if RETRO_AUDIODEVICE_NULL
+    if (readBlock == streamWriteBlock.load(std::memory_order_acquire)) {
+        // offline rendering has no deadline to keep, so decode the block here instead of dropping it (keeps the output deterministic)
+        std::lock_guard<std::mutex> lock(streamDecoderMutex);
+
+        uint32 writeBlock = streamWriteBlock.load(std::memory_order_relaxed);
+        if (readBlock == writeBlock && streamDecoding) {
+            DecodeStreamBlock(&streamBlocks[writeBlock % STREAM_BLOCK_COUNT]);
+            streamWriteBlock.store(writeBlock + 1, std::memory_order_release);
+        }
+    }
+#endif
+    if (readBlock == streamWriteBlock.load(std::memory_order_acquire)) {
+        // the decoder fell behind, play silence for this block rather than stall the device
+        memset(channel->samplePtr, 0, MIX_BUFFER_SIZE * sizeof(SAMPLE_FORMAT));
+        return;
+    }
+
+    StreamBlock *block = &streamBlocks[readBlock % STREAM_BLOCK_COUNT];
+    memcpy(channel->samplePtr, block->samples, MIX_BUFFER_SIZE * sizeof(SAMPLE_FORMAT));
+    streamPlayLoc      = block->loc;
+    streamPlayLocValid = block->locValid;
+
+    if (block->finished) {
+        channel->state   = CHANNEL_IDLE;
+        channel->soundID = -1;
+    }
+
+    // LoadStream may have restarted the ring underneath us, in which case the block we just read is stale anyways
+    if (streamReadBlock.compare_exchange_strong(readBlock, readBlock + 1))
+        streamDecoderSignal.notify_one();
+#else
+    if (!DecodeStreamSamples(channel->samplePtr, channel->loop == 1)) {
+        channel->state   = CHANNEL_IDLE;
+        channel->soundID = -1;
+    }
+#endif
 }
 
 void RSDK::LoadStream(ChannelInfo *channel)
@@ -80,16 +555,69 @@ void RSDK::LoadStream(ChannelInfo *channel)
     if (channel->state != CHANNEL_LOADING_STREAM)
         return;
 
+#if RETRO_USE_THREADED_STREAMS
+    // keeps the decoder thread away from vorbisInfo while we swap it out
+    std::lock_guard<std::mutex> lock(streamDecoderMutex);
+    streamDecoding = false;
+
+    if (!streamDecoderThread.joinable()) {
+        streamDecoderQuit   = false;
+        streamDecoderThread = std::thread(StreamDecoderThread);
+    }
+#endif
+
     if (vorbisInfo) {
         vorbis_deinit(vorbisInfo);
         if (!vorbisInfo->alloc.alloc_buffer)
             free(vorbisInfo);
     }
+    vorbisInfo = NULL;
+
+#if RETRO_USE_INCREMENTAL_STREAMS
+    if (streamFile.file)
+        CloseFile(&streamFile);
+    streamPushdata = false;
+#endif
 
     FileInfo info;
     InitFileInfo(&info);
 
     if (LoadFile(&info, streamFilePath, FMODE_RB)) {
+#if RETRO_USE_INCREMENTAL_STREAMS
+        if (info.fileSize > 0) {
+            vorbisAlloc.alloc_buffer_length_in_bytes = 0x80000;
+            AllocateStorage((void **)&vorbisAlloc, 0x80000, DATASET_MUS, false);
+        }
+
+        if (info.usingFileBuffer && !info.encrypted) {
+            // the datapack is already sitting in memory, so decode straight out of it
+            streamBufferSize = info.fileSize;
+            streamBuffer     = info.fileBuffer;
+            CloseFile(&info);
+
+            if (streamBufferSize > 0) {
+                vorbisInfo = stb_vorbis_open_memory(streamBuffer, streamBufferSize, NULL, &vorbisAlloc);
+                if (vorbisInfo && streamStartPos)
+                    stb_vorbis_seek(vorbisInfo, streamStartPos);
+            }
+        }
+        else if (info.fileSize > 0) {
+            // only a small window of the file is kept in memory, the rest is read in as the decoder needs it
+            memcpy(&streamFile, &info, sizeof(FileInfo));
+            streamPushdata   = true;
+            streamSeekSample = -1;
+            streamSeekOffset = -1;
+
+            streamWindow = NULL;
+            AllocateStorage((void **)&streamWindow, STREAM_WINDOW_SIZE, DATASET_MUS, false);
+
+            if (streamWindow && OpenStreamPushdata() && streamStartPos)
+                SeekStreamPushdata(streamStartPos);
+        }
+        else {
+            CloseFile(&info);
+        }
+#else
         streamBufferSize = info.fileSize;
         streamBuffer     = NULL;
         AllocateStorage((void **)&streamBuffer, info.fileSize, DATASET_MUS, false);
@@ -101,13 +629,26 @@ void RSDK::LoadStream(ChannelInfo *channel)
             AllocateStorage((void **)&vorbisAlloc, 0x80000, DATASET_MUS, false);
 
             vorbisInfo = stb_vorbis_open_memory(streamBuffer, streamBufferSize, NULL, &vorbisAlloc);
-            if (vorbisInfo) {
-                if (streamStartPos)
-                    stb_vorbis_seek(vorbisInfo, streamStartPos);
-                UpdateStreamBuffer(channel);
+            if (vorbisInfo && streamStartPos)
+                stb_vorbis_seek(vorbisInfo, streamStartPos);
+        }
+#endif
 
-                channel->state = CHANNEL_STREAM;
-            }
+        if (vorbisInfo) {
+#if RETRO_USE_THREADED_STREAMS
+            // drop anything left over from the last stream & decode the first block here so playback can start right away
+            uint32 writeBlock = streamWriteBlock.load(std::memory_order_relaxed);
+            streamReadBlock.store(writeBlock, std::memory_order_release);
+
+            streamLooping  = channel->loop == 1;
+            streamDecoding = true;
+            DecodeStreamBlock(&streamBlocks[writeBlock % STREAM_BLOCK_COUNT]);
+            streamWriteBlock.store(writeBlock + 1, std::memory_order_release);
+#endif
+
+            UpdateStreamBuffer(channel);
+
+            channel->state = CHANNEL_STREAM;
         }
     }
 
@@ -147,6 +688,12 @@ int32 RSDK::PlayStream(const char *filename, uint32 slot, int32 startPos, uint32
 
     LockAudioDevice();
 
+#if RETRO_USE_SFX_LOOKUP
+    if (channel->soundID >= 0 && channel->soundID < SFX_COUNT)
+        sfxChannelMask[channel->soundID] &= ~(1 << slot);
+    sfxChannelMask[0xFF] |= 1 << slot;
+#endif
+
     channel->soundID      = 0xFF;
     channel->loop         = loopPoint != 0;
     channel->priority     = 0xFF;
@@ -157,6 +704,9 @@ int32 RSDK::PlayStream(const char *filename, uint32 slot, int32 startPos, uint32
     channel->samplePtr    = sfxList[SFX_COUNT - 1].buffer;
     channel->bufferPos    = 0;
     channel->speed        = TO_FIXED(1);
+#if RETRO_USE_SFX_CACHE
+    channel->cacheSpeed = 0;
+#endif
 
     sprintf_s(streamFilePath, (int32)sizeof(streamFilePath), "Data/Music/%s", filename);
     streamStartPos  = startPos;
@@ -218,6 +768,9 @@ void RSDK::ReadSfx(char *filename, uint8 id, uint8 plays, uint8 scope, uint32 *s
             if (sampleBits == 16)
                 length >>= 1;
 
+#if RETRO_USE_SFX_CACHE
+            CancelSfxCacheBuilds();
+#endif
             AllocateStorage((void **)&sfxList[id].buffer, sizeof(float) * length, DATASET_SFX, false);
             sfxList[id].length = length;
 
@@ -273,22 +826,324 @@ void RSDK::LoadSfx(char *filename, uint8 plays, uint8 scope)
         uint32 format   = 0;
         uint32 size     = 0;
         ReadSfx(fullFilePath, id, plays, scope, &size, &format, &channels, &freq);
+#if RETRO_USE_SFX_LOOKUP
+        AddSfxLookup(id);
+#endif
     }
     else {
         // what the
         PrintLog(PRINT_ERROR, "Sfx format not supported!");
     }
 }
+
+#if RETRO_USE_SFX_LOOKUP
+void RSDK::AddSfxLookup(uint16 sfx)
+{
+    uint32 entry = sfxList[sfx].hash[0] & (SFX_LOOKUP_SIZE - 1);
+    for (int32 i = 0; i < SFX_LOOKUP_SIZE; ++i) {
+        if (!sfxLookup[entry]) {
+            sfxLookup[entry] = sfx + 1;
+            return;
+        }
+
+        if (HASH_MATCH_MD5(sfxList[sfxLookup[entry] - 1].hash, sfxList[sfx].hash)) {
+            // if the same sfx is loaded twice, GetSfx has always returned the lowest slot
+            if (sfx < sfxLookup[entry] - 1)
+                sfxLookup[entry] = sfx + 1;
+            return;
+        }
+
+        entry = (entry + 1) & (SFX_LOOKUP_SIZE - 1);
+    }
+}
+
+void RSDK::RefreshSfxLookup()
+{
+    memset(sfxLookup, 0, sizeof(sfxLookup));
+
+    for (int32 s = 0; s < SFX_COUNT; ++s) {
+        if (sfxList[s].scope != SCOPE_NONE)
+            AddSfxLookup(s);
+    }
+}
+
+uint16 RSDK::GetSfx(const char *sfxName)
+{
+    RETRO_HASH_MD5(hash);
+    GEN_HASH_MD5(sfxName, hash);
+
+    uint32 entry = hash[0] & (SFX_LOOKUP_SIZE - 1);
+    for (int32 i = 0; i < SFX_LOOKUP_SIZE && sfxLookup[entry]; ++i) {
+        if (HASH_MATCH_MD5(sfxList[sfxLookup[entry] - 1].hash, hash))
+            return sfxLookup[entry] - 1;
+
+        entry = (entry + 1) & (SFX_LOOKUP_SIZE - 1);
+    }
+
+    return -1;
+}
+#endif
+#if RETRO_USE_SFX_CACHE
+// points a channel back at the original sfx buffer, converting its position back to the original sample rate
+void UncacheChannel(ChannelInfo *channel)
+{
+    if (!channel->cacheSpeed)
+        return;
+
+    // the mixer clears soundID once an sfx finishes, there's nothing left to point back at
+    if (channel->soundID < 0 || channel->soundID >= SFX_COUNT) {
+        channel->cacheSpeed = 0;
+        return;
+    }
+
+    channel->bufferPos = (int32)(((int64)channel->bufferPos * channel->cacheSpeed) >> 16);
+    if (channel->loop != 0xFFFFFFFF)
+        channel->loop = (uint32)(((uint64)channel->loop * channel->cacheSpeed) >> 16);
+
+    channel->samplePtr    = sfxList[channel->soundID].buffer;
+    channel->sampleLength = sfxList[channel->soundID].length;
+    channel->speed        = channel->cacheSpeed;
+    channel->cacheSpeed   = 0;
+}
+
+inline uint8 GetSfxCacheState(SFXCacheEntry *entry)
+{
+    std::lock_guard<std::mutex> lock(sfxCacheMutex);
+    return entry->state;
+}
+
+void RemoveSfxCacheEntry(SFXCacheEntry *entry, bool32 lockAudio)
+{
+    uint8 state = SFXCACHE_UNBUILT;
+    {
+        // wait for the cache thread to be done with it, then make sure it won't pick it up again
+        std::unique_lock<std::mutex> lock(sfxCacheMutex);
+        while (entry->state == SFXCACHE_BUILDING) sfxCacheSignal.wait(lock);
+
+        state        = entry->state;
+        entry->state = SFXCACHE_UNBUILT;
+    }
+
+    if (entry->buffer) {
+        // anything still playing the resampled buffer has to go back to resampling it in the mixer
+        if (state == SFXCACHE_READY) {
+            if (lockAudio)
+                LockAudioDevice();
+
+            for (int32 c = 0; c < CHANNEL_COUNT; ++c) {
+                if (channels[c].cacheSpeed && channels[c].samplePtr == entry->buffer)
+                    UncacheChannel(&channels[c]);
+            }
+
+            if (lockAudio)
+                UnlockAudioDevice();
+        }
+
+        sfxCacheUsage -= entry->length * sizeof(float);
+        RemoveStorageEntry((void **)&entry->buffer);
+    }
+
+    MEM_ZERO(*entry);
+}
+
+// same interpolation the mixer uses, just done once up front
+void ResampleSfx(float *dst, size_t length, float *src, size_t srcLength, int32 speed)
+{
+    uint64 position = 0;
+    for (size_t i = 0; i < length; ++i) {
+        size_t s   = (size_t)(position >> 16);
+        float next = s + 1 < srcLength ? src[s + 1] : src[s];
+
+        dst[i] = (next - src[s]) * speedMixAmounts[(position & 0xFFFF) >> 6] + src[s];
+        position += speed;
+    }
+}
+
+void SfxCacheThread()
+{
+    std::unique_lock<std::mutex> lock(sfxCacheMutex);
+
+    while (!sfxCacheQuit) {
+        SFXCacheEntry *entry = NULL;
+        for (int32 e = 0; e < SFXCACHE_COUNT && !entry; ++e) {
+            if (sfxCache[e].state == SFXCACHE_QUEUED)
+                entry = &sfxCache[e];
+        }
+
+        if (!entry) {
+            sfxCacheSignal.wait(lock);
+            continue;
+        }
+
+        // nothing can move or free either buffer while it's building, so the lock isn't needed for the resampling itself
+        SFXInfo *sfx = &sfxList[entry->sfx];
+        entry->state = SFXCACHE_BUILDING;
+        lock.unlock();
+
+        ResampleSfx(entry->buffer, entry->length, sfx->buffer, sfx->length, entry->speed);
+
+        lock.lock();
+        entry->state = SFXCACHE_READY;
+        sfxCacheSignal.notify_all();
+    }
+}
+
+// allocates the entry's buffer & hands it off to the cache thread, the sfx keeps being resampled in the mixer until it's done
+bool32 QueueSfxCacheEntry(SFXCacheEntry *entry)
+{
+    SFXInfo *sfx  = &sfxList[entry->sfx];
+    size_t length = (size_t)(((uint64)sfx->length << 16) / entry->speed);
+    size_t size   = length * sizeof(float);
+    if (!sfx->buffer || !length || size > SFXCACHE_LIMIT)
+        return false;
+
+    // make room by evicting the least recently used buffers (ones that are still being built have to be left alone)
+    while (sfxCacheUsage + size > SFXCACHE_LIMIT) {
+        SFXCacheEntry *oldest = NULL;
+        for (int32 e = 0; e < SFXCACHE_COUNT; ++e) {
+            if (sfxCache[e].buffer && (!oldest || sfxCache[e].lastUsed < oldest->lastUsed) && GetSfxCacheState(&sfxCache[e]) == SFXCACHE_READY)
+                oldest = &sfxCache[e];
+        }
+
+        if (!oldest)
+            return false;
+
+        RemoveSfxCacheEntry(oldest, true);
+    }
+
+    // don't let the allocation clear unused storage, that'd move sfx buffers out from under the mixer while they're playing
+    AllocateStorage((void **)&entry->buffer, (uint32)size, DATASET_SFX, false, false);
+    if (!entry->buffer)
+        return false;
+
+    entry->length = length;
+    sfxCacheUsage += size;
+
+    {
+        std::lock_guard<std::mutex> lock(sfxCacheMutex);
+        entry->state = SFXCACHE_QUEUED;
+
+        if (!sfxCacheThread.joinable()) {
+            sfxCacheQuit   = false;
+            sfxCacheThread = std::thread(SfxCacheThread);
+        }
+    }
+
+    sfxCacheSignal.notify_all();
+    return true;
+}
+
+SFXCacheEntry *GetSfxCacheEntry(uint16 sfx, int32 speed)
+{
+    SFXCacheEntry *entry = NULL;
+    for (int32 e = 0; e < SFXCACHE_COUNT; ++e) {
+        if (sfxCache[e].uses && sfxCache[e].sfx == sfx && sfxCache[e].speed == speed) {
+            entry = &sfxCache[e];
+            break;
+        }
+    }
+
+#if RETRO_AUDIODEVICE_NULL
+    // offline rendering has no deadline to keep, so wait on the cache thread instead of letting its timing decide which buffer gets mixed
+    if (entry) {
+        std::unique_lock<std::mutex> lock(sfxCacheMutex);
+        while (entry->state == SFXCACHE_QUEUED || entry->state == SFXCACHE_BUILDING) sfxCacheSignal.wait(lock);
+    }
+#endif
+
+    uint8 state = entry ? GetSfxCacheState(entry) : SFXCACHE_UNBUILT;
+    if (state == SFXCACHE_READY) {
+        entry->lastUsed = ++sfxCacheTimer;
+        ++sfxCacheHits;
+        return entry;
+    }
+
+    ++sfxCacheMisses;
+
+    if (!entry) {
+        // take a free slot, or failing that the least recently used one that isn't waiting on the cache thread
+        for (int32 e = 0; e < SFXCACHE_COUNT; ++e) {
+            if (!sfxCache[e].uses) {
+                entry = &sfxCache[e];
+                break;
+            }
+
+            if (!entry || sfxCache[e].lastUsed < entry->lastUsed) {
+                uint8 slotState = GetSfxCacheState(&sfxCache[e]);
+                if (slotState != SFXCACHE_QUEUED && slotState != SFXCACHE_BUILDING)
+                    entry = &sfxCache[e];
+            }
+        }
+
+        if (!entry)
+            return NULL;
+
+        RemoveSfxCacheEntry(entry, true);
+        entry->sfx   = sfx;
+        entry->speed = speed;
+    }
+
+    entry->lastUsed = ++sfxCacheTimer;
+    if (entry->uses < 2)
+        entry->uses++;
+
+    // one-off speeds aren't worth resampling the whole sfx for
+    if (entry->uses >= 2 && state == SFXCACHE_UNBUILT)
+        QueueSfxCacheEntry(entry);
+
+    return NULL;
+}
+
+// loading or unloading sfx can move or free the buffers the cache thread works with, so anything it's yet to finish gets dropped first
+void RSDK::CancelSfxCacheBuilds()
+{
+    for (int32 e = 0; e < SFXCACHE_COUNT; ++e) {
+        uint8 state = GetSfxCacheState(&sfxCache[e]);
+        if (state == SFXCACHE_QUEUED || state == SFXCACHE_BUILDING)
+            RemoveSfxCacheEntry(&sfxCache[e], false);
+    }
+}
+
+void RSDK::ReleaseSfxCache()
+{
+    if (sfxCacheThread.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(sfxCacheMutex);
+            sfxCacheQuit = true;
+        }
+
+        sfxCacheSignal.notify_all();
+        sfxCacheThread.join();
+    }
+}
+
+void ClearSfxCache(uint8 scope)
+{
+    for (int32 e = 0; e < SFXCACHE_COUNT; ++e) {
+        if (sfxCache[e].uses && sfxList[sfxCache[e].sfx].scope == scope)
+            RemoveSfxCacheEntry(&sfxCache[e], false);
+    }
+}
+#endif
+
 int32 RSDK::PlaySfx(uint16 sfx, uint32 loopPoint, uint32 priority)
 {
     if (sfx >= SFX_COUNT || !sfxList[sfx].scope)
         return -1;
 
     uint8 count = 0;
+#if RETRO_USE_SFX_LOOKUP
+    uint16 mask = sfxChannelMask[sfx];
+    for (int32 c = 0; mask; ++c, mask >>= 1) {
+        if ((mask & 1) && channels[c].soundID == sfx)
+            ++count;
+    }
+#else
     for (int32 c = 0; c < CHANNEL_COUNT; ++c) {
         if (channels[c].soundID == sfx)
             ++count;
     }
+#endif
 
     int8 slot = -1;
     // if we've hit the max, replace the oldest one
@@ -327,6 +1182,12 @@ int32 RSDK::PlaySfx(uint16 sfx, uint32 loopPoint, uint32 priority)
 
     LockAudioDevice();
 
+#if RETRO_USE_SFX_LOOKUP
+    if (channels[slot].soundID >= 0 && channels[slot].soundID < SFX_COUNT)
+        sfxChannelMask[channels[slot].soundID] &= ~(1 << slot);
+    sfxChannelMask[sfx] |= 1 << slot;
+#endif
+
     channels[slot].state        = CHANNEL_SFX;
     channels[slot].bufferPos    = 0;
     channels[slot].samplePtr    = sfxList[sfx].buffer;
@@ -334,6 +1195,9 @@ int32 RSDK::PlaySfx(uint16 sfx, uint32 loopPoint, uint32 priority)
     channels[slot].volume       = 1.0;
     channels[slot].pan          = 0.0;
     channels[slot].speed        = TO_FIXED(1);
+#if RETRO_USE_SFX_CACHE
+    channels[slot].cacheSpeed = 0;
+#endif
     channels[slot].soundID      = sfx;
     if (loopPoint >= 2)
         channels[slot].loop = loopPoint;
@@ -358,6 +1222,41 @@ void RSDK::SetChannelAttributes(uint8 channel, float volume, float panning, floa
         panning               = fmaxf(-1.0f, panning);
         channels[channel].pan = panning;
 
+#if RETRO_USE_SFX_CACHE
+        ChannelInfo *channelPtr = &channels[channel];
+        if ((channelPtr->state & 0x3F) == CHANNEL_SFX && speed > 0.0) {
+            int32 newSpeed = (int32)(speed * 65536.0f);
+            int32 curSpeed = channelPtr->cacheSpeed ? channelPtr->cacheSpeed : channelPtr->speed;
+
+            if (newSpeed != curSpeed) {
+                // only sfx that are pitched straight after being played are cached, ones that get pitched mid-play tend to change speed every frame
+                SFXCacheEntry *entry = NULL;
+                if (curSpeed == TO_FIXED(1) && newSpeed != TO_FIXED(1))
+                    entry = GetSfxCacheEntry(channelPtr->soundID, newSpeed);
+
+                LockAudioDevice();
+
+                UncacheChannel(channelPtr);
+                channelPtr->speed = newSpeed;
+
+                if (entry) {
+                    channelPtr->bufferPos = (int32)(((int64)channelPtr->bufferPos << 16) / newSpeed);
+                    if (channelPtr->loop != 0xFFFFFFFF)
+                        channelPtr->loop = (uint32)(((uint64)channelPtr->loop << 16) / newSpeed);
+
+                    channelPtr->samplePtr    = entry->buffer;
+                    channelPtr->sampleLength = entry->length;
+                    channelPtr->speed        = TO_FIXED(1);
+                    channelPtr->cacheSpeed   = newSpeed;
+                }
+
+                UnlockAudioDevice();
+            }
+
+            return;
+        }
+#endif
+
         if (speed > 0.0)
             channels[channel].speed = (int32)(speed * 65536.0f);
         else if (speed == 1.0)
@@ -365,19 +1264,41 @@ void RSDK::SetChannelAttributes(uint8 channel, float volume, float panning, floa
     }
 }
 
+#if RETRO_USE_THREADED_STREAMS
+// streamPlayLoc is where the decoder was once the block being played was filled,
+// so the part of that block the mixer hasn't got through yet needs taking back off to get where playback actually is
+inline int32 GetStreamPlayhead(ChannelInfo *channel)
+{
+    int32 unplayed = (channel->sampleLength - channel->bufferPos) / 2; // the block is interleaved stereo, streamPlayLoc is in frames
+    int32 loc      = (int32)streamPlayLoc - unplayed;
+    return loc > 0 ? loc : 0;
+}
+#endif
+
 uint32 RSDK::GetChannelPos(uint32 channel)
 {
     if (channel >= CHANNEL_COUNT)
         return 0;
 
-    if (channels[channel].state == CHANNEL_SFX)
+    if (channels[channel].state == CHANNEL_SFX) {
+#if RETRO_USE_SFX_CACHE
+        // report the position in the original sfx, not the resampled one
+        if (channels[channel].cacheSpeed)
+            return (uint32)(((int64)channels[channel].bufferPos * channels[channel].cacheSpeed) >> 16);
+#endif
         return channels[channel].bufferPos;
+    }
 
     if (channels[channel].state == CHANNEL_STREAM) {
+#if RETRO_USE_THREADED_STREAMS
+        // vorbisInfo is ahead of playback by however much the decoder has buffered, so go off the block being played instead
+        return streamPlayLocValid ? GetStreamPlayhead(&channels[channel]) : 0;
+#else
         if (!vorbisInfo->current_loc_valid || vorbisInfo->current_loc < 0)
             return 0;
 
         return vorbisInfo->current_loc;
+#endif
     }
 
     return 0;
@@ -385,9 +1306,15 @@ uint32 RSDK::GetChannelPos(uint32 channel)
 
 double RSDK::GetVideoStreamPos()
 {
+#if RETRO_USE_THREADED_STREAMS
+    if (channels[0].state == CHANNEL_STREAM && AudioDevice::audioState && AudioDevice::initializedAudioChannels && streamPlayLocValid) {
+        return GetStreamPlayhead(&channels[0]) / (float)AUDIO_FREQUENCY;
+    }
+#else
     if (channels[0].state == CHANNEL_STREAM && AudioDevice::audioState && AudioDevice::initializedAudioChannels && vorbisInfo->current_loc_valid) {
         return vorbisInfo->current_loc / (float)AUDIO_FREQUENCY;
     }
+#endif
 
     return -1.0;
 }
@@ -403,6 +1330,11 @@ void RSDK::ClearStageSfx()
         }
     }
 
+#if RETRO_USE_SFX_CACHE
+    CancelSfxCacheBuilds();
+    ClearSfxCache(SCOPE_STAGE);
+#endif
+
     // Unload stage SFX
     for (int32 s = 0; s < SFX_COUNT; ++s) {
         if (sfxList[s].scope >= SCOPE_STAGE) {
@@ -411,6 +1343,10 @@ void RSDK::ClearStageSfx()
         }
     }
 
+#if RETRO_USE_SFX_LOOKUP
+    RefreshSfxLookup();
+#endif
+
     UnlockAudioDevice();
 }
 
@@ -426,6 +1362,11 @@ void RSDK::ClearGlobalSfx()
         }
     }
 
+#if RETRO_USE_SFX_CACHE
+    CancelSfxCacheBuilds();
+    ClearSfxCache(SCOPE_GLOBAL);
+#endif
+
     // Unload global SFX
     for (int32 s = 0; s < SFX_COUNT; ++s) {
         // clear global sfx (do NOT clear the stream channel 0 slot)
@@ -435,6 +1376,10 @@ void RSDK::ClearGlobalSfx()
         }
     }
 
+#if RETRO_USE_SFX_LOOKUP
+    RefreshSfxLookup();
+#endif
+
     UnlockAudioDevice();
 }
 #endif
\ No newline at end of file
@@ -34,13 +34,89 @@ struct ChannelInfo {
     int16 soundID;
     uint8 priority;
     uint8 state;
+#if RETRO_USE_SFX_CACHE
+    int32 cacheSpeed; // the speed samplePtr was resampled at, 0 if it's pointing at the original sfx buffer
+#endif
 };
 
 enum ChannelStates { CHANNEL_IDLE, CHANNEL_SFX, CHANNEL_STREAM, CHANNEL_LOADING_STREAM, CHANNEL_PAUSED = 0x40 };
 
+#if RETRO_USE_SFX_CACHE
+#define SFXCACHE_COUNT (0x20)
+// the most sfx memory the cache is allowed to use, the rest is left for LoadSfx
+#define SFXCACHE_LIMIT (8 * 0x100000)
+
+enum SFXCacheStates { SFXCACHE_UNBUILT, SFXCACHE_QUEUED, SFXCACHE_BUILDING, SFXCACHE_READY };
+
+struct SFXCacheEntry {
+    float *buffer;
+    size_t length;
+    int32 speed;
+    uint32 lastUsed;
+    uint16 sfx;
+    uint16 uses; // the buffer is only built once the same sfx & speed has been requested more than once
+    uint8 state; // the buffer is resampled on the sfx cache thread, so it can't be played until this reaches SFXCACHE_READY
+};
+
+extern SFXCacheEntry sfxCache[SFXCACHE_COUNT];
+extern uint32 sfxCacheHits;
+extern uint32 sfxCacheMisses;
+
+// mixes an sfx channel that's playing at 1.0 speed (either the original sfx, or a copy the cache has already resampled), no interpolation needed
+inline void MixUnresampledSfx(ChannelInfo *channel, SAMPLE_FORMAT *stream, SAMPLE_FORMAT *streamEnd, float panL, float panR)
+{
+    SAMPLE_FORMAT *sfxBuffer = &channel->samplePtr[channel->bufferPos];
+
+    while (stream < streamEnd) {
+        stream[0] += *sfxBuffer * panR;
+        stream[1] += *sfxBuffer * panL;
+        stream += 2;
+
+        ++sfxBuffer;
+        if (++channel->bufferPos >= channel->sampleLength) {
+            if (channel->loop == 0xFFFFFFFF) {
+                channel->state   = CHANNEL_IDLE;
+                channel->soundID = -1;
+                break;
+            }
+            else {
+                channel->bufferPos -= channel->sampleLength;
+                channel->bufferPos += channel->loop;
+
+                sfxBuffer = &channel->samplePtr[channel->bufferPos];
+            }
+        }
+    }
+}
+#endif
+
+#if RETRO_USE_THREADED_STREAMS
+// the decoder thread can run this many MIX_BUFFER_SIZE blocks ahead of the mixer (0x10 blocks ~= 370ms)
+#define STREAM_BLOCK_COUNT (0x10)
+
+struct StreamBlock {
+    SAMPLE_FORMAT samples[MIX_BUFFER_SIZE];
+    uint32 loc; // decoder position after filling this block
+    bool32 locValid;
+    bool32 finished;
+};
+#endif
+
+#if RETRO_USE_INCREMENTAL_STREAMS
+// the window music files are read through, this needs to fit the largest possible ogg page (~64KB)
+#define STREAM_WINDOW_SIZE (0x20000)
+#endif
+
 extern SFXInfo sfxList[SFX_COUNT];
 extern ChannelInfo channels[CHANNEL_COUNT];
 
+#if RETRO_USE_SFX_LOOKUP
+#define SFX_LOOKUP_SIZE (SFX_COUNT * 2)
+
+// a bit for every channel an sfx has been played on since, cleared lazily so channels that have moved on still need their soundID checked
+extern uint16 sfxChannelMask[SFX_COUNT];
+#endif
+
 class AudioDeviceBase
 {
 public:
@@ -60,6 +136,10 @@ public:
     static int32 mixBufferID;
     static SAMPLE_FORMAT mixBuffer[3][MIX_BUFFER_SIZE];
 
+protected:
+    // mixes every active channel into stream (which should already be cleared), the device should be locked while this runs
+    static void MixChannels(SAMPLE_FORMAT *stream, int32 length);
+
 private:
     static void InitAudioChannels();
     static void InitMixBuffer();
@@ -67,11 +147,24 @@ private:
 
 void UpdateStreamBuffer(ChannelInfo *channel);
 void LoadStream(ChannelInfo *channel);
+#if RETRO_USE_THREADED_STREAMS
+void ReleaseStreamDecoder();
+#endif
+#if RETRO_USE_SFX_CACHE
+void CancelSfxCacheBuilds();
+void ReleaseSfxCache();
+#endif
 int32 PlayStream(const char *filename, uint32 slot, int32 startPos, uint32 loopPoint, bool32 loadASync);
 
 void ReadSfx(char *filename, uint8 id, uint8 plays, uint8 scope, uint32 *size, uint32 *format, uint16 *channels, uint32 *freq);
 void LoadSfx(char *filePath, uint8 plays, uint8 scope);
 
+#if RETRO_USE_SFX_LOOKUP
+void AddSfxLookup(uint16 sfx);
+void RefreshSfxLookup();
+
+uint16 GetSfx(const char *sfxName);
+#else
 inline uint16 GetSfx(const char *sfxName)
 {
     RETRO_HASH_MD5(hash);
@@ -84,9 +177,26 @@ inline uint16 GetSfx(const char *sfxName)
 
     return -1;
 }
+#endif
 int32 PlaySfx(uint16 sfx, uint32 loopPoint, uint32 priority);
 inline void StopSfx(int32 sfx)
 {
+#if RETRO_USE_SFX_LOOKUP
+    if (sfx >= 0 && sfx < SFX_COUNT) {
+        uint16 mask = sfxChannelMask[sfx];
+        for (int32 i = 0; mask; ++i, mask >>= 1) {
+            if ((mask & 1) && channels[i].soundID == sfx) {
+                MEM_ZERO(channels[i]);
+                channels[i].soundID = -1;
+                channels[i].state   = CHANNEL_IDLE;
+            }
+        }
+
+        sfxChannelMask[sfx] = 0;
+        return;
+    }
+#endif
+
     for (int32 i = 0; i < CHANNEL_COUNT; ++i) {
         if (channels[i].soundID == sfx) {
             MEM_ZERO(channels[i]);
@@ -147,6 +257,18 @@ inline void ResumeSound()
 
 inline bool32 SfxPlaying(uint16 sfx)
 {
+#if RETRO_USE_SFX_LOOKUP
+    if (sfx < SFX_COUNT) {
+        uint16 mask = sfxChannelMask[sfx];
+        for (int32 c = 0; mask; ++c, mask >>= 1) {
+            if ((mask & 1) && channels[c].state == CHANNEL_SFX && channels[c].soundID == sfx)
+                return true;
+        }
+
+        return false;
+    }
+#endif
+
     for (int32 c = 0; c < CHANNEL_COUNT; ++c) {
         if (channels[c].state == CHANNEL_SFX && channels[c].soundID == sfx)
             return true;
@@ -184,6 +306,8 @@ void ClearGlobalSfx();
 #include "SDL2/SDL2AudioDevice.hpp"
 #elif RETRO_AUDIODEVICE_OBOE
 #include "Oboe/OboeAudioDevice.hpp"
+#elif RETRO_AUDIODEVICE_NULL
+#include "Null/NullAudioDevice.hpp"
 #endif
 
 #endif
@@ -99,6 +99,9 @@ void RSDK::Legacy::LoadSfx(char *filename, uint8 slot, uint8 scope)
         uint32 format   = 0;
         uint32 size     = 0;
         ReadSfx(fullFilePath, slot, 1, scope, &size, &format, &channels, &freq);
+#if RETRO_USE_SFX_LOOKUP
+        AddSfxLookup(slot);
+#endif
     }
     else {
         // what the
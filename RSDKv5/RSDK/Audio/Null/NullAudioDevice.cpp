@@ -0,0 +1,177 @@
+uint8 AudioDevice::contextInitialized;
+
+char AudioDevice::renderPath[0x100];
+SAMPLE_FORMAT *AudioDevice::renderBuffer = NULL;
+size_t AudioDevice::renderLength         = 0;
+FileIO *AudioDevice::renderFile          = NULL;
+size_t AudioDevice::renderCapacity       = 0;
+uint32 AudioDevice::renderChecksum       = 0x811C9DC5;
+bool32 AudioDevice::checkChecksum        = false;
+uint32 AudioDevice::expectedChecksum     = 0;
+bool32 AudioDevice::renderFailed         = false;
+uint32 AudioDevice::mixedFrames          = 0;
+double AudioDevice::mixTime              = 0.0;
+
+bool32 AudioDevice::Init()
+{
+    if (!contextInitialized) {
+        contextInitialized = true;
+        InitAudioChannels();
+    }
+
+    if (renderPath[0] && !renderFile) {
+        renderFile = fOpen(renderPath, "wb");
+
+        if (renderFile)
+            WriteWAVHeader(0); // gets filled in properly once we know how much we've rendered
+        else
+            PrintLog(PRINT_NORMAL, "ERROR: Unable to open %s for audio rendering!", renderPath);
+    }
+
+    audioState = true;
+    return true;
+}
+
+void AudioDevice::Release()
+{
+#if RETRO_USE_THREADED_STREAMS
+    ReleaseStreamDecoder();
+#endif
+#if RETRO_USE_SFX_CACHE
+    ReleaseSfxCache();
+#endif
+
+    LockAudioDevice();
+
+    if (vorbisInfo) {
+        vorbis_deinit(vorbisInfo);
+        if (!vorbisInfo->alloc.alloc_buffer)
+            free(vorbisInfo);
+    }
+    vorbisInfo = NULL;
+
+    UnlockAudioDevice();
+
+    if (renderFile) {
+        fSeek(renderFile, 0, SEEK_SET);
+        WriteWAVHeader((uint32)(mixedFrames * NULLAUDIO_FRAME_SAMPLES * AUDIO_CHANNELS * sizeof(SAMPLE_FORMAT)));
+        fClose(renderFile);
+        renderFile = NULL;
+    }
+
+    if (mixedFrames) {
+        PrintLog(PRINT_NORMAL, "Rendered %d frames of audio, checksum: %08X, avg mixing time: %.4fms", mixedFrames, renderChecksum,
+                 mixTime / mixedFrames);
+    }
+
+    if (checkChecksum && renderChecksum != expectedChecksum) {
+        PrintLog(PRINT_NORMAL, "ERROR: Audio checksum mismatch! Expected %08X, got %08X", expectedChecksum, renderChecksum);
+        renderFailed = true;
+    }
+
+    if (renderBuffer)
+        free(renderBuffer);
+    renderBuffer   = NULL;
+    renderLength   = 0;
+    renderCapacity = 0;
+}
+
+void AudioDevice::FrameInit()
+{
+    if (!initializedAudioChannels)
+        return;
+
+    SAMPLE_FORMAT frameBuffer[NULLAUDIO_FRAME_SAMPLES * AUDIO_CHANNELS];
+
+    auto mixStart = std::chrono::steady_clock::now();
+    ProcessAudioMixing(frameBuffer, NULLAUDIO_FRAME_SAMPLES * AUDIO_CHANNELS);
+    mixTime += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - mixStart).count();
+    ++mixedFrames;
+
+    // FNV-1a over the raw output, so runs can be compared without keeping the audio around
+    uint8 *bytes = (uint8 *)frameBuffer;
+    for (int32 b = 0; b < (int32)sizeof(frameBuffer); ++b) {
+        renderChecksum ^= bytes[b];
+        renderChecksum *= 0x01000193;
+    }
+
+    if (renderFile) {
+        fWrite(frameBuffer, sizeof(SAMPLE_FORMAT), NULLAUDIO_FRAME_SAMPLES * AUDIO_CHANNELS, renderFile);
+    }
+    else {
+        if (renderLength + NULLAUDIO_FRAME_SAMPLES * AUDIO_CHANNELS > renderCapacity) {
+            size_t capacity = renderCapacity ? renderCapacity * 2 : AUDIO_FREQUENCY * AUDIO_CHANNELS;
+
+            SAMPLE_FORMAT *buffer = (SAMPLE_FORMAT *)realloc(renderBuffer, capacity * sizeof(SAMPLE_FORMAT));
+            if (!buffer)
+                return;
+
+            renderBuffer   = buffer;
+            renderCapacity = capacity;
+        }
+
+        memcpy(&renderBuffer[renderLength], frameBuffer, sizeof(frameBuffer));
+        renderLength += NULLAUDIO_FRAME_SAMPLES * AUDIO_CHANNELS;
+    }
+}
+
+void AudioDevice::WriteWAVHeader(uint32 dataSize)
+{
+    uint32 chunkSize     = 36 + dataSize;
+    uint32 fmtSize       = 16;
+    uint16 format        = 3; // IEEE float
+    uint16 channelCount  = AUDIO_CHANNELS;
+    uint32 sampleRate    = AUDIO_FREQUENCY;
+    uint32 byteRate      = AUDIO_FREQUENCY * AUDIO_CHANNELS * sizeof(SAMPLE_FORMAT);
+    uint16 blockAlign    = AUDIO_CHANNELS * sizeof(SAMPLE_FORMAT);
+    uint16 bitsPerSample = sizeof(SAMPLE_FORMAT) * 8;
+
+    fWrite("RIFF", 1, 4, renderFile);
+    fWrite(&chunkSize, sizeof(uint32), 1, renderFile);
+    fWrite("WAVE", 1, 4, renderFile);
+
+    fWrite("fmt ", 1, 4, renderFile);
+    fWrite(&fmtSize, sizeof(uint32), 1, renderFile);
+    fWrite(&format, sizeof(uint16), 1, renderFile);
+    fWrite(&channelCount, sizeof(uint16), 1, renderFile);
+    fWrite(&sampleRate, sizeof(uint32), 1, renderFile);
+    fWrite(&byteRate, sizeof(uint32), 1, renderFile);
+    fWrite(&blockAlign, sizeof(uint16), 1, renderFile);
+    fWrite(&bitsPerSample, sizeof(uint16), 1, renderFile);
+
+    fWrite("data", 1, 4, renderFile);
+    fWrite(&dataSize, sizeof(uint32), 1, renderFile);
+}
+
+void AudioDevice::ProcessAudioMixing(void *stream, int32 length)
+{
+    memset(stream, 0, length * sizeof(SAMPLE_FORMAT));
+
+    LockAudioDevice();
+    MixChannels((SAMPLE_FORMAT *)stream, length);
+    UnlockAudioDevice();
+}
+
+void AudioDevice::InitAudioChannels()
+{
+    for (int32 i = 0; i < CHANNEL_COUNT; ++i) {
+        channels[i].soundID = -1;
+        channels[i].state   = CHANNEL_IDLE;
+    }
+
+    for (int32 i = 0; i < 0x400; i += 2) {
+        speedMixAmounts[i]     = (i + 0) * (1.0f / 1024.0f);
+        speedMixAmounts[i + 1] = (i + 1) * (1.0f / 1024.0f);
+    }
+
+    GEN_HASH_MD5("Stream Channel 0", sfxList[SFX_COUNT - 1].hash);
+    sfxList[SFX_COUNT - 1].scope              = SCOPE_GLOBAL;
+    sfxList[SFX_COUNT - 1].maxConcurrentPlays = 1;
+    sfxList[SFX_COUNT - 1].length             = MIX_BUFFER_SIZE;
+    AllocateStorage((void **)&sfxList[SFX_COUNT - 1].buffer, MIX_BUFFER_SIZE * sizeof(SAMPLE_FORMAT), DATASET_MUS, false);
+#if RETRO_USE_SFX_LOOKUP
+    AddSfxLookup(SFX_COUNT - 1);
+#endif
+
+    initializedAudioChannels = true;
+}
@@ -0,0 +1,47 @@
+#define LockAudioDevice()   ;
+#define UnlockAudioDevice() ;
+
+// the null device mixes exactly this many samples per engine frame, regardless of how fast the engine is actually running
+#define NULLAUDIO_FRAME_SAMPLES (AUDIO_FREQUENCY / 60)
+
+namespace RSDK
+{
+class AudioDevice : public AudioDeviceBase
+{
+public:
+    static bool32 Init();
+    static void Release();
+
+    static void ProcessAudioMixing(void *stream, int32 length);
+
+    static void FrameInit();
+
+    inline static void HandleStreamLoad(ChannelInfo *channel, bool32 async) { LoadStream(channel); }
+
+    // if this is set the mixed output is written here as a wav file, otherwise it's kept in renderBuffer
+    static char renderPath[0x100];
+
+    static SAMPLE_FORMAT *renderBuffer;
+    static size_t renderLength;
+
+    // set with "audiochecksum=", if what was rendered doesn't match it then renderFailed is set & the engine exits with an error code
+    static bool32 checkChecksum;
+    static uint32 expectedChecksum;
+    static bool32 renderFailed;
+
+private:
+    static uint8 contextInitialized;
+
+    static FileIO *renderFile;
+    static size_t renderCapacity;
+    static uint32 renderChecksum;
+
+    static uint32 mixedFrames;
+    static double mixTime;
+
+    static void InitAudioChannels();
+    static void InitMixBuffer() {}
+
+    static void WriteWAVHeader(uint32 dataSize);
+};
+} // namespace RSDK
@@ -0,0 +1,156 @@
+#ifndef REGISTRY_H
+#define REGISTRY_H
+
+namespace RSDK
+{
+
+#if RETRO_USE_RESOURCE_REGISTRY
+// keeps track of which slots in a resource list (sprite sheets, animations, meshes, etc) are in use & what they were loaded with,
+// so a load can find a match or a free slot without scanning the whole list
+template <int32 COUNT> class HashRegistry
+{
+    static_assert(COUNT >= 32 && !(COUNT & (COUNT - 1)), "HashRegistry size must be a power of 2");
+
+    RETRO_HASH_MD5(hashes[COUNT]);
+    uint8 scopes[COUNT];
+    uint16 lookup[COUNT * 2];     // slot + 1, 0 if the entry is empty. only ever half full so probing always finds a gap
+    uint32 freeSlots[COUNT / 32]; // a bit for every slot that isn't in use
+
+    inline uint32 GetEntry(uint32 *hash) { return hash[0] & (COUNT * 2 - 1); }
+
+    void AddLookup(int32 slot)
+    {
+        uint32 entry = GetEntry(hashes[slot]);
+        while (lookup[entry]) {
+            if (HASH_MATCH_MD5(hashes[lookup[entry] - 1], hashes[slot])) {
+                // if the same hash is in more than one slot, the lowest one is what a scan would've found
+                if (slot < lookup[entry] - 1)
+                    lookup[entry] = slot + 1;
+                return;
+            }
+
+            entry = (entry + 1) & (COUNT * 2 - 1);
+        }
+
+        lookup[entry] = slot + 1;
+    }
+
+    void RefreshLookup()
+    {
+        memset(lookup, 0, sizeof(lookup));
+
+        for (int32 s = 0; s < COUNT; ++s) {
+            if (scopes[s] != SCOPE_NONE)
+                AddLookup(s);
+        }
+    }
+
+public:
+    HashRegistry() { Clear(); }
+
+    void Clear()
+    {
+        memset(hashes, 0, sizeof(hashes));
+        memset(scopes, SCOPE_NONE, sizeof(scopes));
+        memset(lookup, 0, sizeof(lookup));
+        memset(freeSlots, 0xFF, sizeof(freeSlots));
+    }
+
+    int32 Find(uint32 *hash)
+    {
+        uint32 entry = GetEntry(hash);
+        while (lookup[entry]) {
+            if (HASH_MATCH_MD5(hashes[lookup[entry] - 1], hash))
+                return lookup[entry] - 1;
+
+            entry = (entry + 1) & (COUNT * 2 - 1);
+        }
+
+        return -1;
+    }
+
+    // always the lowest free slot, so ids are handed out the same as they were when scanning for SCOPE_NONE
+    int32 GetFreeSlot()
+    {
+        for (int32 i = 0; i < COUNT / 32; ++i) {
+            uint32 bits = freeSlots[i];
+            if (bits) {
+                int32 slot = i * 32;
+                for (; !(bits & 1); bits >>= 1) ++slot;
+                return slot;
+            }
+        }
+
+        return -1;
+    }
+
+    void Register(int32 slot, uint32 *hash, uint8 scope)
+    {
+        if (slot < 0 || slot >= COUNT)
+            return;
+
+        if (scopes[slot] != SCOPE_NONE)
+            Remove(slot);
+
+        HASH_COPY_MD5(hashes[slot], hash);
+        scopes[slot] = scope;
+        freeSlots[slot / 32] &= ~(1u << (slot & 31));
+        AddLookup(slot);
+    }
+
+    void Remove(int32 slot)
+    {
+        if (slot < 0 || slot >= COUNT || scopes[slot] == SCOPE_NONE)
+            return;
+
+        scopes[slot] = SCOPE_NONE;
+        freeSlots[slot / 32] |= 1u << (slot & 31);
+
+        uint32 entry = GetEntry(hashes[slot]);
+        while (lookup[entry] && lookup[entry] != slot + 1) entry = (entry + 1) & (COUNT * 2 - 1);
+
+        if (lookup[entry]) {
+            // shift back any entries that probed past this one, so they can still be reached
+            lookup[entry] = 0;
+            for (uint32 next = (entry + 1) & (COUNT * 2 - 1); lookup[next]; next = (next + 1) & (COUNT * 2 - 1)) {
+                uint32 home = GetEntry(hashes[lookup[next] - 1]);
+                if (((next - home) & (COUNT * 2 - 1)) >= ((next - entry) & (COUNT * 2 - 1))) {
+                    lookup[entry] = lookup[next];
+                    lookup[next]  = 0;
+                    entry         = next;
+                }
+            }
+
+            // another slot with the same hash may have been hidden behind this one
+            for (int32 s = 0; s < COUNT; ++s) {
+                if (scopes[s] != SCOPE_NONE && HASH_MATCH_MD5(hashes[s], hashes[slot])) {
+                    AddLookup(s);
+                    break;
+                }
+            }
+        }
+
+        HASH_CLEAR_MD5(hashes[slot]);
+    }
+
+    // calls release() on every slot loaded with the given scope, then frees them all at once
+    template <typename T> void ReleaseScope(uint8 scope, T release)
+    {
+        for (int32 s = 0; s < COUNT; ++s) {
+            if (scopes[s] == scope) {
+                release(s);
+
+                HASH_CLEAR_MD5(hashes[s]);
+                scopes[s] = SCOPE_NONE;
+                freeSlots[s / 32] |= 1u << (s & 31);
+            }
+        }
+
+        RefreshLookup();
+    }
+};
+#endif
+
+} // namespace RSDK
+
+#endif // !REGISTRY_H
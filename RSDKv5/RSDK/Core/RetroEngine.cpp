@@ -38,6 +38,17 @@ int32 RSDK::RunRetroEngine(int32 argc, char *argv[])
 #endif
     }
 
+#if RETRO_USE_SELF_TESTS
+    if (engine.runSelfTests)
+        return RunSelfTests() ? 0 : 1;
+#if RETRO_REV0U && RETRO_USE_FUSED_SCRIPT_OPCODES && RETRO_USE_SCRIPT_PROFILER
+    if (engine.runScriptBenchmark) {
+        Legacy::v4::BenchmarkScripts();
+        return 0;
+    }
+#endif
+#endif
+
 #if RETRO_RENDERDEVICE_DIRECTX9 || RETRO_RENDERDEVICE_DIRECTX11
     MSG Msg;
     PeekMessage(&Msg, NULL, 0, 0, PM_REMOVE);
@@ -93,6 +104,13 @@ int32 RSDK::RunRetroEngine(int32 argc, char *argv[])
         }
     }
 
+#if RETRO_REV0U && RETRO_USE_SCRIPT_PROFILER && RETRO_RENDERDEVICE_NULL
+    if (engine.runStageBenchmark) {
+        Legacy::ClearScriptProfile();
+        Legacy::scriptProfilerEnabled = true;
+    }
+#endif
+
     RenderDevice::InitFPSCap();
 
     while (RenderDevice::isRunning) {
@@ -274,6 +292,13 @@ int32 RSDK::RunRetroEngine(int32 argc, char *argv[])
                     }
 
                     RenderDevice::CopyFrameBuffer();
+
+#if RETRO_USE_PALETTE_TRACKING
+                    ClearPaletteChanges();
+#if RETRO_USE_DIRTY_SCREEN_ROWS
+                    screensUnchanged = false;
+#endif
+#endif
                 }
             }
 
@@ -284,8 +309,18 @@ int32 RSDK::RunRetroEngine(int32 argc, char *argv[])
         }
     }
 
+#if RETRO_REV0U && RETRO_USE_SCRIPT_PROFILER && RETRO_RENDERDEVICE_NULL
+    if (engine.runStageBenchmark) {
+        Legacy::PrintStageBenchmark(RenderDevice::frameCount);
+        Legacy::SaveScriptProfile();
+    }
+#endif
+
     // Shutdown
 
+#if RETRO_USE_THREADED_VIDEO
+    ReleaseVideo();
+#endif
     AudioDevice::Release();
     RenderDevice::Release(false);
     SaveSettingsINI(false);
@@ -304,6 +339,11 @@ int32 RSDK::RunRetroEngine(int32 argc, char *argv[])
 #endif
     }
 
+#if RETRO_AUDIODEVICE_NULL
+    if (AudioDevice::renderFailed)
+        return 1;
+#endif
+
     return 0;
 }
 
@@ -430,6 +470,11 @@ void RSDK::ProcessEngine()
                 ProcessObjectDrawLists();
                 engine.frameStep = false;
             }
+#if RETRO_USE_PALETTE_TRACKING && RETRO_USE_DIRTY_SCREEN_ROWS
+            else {
+                screensUnchanged = true;
+            }
+#endif
             break;
 
         case ENGINESTATE_PAUSED | ENGINESTATE_STEPOVER:
@@ -443,6 +488,11 @@ void RSDK::ProcessEngine()
                 ProcessObjectDrawLists();
                 engine.frameStep = false;
             }
+#if RETRO_USE_PALETTE_TRACKING && RETRO_USE_DIRTY_SCREEN_ROWS
+            else {
+                screensUnchanged = true;
+            }
+#endif
             break;
 
         case ENGINESTATE_FROZEN | ENGINESTATE_STEPOVER:
@@ -456,6 +506,11 @@ void RSDK::ProcessEngine()
                 ProcessObjectDrawLists();
                 engine.frameStep = false;
             }
+#if RETRO_USE_PALETTE_TRACKING && RETRO_USE_DIRTY_SCREEN_ROWS
+            else {
+                screensUnchanged = true;
+            }
+#endif
             break;
 
         case ENGINESTATE_DEVMENU:
@@ -572,6 +627,68 @@ void RSDK::ParseArguments(int32 argc, char *argv[])
         }
 #endif
 
+#if RETRO_AUDIODEVICE_NULL
+        find = strstr(argv[a], "audiorender=");
+        if (find) {
+            int32 b = 0;
+            int32 c = 12;
+            while (find[c] && find[c] != ';' && b < (int32)sizeof(AudioDevice::renderPath) - 1) AudioDevice::renderPath[b++] = find[c++];
+            AudioDevice::renderPath[b] = 0;
+        }
+
+        find = strstr(argv[a], "audiochecksum=");
+        if (find) {
+            AudioDevice::expectedChecksum = (uint32)strtoul(&find[14], NULL, 16);
+            AudioDevice::checkChecksum    = true;
+        }
+#endif
+
+#if RETRO_RENDERDEVICE_NULL
+        find = strstr(argv[a], "frames=");
+        if (find)
+            RenderDevice::frameLimit = atoi(&find[7]);
+
+#if RETRO_REV0U && RETRO_USE_SCRIPT_PROFILER
+        find = strstr(argv[a], "stagebench=true");
+        if (find)
+            engine.runStageBenchmark = true;
+#endif
+#endif
+
+#if RETRO_USE_SPRITE_CACHE
+        find = strstr(argv[a], "spritecache=true");
+        if (find)
+            useSpriteCache = true;
+#endif
+
+#if RETRO_USE_THREADED_SPRITES
+        find = strstr(argv[a], "threadedsprites=true");
+        if (find)
+            useThreadedSprites = true;
+#endif
+
+#if RETRO_REV0U && RETRO_USE_SCRIPT_CACHE
+        find = strstr(argv[a], "scriptcache=true");
+        if (find)
+            Legacy::v4::useScriptCache = true;
+#endif
+
+#if RETRO_USE_SOFTWARE_VIDEO
+        find = strstr(argv[a], "softwarevideo=true");
+        if (find)
+            VideoManager::softwareOutput = true;
+#endif
+
+#if RETRO_USE_SELF_TESTS
+        find = strstr(argv[a], "selftest=true");
+        if (find)
+            engine.runSelfTests = true;
+
+        find = strstr(argv[a], "scriptbench=true");
+        if (find)
+            engine.runScriptBenchmark = true;
+#endif
+
         find = strstr(argv[a], "console=true");
         if (find) {
             engine.consoleEnabled = true;
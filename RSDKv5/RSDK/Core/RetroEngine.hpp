@@ -8,6 +8,7 @@
 #include <string.h>
 #include <cmath>
 #include <ctime>
+#include <chrono>
 
 // ================
 // STANDARD TYPES
@@ -166,6 +167,7 @@ enum GameRegions {
 #define RETRO_RENDERDEVICE_SDL2 (0)
 #define RETRO_RENDERDEVICE_GLFW (0)
 #define RETRO_RENDERDEVICE_EGL  (0)
+#define RETRO_RENDERDEVICE_NULL (0)
 
 // ============================
 // AUDIO DEVICE BACKENDS
@@ -175,6 +177,7 @@ enum GameRegions {
 // CUSTOM
 #define RETRO_AUDIODEVICE_SDL2 (0)
 #define RETRO_AUDIODEVICE_OBOE (0)
+#define RETRO_AUDIODEVICE_NULL (0)
 
 // ============================
 // INPUT DEVICE BACKENDS
@@ -235,6 +238,133 @@ enum GameRegions {
 #define RETRO_MOD_LOADER_VER (1)
 #endif
 
+// decodes music streams ahead of playback on a background thread, instead of inside the audio callback
+#ifndef RETRO_USE_THREADED_STREAMS
+#define RETRO_USE_THREADED_STREAMS (!RETRO_USE_ORIGINAL_CODE && 1)
+#endif
+
+// reads music files in small chunks as they're decoded instead of loading the entire file up front (requires threaded streams)
+#ifndef RETRO_USE_INCREMENTAL_STREAMS
+#define RETRO_USE_INCREMENTAL_STREAMS (RETRO_USE_THREADED_STREAMS && 1)
+#endif
+
+// keeps pre-resampled copies of sfx that are repeatedly played at the same non-1.0 speed, so the mixer doesn't have to resample them
+#ifndef RETRO_USE_SFX_CACHE
+#define RETRO_USE_SFX_CACHE (!RETRO_USE_ORIGINAL_CODE && 1)
+#endif
+
+// looks sfx up by name through a hash table and keeps track of which channels each sfx is playing on, instead of scanning every slot
+#ifndef RETRO_USE_SFX_LOOKUP
+#define RETRO_USE_SFX_LOOKUP (!RETRO_USE_ORIGINAL_CODE && 1)
+#endif
+
+// decodes videos a few frames ahead on a background thread, so the main thread only has to upload them
+#ifndef RETRO_USE_THREADED_VIDEO
+#define RETRO_USE_THREADED_VIDEO (!RETRO_USE_ORIGINAL_CODE && 1)
+#endif
+
+// converts video frames to RGB on the CPU, for devices that can't do it in a shader and for drawing videos straight into the screen buffers
+#ifndef RETRO_USE_SOFTWARE_VIDEO
+#define RETRO_USE_SOFTWARE_VIDEO (!RETRO_USE_ORIGINAL_CODE && 1)
+#endif
+
+// decodes gif images with a table of string lengths so each code can be written straight into the pixels, instead of one code & pixel at a time
+#ifndef RETRO_USE_FAST_GIF_DECODER
+#define RETRO_USE_FAST_GIF_DECODER (!RETRO_USE_ORIGINAL_CODE && 1)
+#endif
+
+// allows decoded sprite sheets to be cached on disk ("spritecache=true"), so later loads can skip the gif decoding entirely
+#ifndef RETRO_USE_SPRITE_CACHE
+#define RETRO_USE_SPRITE_CACHE (!RETRO_USE_ORIGINAL_CODE && 1)
+#endif
+
+// allows sprite sheets loaded during stageLoad to be decoded on a pool of worker threads ("threadedsprites=true"), rather than one after another on the main thread
+#ifndef RETRO_USE_THREADED_SPRITES
+#define RETRO_USE_THREADED_SPRITES (!RETRO_USE_ORIGINAL_CODE && 1)
+#endif
+
+// unfilters & unpacks png images a whole pixel (or 16 bytes) at a time with SSE2/NEON where it's available, instead of one byte at a time
+#ifndef RETRO_USE_FAST_PNG_DECODER
+#define RETRO_USE_FAST_PNG_DECODER (!RETRO_USE_ORIGINAL_CODE && 1)
+#endif
+
+// palette fades & blends are done 8 colors at a time with SSE2/NEON where it's available
+#ifndef RETRO_USE_FAST_PALETTE_BLENDING
+#define RETRO_USE_FAST_PALETTE_BLENDING (!RETRO_USE_ORIGINAL_CODE && 1)
+#endif
+
+// keeps track of which palette banks have changed, so anything built from the palettes can tell when it needs redoing
+#ifndef RETRO_USE_PALETTE_TRACKING
+#define RETRO_USE_PALETTE_TRACKING (!RETRO_USE_ORIGINAL_CODE && 1)
+#endif
+
+// sprite sheets, animations, meshes & 3D scenes are looked up by hash through a registry, rather than scanning every slot for a match or a free one
+#ifndef RETRO_USE_RESOURCE_REGISTRY
+#define RETRO_USE_RESOURCE_REGISTRY (!RETRO_USE_ORIGINAL_CODE && 1)
+#endif
+
+// only uploads the screen rows that changed since the last frame was uploaded, rather than the whole framebuffer every frame
+#ifndef RETRO_USE_DIRTY_SCREEN_ROWS
+#define RETRO_USE_DIRTY_SCREEN_ROWS (!RETRO_USE_ORIGINAL_CODE && 1)
+#endif
+
+// legacy v4 scripts are decoded once as they're loaded, rather than every operand being re-read from scriptCode each time an opcode runs
+#ifndef RETRO_USE_PREDECODED_SCRIPTS
+#define RETRO_USE_PREDECODED_SCRIPTS (!RETRO_USE_ORIGINAL_CODE && 1)
+#endif
+
+// each legacy script opcode handler writes back its own operands & jumps straight to the next opcode's handler through a table of label addresses, rather than everything going back round to one switch (GCC & clang only)
+// off by default, "scriptbench=true" has it 10-15% slower than the switch since every handler has to call out to the operand reads & writes
+#ifndef RETRO_USE_COMPUTED_GOTO
+#define RETRO_USE_COMPUTED_GOTO (0)
+#endif
+#if RETRO_USE_COMPUTED_GOTO && !defined(__GNUC__) && !defined(__clang__)
+#undef RETRO_USE_COMPUTED_GOTO
+#define RETRO_USE_COMPUTED_GOTO (0)
+#endif
+
+// lets compiled legacy v4 text scripts be saved to disk ("scriptcache=true"), so later loads of an unchanged script can skip the compiler
+#ifndef RETRO_USE_SCRIPT_CACHE
+#define RETRO_USE_SCRIPT_CACHE (!RETRO_USE_ORIGINAL_CODE && 1)
+#endif
+
+// the legacy v4 compiler looks up opcode, variable, alias & function names through hash tables instead of scanning every name for each identifier
+#ifndef RETRO_USE_SCRIPT_NAME_LOOKUP
+#define RETRO_USE_SCRIPT_NAME_LOOKUP (!RETRO_USE_ORIGINAL_CODE && 1)
+#endif
+
+// adds a legacy script profiler to the dev menu, which times each object type's events & counts every opcode that runs,
+// headless builds can also be run with "stagebench=true" (plus stage=, scene= & frames=) to profile a stage's scripts for that many frames, log how many opcodes a second they ran at & save the profile
+#ifndef RETRO_USE_SCRIPT_PROFILER
+#define RETRO_USE_SCRIPT_PROFILER (!RETRO_USE_ORIGINAL_CODE && 1)
+#endif
+
+// predecoded legacy v4 arithmetic & compare/branch opcodes whose operands are all constants, fixed variables or plain entity fields each run as one fused opcode, with the operand reads & write-back folded in rather than going through the generic ones (opcodes are only ever fused on their own, never into sequences)
+#ifndef RETRO_USE_FUSED_SCRIPT_OPCODES
+#define RETRO_USE_FUSED_SCRIPT_OPCODES (!RETRO_USE_ORIGINAL_CODE && RETRO_USE_PREDECODED_SCRIPTS)
+#endif
+
+// legacy h/v scroll layers draw each tile line through one masked span, using per-line opacity masks built when the tileset's loaded so empty & solid lines skip the per-pixel checks
+#ifndef RETRO_USE_FAST_SCROLL_LAYERS
+#define RETRO_USE_FAST_SCROLL_LAYERS (!RETRO_USE_ORIGINAL_CODE && 1)
+#endif
+
+// the legacy 3D floor & sky layers read pixels from a pre-flipped copy of the tileset through a per-tile offset table, rather than going layout -> chunk -> tile -> pixel for every pixel
+#ifndef RETRO_USE_FAST_3D_FLOOR
+#define RETRO_USE_FAST_3D_FLOOR (!RETRO_USE_ORIGINAL_CODE && 1)
+#endif
+
+// the legacy 3D scene transforms its vertex buffer with SSE2/NEON & sorts its drawlist with a stable radix sort, rather than scalar matrix math & a bubble sort
+#ifndef RETRO_USE_FAST_3D_DRAWLIST
+#define RETRO_USE_FAST_3D_DRAWLIST (!RETRO_USE_ORIGINAL_CODE && 1)
+#endif
+
+// builds with RSDK/Dev/SelfTests.cpp compiled in ("make SELFTESTS=1", or the RETRO_SELF_TESTS cmake option which also runs them through ctest) can be run with "selftest=true" to check the fast paths above against the plain code they stand in for, then quit,
+// or with "scriptbench=true" to log how many legacy v4 opcodes a second ProcessScript gets through
+#ifndef RETRO_USE_SELF_TESTS
+#define RETRO_USE_SELF_TESTS (0)
+#endif
+
 // ============================
 // PLATFORM INIT
 // ============================
@@ -315,8 +445,17 @@ enum GameRegions {
 #undef RETRO_AUDIODEVICE_SDL2
 #define RETRO_AUDIODEVICE_SDL2 (1)
 
+#elif defined(RSDK_USE_NULL)
+// no window, sound or input, for running on machines without a display
+#undef RETRO_RENDERDEVICE_NULL
+#define RETRO_RENDERDEVICE_NULL (1)
+#undef RETRO_AUDIODEVICE_NULL
+#define RETRO_AUDIODEVICE_NULL (1)
+#undef RETRO_INPUTDEVICE_KEYBOARD
+#define RETRO_INPUTDEVICE_KEYBOARD (0)
+
 #else
-#error RSDK_USE_SDL2 or RSDK_USE_GL3 must be defined.
+#error RSDK_USE_SDL2, RSDK_USE_GL3 or RSDK_USE_NULL must be defined.
 #endif //! RSDK_USE_SDL2
 
 #elif RETRO_PLATFORM == RETRO_SWITCH
@@ -382,6 +521,22 @@ enum GameRegions {
 
 #endif
 
+// replaces the platform's audio device with one that mixes in step with the engine's frames and captures the output instead of playing it
+// (not usable with the DX9/DX11 render devices, since they talk to XAudio directly)
+#ifdef RSDK_USE_NULLAUDIO
+#undef RETRO_AUDIODEVICE_XAUDIO
+#define RETRO_AUDIODEVICE_XAUDIO (0)
+#undef RETRO_AUDIODEVICE_NX
+#define RETRO_AUDIODEVICE_NX (0)
+#undef RETRO_AUDIODEVICE_SDL2
+#define RETRO_AUDIODEVICE_SDL2 (0)
+#undef RETRO_AUDIODEVICE_OBOE
+#define RETRO_AUDIODEVICE_OBOE (0)
+
+#undef RETRO_AUDIODEVICE_NULL
+#define RETRO_AUDIODEVICE_NULL (1)
+#endif
+
 #if RETRO_PLATFORM == RETRO_WIN || RETRO_PLATFORM == RETRO_UWP
 
 #if RETRO_AUDIODEVICE_XAUDIO
@@ -476,6 +631,25 @@ enum GameRegions {
 #undef RETRO_USING_MOUSE
 #endif
 
+// ============================
+// SIMD
+// ============================
+
+// picked at compile time, anything without SSE2 or NEON uses the plain C paths
+#if !RETRO_USE_ORIGINAL_CODE && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define RETRO_USE_SSE2 (1)
+#include <emmintrin.h>
+#else
+#define RETRO_USE_SSE2 (0)
+#endif
+
+#if !RETRO_USE_ORIGINAL_CODE && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+#define RETRO_USE_NEON (1)
+#include <arm_neon.h>
+#else
+#define RETRO_USE_NEON (0)
+#endif
+
 // ============================
 // ENGINE INCLUDES
 // ============================
@@ -484,6 +658,7 @@ enum GameRegions {
 #include "RSDK/Core/Math.hpp"
 #include "RSDK/Storage/Text.hpp"
 #include "RSDK/Core/Reader.hpp"
+#include "RSDK/Core/Registry.hpp"
 #include "RSDK/Graphics/Animation.hpp"
 #include "RSDK/Audio/Audio.hpp"
 #include "RSDK/Input/Input.hpp"
@@ -496,6 +671,9 @@ enum GameRegions {
 #include "RSDK/Graphics/Sprite.hpp"
 #include "RSDK/Graphics/Video.hpp"
 #include "RSDK/Dev/Debug.hpp"
+#if RETRO_USE_SELF_TESTS
+#include "RSDK/Dev/SelfTests.hpp"
+#endif
 #include "RSDK/User/Core/UserCore.hpp"
 #include "RSDK/User/Core/UserAchievements.hpp"
 #include "RSDK/User/Core/UserLeaderboards.hpp"
@@ -533,6 +711,13 @@ struct RetroEngine {
 
     bool32 devMenu        = false;
     bool32 consoleEnabled = false;
+#if RETRO_USE_SELF_TESTS
+    bool32 runSelfTests       = false;
+    bool32 runScriptBenchmark = false;
+#endif
+#if RETRO_REV0U && RETRO_USE_SCRIPT_PROFILER && RETRO_RENDERDEVICE_NULL
+    bool32 runStageBenchmark = false;
+#endif
 
     bool32 confirmFlip = false; // swaps A/B, used for nintendo and etc controllers
     bool32 XYFlip      = false; // swaps X/Y, used for nintendo and etc controllers
@@ -776,11 +776,16 @@ void RSDK::DevMenu_SceneSelectMenu()
 }
 void RSDK::DevMenu_OptionsMenu()
 {
+#if RETRO_REV0U && RETRO_USE_SCRIPT_PROFILER
+    const uint8 selectionCount = 6;
+    uint32 selectionColors[]   = { 0x808090, 0x808090, 0x808090, 0x808090, 0x808090, 0x808090 };
+#else
     const uint8 selectionCount = RETRO_REV02 ? 5 : 4;
 #if RETRO_REV02
     uint32 selectionColors[] = { 0x808090, 0x808090, 0x808090, 0x808090, 0x808090 };
 #else
     uint32 selectionColors[] = { 0x808090, 0x808090, 0x808090, 0x808090 };
+#endif
 #endif
     selectionColors[devMenu.selection] = 0xF0F0F0;
 
@@ -791,7 +796,11 @@ void RSDK::DevMenu_OptionsMenu()
     DrawDevString("OPTIONS", currentScreen->center.x, dy, ALIGN_CENTER, 0xF0F0F0);
 
     dy += 44;
+#if RETRO_REV0U && RETRO_USE_SCRIPT_PROFILER
+    DrawRectangle(currentScreen->center.x - 128, dy - 8, 0x100, 0x54, 0x80, 0xFF, INK_NONE, true);
+#else
     DrawRectangle(currentScreen->center.x - 128, dy - 8, 0x100, 0x48, 0x80, 0xFF, INK_NONE, true);
+#endif
 
     DrawDevString("Video Settings", currentScreen->center.x, dy, ALIGN_CENTER, selectionColors[0]);
 
@@ -805,6 +814,11 @@ void RSDK::DevMenu_OptionsMenu()
     dy += 12;
     DrawDevString("Debug Flags", currentScreen->center.x, dy, ALIGN_CENTER, selectionColors[3]);
 
+#endif
+#if RETRO_REV0U && RETRO_USE_SCRIPT_PROFILER
+    dy += 12;
+    DrawDevString("Script Profiler", currentScreen->center.x, dy, ALIGN_CENTER, selectionColors[4]);
+
 #endif
     DrawDevString("Back", currentScreen->center.x, dy + 12, ALIGN_CENTER, selectionColors[selectionCount - 1]);
 
@@ -887,7 +901,16 @@ void RSDK::DevMenu_OptionsMenu()
 #endif
                 break;
 
+#if RETRO_REV0U && RETRO_USE_SCRIPT_PROFILER
             case 4:
+                devMenu.state     = DevMenu_ScriptProfilerMenu;
+                devMenu.selection = 0;
+                break;
+
+            case 5:
+#else
+            case 4:
+#endif
 #else
             case 3:
 #endif
@@ -1125,6 +1148,12 @@ void RSDK::DevMenu_AudioOptionsMenu()
     dy -= 68;
     DrawDevString("AUDIO SETTINGS", currentScreen->center.x, dy, ALIGN_CENTER, 0xF0F0F0);
 
+#if RETRO_USE_SFX_CACHE
+    char cacheInfo[0x40];
+    sprintf_s(cacheInfo, (int32)sizeof(cacheInfo), "SFX Cache: %u Hits, %u Misses", sfxCacheHits, sfxCacheMisses);
+    DrawDevString(cacheInfo, currentScreen->center.x, dy + 12, ALIGN_CENTER, 0x808090);
+#endif
+
     dy += 44;
     DrawRectangle(currentScreen->center.x - 128, dy - 8, 0x100, 0x48, 0x80, 0xFF, INK_NONE, true);
 
@@ -1748,6 +1777,159 @@ void RSDK::DevMenu_DebugOptionsMenu()
 }
 #endif
 
+#if RETRO_REV0U && RETRO_USE_SCRIPT_PROFILER
+void RSDK::DevMenu_ScriptProfilerMenu()
+{
+    uint32 selectionColors[]           = { 0x808090, 0x808090, 0x808090, 0x808090 };
+    selectionColors[devMenu.selection] = 0xF0F0F0;
+
+    int32 dy = currentScreen->center.y;
+    DrawRectangle(currentScreen->center.x - 128, dy - 84, 0x100, 0x30, 0x80, 0xFF, INK_NONE, true);
+
+    dy -= 68;
+    DrawDevString("SCRIPT PROFILER", currentScreen->center.x, dy, ALIGN_CENTER, 0xF0F0F0);
+
+    char info[0x40];
+    if (ENGINE_VERSION == 5)
+        sprintf_s(info, (int32)sizeof(info), "Only legacy scripts are profiled");
+    else
+        sprintf_s(info, (int32)sizeof(info), "%llu Opcodes Run", (unsigned long long)Legacy::scriptProfileOpcodeTotal);
+    DrawDevString(info, currentScreen->center.x, dy + 12, ALIGN_CENTER, 0x808090);
+
+    // only shown once a script has drawn a 3D scene
+    if (Legacy::scene3DProfiles[Legacy::SCENE3D_PROFILE_DRAW].runCount) {
+        sprintf_s(info, (int32)sizeof(info), "Xform %.1f Sort %.1f Draw %.1fms", Legacy::scene3DProfiles[Legacy::SCENE3D_PROFILE_TRANSFORM].time / 1000000.0,
+                  Legacy::scene3DProfiles[Legacy::SCENE3D_PROFILE_SORT].time / 1000000.0,
+                  Legacy::scene3DProfiles[Legacy::SCENE3D_PROFILE_DRAW].time / 1000000.0);
+        DrawDevString(info, currentScreen->center.x, dy + 22, ALIGN_CENTER, 0x808090);
+    }
+
+    dy += 44;
+    DrawRectangle(currentScreen->center.x - 128, dy - 8, 0x100, 0x3C, 0x80, 0xFF, INK_NONE, true);
+
+    DrawDevString("Profiling:", currentScreen->center.x - 96, dy, 0, selectionColors[0]);
+    DrawDevString(Legacy::scriptProfilerEnabled ? "ON" : "OFF", currentScreen->center.x + 80, dy, ALIGN_CENTER, 0xF0F080);
+
+    dy += 12;
+    DrawDevString("Reset", currentScreen->center.x, dy, ALIGN_CENTER, selectionColors[1]);
+
+    dy += 12;
+    DrawDevString("Save CSV", currentScreen->center.x, dy, ALIGN_CENTER, selectionColors[2]);
+
+    dy += 12;
+    DrawDevString("Back", currentScreen->center.x, dy, ALIGN_CENTER, selectionColors[3]);
+
+    // the events that have taken the longest so far
+    const int32 listCount = 6;
+    int32 listTypes[listCount];
+    int32 listEvents[listCount];
+    int32 listSize = 0;
+    for (int32 t = 0; t < LEGACY_PROFILE_TYPE_COUNT; ++t) {
+        for (int32 e = 0; e < LEGACY_PROFILE_EVENT_COUNT; ++e) {
+            uint64 time = Legacy::scriptEventProfiles[t][e].time;
+            if (!Legacy::scriptEventProfiles[t][e].runCount)
+                continue;
+
+            int32 pos = listSize;
+            while (pos > 0 && Legacy::scriptEventProfiles[listTypes[pos - 1]][listEvents[pos - 1]].time < time) --pos;
+
+            if (pos < listCount) {
+                for (int32 i = listSize < listCount ? listSize : listCount - 1; i > pos; --i) {
+                    listTypes[i]  = listTypes[i - 1];
+                    listEvents[i] = listEvents[i - 1];
+                }
+
+                listTypes[pos]  = t;
+                listEvents[pos] = e;
+                if (listSize < listCount)
+                    listSize++;
+            }
+        }
+    }
+
+    dy += 24;
+    DrawRectangle(currentScreen->center.x - 128, dy - 8, 0x100, 0x10 + listCount * 10, 0x80, 0xFF, INK_NONE, true);
+    for (int32 i = 0; i < listSize; ++i) {
+        Legacy::ScriptEventProfile *profile = &Legacy::scriptEventProfiles[listTypes[i]][listEvents[i]];
+
+        char name[0x40];
+        sprintf_s(name, (int32)sizeof(name), "%.16s %.4s", Legacy::GetScriptProfileTypeName(listTypes[i]),
+                  Legacy::GetScriptProfileEventName(listEvents[i]));
+        DrawDevString(name, currentScreen->center.x - 120, dy, 0, 0xF0F0F0);
+
+        sprintf_s(info, (int32)sizeof(info), "%.1fms", profile->time / 1000000.0);
+        DrawDevString(info, currentScreen->center.x + 88, dy, ALIGN_CENTER, 0xF0F080);
+        dy += 10;
+    }
+
+#if !RETRO_USE_ORIGINAL_CODE
+    DevMenu_HandleTouchControls();
+#endif
+
+    if (controller[CONT_ANY].keyUp.press) {
+        if (--devMenu.selection < 0)
+            devMenu.selection = 3;
+
+        devMenu.timer = 1;
+    }
+    else if (controller[CONT_ANY].keyUp.down) {
+        if (!devMenu.timer && --devMenu.selection < 0)
+            devMenu.selection = 3;
+
+        devMenu.timer = (devMenu.timer + 1) & 7;
+    }
+
+    if (controller[CONT_ANY].keyDown.press) {
+        if (++devMenu.selection > 3)
+            devMenu.selection = 0;
+
+        devMenu.timer = 1;
+    }
+    else if (controller[CONT_ANY].keyDown.down) {
+        if (!devMenu.timer && ++devMenu.selection > 3)
+            devMenu.selection = 0;
+
+        devMenu.timer = (devMenu.timer + 1) & 7;
+    }
+
+    bool32 confirm = controller[CONT_ANY].keyA.press;
+    bool32 swap    = SKU::userCore->GetConfirmButtonFlip();
+    if (swap)
+        confirm = controller[CONT_ANY].keyB.press;
+
+    switch (devMenu.selection) {
+        case 0:
+            if (controller[CONT_ANY].keyLeft.press || controller[CONT_ANY].keyRight.press || controller[CONT_ANY].keyStart.press || confirm)
+                Legacy::scriptProfilerEnabled ^= 1;
+            break;
+
+        case 1:
+            if (controller[CONT_ANY].keyStart.press || confirm)
+                Legacy::ClearScriptProfile();
+            break;
+
+        case 2:
+            if (controller[CONT_ANY].keyStart.press || confirm)
+                Legacy::SaveScriptProfile();
+            break;
+
+        case 3:
+            if (controller[CONT_ANY].keyStart.press || confirm) {
+                devMenu.state     = DevMenu_OptionsMenu;
+                devMenu.selection = 4;
+            }
+            break;
+    }
+
+#if !RETRO_USE_ORIGINAL_CODE
+    if (swap ? controller[CONT_ANY].keyA.press : controller[CONT_ANY].keyB.press) {
+        devMenu.state     = DevMenu_OptionsMenu;
+        devMenu.selection = 4;
+    }
+#endif
+}
+#endif
+
 #if RETRO_USE_MOD_LOADER
 void RSDK::DevMenu_ModsMenu()
 {
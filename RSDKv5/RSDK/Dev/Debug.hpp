@@ -123,6 +123,9 @@ void DevMenu_KeyMappingsMenu();
 #if RETRO_REV02
 void DevMenu_DebugOptionsMenu();
 #endif
+#if RETRO_REV0U && RETRO_USE_SCRIPT_PROFILER
+void DevMenu_ScriptProfilerMenu();
+#endif
 #if RETRO_USE_MOD_LOADER
 void DevMenu_ModsMenu();
 #endif
@@ -0,0 +1,1362 @@
+#if RETRO_USE_FAST_SCROLL_LAYERS
+namespace RSDK
+{
+namespace Legacy
+{
+
+// the per-pixel tile line the masked spans replaced: every non-zero pixel along the (flipped) line goes through the palette,
+// & a chunk with a bad direction isn't drawn or stepped over
+uint16 *DrawTileLineScalar(uint16 *frameBuffer, int32 pitch, int32 chunk, int32 tileX, int32 tileY, int32 count, bool32 vertical)
+{
+    int32 gfxDataPos = tiles128x128.gfxDataPos[chunk];
+    uint8 direction  = tiles128x128.direction[chunk];
+    if (direction > FLIP_XY)
+        return frameBuffer;
+
+    for (int32 i = 0; i < count; ++i) {
+        int32 x = vertical ? tileX : tileX + i;
+        int32 y = vertical ? tileY + i : tileY;
+        if (direction & FLIP_X)
+            x = 0xF - x;
+        if (direction & FLIP_Y)
+            y = 0xF - y;
+
+        uint8 index = tilesetGFXData[gfxDataPos + TILE_SIZE * y + x];
+        if (index > 0)
+            frameBuffer[i * pitch] = activePalette[index];
+    }
+
+    return frameBuffer + pitch * count;
+}
+
+} // namespace Legacy
+} // namespace RSDK
+
+bool32 RSDK::Legacy::CheckScrollLayerTiles()
+{
+    const int32 tileCount  = 0x10;
+    const int32 chunkCount = tileCount * 5 + 4 * 4;
+    const int32 pitch      = 5; // only used as the framebuffer stride, so it doesn't need to be anywhere near a real screen width
+
+    // a few pixels either side of the line, plus how far the framebuffer pointer got moved on
+    struct TileLine {
+        uint16 frame[(TILE_SIZE + 2) * pitch];
+        int32 end;
+    };
+
+    SelfTest test("Scroll layer tiles", 0x5C3B2A19);
+
+    {
+        // the test tiles, chunks & palette replace the first few of each
+        SelfTestBackup tilesBackup(tilesetGFXData, (tileCount + 1) * LEGACY_TILE_DATASIZE);
+        SelfTestBackup gfxDataPosBackup(tiles128x128.gfxDataPos, chunkCount * sizeof(tiles128x128.gfxDataPos[0]));
+        SelfTestBackup directionBackup(tiles128x128.direction, chunkCount * sizeof(tiles128x128.direction[0]));
+        SELFTEST_BACKUP(activePalette);
+        SELFTEST_BACKUP(GFX_LINESIZE);
+
+        uint16 palette[0x100];
+        for (int32 i = 0; i < 0x100; ++i) palette[i] = test.Random();
+        activePalette = palette;
+        GFX_LINESIZE  = pitch;
+
+        // empty, solid, sparse through to dense, a checkerboard, alternating rows & a single pixel, so every span kind comes up
+        for (int32 t = 0; t < tileCount + 1; ++t) {
+            uint8 *pixels = &tilesetGFXData[t * LEGACY_TILE_DATASIZE];
+            for (int32 p = 0; p < LEGACY_TILE_DATASIZE; ++p) {
+                int32 x = p & 0xF;
+                int32 y = p >> 4;
+
+                bool32 opaque = false;
+                switch (t) {
+                    case 0: opaque = false; break;
+                    case 1: opaque = true; break;
+                    case 12: opaque = (x ^ y) & 1; break;
+                    case 13: opaque = y & 1; break;
+                    case 14: opaque = p == 0x5A; break;
+                    default: opaque = (int32)test.Random(tileCount) < t; break;
+                }
+                pixels[p] = opaque ? 1 + test.Random(0xFF) : 0;
+            }
+        }
+        UpdateTilesetMasks(0, tileCount + 1);
+
+        // every tile in every direction (plus a bad one), then a few that start partway into a tile, like scripts can set up
+        for (int32 c = 0; c < tileCount * 5; ++c) {
+            tiles128x128.gfxDataPos[c] = (c / 5) * LEGACY_TILE_DATASIZE;
+            tiles128x128.direction[c]  = c % 5;
+        }
+        const int32 offsets[] = { 0x05, 0x10, 0x3F, 0xF1 };
+        for (int32 c = 0; c < 4 * 4; ++c) {
+            tiles128x128.gfxDataPos[tileCount * 5 + c] = (2 + (c >> 2)) * LEGACY_TILE_DATASIZE + offsets[c >> 2];
+            tiles128x128.direction[tileCount * 5 + c]  = c & 3;
+        }
+
+        uint16 background[(TILE_SIZE + 2) * pitch];
+        TileLine expected;
+        TileLine line;
+        for (int32 pass = 0; pass < 2; ++pass) {
+            // the second pass copies tiles over each other first, so masks Copy16x16Tile didn't update would show up
+            if (pass) {
+                for (int32 t = 0; t < tileCount / 2; ++t) Copy16x16Tile(t, tileCount - 1 - t);
+            }
+
+            for (int32 c = 0; c < chunkCount; ++c) {
+                for (int32 row = 0; row < TILE_SIZE; ++row) {
+                    for (int32 start = 0; start < TILE_SIZE; ++start) {
+                        for (int32 count = 1; start + count <= TILE_SIZE; ++count) {
+                            for (int32 i = 0; i < (int32)(sizeof(background) / sizeof(uint16)); ++i) background[i] = test.Random();
+
+                            // horizontal lines are drawn partway into a row, vertical ones down a column
+                            memcpy(expected.frame, background, sizeof(background));
+                            memcpy(line.frame, background, sizeof(background));
+                            expected.end = (int32)(DrawTileLineScalar(&expected.frame[3], 1, c, start, row, count, false) - expected.frame);
+                            line.end     = (int32)(DrawHLineTile(&line.frame[3], c, start, row, count) - line.frame);
+                            test.Compare(&expected, &line, sizeof(line),
+                                         "DrawHLineTile doesn't match the per-pixel draw (pass %d, chunk %d, row %d, from %d, %d pixels)", pass, c, row, start,
+                                         count);
+
+                            memcpy(expected.frame, background, sizeof(background));
+                            memcpy(line.frame, background, sizeof(background));
+                            expected.end = (int32)(DrawTileLineScalar(&expected.frame[pitch + 2], pitch, c, row, start, count, true) - expected.frame);
+                            line.end     = (int32)(DrawVLineTile(&line.frame[pitch + 2], c, row, start, count) - line.frame);
+                            test.Compare(&expected, &line, sizeof(line),
+                                         "DrawVLineTile doesn't match the per-pixel draw (pass %d, chunk %d, column %d, from %d, %d pixels)", pass, c, row, start,
+                                         count);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    // the masks (& 3D floor tiles) are built from the tile pixels, so they need building again from the ones that were put back
+    UpdateTilesetMasks(0, tileCount + 1);
+#if RETRO_USE_FAST_3D_FLOOR
+    UpdateFloor3DTiles(0, tileCount + 1);
+#endif
+
+    return test.Finish();
+}
+#endif
+
+namespace RSDK
+{
+namespace Legacy
+{
+
+#define LAYERTEST_TILE_COUNT  (0x40)
+#define LAYERTEST_CHUNK_COUNT (0x10)
+#define LAYERTEST_FRAME_COUNT (0x10)
+
+// everything the layer draws read or write, put back once a test's done scribbling over it
+struct LayerTestScene {
+    SelfTestBackup tilesBackup{ tilesetGFXData, sizeof(tilesetGFXData) };
+#if RETRO_USE_FAST_SCROLL_LAYERS
+    SelfTestBackup rowMasksBackup{ tilesetRowMasks, sizeof(tilesetRowMasks) };
+    SelfTestBackup columnMasksBackup{ tilesetColumnMasks, sizeof(tilesetColumnMasks) };
+#endif
+    SelfTestBackup chunksBackup{ &tiles128x128, sizeof(tiles128x128) };
+    SelfTestBackup layoutsBackup{ stageLayouts, sizeof(stageLayouts) };
+    SelfTestBackup activeLayersBackup{ activeTileLayers, sizeof(activeTileLayers) };
+    SelfTestBackup midPointBackup{ &tLayerMidPoint, sizeof(tLayerMidPoint) };
+    SelfTestBackup hParallaxBackup{ &hParallax, sizeof(hParallax) };
+    SelfTestBackup vParallaxBackup{ &vParallax, sizeof(vParallax) };
+    SelfTestBackup deformation0Backup{ bgDeformationData0, sizeof(bgDeformationData0) };
+    SelfTestBackup deformation1Backup{ bgDeformationData1, sizeof(bgDeformationData1) };
+    SelfTestBackup deformation2Backup{ bgDeformationData2, sizeof(bgDeformationData2) };
+    SelfTestBackup deformation3Backup{ bgDeformationData3, sizeof(bgDeformationData3) };
+    SelfTestBackup xScrollBackup{ &xScrollOffset, sizeof(xScrollOffset) };
+    SelfTestBackup yScrollBackup{ &yScrollOffset, sizeof(yScrollOffset) };
+    SelfTestBackup waterBackup{ &waterDrawPos, sizeof(waterDrawPos) };
+    SelfTestBackup lastXSizeBackup{ &lastXSize, sizeof(lastXSize) };
+    SelfTestBackup lastYSizeBackup{ &lastYSize, sizeof(lastYSize) };
+    SelfTestBackup paletteBackup{ fullPalette, sizeof(fullPalette) };
+    SelfTestBackup lineBufferBackup{ gfxLineBuffer, sizeof(gfxLineBuffer) };
+    SelfTestBackup activePaletteBackup{ &activePalette, sizeof(activePalette) };
+    SelfTestBackup lineSizeBackup{ &GFX_LINESIZE, sizeof(GFX_LINESIZE) };
+    SelfTestBackup frameBufferSizeBackup{ &GFX_FBUFFERMINUSONE, sizeof(GFX_FBUFFERMINUSONE) };
+    SelfTestBackup screenXSizeBackup{ &SCREEN_XSIZE, sizeof(SCREEN_XSIZE) };
+    SelfTestBackup screenCenterXBackup{ &SCREEN_CENTERX, sizeof(SCREEN_CENTERX) };
+    SelfTestBackup screenBackup{ &currentScreen, sizeof(currentScreen) };
+    SelfTestBackup frameBufferBackup{ screens[0].frameBuffer, sizeof(screens[0].frameBuffer) };
+    SelfTestBackup floorBufferBackup{ tile3DFloorBuffer, sizeof(tile3DFloorBuffer) };
+#if RETRO_USE_FAST_3D_FLOOR
+    SelfTestBackup floorTilesBackup{ floor3DTiles, sizeof(floor3DTiles) };
+    SelfTestBackup floorTileOffsetsBackup{ floor3DTileOffsets, sizeof(floor3DTileOffsets) };
+    SelfTestBackup floorTileOffsetsDirtyBackup{ &floor3DTileOffsetsDirty, sizeof(floor3DTileOffsetsDirty) };
+#endif
+    SelfTestBackup sinM7Backup{ sinM7LookupTable, sizeof(sinM7LookupTable) };
+    SelfTestBackup cosM7Backup{ cosM7LookupTable, sizeof(cosM7LookupTable) };
+};
+
+// a random tileset (with a fully transparent & a solid tile), chunks using it in every direction & plane, & a few layers made of those chunks:
+// layout 0 is the FG, 1 a BG that scrolls horizontally & 2 a BG that scrolls vertically
+void SetupLayerTestScene(SelfTest *test)
+{
+    for (int32 t = 0; t < LAYERTEST_TILE_COUNT; ++t) {
+        uint8 *pixels = &tilesetGFXData[t * LEGACY_TILE_DATASIZE];
+        for (int32 p = 0; p < LEGACY_TILE_DATASIZE; ++p) {
+            bool32 opaque = t == 1 || (t && (int32)test->Random(4) <= (t & 3));
+            pixels[p]     = opaque ? 1 + test->Random(0xFF) : 0;
+        }
+    }
+#if RETRO_USE_FAST_SCROLL_LAYERS
+    UpdateTilesetMasks(0, LAYERTEST_TILE_COUNT);
+#endif
+#if RETRO_USE_FAST_3D_FLOOR
+    UpdateFloor3DTiles(0, LAYERTEST_TILE_COUNT);
+#endif
+
+    // most chunk tiles start on a tile, like the stage files set them up, but scripts can point them partway into one too
+    for (int32 c = 0; c < LAYERTEST_CHUNK_COUNT * 0x40; ++c) {
+        tiles128x128.gfxDataPos[c]  = test->Random(LAYERTEST_TILE_COUNT) * LEGACY_TILE_DATASIZE;
+        tiles128x128.direction[c]   = test->Random(4);
+        tiles128x128.visualPlane[c] = test->Random(2);
+        if (!test->Random(0x20))
+            tiles128x128.gfxDataPos[c] += test->Random(LEGACY_TILE_DATASIZE);
+    }
+
+    for (int32 b = 0; b < PALETTE_BANK_COUNT; ++b) {
+        for (int32 i = 0; i < PALETTE_BANK_SIZE; ++i) fullPalette[b][i] = test->Random();
+    }
+
+    int32 *deformations[] = { bgDeformationData0, bgDeformationData1, bgDeformationData2, bgDeformationData3 };
+    for (int32 d = 0; d < 4; ++d) {
+        for (int32 i = 0; i < LEGACY_DEFORM_COUNT; ++i) deformations[d][i] = (int32)test->Random(0x80) - 0x40;
+    }
+
+    const uint8 sizes[][2] = { { 6, 4 }, { 4, 2 }, { 3, 5 } };
+    for (int32 l = 0; l < 3; ++l) {
+        TileLayer *layer = &stageLayouts[l];
+        memset(layer, 0, sizeof(TileLayer));
+
+        layer->type  = l == 2 ? LAYER_VSCROLL : LAYER_HSCROLL;
+        layer->xsize = sizes[l][0];
+        layer->ysize = sizes[l][1];
+        for (int32 y = 0; y < layer->ysize; ++y) {
+            for (int32 x = 0; x < layer->xsize; ++x) layer->tiles[x + (y << 8)] = test->Random(LAYERTEST_CHUNK_COUNT);
+        }
+        for (int32 i = 0; i < LEGACY_TILELAYER_LINESCROLL_COUNT; ++i) layer->lineScroll[i] = test->Random(4);
+
+        if (l) {
+            layer->parallaxFactor     = 0x40 + test->Random(0x100);
+            layer->scrollSpeed        = test->Random(0x20000);
+            layer->deformationOffset  = test->Random(0x100);
+            layer->deformationOffsetW = test->Random(0x100);
+        }
+    }
+
+    LineScroll *parallaxes[] = { &hParallax, &vParallax };
+    for (int32 p = 0; p < 2; ++p) {
+        LineScroll *parallax = parallaxes[p];
+        memset(parallax, 0, sizeof(LineScroll));
+
+        parallax->entryCount = 4;
+        for (int32 i = 0; i < parallax->entryCount; ++i) {
+            parallax->parallaxFactor[i] = 0x40 + test->Random(0x100);
+            parallax->scrollSpeed[i]    = test->Random(0x20000);
+            parallax->scrollPos[i]      = p ? 0 : test->Random(0x1000000);
+            parallax->deform[i]         = test->Random(2);
+        }
+    }
+
+    // the BG goes under the FG's low plane, & the FG's drawn a second time above the midpoint for its high plane
+    activeTileLayers[0] = 1;
+    activeTileLayers[1] = 0;
+    activeTileLayers[2] = 2;
+    activeTileLayers[3] = 0;
+    tLayerMidPoint      = 3;
+    lastXSize           = -1;
+    lastYSize           = -1;
+    currentScreen       = &screens[0];
+}
+
+// sets the screen up the way SetScreenSize would for a screen this wide
+inline void SetLayerTestScreenWidth(int32 width)
+{
+    SCREEN_XSIZE        = width;
+    SCREEN_CENTERX      = width / 2;
+    GFX_LINESIZE        = (width + 15) & ~15;
+    GFX_FBUFFERMINUSONE = SCREEN_YSIZE * GFX_LINESIZE - 1;
+}
+
+inline uint32 GetLayerTestChecksum()
+{
+    uint32 hash = 0x811C9DC5;
+    for (int32 i = 0; i < GFX_LINESIZE * SCREEN_YSIZE; ++i) hash = (hash ^ currentScreen->frameBuffer[i]) * 0x01000193;
+    return hash;
+}
+
+} // namespace Legacy
+} // namespace RSDK
+
+bool32 RSDK::Legacy::CheckScrollLayerFrames()
+{
+    // what each frame drew, taken from a build with RETRO_USE_FAST_SCROLL_LAYERS set to 0
+    const uint32 goldenFrames[LAYERTEST_FRAME_COUNT][2] = {
+        { 0x3E39B2A1, 0x37F75042 }, { 0xE21AF9C2, 0x140E1154 }, { 0x9346AC2C, 0xB2D23115 }, { 0xEF36FDDD, 0xE7373619 },
+        { 0x237D23DE, 0x2B4FD887 }, { 0xA2E74123, 0x409CCEFA }, { 0x693F6251, 0x92317592 }, { 0xEF00E724, 0x1F0DAC16 },
+        { 0xCBB0EE83, 0xFDB621A6 }, { 0x0B460417, 0xEF1F2131 }, { 0x45CFBE7D, 0x82527D4A }, { 0xBAA47D32, 0x5AB6C2A4 },
+        { 0x27BE4A2B, 0xF0690E35 }, { 0x601B91E6, 0xBD3C94A6 }, { 0xC5E0DC6E, 0x6EE5EF5F }, { 0xB334BE3D, 0xBD41172D },
+    };
+
+    SelfTest test("Scroll layer frames", 0x3A7F19C5);
+
+    {
+        LayerTestScene scene;
+        SetupLayerTestScene(&test);
+
+        // the horizontal frames go between a 4:3 & a widescreen width (one that isn't a multiple of a tile), with the water line & palette lines moving about,
+        // the vertical ones stay 4:3 since the deformation tables only go as wide as that
+        for (int32 f = 0; f < LAYERTEST_FRAME_COUNT; ++f) {
+            xScrollOffset = test.Random(0x300);
+            yScrollOffset = test.Random(0x200);
+            waterDrawPos  = test.Random(SCREEN_YSIZE + 1);
+            for (int32 y = 0; y < SCREEN_YSIZE; ++y) gfxLineBuffer[y] = test.Random(PALETTE_BANK_COUNT);
+
+            uint32 frames[2];
+
+            SetLayerTestScreenWidth((f & 1) ? 424 : 320);
+            memset(currentScreen->frameBuffer, 0, sizeof(currentScreen->frameBuffer));
+            stageLayouts[0].type = LAYER_HSCROLL;
+            activeTileLayers[0]  = 1;
+            DrawHLineScrollLayer(0);
+            DrawHLineScrollLayer(1);
+            DrawHLineScrollLayer(3);
+            frames[0] = GetLayerTestChecksum();
+
+            SetLayerTestScreenWidth(320);
+            memset(currentScreen->frameBuffer, 0, sizeof(currentScreen->frameBuffer));
+            stageLayouts[0].type = LAYER_VSCROLL;
+            activeTileLayers[0]  = 2;
+            DrawVLineScrollLayer(0);
+            DrawVLineScrollLayer(1);
+            DrawVLineScrollLayer(3);
+            frames[1] = GetLayerTestChecksum();
+
+            for (int32 d = 0; d < 2; ++d) {
+                test.Compare(&goldenFrames[f][d], &frames[d], sizeof(uint32), "%s frame %d came out as %08X, not %08X", d ? "vertical" : "horizontal", f,
+                             frames[d], goldenFrames[f][d]);
+            }
+        }
+    }
+
+    return test.Finish();
+}
+
+bool32 RSDK::Legacy::CheckFloor3DFrames()
+{
+    // what each frame drew, taken from a build with RETRO_USE_FAST_3D_FLOOR set to 0
+    const uint32 goldenFrames[LAYERTEST_FRAME_COUNT][2] = {
+        { 0x880EB82A, 0x7D68ABDA }, { 0x91E634CA, 0xF5FB5D0E }, { 0xE57D58BD, 0xEC5B4942 }, { 0xE2A5910B, 0xEF0CA366 },
+        { 0x33C24D06, 0xAC35FA31 }, { 0xEAA2B594, 0x25408509 }, { 0xDAAA8063, 0x98284E0C }, { 0x745C10BB, 0x38178835 },
+        { 0xF47AA4E1, 0x25BF398B }, { 0x33283A4F, 0x565E801E }, { 0x09A9E1BE, 0x7683814F }, { 0x17BBF6C7, 0x324F6AA0 },
+        { 0xD1FF82C1, 0x1747F74D }, { 0x66A0B0C6, 0x2CDA6903 }, { 0xCCCF9635, 0xF878A1F1 }, { 0xE1337FD0, 0xCC8E8C05 },
+    };
+
+    SelfTest test("3D floor frames", 0x6D2E8B47);
+
+    {
+        LayerTestScene scene;
+        SetupLayerTestScene(&test);
+
+        // the M7 tables are filled in from sinf, so they're swapped for fixed values to keep the frames the same everywhere
+        for (int32 a = 0; a < 0x200; ++a) {
+            sinM7LookupTable[a] = (int32)test.Random(0x2001) - 0x1000;
+            cosM7LookupTable[a] = (int32)test.Random(0x2001) - 0x1000;
+        }
+
+        // a few chunk tiles with a bad direction, which the original lookup reads from the start of the tile
+        for (int32 c = 0; c < 8; ++c) tiles128x128.direction[test.Random(LAYERTEST_CHUNK_COUNT * 0x40)] = 4 + test.Random(0xFC);
+
+        // the frames go between a 4:3 & a widescreen width, with the floor moving about & being changed the ways scripts can change it:
+        // a new layout every few frames, & tiles being copied, moved to other tiles or flipped
+        for (int32 f = 0; f < LAYERTEST_FRAME_COUNT; ++f) {
+            if (!(f & 3)) {
+                activeTileLayers[0] = test.Random(3);
+                Init3DFloorBuffer(activeTileLayers[0]);
+            }
+
+            Copy16x16Tile(test.Random(LAYERTEST_TILE_COUNT), test.Random(LAYERTEST_TILE_COUNT));
+            for (int32 e = 0; e < 4; ++e) {
+                int32 c = test.Random(LAYERTEST_CHUNK_COUNT * 0x40);
+                if (test.Random(2))
+                    tiles128x128.gfxDataPos[c] = test.Random(LAYERTEST_TILE_COUNT) << 8;
+                else
+                    tiles128x128.direction[c] = test.Random(4);
+            }
+#if RETRO_USE_FAST_3D_FLOOR
+            floor3DTileOffsetsDirty = true; // the same as Set16x16TileInfo does
+#endif
+
+            TileLayer *layer = &stageLayouts[activeTileLayers[0]];
+            layer->xpos      = test.Random(layer->xsize << 23);
+            layer->ypos      = 0x10000 + test.Random(0x100000);
+            layer->zpos      = test.Random(layer->ysize << 23);
+            layer->angle     = test.Random(0x200);
+            for (int32 y = 0; y < SCREEN_YSIZE; ++y) gfxLineBuffer[y] = test.Random(PALETTE_BANK_COUNT);
+
+            uint32 frames[2];
+
+            SetLayerTestScreenWidth((f & 1) ? 424 : 320);
+            memset(currentScreen->frameBuffer, 0, sizeof(currentScreen->frameBuffer));
+            Draw3DFloorLayer(0);
+            frames[0] = GetLayerTestChecksum();
+
+            memset(currentScreen->frameBuffer, 0, sizeof(currentScreen->frameBuffer));
+            Draw3DSkyLayer(0);
+            frames[1] = GetLayerTestChecksum();
+
+            for (int32 d = 0; d < 2; ++d) {
+                test.Compare(&goldenFrames[f][d], &frames[d], sizeof(uint32), "%s frame %d came out as %08X, not %08X", d ? "sky" : "floor", f, frames[d],
+                             goldenFrames[f][d]);
+            }
+        }
+    }
+
+    return test.Finish();
+}
+
+#if RETRO_USE_FAST_3D_DRAWLIST
+namespace RSDK
+{
+namespace Legacy
+{
+
+#define DRAWLISTTEST_VERTEX_COUNT (0x400)
+
+// one axis of the per-vertex transform TransformVertexSpan replaced, with the multiplies & adds wrapping around the way they always did in practice
+inline int32 TransformVertexScalar(Vertex *vertex, Matrix *matrix, int32 axis)
+{
+    uint32 x = (uint32)((int32)((uint32)vertex->x * (uint32)matrix->values[0][axis]) >> 8);
+    uint32 y = (uint32)((int32)((uint32)vertex->y * (uint32)matrix->values[1][axis]) >> 8);
+    uint32 z = (uint32)((int32)((uint32)vertex->z * (uint32)matrix->values[2][axis]) >> 8);
+    return (int32)(x + y + z + (uint32)matrix->values[3][axis]);
+}
+
+// the bubble sort the radix sort replaced
+void SortDrawListScalar(DrawListEntry3D *drawList, int32 count)
+{
+    for (int32 i = 0; i < count; ++i) {
+        for (int32 j = count - 1; j > i; --j) {
+            if (drawList[j].depth > drawList[j - 1].depth) {
+                DrawListEntry3D entry = drawList[j];
+                drawList[j]           = drawList[j - 1];
+                drawList[j - 1]       = entry;
+            }
+        }
+    }
+}
+
+// mostly values the size a 3D scene would use, but every so often anything at all, so the math overflows
+inline int32 GetDrawListTestValue(SelfTest *test, int32 range)
+{
+    if (!test->Random(8))
+        return (int32)test->Random();
+
+    return (int32)test->Random(range * 2 + 1) - range;
+}
+
+} // namespace Legacy
+} // namespace RSDK
+
+bool32 RSDK::Legacy::CheckVertexTransform()
+{
+    SelfTest test("3D vertex transform", 0x49D1A6E3);
+
+    Vertex vertices[DRAWLISTTEST_VERTEX_COUNT];
+    Vertex transformed[DRAWLISTTEST_VERTEX_COUNT];
+    Vertex expected[DRAWLISTTEST_VERTEX_COUNT];
+    Matrix matrix;
+
+    for (int32 t = 0; t < 0x1000; ++t) {
+        for (int32 y = 0; y < 4; ++y) {
+            for (int32 x = 0; x < 4; ++x) matrix.values[y][x] = GetDrawListTestValue(&test, y == 3 ? 0x100000 : 0x200);
+        }
+
+        // spans of every length up to the buffer, with a few empty ones
+        int32 count = test.Random(t & 1 ? 0x10 : DRAWLISTTEST_VERTEX_COUNT + 1);
+        for (int32 v = 0; v < DRAWLISTTEST_VERTEX_COUNT; ++v) {
+            vertices[v].x    = GetDrawListTestValue(&test, 0x10000);
+            vertices[v].y    = GetDrawListTestValue(&test, 0x10000);
+            vertices[v].z    = GetDrawListTestValue(&test, 0x10000);
+            vertices[v].u    = test.Random();
+            vertices[v].v    = test.Random();
+            transformed[v].x = test.Random();
+            transformed[v].y = test.Random();
+            transformed[v].z = test.Random();
+            transformed[v].u = test.Random();
+            transformed[v].v = test.Random();
+        }
+
+        // every other span is transformed in place, the way TransformVertices does it, the rest into another buffer like TransformVertexBuffer
+        bool32 inPlace = t & 2;
+        Vertex *dst    = inPlace ? vertices : transformed;
+        memcpy(expected, dst, sizeof(expected));
+        for (int32 v = 0; v < count; ++v) {
+            expected[v].x = TransformVertexScalar(&vertices[v], &matrix, 0);
+            expected[v].y = TransformVertexScalar(&vertices[v], &matrix, 1);
+            expected[v].z = TransformVertexScalar(&vertices[v], &matrix, 2);
+        }
+
+        TransformVertexSpan(dst, vertices, count, &matrix);
+        test.Compare(expected, dst, sizeof(expected), "TransformVertexSpan doesn't match the scalar transform (%d vertices, %s)", count,
+                     inPlace ? "in place" : "into another buffer");
+    }
+
+    return test.Finish();
+}
+
+bool32 RSDK::Legacy::CheckDrawListSort()
+{
+    SelfTest test("3D drawlist sort", 0x1C5F8E29);
+
+    DrawListEntry3D drawList[LEGACY_v4_FACEBUFFER_SIZE];
+    DrawListEntry3D expected[LEGACY_v4_FACEBUFFER_SIZE];
+
+    for (int32 t = 0; t < 0x400; ++t) {
+        // lists of every length up to the face buffer, including ones too short to sort
+        int32 count = test.Random(t & 1 ? 4 : LEGACY_v4_FACEBUFFER_SIZE + 1);
+
+        // depths from a handful of values (so most faces tie) up to anything at all (including the very lowest & highest depths),
+        // along with ones that only differ in a single byte so the passes that wouldn't move anything get skipped
+        int32 kind = test.Random(5);
+        for (int32 i = 0; i < count; ++i) {
+            switch (kind) {
+                default:
+                case 0: drawList[i].depth = test.Random(4); break;
+                case 1: drawList[i].depth = GetDrawListTestValue(&test, 0x10000); break;
+                case 2: drawList[i].depth = (int32)test.Random(); break;
+                case 3: drawList[i].depth = test.Random(3) ? 0x7FFFFFFF - test.Random(4) : (int32)(0x80000000 + test.Random(4)); break;
+                case 4: drawList[i].depth = 0x12345600 ^ (test.Random(0x100) << (8 * (t & 3))); break;
+            }
+            drawList[i].faceID = i;
+        }
+
+        memcpy(expected, drawList, sizeof(expected));
+        SortDrawListScalar(expected, count);
+        SortDrawList3D(drawList, count);
+
+        test.Compare(expected, drawList, sizeof(expected), "SortDrawList3D doesn't match the bubble sort (%d faces, depths of kind %d)", count, kind);
+    }
+
+    return test.Finish();
+}
+#endif
+
+#if RETRO_USE_PREDECODED_SCRIPTS
+#include "RSDK/Scene/Legacy/v4/ScriptLegacyv4Opcodes.hpp"
+
+namespace RSDK
+{
+namespace Legacy
+{
+namespace v4
+{
+
+#define OPERANDTEST_CODE_SIZE   (0x1000)
+#define OPERANDTEST_STRING_SIZE (0x20)
+
+// an operand as the old inline reads found it, or as it was decoded
+struct OperandTestRead {
+    int32 type;
+    int32 arrayMode;
+    int32 indexIsArrayPos;
+    int32 index;
+    int32 value;
+    int32 *ptr;
+    char text[OPERANDTEST_STRING_SIZE + 1];
+};
+
+// the test streams only use a few opcodes, covering every operand count up to the most any opcode takes
+inline int32 GetOperandTestOpcodeSize(int32 opcode)
+{
+    switch (opcode) {
+        default: return 0;
+        case FUNC_INC: return 1;
+        case FUNC_EQUAL: return 2;
+        case FUNC_IFEQUAL: return 3;
+        case FUNC_LOADPALETTE: return 5;
+        case FUNC_DRAWRECT: return 8;
+    }
+}
+
+// writes a random operand, laid out the way the compiler would but with any variable, array mode & index
+void EmitOperandTestOperand(SelfTest *test, int32 &codePos)
+{
+    switch (test->Random(4)) {
+        default:
+        case 0:
+        case 1: {
+            scriptCode[codePos++] = SCRIPTVAR_VAR;
+            int32 arrayMode       = test->Random(4);
+            scriptCode[codePos++] = arrayMode;
+            if (arrayMode != VARARR_NONE) {
+                // anything but 1 means the index is a constant
+                int32 indexIsArrayPos = test->Random(3);
+                scriptCode[codePos++] = indexIsArrayPos;
+                scriptCode[codePos++] = indexIsArrayPos == 1 ? test->Random(8) : test->Random(LEGACY_GLOBALVAR_COUNT);
+            }
+
+            // half of them are the variables that can be read straight through a pointer
+            scriptCode[codePos++] = test->Random(2) ? test->Random(VAR_LOCAL + 1) : test->Random(VAR_MAX_CNT);
+            break;
+        }
+
+        case 2:
+            scriptCode[codePos++] = SCRIPTVAR_INTCONST;
+            scriptCode[codePos++] = test->Random();
+            break;
+
+        case 3: {
+            int32 strLen          = test->Random(OPERANDTEST_STRING_SIZE + 1);
+            scriptCode[codePos++] = SCRIPTVAR_STRCONST;
+            scriptCode[codePos++] = strLen;
+            for (int32 c = 0; c <= strLen; c += 4) scriptCode[codePos++] = test->Random();
+            break;
+        }
+    }
+}
+
+// reads an operand the way ProcessScript did before scripts were predecoded, returns where the next one starts
+int32 ReadOperandTestOperand(int32 scriptCodePtr, OperandTestRead *read)
+{
+    memset(read, 0, sizeof(*read));
+
+    read->type = scriptCode[scriptCodePtr++];
+    if (read->type == SCRIPTVAR_VAR) {
+        read->arrayMode = scriptCode[scriptCodePtr++];
+        switch (read->arrayMode) {
+            case VARARR_ARRAY:
+            case VARARR_ENTNOPLUS1:
+            case VARARR_ENTNOMINUS1:
+                read->indexIsArrayPos = scriptCode[scriptCodePtr++] == 1;
+                read->index           = scriptCode[scriptCodePtr++];
+                break;
+            default: break;
+        }
+        read->value = scriptCode[scriptCodePtr++];
+
+        // these always read & write the same place, whichever entity's running & wherever the array positions are
+        bool32 constantIndex = read->arrayMode == VARARR_ARRAY && !read->indexIsArrayPos;
+        if (read->value >= VAR_TEMP0 && read->value <= VAR_TEMP7)
+            read->ptr = &scriptEng.temp[read->value - VAR_TEMP0];
+        else if (read->value == VAR_CHECKRESULT)
+            read->ptr = &scriptEng.checkResult;
+        else if (read->value >= VAR_ARRAYPOS0 && read->value <= VAR_ARRAYPOS7)
+            read->ptr = &scriptEng.arrayPosition[read->value - VAR_ARRAYPOS0];
+        else if (read->value == VAR_GLOBAL && constantIndex)
+            read->ptr = &globalVariables[read->index].value;
+        else if (read->value == VAR_LOCAL && constantIndex)
+            read->ptr = &scriptCode[read->index];
+    }
+    else if (read->type == SCRIPTVAR_INTCONST) {
+        read->value = scriptCode[scriptCodePtr++];
+    }
+    else if (read->type == SCRIPTVAR_STRCONST) {
+        int32 strLen = scriptCode[scriptCodePtr++];
+        read->index  = strLen;
+        read->value  = scriptCodePtr;
+        for (int32 c = 0; c < strLen; ++c) {
+            switch (c % 4) {
+                case 0: read->text[c] = scriptCode[scriptCodePtr] >> 24; break;
+                case 1: read->text[c] = (0xFFFFFF & scriptCode[scriptCodePtr]) >> 16; break;
+                case 2: read->text[c] = (0xFFFF & scriptCode[scriptCodePtr]) >> 8; break;
+                case 3: read->text[c] = scriptCode[scriptCodePtr++]; break;
+            }
+        }
+        scriptCodePtr++;
+    }
+
+    return scriptCodePtr;
+}
+
+void GetOperandTestDecoded(ScriptOperand *operand, OperandTestRead *read)
+{
+    memset(read, 0, sizeof(*read));
+
+    read->type            = operand->type;
+    read->arrayMode       = operand->arrayMode;
+    read->indexIsArrayPos = operand->indexIsArrayPos;
+    read->index           = operand->index;
+    read->value           = operand->value;
+    read->ptr             = operand->ptr;
+    if (operand->type == SCRIPTVAR_STRCONST && operand->stringPos >= 0)
+        memcpy(read->text, &scriptStringList[operand->stringPos], operand->index + 1);
+}
+
+} // namespace v4
+} // namespace Legacy
+} // namespace RSDK
+
+bool32 RSDK::Legacy::v4::CheckScriptOperandDecoding()
+{
+    SelfTest test("Script operand decoding", 0x2E6B93D7);
+
+    // the streams go at the very end of scriptCode, with the very last slot kept as the empty event everything starts out on
+    const int32 codeStart = LEGACY_v4_SCRIPTCODE_COUNT - 1 - OPERANDTEST_CODE_SIZE;
+    SelfTestBackup codeBackup(&scriptCode[codeStart], OPERANDTEST_CODE_SIZE * sizeof(int32));
+    SelfTestBackup instructionBackup(&scriptInstructionList[codeStart], OPERANDTEST_CODE_SIZE * sizeof(ScriptInstruction));
+    SELFTEST_BACKUP(scriptOperandPos);
+    SELFTEST_BACKUP(scriptStringPos);
+
+    const int32 opcodes[]  = { FUNC_INC, FUNC_EQUAL, FUNC_IFEQUAL, FUNC_LOADPALETTE, FUNC_DRAWRECT };
+    const int32 operandPos = scriptOperandPos;
+    const int32 stringPos  = scriptStringPos;
+
+    OperandTestRead expected;
+    OperandTestRead result;
+    for (int32 s = 0; s < 0x400; ++s) {
+        // a random stream of opcodes, ending on FUNC_END like every event does
+        int32 codePos = codeStart;
+        memset(&scriptCode[codeStart], 0, OPERANDTEST_CODE_SIZE * sizeof(int32));
+        while (codePos < codeStart + OPERANDTEST_CODE_SIZE - 0x100) {
+            int32 opcode          = opcodes[test.Random(5)];
+            scriptCode[codePos++] = opcode;
+            for (int32 i = 0; i < GetOperandTestOpcodeSize(opcode); ++i) EmitOperandTestOperand(&test, codePos);
+        }
+        scriptCode[codePos] = FUNC_END;
+
+        memset(&scriptInstructionList[codeStart], 0, OPERANDTEST_CODE_SIZE * sizeof(ScriptInstruction));
+        scriptOperandPos = operandPos;
+        scriptStringPos  = stringPos;
+        DecodeScriptCode(codeStart);
+
+        // then the stream's read the old way, checking every operand & where each opcode ends against what got decoded
+        int32 scriptCodePtr = codeStart;
+        while (scriptCode[scriptCodePtr] != FUNC_END) {
+            int32 opcodePos                = scriptCodePtr;
+            ScriptInstruction *instruction = &scriptInstructionList[opcodePos];
+            int32 opcodeSize               = GetOperandTestOpcodeSize(scriptCode[scriptCodePtr++]);
+
+            for (int32 i = 0; i < opcodeSize; ++i) {
+                scriptCodePtr = ReadOperandTestOperand(scriptCodePtr, &expected);
+                GetOperandTestDecoded(&scriptOperandList[instruction->operandPos + i], &result);
+                test.Compare(&expected, &result, sizeof(expected), "operand %d of the opcode at %d doesn't match the old read (stream %d)", i,
+                             opcodePos - codeStart, s);
+            }
+
+            test.Compare(&scriptCodePtr, &instruction->nextCodePtr, sizeof(int32), "the opcode at %d doesn't end where the old read did (stream %d)",
+                         opcodePos - codeStart, s);
+        }
+    }
+
+    return test.Finish();
+}
+#endif
+
+#if RETRO_USE_FUSED_SCRIPT_OPCODES
+namespace RSDK
+{
+namespace Legacy
+{
+namespace v4
+{
+
+#define FUSIONTEST_CODE_SIZE      (0x4000)
+#define FUSIONTEST_JUMPTABLE_SIZE (0x400)
+#define FUSIONTEST_ENTITY_COUNT   (0x20)
+#define FUSIONTEST_ENTITY_START   (8)
+#define FUSIONTEST_TYPE_COUNT     (4)
+#define FUSIONTEST_FRAME_COUNT    (0x10)
+
+// a random script written straight into scriptCode & jumpTable, the same way the compiler would lay it out
+struct FusionTestScript {
+    int32 codeStart;
+    int32 codePos;
+    int32 jumpTableStart;
+    int32 jumpTablePos;
+    int32 loopDepth;
+    SelfTest *test;
+};
+
+inline int32 NextFusionTestValue(FusionTestScript *script, int32 count) { return script->test->Random(count); }
+
+// writes a variable (or constant, when it's only read) from a mix of ones that can be fused & ones that can't,
+// temp5-7 are left alone so they can count loops, & array positions are only ever read so they can't index out of bounds
+void EmitFusionTestOperand(FusionTestScript *script, bool32 writable)
+{
+    int32 *code = &scriptCode[script->codePos];
+    int32 kind  = NextFusionTestValue(script, writable ? 6 : 8);
+
+    switch (kind) {
+        default:
+        case 0:
+            code[0] = SCRIPTVAR_VAR;
+            code[1] = VARARR_NONE;
+            code[2] = VAR_TEMP0 + NextFusionTestValue(script, 5);
+            script->codePos += 3;
+            break;
+
+        case 1:
+            code[0] = SCRIPTVAR_VAR;
+            code[1] = VARARR_NONE;
+            code[2] = VAR_CHECKRESULT;
+            script->codePos += 3;
+            break;
+
+        case 2: // global[n] is fused, global[arrayPos0] isn't
+            code[0] = SCRIPTVAR_VAR;
+            code[1] = VARARR_ARRAY;
+            code[2] = NextFusionTestValue(script, 2);
+            code[3] = code[2] ? 0 : NextFusionTestValue(script, 4);
+            code[4] = VAR_GLOBAL;
+            script->codePos += 5;
+            break;
+
+        case 3:
+        case 4: { // plain int32 entity fields are fused, the uint8 ones aren't
+            const int32 fusedFields[]   = { VAR_OBJECTXPOS, VAR_OBJECTYPOS, VAR_OBJECTSTATE, VAR_OBJECTANGLE, VAR_OBJECTVALUE0, VAR_OBJECTVALUE0 + 17, VAR_OBJECTLOOKPOSY };
+            const int32 genericFields[] = { VAR_OBJECTPROPERTYVALUE, VAR_OBJECTFRAME };
+
+            code[0]         = SCRIPTVAR_VAR;
+            code[1]         = NextFusionTestValue(script, 4);
+            int32 arrayMode = code[1];
+            script->codePos += 2;
+            if (arrayMode != VARARR_NONE) {
+                // entities are only ever 7 either side of objectEntityPos (8-23), so everything stays in the first 32
+                int32 indexIsArrayPos = NextFusionTestValue(script, 2);
+                code[2]               = indexIsArrayPos;
+                code[3]               = indexIsArrayPos ? NextFusionTestValue(script, 2) : NextFusionTestValue(script, arrayMode == VARARR_ARRAY ? 16 : 8);
+                script->codePos += 2;
+            }
+            scriptCode[script->codePos++] = kind == 3 ? fusedFields[NextFusionTestValue(script, 7)] : genericFields[NextFusionTestValue(script, 2)];
+            break;
+        }
+
+        case 6:
+            code[0] = SCRIPTVAR_VAR;
+            code[1] = VARARR_NONE;
+            code[2] = VAR_ARRAYPOS0 + NextFusionTestValue(script, 2);
+            script->codePos += 3;
+            break;
+
+        case 7:
+            code[0] = SCRIPTVAR_INTCONST;
+            code[1] = NextFusionTestValue(script, 9) - 3;
+            script->codePos += 2;
+            break;
+    }
+}
+
+inline void EmitFusionTestConstant(FusionTestScript *script, int32 value)
+{
+    scriptCode[script->codePos++] = SCRIPTVAR_INTCONST;
+    scriptCode[script->codePos++] = value;
+}
+
+inline void EmitFusionTestTemp(FusionTestScript *script, int32 temp)
+{
+    scriptCode[script->codePos++] = SCRIPTVAR_VAR;
+    scriptCode[script->codePos++] = VARARR_NONE;
+    scriptCode[script->codePos++] = VAR_TEMP0 + temp;
+}
+
+void EmitFusionTestBlock(FusionTestScript *script, int32 depth);
+
+void EmitFusionTestStatement(FusionTestScript *script, int32 depth)
+{
+    int32 kind = NextFusionTestValue(script, depth < 3 ? 10 : 7);
+
+    // arithmetic, compares & a few opcodes that always take the generic path
+    if (kind < 7) {
+        const int32 opcodes[] = { FUNC_EQUAL, FUNC_ADD,      FUNC_SUB,          FUNC_INC,         FUNC_DEC,        FUNC_MUL,         FUNC_DIV,
+                                  FUNC_SHR,   FUNC_SHL,      FUNC_AND,          FUNC_OR,          FUNC_XOR,        FUNC_MOD,         FUNC_FLIPSIGN,
+                                  FUNC_NOT,   FUNC_ABS,      FUNC_GETBIT,       FUNC_SETBIT,      FUNC_CHECKEQUAL, FUNC_CHECKGREATER, FUNC_CHECKLOWER,
+                                  FUNC_CHECKNOTEQUAL };
+        int32 opcode = opcodes[NextFusionTestValue(script, (int32)(sizeof(opcodes) / sizeof(int32)))];
+
+        scriptCode[script->codePos++] = opcode;
+        switch (opcode) {
+            default: // dest, source
+                EmitFusionTestOperand(script, true);
+                EmitFusionTestOperand(script, false);
+                break;
+
+            case FUNC_INC:
+            case FUNC_DEC:
+            case FUNC_FLIPSIGN:
+            case FUNC_NOT:
+            case FUNC_ABS: EmitFusionTestOperand(script, true); break;
+
+            // divisors & shifts stay constant so neither path hits anything undefined
+            case FUNC_DIV:
+            case FUNC_MOD:
+                EmitFusionTestOperand(script, true);
+                EmitFusionTestConstant(script, 1 + NextFusionTestValue(script, 6));
+                break;
+
+            case FUNC_SHR:
+            case FUNC_SHL:
+                EmitFusionTestOperand(script, true);
+                EmitFusionTestConstant(script, NextFusionTestValue(script, 5));
+                break;
+
+            case FUNC_GETBIT:
+                EmitFusionTestOperand(script, true);
+                EmitFusionTestOperand(script, true);
+                EmitFusionTestConstant(script, NextFusionTestValue(script, 8));
+                break;
+
+            case FUNC_SETBIT:
+                EmitFusionTestOperand(script, true);
+                EmitFusionTestConstant(script, NextFusionTestValue(script, 8));
+                EmitFusionTestOperand(script, false);
+                break;
+
+            case FUNC_CHECKEQUAL:
+            case FUNC_CHECKGREATER:
+            case FUNC_CHECKLOWER:
+            case FUNC_CHECKNOTEQUAL:
+                EmitFusionTestOperand(script, false);
+                EmitFusionTestOperand(script, false);
+                break;
+        }
+        return;
+    }
+
+    int32 jumpTablePos = script->jumpTablePos;
+    int32 *table       = &jumpTable[jumpTablePos];
+
+    switch (kind) {
+        default:
+        case 7: { // if, maybe with an else
+            script->jumpTablePos += 2;
+            scriptCode[script->codePos++] = FUNC_IFEQUAL + NextFusionTestValue(script, 6);
+            EmitFusionTestConstant(script, jumpTablePos - script->jumpTableStart);
+            EmitFusionTestOperand(script, false);
+            EmitFusionTestOperand(script, false);
+            EmitFusionTestBlock(script, depth + 1);
+
+            bool32 hasElse = NextFusionTestValue(script, 2);
+            if (hasElse) {
+                scriptCode[script->codePos++] = FUNC_ELSE;
+                table[0]                      = script->codePos - script->codeStart;
+                EmitFusionTestBlock(script, depth + 1);
+            }
+
+            scriptCode[script->codePos++] = FUNC_ENDIF;
+            table[1]                      = script->codePos - script->codeStart;
+            if (!hasElse)
+                table[0] = table[1] - 1;
+            break;
+        }
+
+        case 8: { // while, counting up in its own temp so it always ends
+            if (script->loopDepth >= 3) {
+                scriptCode[script->codePos++] = FUNC_INC;
+                EmitFusionTestOperand(script, true);
+                break;
+            }
+
+            int32 counter = 5 + script->loopDepth++;
+            int32 count   = 1 + NextFusionTestValue(script, 3);
+            script->jumpTablePos += 2;
+
+            scriptCode[script->codePos++] = FUNC_EQUAL;
+            EmitFusionTestTemp(script, counter);
+            EmitFusionTestConstant(script, 0);
+
+            table[0] = script->codePos - script->codeStart;
+            switch (NextFusionTestValue(script, 4)) {
+                default:
+                case 0:
+                    scriptCode[script->codePos++] = FUNC_WLOWER;
+                    EmitFusionTestConstant(script, jumpTablePos - script->jumpTableStart);
+                    EmitFusionTestTemp(script, counter);
+                    EmitFusionTestConstant(script, count);
+                    break;
+
+                case 1:
+                    scriptCode[script->codePos++] = FUNC_WLOWEROREQUAL;
+                    EmitFusionTestConstant(script, jumpTablePos - script->jumpTableStart);
+                    EmitFusionTestTemp(script, counter);
+                    EmitFusionTestConstant(script, count - 1);
+                    break;
+
+                case 2:
+                    scriptCode[script->codePos++] = FUNC_WNOTEQUAL;
+                    EmitFusionTestConstant(script, jumpTablePos - script->jumpTableStart);
+                    EmitFusionTestTemp(script, counter);
+                    EmitFusionTestConstant(script, count);
+                    break;
+
+                case 3:
+                    scriptCode[script->codePos++] = FUNC_WGREATER;
+                    EmitFusionTestConstant(script, jumpTablePos - script->jumpTableStart);
+                    EmitFusionTestConstant(script, count);
+                    EmitFusionTestTemp(script, counter);
+                    break;
+            }
+
+            EmitFusionTestBlock(script, depth + 1);
+            scriptCode[script->codePos++] = FUNC_INC;
+            EmitFusionTestTemp(script, counter);
+            scriptCode[script->codePos++] = FUNC_LOOP;
+            table[1]                      = script->codePos - script->codeStart;
+            --script->loopDepth;
+            break;
+        }
+
+        case 9: { // switch, with cases that break, cases that fall through, gaps & maybe a default
+            int32 minCase   = NextFusionTestValue(script, 3);
+            int32 caseCount = 1 + NextFusionTestValue(script, 4);
+            script->jumpTablePos += 4 + caseCount;
+
+            table[0] = minCase;
+            table[1] = minCase + caseCount - 1;
+            for (int32 c = 0; c < caseCount; ++c) table[4 + c] = -1;
+
+            scriptCode[script->codePos++] = FUNC_SWITCH;
+            EmitFusionTestConstant(script, jumpTablePos - script->jumpTableStart);
+            EmitFusionTestOperand(script, false);
+
+            for (int32 c = 0; c < caseCount; ++c) {
+                if (!NextFusionTestValue(script, 4))
+                    continue;
+
+                table[4 + c] = script->codePos - script->codeStart;
+                EmitFusionTestBlock(script, depth + 1);
+                if (NextFusionTestValue(script, 2))
+                    scriptCode[script->codePos++] = FUNC_BREAK;
+            }
+
+            bool32 hasDefault = NextFusionTestValue(script, 2);
+            if (hasDefault) {
+                table[2] = script->codePos - script->codeStart;
+                EmitFusionTestBlock(script, depth + 1);
+            }
+
+            scriptCode[script->codePos++] = FUNC_ENDSWITCH;
+            table[3]                      = script->codePos - script->codeStart;
+            if (!hasDefault)
+                table[2] = table[3] - 1;
+            for (int32 c = 0; c < caseCount; ++c) {
+                if (table[4 + c] < 0)
+                    table[4 + c] = table[2];
+            }
+            break;
+        }
+    }
+}
+
+void EmitFusionTestBlock(FusionTestScript *script, int32 depth)
+{
+    int32 count = 1 + NextFusionTestValue(script, 6);
+    for (int32 i = 0; i < count; ++i) {
+        // leave plenty of room for whatever's still open to be closed off
+        if (script->codePos - script->codeStart > FUSIONTEST_CODE_SIZE - 0x400
+            || script->jumpTablePos - script->jumpTableStart > FUSIONTEST_JUMPTABLE_SIZE - 0x40)
+            break;
+
+        EmitFusionTestStatement(script, depth);
+    }
+}
+
+struct FusionTestState {
+    int32 temp[8];
+    int32 arrayPosition[9];
+    int32 checkResult;
+    int32 globals[8];
+    Entity entities[FUSIONTEST_ENTITY_COUNT];
+    int32 jumpTableStackPos;
+    int32 jumpTableStack[LEGACY_v4_JUMPSTACK_COUNT];
+#if RETRO_USE_SCRIPT_PROFILER
+    uint64 opcodeCounts[LEGACY_PROFILE_OPCODE_COUNT];
+#endif
+};
+
+void StoreFusionTestState(FusionTestState *state)
+{
+    memset(state, 0, sizeof(*state));
+    memcpy(state->temp, scriptEng.temp, sizeof(state->temp));
+    memcpy(state->arrayPosition, scriptEng.arrayPosition, sizeof(state->arrayPosition));
+    state->checkResult = scriptEng.checkResult;
+    for (int32 g = 0; g < 8; ++g) state->globals[g] = globalVariables[g].value;
+    memcpy(state->entities, objectEntityList, sizeof(state->entities));
+    state->jumpTableStackPos = jumpTableStackPos;
+    memcpy(state->jumpTableStack, jumpTableStack, sizeof(state->jumpTableStack));
+#if RETRO_USE_SCRIPT_PROFILER
+    memcpy(state->opcodeCounts, scriptOpcodeProfiles, sizeof(state->opcodeCounts));
+#endif
+}
+
+void RestoreFusionTestState(FusionTestState *state)
+{
+    memcpy(scriptEng.temp, state->temp, sizeof(state->temp));
+    memcpy(scriptEng.arrayPosition, state->arrayPosition, sizeof(state->arrayPosition));
+    scriptEng.checkResult = state->checkResult;
+    for (int32 g = 0; g < 8; ++g) globalVariables[g].value = state->globals[g];
+    memcpy(objectEntityList, state->entities, sizeof(state->entities));
+    jumpTableStackPos = state->jumpTableStackPos;
+    memcpy(jumpTableStack, state->jumpTableStack, sizeof(state->jumpTableStack));
+#if RETRO_USE_SCRIPT_PROFILER
+    memcpy(scriptOpcodeProfiles, state->opcodeCounts, sizeof(state->opcodeCounts));
+#endif
+}
+
+// everything the test scripts touch, put back once the test's done
+// the scripts go at the very end of scriptCode & jumpTable, one after another, with the very last slot kept as the empty event everything starts out on
+struct FusionTestFixture {
+    FusionTestFixture(int32 scriptCount)
+        : codeStart(LEGACY_v4_SCRIPTCODE_COUNT - 1 - scriptCount * FUSIONTEST_CODE_SIZE),
+          jumpTableStart(LEGACY_v4_JUMPTABLE_COUNT - 1 - scriptCount * FUSIONTEST_JUMPTABLE_SIZE), scriptCount(scriptCount),
+          codeBackup(&scriptCode[codeStart], scriptCount * FUSIONTEST_CODE_SIZE * sizeof(int32)),
+          instructionBackup(&scriptInstructionList[codeStart], scriptCount * FUSIONTEST_CODE_SIZE * sizeof(ScriptInstruction)),
+          jumpTableBackup(&jumpTable[jumpTableStart], scriptCount * FUSIONTEST_JUMPTABLE_SIZE * sizeof(int32)),
+          entityBackup(objectEntityList, sizeof(objectEntityList)), globalBackup(globalVariables, 8 * sizeof(GlobalVariable)),
+          scriptEngBackup(&scriptEng, sizeof(scriptEng)), jumpTableStackBackup(jumpTableStack, sizeof(jumpTableStack)),
+          jumpTableStackPosBackup(&jumpTableStackPos, sizeof(jumpTableStackPos)), scriptOperandPosBackup(&scriptOperandPos, sizeof(scriptOperandPos)),
+          scriptStringPosBackup(&scriptStringPos, sizeof(scriptStringPos)), objectEntityPosBackup(&objectEntityPos, sizeof(objectEntityPos))
+#if RETRO_USE_SCRIPT_PROFILER
+          ,
+          opcodeProfileBackup(scriptOpcodeProfiles, sizeof(scriptOpcodeProfiles)),
+          opcodeTotalBackup(&scriptProfileOpcodeTotal, sizeof(scriptProfileOpcodeTotal)),
+          timeTotalBackup(&scriptProfileTimeTotal, sizeof(scriptProfileTimeTotal)), eventProfileBackup(scriptEventProfiles, sizeof(scriptEventProfiles)),
+          profilerEnabledBackup(&scriptProfilerEnabled, sizeof(scriptProfilerEnabled))
+#endif
+    {
+        operandPos = scriptOperandPos;
+        stringPos  = scriptStringPos;
+    }
+
+    inline int32 GetCodeStart(int32 script) { return codeStart + script * FUSIONTEST_CODE_SIZE; }
+    inline int32 GetJumpTableStart(int32 script) { return jumpTableStart + script * FUSIONTEST_JUMPTABLE_SIZE; }
+
+    // writes a new random script into the given slot, ending it on FUNC_END
+    void EmitScript(int32 script, SelfTest *test)
+    {
+        FusionTestScript emit;
+        emit.codeStart      = GetCodeStart(script);
+        emit.codePos        = emit.codeStart;
+        emit.jumpTableStart = GetJumpTableStart(script);
+        emit.jumpTablePos   = emit.jumpTableStart;
+        emit.loopDepth      = 0;
+        emit.test           = test;
+
+        memset(&scriptCode[emit.codeStart], 0, FUSIONTEST_CODE_SIZE * sizeof(int32));
+        EmitFusionTestBlock(&emit, 0);
+        EmitFusionTestBlock(&emit, 0);
+        scriptCode[emit.codePos++] = FUNC_END;
+    }
+
+    // decodes every script from scratch, fusing whatever can be
+    void Decode()
+    {
+        memset(&scriptInstructionList[codeStart], 0, scriptCount * FUSIONTEST_CODE_SIZE * sizeof(ScriptInstruction));
+        scriptOperandPos = operandPos;
+        scriptStringPos  = stringPos;
+        for (int32 s = 0; s < scriptCount; ++s) DecodeScriptCode(GetCodeStart(s));
+    }
+
+    // sends every opcode back through the generic path
+    void Unfuse()
+    {
+        for (int32 c = 0; c < scriptCount * FUSIONTEST_CODE_SIZE; ++c) scriptInstructionList[codeStart + c].fused = false;
+    }
+
+    // gives the test entities, temps & globals random values for the scripts to run over
+    void Randomize(SelfTest *test)
+    {
+        for (int32 e = 0; e < FUSIONTEST_ENTITY_COUNT; ++e) {
+            Entity *entity = &objectEntityList[e];
+            entity->xpos   = (int32)test->Random(0x200) - 0x100;
+            entity->ypos   = (int32)test->Random(0x200) - 0x100;
+            entity->state  = test->Random(6);
+            entity->angle  = test->Random(0x200);
+            for (int32 v = 0; v < 48; ++v) entity->values[v] = (int32)test->Random(9) - 4;
+            entity->lookPosY      = test->Random(0x10);
+            entity->propertyValue = test->Random();
+            entity->frame         = test->Random();
+        }
+        for (int32 t = 0; t < 8; ++t) scriptEng.temp[t] = (int32)test->Random(9) - 4;
+        for (int32 g = 0; g < 8; ++g) globalVariables[g].value = (int32)test->Random(9) - 4;
+        scriptEng.arrayPosition[0] = test->Random(8);
+        scriptEng.arrayPosition[1] = test->Random(8);
+        scriptEng.checkResult      = test->Random(2);
+        objectEntityPos            = FUSIONTEST_ENTITY_START;
+    }
+
+    int32 codeStart;
+    int32 jumpTableStart;
+    int32 scriptCount;
+    int32 operandPos;
+    int32 stringPos;
+
+    SelfTestBackup codeBackup;
+    SelfTestBackup instructionBackup;
+    SelfTestBackup jumpTableBackup;
+    SelfTestBackup entityBackup;
+    SelfTestBackup globalBackup;
+    SelfTestBackup scriptEngBackup;
+    SelfTestBackup jumpTableStackBackup;
+    SelfTestBackup jumpTableStackPosBackup;
+    SelfTestBackup scriptOperandPosBackup;
+    SelfTestBackup scriptStringPosBackup;
+    SelfTestBackup objectEntityPosBackup;
+#if RETRO_USE_SCRIPT_PROFILER
+    SelfTestBackup opcodeProfileBackup;
+    SelfTestBackup opcodeTotalBackup;
+    SelfTestBackup timeTotalBackup;
+    SelfTestBackup eventProfileBackup;
+    SelfTestBackup profilerEnabledBackup;
+#endif
+};
+
+} // namespace v4
+} // namespace Legacy
+} // namespace RSDK
+
+bool32 RSDK::Legacy::v4::CheckScriptFusion()
+{
+    SelfTest test("Script fusion", 0x7A3E91C5);
+    FusionTestFixture fixture(1);
+#if RETRO_USE_SCRIPT_PROFILER
+    scriptProfilerEnabled = true; // so the opcode counts can be checked too
+#endif
+
+    const int32 codeStart = fixture.GetCodeStart(0);
+    int32 opcodeCount     = 0;
+    int32 fusedCount      = 0;
+
+    FusionTestState startState;
+    FusionTestState fusedState;
+    FusionTestState plainState;
+    for (int32 s = 0; s < 0x200; ++s) {
+        fixture.EmitScript(0, &test);
+        fixture.Decode();
+
+        for (int32 c = codeStart; c < codeStart + FUSIONTEST_CODE_SIZE; ++c) {
+            if (scriptInstructionList[c].nextCodePtr) {
+                opcodeCount++;
+                fusedCount += scriptInstructionList[c].fused;
+            }
+        }
+
+        // each script runs a few times over different entities & variables, once as decoded & once with nothing fused
+        for (int32 r = 0; r < 4; ++r) {
+            fixture.Randomize(&test);
+            StoreFusionTestState(&startState);
+
+            ProcessScript(codeStart, fixture.GetJumpTableStart(0), EVENT_MAIN);
+            StoreFusionTestState(&fusedState);
+
+            RestoreFusionTestState(&startState);
+            fixture.Unfuse();
+            ProcessScript(codeStart, fixture.GetJumpTableStart(0), EVENT_MAIN);
+            StoreFusionTestState(&plainState);
+
+            test.Compare(&fusedState, &plainState, sizeof(FusionTestState), "script %d doesn't match the unfused run (run %d)", s, r);
+
+            // fuse everything again for the next run
+            fixture.Decode();
+        }
+    }
+
+    PrintLog(PRINT_NORMAL, "Script fusion: %d of %d opcodes fused", fusedCount, opcodeCount);
+    return test.Finish();
+}
+
+bool32 RSDK::Legacy::v4::CheckScriptFusionFrames()
+{
+    SelfTest test("Script fusion frames", 0x3D8C25A1);
+    FusionTestFixture fixture(FUSIONTEST_TYPE_COUNT);
+
+    // the test scripts stand in for the update events of the last few object types, with the rest of the entity list left empty
+    const int32 firstType = LEGACY_v4_OBJECT_COUNT - FUSIONTEST_TYPE_COUNT;
+    SelfTestBackup scriptListBackup(&objectScriptList[firstType], FUSIONTEST_TYPE_COUNT * sizeof(ObjectScript));
+    SELFTEST_BACKUP(processObjectFlag);
+    SELFTEST_BACKUP(objectTypeGroupList);
+    SELFTEST_BACKUP(drawListEntries);
+#if RETRO_USE_SCRIPT_PROFILER
+    scriptProfilerEnabled = true;
+#endif
+
+    FusionTestState startState;
+    FusionTestState fusedState;
+    FusionTestState plainState;
+    for (int32 s = 0; s < 0x40; ++s) {
+        for (int32 t = 0; t < FUSIONTEST_TYPE_COUNT; ++t) {
+            fixture.EmitScript(t, &test);
+
+            ObjectScript *scriptInfo              = &objectScriptList[firstType + t];
+            scriptInfo->eventUpdate.scriptCodePtr = fixture.GetCodeStart(t);
+            scriptInfo->eventUpdate.jumpTablePtr  = fixture.GetJumpTableStart(t);
+        }
+
+        memset(objectEntityList, 0, sizeof(objectEntityList));
+        fixture.Randomize(&test);
+        for (int32 e = FUSIONTEST_ENTITY_START; e < FUSIONTEST_ENTITY_START + 0x10; ++e) {
+            Entity *entity             = &objectEntityList[e];
+            entity->type               = firstType + test.Random(FUSIONTEST_TYPE_COUNT);
+            entity->priority           = PRIORITY_ALWAYS;
+            entity->objectInteractions = true;
+        }
+        StoreFusionTestState(&startState);
+
+        // every entity gets updated for a few frames, once as decoded & once with nothing fused
+        fixture.Decode();
+        for (int32 f = 0; f < FUSIONTEST_FRAME_COUNT; ++f) ProcessObjects();
+        StoreFusionTestState(&fusedState);
+
+        RestoreFusionTestState(&startState);
+        fixture.Unfuse();
+        for (int32 f = 0; f < FUSIONTEST_FRAME_COUNT; ++f) ProcessObjects();
+        StoreFusionTestState(&plainState);
+
+        test.Compare(&fusedState, &plainState, sizeof(FusionTestState), "scene %d doesn't match the unfused run after %d frames", s, FUSIONTEST_FRAME_COUNT);
+    }
+
+    return test.Finish();
+}
+
+#if RETRO_USE_SCRIPT_PROFILER
+void RSDK::Legacy::v4::BenchmarkScripts()
+{
+    SelfTest test("Script benchmark", 0x5C1B7E03);
+    FusionTestFixture fixture(1);
+
+    const int32 codeStart      = fixture.GetCodeStart(0);
+    const int32 jumpTableStart = fixture.GetJumpTableStart(0);
+
+    // [0] is as decoded, [1] is with nothing fused
+    uint64 opcodeCount[2] = { 0, 0 };
+    uint64 time[2]        = { 0, 0 };
+
+    FusionTestState startState;
+    for (int32 s = 0; s < 0x100; ++s) {
+        fixture.EmitScript(0, &test);
+        fixture.Randomize(&test);
+        StoreFusionTestState(&startState);
+
+        for (int32 f = 0; f < 2; ++f) {
+            fixture.Decode();
+            if (f)
+                fixture.Unfuse();
+
+            // every run starts from the same state, so they all go through the same opcodes as the counted one
+            RestoreFusionTestState(&startState);
+            scriptProfilerEnabled = true;
+            uint64 startOpcode    = scriptProfileOpcodeTotal;
+            ProcessScript(codeStart, jumpTableStart, EVENT_MAIN);
+            uint64 runOpcodes     = scriptProfileOpcodeTotal - startOpcode;
+            scriptProfilerEnabled = false;
+
+            for (int32 r = 0; r < 0x100; ++r) {
+                RestoreFusionTestState(&startState);
+
+                uint64 startTime = GetScriptProfileTime();
+                ProcessScript(codeStart, jumpTableStart, EVENT_MAIN);
+                time[f] += GetScriptProfileTime() - startTime;
+                opcodeCount[f] += runOpcodes;
+            }
+        }
+    }
+
+    for (int32 f = 0; f < 2; ++f) {
+        PrintLog(PRINT_NORMAL, "Script benchmark (%s): %llu opcodes in %.2fms, %.2fM opcodes/sec", f ? "nothing fused" : "as decoded",
+                 (unsigned long long)opcodeCount[f], time[f] / 1000000.0, time[f] ? opcodeCount[f] * 1000.0 / time[f] : 0.0);
+    }
+}
+#endif
+#endif
@@ -0,0 +1,44 @@
+namespace Legacy
+{
+
+#if RETRO_USE_FAST_SCROLL_LAYERS
+// checks the masked tile lines the h/v scroll layers draw with against a plain per-pixel draw, for every tile line, flip & span
+bool32 CheckScrollLayerTiles();
+#endif
+
+// draws a few frames of random h/v scroll layers & checks they come out the same as they did before the fast paths went in
+bool32 CheckScrollLayerFrames();
+// draws a few frames of random 3D floor & sky layers & checks they come out the same as they did before the flipped tile cache went in
+bool32 CheckFloor3DFrames();
+
+#if RETRO_USE_FAST_3D_DRAWLIST
+// checks the SIMD vertex transform against the scalar one, in place & not, with values big enough to overflow
+bool32 CheckVertexTransform();
+// checks the radix sorted drawlist against the bubble sort it replaced, with lots of ties & the very lowest & highest depths
+bool32 CheckDrawListSort();
+#endif
+
+#if RETRO_USE_PREDECODED_SCRIPTS
+namespace v4
+{
+// decodes random operand streams & checks every operand (and where each opcode ends) against reading them straight out of scriptCode
+bool32 CheckScriptOperandDecoding();
+} // namespace v4
+#endif
+
+#if RETRO_USE_FUSED_SCRIPT_OPCODES
+namespace v4
+{
+// runs random scripts as decoded & again with nothing fused, checking both leave everything the same
+bool32 CheckScriptFusion();
+// updates entities running random scripts for a few frames, as decoded & again with nothing fused, checking they all end up the same
+bool32 CheckScriptFusionFrames();
+
+#if RETRO_USE_SCRIPT_PROFILER
+// times random scripts through ProcessScript & logs how many opcodes a second they ran at, both as decoded & with nothing fused
+void BenchmarkScripts();
+#endif
+} // namespace v4
+#endif
+
+} // namespace Legacy
@@ -0,0 +1,187 @@
+#include "RSDK/Core/RetroEngine.hpp"
+
+#if RETRO_USE_SELF_TESTS
+
+#if RETRO_REV0U
+#include "Legacy/SelfTestsLegacy.cpp"
+#endif
+
+using namespace RSDK;
+
+bool32 SelfTest::Compare(const void *expected, const void *result, size_t size, const char *message, ...)
+{
+    if (!memcmp(expected, result, size))
+        return true;
+
+    if (failures++ < 8) {
+        char buffer[0x200];
+
+        va_list args;
+        va_start(args, message);
+        vsnprintf(buffer, sizeof(buffer), message, args);
+        va_end(args);
+
+        PrintLog(PRINT_NORMAL, "%s: %s", name, buffer);
+    }
+
+    return false;
+}
+
+bool32 SelfTest::Finish()
+{
+    PrintLog(PRINT_NORMAL, "%s: %s (%d mismatches)", name, failures ? "FAILED" : "OK", failures);
+    return !failures;
+}
+
+SelfTestBackup::SelfTestBackup(void *data, size_t size) : data(data), size(size)
+{
+    copy = malloc(size);
+    memcpy(copy, data, size);
+}
+
+SelfTestBackup::~SelfTestBackup()
+{
+    memcpy(data, copy, size);
+    free(copy);
+}
+
+#if RETRO_USE_FAST_PALETTE_BLENDING
+namespace RSDK
+{
+
+inline uint32 UnpackPaletteColor(uint16 clr) { return ((clr & 0xF800) << 8) | ((clr & 0x7E0) << 5) | ((clr & 0x1F) << 3); }
+
+inline uint16 BlendPaletteColor(uint32 clrA, uint32 clrB, int32 blendAmount)
+{
+    int32 blendA = 0xFF - blendAmount;
+    int32 r      = blendAmount * ((clrB >> 0x10) & 0xFF) + blendA * ((clrA >> 0x10) & 0xFF);
+    int32 g      = blendAmount * ((clrB >> 0x08) & 0xFF) + blendA * ((clrA >> 0x08) & 0xFF);
+    int32 b      = blendAmount * ((clrB >> 0x00) & 0xFF) + blendA * ((clrA >> 0x00) & 0xFF);
+
+    return PACK_RGB888((uint8)(r >> 8), (uint8)(g >> 8), (uint8)(b >> 8));
+}
+
+// SetPaletteFade done one color at a time, the way it was before the SIMD path (the wrapped read & the write past the bank at endIndex 0x100 included)
+void FadePaletteScalar(uint16 (*palette)[PALETTE_BANK_SIZE], uint8 destBankID, uint8 srcBankA, uint8 srcBankB, int32 blendAmount, int32 startIndex,
+                       int32 endIndex)
+{
+    blendAmount = CLAMP(blendAmount, 0x00, 0xFF);
+    endIndex    = MIN(endIndex, 0x100);
+
+    if (startIndex >= endIndex)
+        return;
+
+    uint16 *paletteColor = &palette[0][0] + destBankID * PALETTE_BANK_SIZE + startIndex;
+    for (int32 i = startIndex; i <= endIndex; ++i) {
+        uint32 clrA     = UnpackPaletteColor(palette[srcBankA][(uint8)i]);
+        uint32 clrB     = UnpackPaletteColor(palette[srcBankB][(uint8)i]);
+        *paletteColor++ = BlendPaletteColor(clrA, clrB, blendAmount);
+    }
+}
+
+} // namespace RSDK
+
+bool32 RSDK::CheckPaletteBlending()
+{
+    SelfTest test("Palette blending", 0x1F2E3D4C);
+    SELFTEST_BACKUP(fullPalette);
+
+    uint16 expected[PALETTE_BANK_COUNT][PALETTE_BANK_SIZE];
+
+    // every RGB565 color is faded both from & into, at every amount (plus one either side to check the clamping)
+    for (int32 c = 0; c < 0x10000; c += PALETTE_BANK_SIZE) {
+        for (int32 i = 0; i < PALETTE_BANK_SIZE; ++i) {
+            fullPalette[0][i] = c + i;
+            fullPalette[1][i] = (c + i) * 0x9E37; // odd, so bank 1 covers every color too, just in a different order
+        }
+
+        for (int32 amount = -1; amount <= 0x100; ++amount) {
+            memcpy(expected, fullPalette, sizeof(fullPalette));
+            FadePaletteScalar(expected, 2, 0, 1, amount, 0, 0xFF);
+            SetPaletteFade(2, 0, 1, amount, 0, 0xFF);
+
+            test.Compare(expected, fullPalette, sizeof(fullPalette), "SetPaletteFade doesn't match the plain fade (colors %04X-%04X, amount %d)", c,
+                         c + 0xFF, amount);
+        }
+    }
+
+    // random banks (the same bank can be both source & destination) & ranges, including empty ones & ones ending at 0x100
+    for (int32 t = 0; t < 0x4000; ++t) {
+        for (int32 b = 0; b < PALETTE_BANK_COUNT; ++b) {
+            for (int32 i = 0; i < PALETTE_BANK_SIZE; ++i) fullPalette[b][i] = test.Random();
+        }
+
+        uint8 destBankID = test.Random(PALETTE_BANK_COUNT - 1); // the last bank has nothing after it to take the 0x100 write
+        uint8 srcBankA   = test.Random(PALETTE_BANK_COUNT);
+        uint8 srcBankB   = test.Random(PALETTE_BANK_COUNT);
+        int32 amount     = (int32)test.Random(0x120) - 0x10;
+        int32 startIndex = test.Random(0x101);
+        int32 endIndex   = test.Random(0x110);
+
+        memcpy(expected, fullPalette, sizeof(fullPalette));
+        FadePaletteScalar(expected, destBankID, srcBankA, srcBankB, amount, startIndex, endIndex);
+        SetPaletteFade(destBankID, srcBankA, srcBankB, amount, startIndex, endIndex);
+
+        test.Compare(expected, fullPalette, sizeof(fullPalette), "SetPaletteFade(%d, %d, %d, %d, %d, %d) doesn't match the plain fade", destBankID,
+                     srcBankA, srcBankB, amount, startIndex, endIndex);
+    }
+
+#if RETRO_REV02
+    // the first few blends go through every amount over a whole bank, the rest are random ranges
+    uint32 colorsA[PALETTE_BANK_SIZE];
+    uint32 colorsB[PALETTE_BANK_SIZE];
+    for (int32 t = 0; t < 0x4000; ++t) {
+        for (int32 i = 0; i < PALETTE_BANK_SIZE; ++i) {
+            colorsA[i] = test.Random();
+            colorsB[i] = test.Random();
+        }
+
+        uint8 destBankID = test.Random(PALETTE_BANK_COUNT);
+        int32 amount     = t <= 0x101 ? t - 1 : (int32)test.Random(0x120) - 0x10;
+        int32 startIndex = t <= 0x101 ? 0 : test.Random(PALETTE_BANK_SIZE);
+        int32 count      = t <= 0x101 ? PALETTE_BANK_SIZE : test.Random(PALETTE_BANK_SIZE + 1 - startIndex);
+
+        memcpy(expected, fullPalette, sizeof(fullPalette));
+        for (int32 i = 0; i < count; ++i) expected[destBankID][startIndex + i] = BlendPaletteColor(colorsA[i], colorsB[i], CLAMP(amount, 0x00, 0xFF));
+        BlendColors(destBankID, colorsA, colorsB, amount, startIndex, count);
+
+        test.Compare(expected, fullPalette, sizeof(fullPalette), "BlendColors(%d, %d, %d, %d) doesn't match the plain blend", destBankID, amount,
+                     startIndex, count);
+    }
+#endif
+
+    return test.Finish();
+}
+#endif
+
+bool32 RSDK::RunSelfTests()
+{
+    bool32 passed = true;
+
+#if RETRO_USE_FAST_PALETTE_BLENDING
+    passed &= CheckPaletteBlending();
+#endif
+#if RETRO_REV0U && RETRO_USE_FAST_SCROLL_LAYERS
+    passed &= Legacy::CheckScrollLayerTiles();
+#endif
+#if RETRO_REV0U
+    passed &= Legacy::CheckScrollLayerFrames();
+    passed &= Legacy::CheckFloor3DFrames();
+#endif
+#if RETRO_REV0U && RETRO_USE_FAST_3D_DRAWLIST
+    passed &= Legacy::CheckVertexTransform();
+    passed &= Legacy::CheckDrawListSort();
+#endif
+#if RETRO_REV0U && RETRO_USE_PREDECODED_SCRIPTS
+    passed &= Legacy::v4::CheckScriptOperandDecoding();
+#endif
+#if RETRO_REV0U && RETRO_USE_FUSED_SCRIPT_OPCODES
+    passed &= Legacy::v4::CheckScriptFusion();
+    passed &= Legacy::v4::CheckScriptFusionFrames();
+#endif
+
+    PrintLog(PRINT_NORMAL, "Self tests %s", passed ? "passed" : "FAILED");
+    return passed;
+}
+
+#endif
@@ -0,0 +1,56 @@
+#ifndef SELFTESTS_H
+#define SELFTESTS_H
+
+namespace RSDK
+{
+
+// seeds, compares & reports a single self test, a plain xorshift is used so every run goes through the same "random" cases
+struct SelfTest {
+    SelfTest(const char *name, uint32 seed) : name(name), seed(seed) {}
+
+    inline uint32 Random()
+    {
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+        return seed;
+    }
+    inline uint32 Random(uint32 count) { return Random() % count; }
+
+    // compares what the fast path did with what the plain code it stands in for would've done, only the first few mismatches are logged
+    bool32 Compare(const void *expected, const void *result, size_t size, const char *message, ...);
+
+    // logs "name: OK/FAILED" & returns whether everything matched
+    bool32 Finish();
+
+    const char *name = nullptr;
+    uint32 seed      = 0;
+    int32 failures   = 0;
+};
+
+// copies some engine state when it's made & puts it back when it goes out of scope, so a test can scribble over globals it doesn't own
+struct SelfTestBackup {
+    SelfTestBackup(void *data, size_t size);
+    ~SelfTestBackup();
+
+    void *data;
+    void *copy;
+    size_t size;
+};
+
+#define SELFTEST_BACKUP(var) SelfTestBackup var##Backup(&(var), sizeof(var))
+
+bool32 RunSelfTests();
+
+#if RETRO_USE_FAST_PALETTE_BLENDING
+// checks the SIMD fades & blends against the plain per-color loop, for every blend amount & every color
+bool32 CheckPaletteBlending();
+#endif
+
+#if RETRO_REV0U
+#include "Legacy/SelfTestsLegacy.hpp"
+#endif
+
+} // namespace RSDK
+
+#endif
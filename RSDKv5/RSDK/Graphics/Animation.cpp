@@ -7,6 +7,9 @@
 using namespace RSDK;
 
 SpriteAnimation RSDK::spriteAnimationList[SPRFILE_COUNT];
+#if RETRO_USE_RESOURCE_REGISTRY
+HashRegistry<SPRFILE_COUNT> RSDK::spriteAnimationRegistry;
+#endif
 
 uint16 RSDK::LoadSpriteAnimation(const char *filePath, int32 scope)
 {
@@ -16,6 +19,13 @@ uint16 RSDK::LoadSpriteAnimation(const char *filePath, int32 scope)
     RETRO_HASH_MD5(hash);
     GEN_HASH_MD5(filePath, hash);
 
+#if RETRO_USE_RESOURCE_REGISTRY
+    int32 existing = spriteAnimationRegistry.Find(hash);
+    if (existing >= 0)
+        return existing;
+
+    uint16 id = spriteAnimationRegistry.GetFreeSlot();
+#else
     for (int32 i = 0; i < SPRFILE_COUNT; ++i) {
         if (HASH_MATCH_MD5(spriteAnimationList[i].hash, hash))
             return i;
@@ -26,6 +36,7 @@ uint16 RSDK::LoadSpriteAnimation(const char *filePath, int32 scope)
         if (spriteAnimationList[id].scope == SCOPE_NONE)
             break;
     }
+#endif
 
     if (id >= SPRFILE_COUNT)
         return -1;
@@ -47,6 +58,9 @@ uint16 RSDK::LoadSpriteAnimation(const char *filePath, int32 scope)
         SpriteAnimation *spr = &spriteAnimationList[id];
         spr->scope           = scope;
         memcpy(spr->hash, hash, 4 * sizeof(uint32));
+#if RETRO_USE_RESOURCE_REGISTRY
+        spriteAnimationRegistry.Register(id, hash, scope);
+#endif
 
         uint32 frameCount = ReadInt32(&info, false);
         AllocateStorage((void **)&spr->frames, frameCount * sizeof(SpriteFrame), DATASET_STG, false);
@@ -116,6 +130,13 @@ uint16 RSDK::CreateSpriteAnimation(const char *filename, uint32 frameCount, uint
     RETRO_HASH_MD5(hash);
     GEN_HASH_MD5(filename, hash);
 
+#if RETRO_USE_RESOURCE_REGISTRY
+    int32 existing = spriteAnimationRegistry.Find(hash);
+    if (existing >= 0)
+        return existing;
+
+    uint16 id = spriteAnimationRegistry.GetFreeSlot();
+#else
     for (int32 i = 0; i < SPRFILE_COUNT; ++i) {
         if (HASH_MATCH_MD5(spriteAnimationList[i].hash, hash)) {
             return i;
@@ -127,6 +148,7 @@ uint16 RSDK::CreateSpriteAnimation(const char *filename, uint32 frameCount, uint
         if (spriteAnimationList[id].scope == SCOPE_NONE)
             break;
     }
+#endif
 
     if (id >= SPRFILE_COUNT)
         return -1;
@@ -134,6 +156,9 @@ uint16 RSDK::CreateSpriteAnimation(const char *filename, uint32 frameCount, uint
     SpriteAnimation *spr = &spriteAnimationList[id];
     spr->scope           = scope;
     memcpy(spr->hash, hash, 4 * sizeof(uint32));
+#if RETRO_USE_RESOURCE_REGISTRY
+    spriteAnimationRegistry.Register(id, hash, scope);
+#endif
 
     AllocateStorage((void **)&spr->frames, sizeof(SpriteFrame) * MIN(frameCount, SPRITEFRAME_COUNT), DATASET_STG, true);
     AllocateStorage((void **)&spr->animations, sizeof(SpriteAnimationEntry) * MIN(animCount, SPRITEANIM_COUNT), DATASET_STG, true);
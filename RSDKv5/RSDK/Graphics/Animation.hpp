@@ -78,6 +78,9 @@ struct Animator {
 };
 
 extern SpriteAnimation spriteAnimationList[SPRFILE_COUNT];
+#if RETRO_USE_RESOURCE_REGISTRY
+extern HashRegistry<SPRFILE_COUNT> spriteAnimationRegistry;
+#endif
 
 uint16 LoadSpriteAnimation(const char *filename, int32 scope);
 uint16 CreateSpriteAnimation(const char *filename, uint32 frameCount, uint32 animCount, int32 scope);
@@ -182,12 +185,19 @@ void SetSpriteString(uint16 aniFrames, uint16 animID, String *string);
 inline void ClearSpriteAnimations()
 {
     // Unload animations
+#if RETRO_USE_RESOURCE_REGISTRY
+    spriteAnimationRegistry.ReleaseScope(SCOPE_STAGE, [](int32 s) {
+        MEM_ZERO(spriteAnimationList[s]);
+        spriteAnimationList[s].scope = SCOPE_NONE;
+    });
+#else
     for (int32 s = 0; s < SPRFILE_COUNT; ++s) {
         if (spriteAnimationList[s].scope != SCOPE_GLOBAL) {
             MEM_ZERO(spriteAnimationList[s]);
             spriteAnimationList[s].scope = SCOPE_NONE;
         }
     }
+#endif
 }
 
 #if RETRO_REV0U
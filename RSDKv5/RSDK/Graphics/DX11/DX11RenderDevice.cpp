@@ -1813,6 +1813,11 @@ void RenderDevice::SetupVideoTexture_YUV420(int32 width, int32 height, uint8 *yP
             }
         }
         else {
+#if RETRO_USE_SOFTWARE_VIDEO
+            // No shader support means no YUV support! so do the conversion ourselves
+            ConvertVideoFrame_XRGB8888((uint32 *)pixels, mappedResource.RowPitch >> 2, width, height, yPlane, uPlane, vPlane,
+                                       strideY, strideU, strideV, TH_PF_420, false);
+#else
             // No shader support means no YUV support! at least use the brightness to show it in grayscale!
             for (int32 y = 0; y < height; ++y) {
                 for (int32 x = 0; x < width; ++x) {
@@ -1823,6 +1828,7 @@ void RenderDevice::SetupVideoTexture_YUV420(int32 width, int32 height, uint8 *yP
                 pixels += pitch;
                 yPlane += strideY;
             }
+#endif
         }
 
         dx11Context->Unmap(imageTexture, 0);
@@ -1860,6 +1866,11 @@ void RenderDevice::SetupVideoTexture_YUV422(int32 width, int32 height, uint8 *yP
             }
         }
         else {
+#if RETRO_USE_SOFTWARE_VIDEO
+            // No shader support means no YUV support! so do the conversion ourselves
+            ConvertVideoFrame_XRGB8888((uint32 *)pixels, mappedResource.RowPitch >> 2, width, height, yPlane, uPlane, vPlane,
+                                       strideY, strideU, strideV, TH_PF_422, false);
+#else
             // No shader support means no YUV support! at least use the brightness to show it in grayscale!
             for (int32 y = 0; y < height; ++y) {
                 for (int32 x = 0; x < width; ++x) {
@@ -1870,6 +1881,7 @@ void RenderDevice::SetupVideoTexture_YUV422(int32 width, int32 height, uint8 *yP
                 pixels += pitch;
                 yPlane += strideY;
             }
+#endif
         }
 
         dx11Context->Unmap(imageTexture, 0);
@@ -1901,6 +1913,11 @@ void RenderDevice::SetupVideoTexture_YUV444(int32 width, int32 height, uint8 *yP
             }
         }
         else {
+#if RETRO_USE_SOFTWARE_VIDEO
+            // No shader support means no YUV support! so do the conversion ourselves
+            ConvertVideoFrame_XRGB8888((uint32 *)pixels, mappedResource.RowPitch >> 2, width, height, yPlane, uPlane, vPlane,
+                                       strideY, strideU, strideV, TH_PF_444, false);
+#else
             // No shader support means no YUV support! at least use the brightness to show it in grayscale!
             for (int32 y = 0; y < height; ++y) {
                 for (int32 x = 0; x < width; ++x) {
@@ -1911,6 +1928,7 @@ void RenderDevice::SetupVideoTexture_YUV444(int32 width, int32 height, uint8 *yP
                 pixels += pitch;
                 yPlane += strideY;
             }
+#endif
         }
 
         dx11Context->Unmap(imageTexture, 0);
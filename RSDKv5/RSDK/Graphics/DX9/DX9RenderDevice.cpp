@@ -1536,6 +1536,11 @@ void RenderDevice::SetupVideoTexture_YUV420(int32 width, int32 height, uint8 *yP
             }
         }
         else {
+#if RETRO_USE_SOFTWARE_VIDEO
+            // No shader support means no YUV support! so do the conversion ourselves
+            ConvertVideoFrame_XRGB8888((uint32 *)pixels, rect.Pitch >> 2, width, height, yPlane, uPlane, vPlane,
+                                       strideY, strideU, strideV, TH_PF_420, false);
+#else
             // No shader support means no YUV support! at least use the brightness to show it in grayscale!
             for (int32 y = 0; y < height; ++y) {
                 for (int32 x = 0; x < width; ++x) {
@@ -1546,6 +1551,7 @@ void RenderDevice::SetupVideoTexture_YUV420(int32 width, int32 height, uint8 *yP
                 pixels += pitch;
                 yPlane += strideY;
             }
+#endif
         }
 
         imageTexture->UnlockRect(0);
@@ -1585,6 +1591,11 @@ void RenderDevice::SetupVideoTexture_YUV422(int32 width, int32 height, uint8 *yP
             }
         }
         else {
+#if RETRO_USE_SOFTWARE_VIDEO
+            // No shader support means no YUV support! so do the conversion ourselves
+            ConvertVideoFrame_XRGB8888((uint32 *)pixels, rect.Pitch >> 2, width, height, yPlane, uPlane, vPlane,
+                                       strideY, strideU, strideV, TH_PF_422, false);
+#else
             // No shader support means no YUV support! at least use the brightness to show it in grayscale!
             for (int32 y = 0; y < height; ++y) {
                 for (int32 x = 0; x < width; ++x) {
@@ -1595,6 +1606,7 @@ void RenderDevice::SetupVideoTexture_YUV422(int32 width, int32 height, uint8 *yP
                 pixels += pitch;
                 yPlane += strideY;
             }
+#endif
         }
 
         imageTexture->UnlockRect(0);
@@ -1628,6 +1640,11 @@ void RenderDevice::SetupVideoTexture_YUV444(int32 width, int32 height, uint8 *yP
             }
         }
         else {
+#if RETRO_USE_SOFTWARE_VIDEO
+            // No shader support means no YUV support! so do the conversion ourselves
+            ConvertVideoFrame_XRGB8888((uint32 *)pixels, rect.Pitch >> 2, width, height, yPlane, uPlane, vPlane,
+                                       strideY, strideU, strideV, TH_PF_444, false);
+#else
             // No shader support means no YUV support! at least use the brightness to show it in grayscale!
             for (int32 y = 0; y < height; ++y) {
                 for (int32 x = 0; x < width; ++x) {
@@ -1638,6 +1655,7 @@ void RenderDevice::SetupVideoTexture_YUV444(int32 width, int32 height, uint8 *yP
                 pixels += pitch;
                 yPlane += strideY;
             }
+#endif
         }
 
         imageTexture->UnlockRect(0);
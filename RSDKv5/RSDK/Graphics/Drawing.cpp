@@ -141,6 +141,8 @@ const RenderVertex rsdkVertexBuffer[24] =
 #include "GLFW/GLFWRenderDevice.cpp"
 #elif RETRO_RENDERDEVICE_EGL
 #include "EGL/EGLRenderDevice.cpp"
+#elif RETRO_RENDERDEVICE_NULL
+#include "Null/NullRenderDevice.cpp"
 #endif
 
 RenderDevice::WindowInfo RenderDevice::displayInfo;
@@ -151,6 +153,9 @@ uint16 RSDK::blendLookupTable[0x20 * 0x100];
 uint16 RSDK::subtractLookupTable[0x20 * 0x100];
 
 GFXSurface RSDK::gfxSurface[SURFACE_COUNT];
+#if RETRO_USE_RESOURCE_REGISTRY
+HashRegistry<SURFACE_COUNT> RSDK::surfaceRegistry;
+#endif
 
 float RSDK::dpi         = 1;
 int32 RSDK::cameraCount = 0;
@@ -158,6 +163,14 @@ ScreenInfo RSDK::screens[SCREEN_COUNT];
 CameraInfo RSDK::cameras[CAMERA_COUNT];
 ScreenInfo *RSDK::currentScreen = NULL;
 
+#if RETRO_USE_DIRTY_SCREEN_ROWS
+uint16 RSDK::screenRowCopies[SCREEN_COUNT][SCREEN_XMAX * SCREEN_YSIZE];
+int32 RSDK::screenRowWidths[SCREEN_COUNT];
+#if RETRO_USE_PALETTE_TRACKING
+bool32 RSDK::screensUnchanged = false;
+#endif
+#endif
+
 int32 RSDK::shaderCount = 0;
 ShaderEntry RSDK::shaderList[SHADER_COUNT];
 
@@ -277,6 +290,47 @@ void RSDK::GenerateBlendLookupTable()
     }
 }
 
+#if RETRO_USE_DIRTY_SCREEN_ROWS
+bool32 RSDK::GetDirtyScreenRows(int32 screenID, int32 width, int32 *firstRow, int32 *rowCount)
+{
+    bool32 rebuild = screenRowWidths[screenID] != width;
+
+#if RETRO_USE_PALETTE_TRACKING
+    // nothing's been drawn & no colors have changed, so every row still matches what was last uploaded
+    if (screensUnchanged && !changedPaletteBanks && !rebuild)
+        return false;
+#endif
+
+    ScreenInfo *screen = &screens[screenID];
+    uint16 *copies     = screenRowCopies[screenID];
+
+    int32 first    = SCREEN_YSIZE;
+    int32 last     = -1;
+
+    // width is never more than the pitch, so a row always fits in SCREEN_XMAX
+    uint16 *pixels = screen->frameBuffer;
+    for (int32 y = 0; y < SCREEN_YSIZE; ++y) {
+        uint16 *copy = &copies[y * SCREEN_XMAX];
+        if (rebuild || memcmp(pixels, copy, width * sizeof(uint16))) {
+            memcpy(copy, pixels, width * sizeof(uint16));
+            if (y < first)
+                first = y;
+            last = y;
+        }
+
+        pixels += screen->pitch;
+    }
+
+    screenRowWidths[screenID] = width;
+
+    *firstRow = first;
+    *rowCount = last + 1 - first;
+    return last >= 0;
+}
+
+void RSDK::InvalidateScreenRows() { memset(screenRowWidths, 0, sizeof(screenRowWidths)); }
+#endif
+
 void RSDK::InitSystemSurfaces()
 {
     GEN_HASH_MD5("TileBuffer", gfxSurface[0].hash);
@@ -285,6 +339,9 @@ void RSDK::InitSystemSurfaces()
     gfxSurface[0].height   = TILE_COUNT * TILE_SIZE;
     gfxSurface[0].lineSize = 4; // 16px
     gfxSurface[0].pixels   = tilesetPixels;
+#if RETRO_USE_RESOURCE_REGISTRY
+    surfaceRegistry.Register(0, gfxSurface[0].hash, SCOPE_GLOBAL);
+#endif
 
 #if RETRO_REV02
     GEN_HASH_MD5("EngineText", gfxSurface[1].hash);
@@ -293,6 +350,9 @@ void RSDK::InitSystemSurfaces()
     gfxSurface[1].height   = 128 * 8;
     gfxSurface[1].lineSize = 3; // 8px
     gfxSurface[1].pixels   = devTextStencil;
+#if RETRO_USE_RESOURCE_REGISTRY
+    surfaceRegistry.Register(1, gfxSurface[1].hash, SCOPE_GLOBAL);
+#endif
 #endif
 }
 
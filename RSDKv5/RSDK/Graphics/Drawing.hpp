@@ -252,6 +252,8 @@ private:
 #include "GLFW/GLFWRenderDevice.hpp"
 #elif RETRO_RENDERDEVICE_EGL
 #include "EGL/EGLRenderDevice.hpp"
+#elif RETRO_RENDERDEVICE_NULL
+#include "Null/NullRenderDevice.hpp"
 #endif
 
 extern DrawList drawGroups[DRAWGROUP_COUNT];
@@ -261,6 +263,9 @@ extern uint16 blendLookupTable[0x20 * 0x100];
 extern uint16 subtractLookupTable[0x20 * 0x100];
 
 extern GFXSurface gfxSurface[SURFACE_COUNT];
+#if RETRO_USE_RESOURCE_REGISTRY
+extern HashRegistry<SURFACE_COUNT> surfaceRegistry;
+#endif
 
 extern float dpi;
 extern int32 cameraCount;
@@ -287,6 +292,20 @@ void GenerateBlendLookupTable();
 
 void InitSystemSurfaces();
 
+#if RETRO_USE_DIRTY_SCREEN_ROWS
+extern uint16 screenRowCopies[SCREEN_COUNT][SCREEN_XMAX * SCREEN_YSIZE]; // what each row held when it was last uploaded
+extern int32 screenRowWidths[SCREEN_COUNT];                             // the width the copies were taken at, 0 if they need rebuilding
+
+// compares each row of the screen against what it held last time, returns false if nothing changed
+bool32 GetDirtyScreenRows(int32 screenID, int32 width, int32 *firstRow, int32 *rowCount);
+// forces the next GetDirtyScreenRows call to report every row (after the screen textures are recreated, etc)
+void InvalidateScreenRows();
+#if RETRO_USE_PALETTE_TRACKING
+// set when a frame went by without anything being drawn (stepping over frames with the dev menu), reset once the screens are copied out
+extern bool32 screensUnchanged;
+#endif
+#endif
+
 void GetDisplayInfo(int32 *displayID, int32 *width, int32 *height, int32 *refreshRate, char *text);
 void GetWindowSize(int32 *width, int32 *height);
 
@@ -408,12 +427,19 @@ void DrawDevString(const char *string, int32 x, int32 y, int32 align, uint32 col
 inline void ClearGfxSurfaces()
 {
     // Unload sprite sheets
+#if RETRO_USE_RESOURCE_REGISTRY
+    surfaceRegistry.ReleaseScope(SCOPE_STAGE, [](int32 s) {
+        MEM_ZERO(gfxSurface[s]);
+        gfxSurface[s].scope = SCOPE_NONE;
+    });
+#else
     for (int32 s = 0; s < SURFACE_COUNT; ++s) {
         if (gfxSurface[s].scope != SCOPE_GLOBAL) {
             MEM_ZERO(gfxSurface[s]);
             gfxSurface[s].scope = SCOPE_NONE;
         }
     }
+#endif
 }
 
 #if RETRO_REV0U
@@ -380,6 +380,9 @@ bool RenderDevice::InitGraphicsAPI()
         glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
         glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
     }
+#if RETRO_USE_DIRTY_SCREEN_ROWS
+    InvalidateScreenRows();
+#endif
     glGenTextures(1, &imageTexture);
     glBindTexture(GL_TEXTURE_2D, imageTexture);
 #if RETRO_PLATFORM == RETRO_SWITCH
@@ -469,8 +472,18 @@ void RenderDevice::CopyFrameBuffer()
         return;
 
     for (int32 s = 0; s < videoSettings.screenCount; ++s) {
+#if RETRO_USE_DIRTY_SCREEN_ROWS
+        int32 firstRow = 0, rowCount = 0;
+        if (!GetDirtyScreenRows(s, screens[s].pitch, &firstRow, &rowCount))
+            continue;
+
+        glBindTexture(GL_TEXTURE_2D, screenTextures[s]);
+        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, firstRow, screens[s].pitch, rowCount, GL_RGB, GL_UNSIGNED_SHORT_5_6_5,
+                        &screens[s].frameBuffer[firstRow * screens[s].pitch]);
+#else
         glBindTexture(GL_TEXTURE_2D, screenTextures[s]);
         glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, screens[s].pitch, SCREEN_YSIZE, GL_RGB, GL_UNSIGNED_SHORT_5_6_5, screens[s].frameBuffer);
+#endif
     }
 }
 
@@ -840,6 +853,10 @@ void RenderDevice::SetupVideoTexture_YUV420(int32 width, int32 height, uint8 *yP
         }
     }
     else {
+#if RETRO_USE_SOFTWARE_VIDEO
+        // No shader support means no YUV support! so do the conversion ourselves
+        ConvertVideoFrame_XRGB8888(pixels, RETRO_VIDEO_TEXTURE_W, width, height, yPlane, uPlane, vPlane, strideY, strideU, strideV, TH_PF_420, _YOFF == 0);
+#else
         // No shader support means no YUV support! at least use the brightness to show it in grayscale!
         for (int32 y = 0; y < height; ++y) {
             for (int32 x = 0; x < width; ++x) {
@@ -850,6 +867,7 @@ void RenderDevice::SetupVideoTexture_YUV420(int32 width, int32 height, uint8 *yP
             pixels += pitch;
             yPlane += strideY;
         }
+#endif
     }
 
     glBindTexture(GL_TEXTURE_2D, imageTexture);
@@ -888,6 +906,10 @@ void RenderDevice::SetupVideoTexture_YUV422(int32 width, int32 height, uint8 *yP
         }
     }
     else {
+#if RETRO_USE_SOFTWARE_VIDEO
+        // No shader support means no YUV support! so do the conversion ourselves
+        ConvertVideoFrame_XRGB8888(pixels, RETRO_VIDEO_TEXTURE_W, width, height, yPlane, uPlane, vPlane, strideY, strideU, strideV, TH_PF_422, _YOFF == 0);
+#else
         // No shader support means no YUV support! at least use the brightness to show it in grayscale!
         for (int32 y = 0; y < height; ++y) {
             for (int32 x = 0; x < width; ++x) {
@@ -898,6 +920,7 @@ void RenderDevice::SetupVideoTexture_YUV422(int32 width, int32 height, uint8 *yP
             pixels += pitch;
             yPlane += strideY;
         }
+#endif
     }
 
     glBindTexture(GL_TEXTURE_2D, imageTexture);
@@ -927,6 +950,10 @@ void RenderDevice::SetupVideoTexture_YUV444(int32 width, int32 height, uint8 *yP
         }
     }
     else {
+#if RETRO_USE_SOFTWARE_VIDEO
+        // No shader support means no YUV support! so do the conversion ourselves
+        ConvertVideoFrame_XRGB8888(pixels, RETRO_VIDEO_TEXTURE_W, width, height, yPlane, uPlane, vPlane, strideY, strideU, strideV, TH_PF_444, _YOFF == 0);
+#else
         // No shader support means no YUV support! at least use the brightness to show it in grayscale!
         for (int32 y = 0; y < height; ++y) {
             for (int32 x = 0; x < width; ++x) {
@@ -937,6 +964,7 @@ void RenderDevice::SetupVideoTexture_YUV444(int32 width, int32 height, uint8 *yP
             pixels += pitch;
             yPlane += strideY;
         }
+#endif
     }
 
     glBindTexture(GL_TEXTURE_2D, imageTexture);
@@ -43,6 +43,170 @@ void RSDK::Legacy::ClearScreen(uint8 index)
     }
 }
 
+#if RETRO_USE_FAST_SCROLL_LAYERS
+namespace RSDK
+{
+namespace Legacy
+{
+
+inline uint32 ReverseTileMask(uint32 mask)
+{
+    mask = ((mask >> 1) & 0x5555) | ((mask & 0x5555) << 1);
+    mask = ((mask >> 2) & 0x3333) | ((mask & 0x3333) << 2);
+    mask = ((mask >> 4) & 0x0F0F) | ((mask & 0x0F0F) << 4);
+    return ((mask >> 8) & 0x00FF) | ((mask & 0x00FF) << 8);
+}
+
+// gets which of the count pixels (starting at start along one of the tile's rows or columns) aren't transparent, one bit per pixel in draw order
+inline uint32 GetTileSpanMask(uint16 *masks, int32 gfxDataPos, int32 line, bool32 reversed, int32 start, int32 count, uint8 *pixels, int32 step)
+{
+    uint32 tile = (uint32)gfxDataPos / LEGACY_TILE_DATASIZE;
+    if (!(gfxDataPos % LEGACY_TILE_DATASIZE) && tile < LEGACY_TILE_COUNT) {
+        uint32 mask = masks[tile * TILE_SIZE + line];
+        if (reversed)
+            mask = ReverseTileMask(mask);
+
+        return (mask >> start) & ((1 << count) - 1);
+    }
+
+    // scripts can point a tile anywhere, so anything outside the tileset is checked pixel by pixel
+    uint32 mask = 0;
+    for (int32 i = 0; i < count; ++i) {
+        if (pixels[i * step] > 0)
+            mask |= 1 << i;
+    }
+    return mask;
+}
+
+// the shared masked span for the scroll layers: empty spans are skipped, solid ones are copied straight through the palette,
+// & anything in between is blended by mask (16 pixels at once when the span is a full horizontal tile line)
+inline void DrawTileSpan(uint16 *frameBuffer, int32 pitch, uint8 *pixels, int32 step, int32 count, uint32 mask)
+{
+    if (!mask)
+        return;
+
+    uint16 *palette = activePalette;
+    if (mask == (uint32)((1 << count) - 1)) {
+        while (count--) {
+            *frameBuffer = palette[*pixels];
+            frameBuffer += pitch;
+            pixels += step;
+        }
+        return;
+    }
+
+#if RETRO_USE_SSE2 || RETRO_USE_NEON
+    if (count == TILE_SIZE && pitch == 1) {
+        uint16 colors[TILE_SIZE];
+        for (int32 i = 0; i < TILE_SIZE; ++i) colors[i] = palette[pixels[i * step]];
+
+#if RETRO_USE_SSE2
+        const __m128i bits = _mm_set_epi16(0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01);
+        __m128i maskLo     = _mm_cmpeq_epi16(_mm_and_si128(_mm_set1_epi16(mask & 0xFF), bits), bits);
+        __m128i maskHi     = _mm_cmpeq_epi16(_mm_and_si128(_mm_set1_epi16(mask >> 8), bits), bits);
+
+        __m128i pixelsLo = _mm_loadu_si128((__m128i *)&colors[0]);
+        __m128i pixelsHi = _mm_loadu_si128((__m128i *)&colors[8]);
+        __m128i destLo   = _mm_loadu_si128((__m128i *)&frameBuffer[0]);
+        __m128i destHi   = _mm_loadu_si128((__m128i *)&frameBuffer[8]);
+
+        _mm_storeu_si128((__m128i *)&frameBuffer[0], _mm_or_si128(_mm_and_si128(maskLo, pixelsLo), _mm_andnot_si128(maskLo, destLo)));
+        _mm_storeu_si128((__m128i *)&frameBuffer[8], _mm_or_si128(_mm_and_si128(maskHi, pixelsHi), _mm_andnot_si128(maskHi, destHi)));
+#elif RETRO_USE_NEON
+        const uint16 bitList[8] = { 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80 };
+        uint16x8_t bits         = vld1q_u16(bitList);
+        uint16x8_t maskLo       = vtstq_u16(vdupq_n_u16(mask & 0xFF), bits);
+        uint16x8_t maskHi       = vtstq_u16(vdupq_n_u16(mask >> 8), bits);
+
+        vst1q_u16(&frameBuffer[0], vbslq_u16(maskLo, vld1q_u16(&colors[0]), vld1q_u16(&frameBuffer[0])));
+        vst1q_u16(&frameBuffer[8], vbslq_u16(maskHi, vld1q_u16(&colors[8]), vld1q_u16(&frameBuffer[8])));
+#endif
+        return;
+    }
+#endif
+
+    for (; count--; mask >>= 1) {
+        if (mask & 1)
+            *frameBuffer = palette[*pixels];
+        frameBuffer += pitch;
+        pixels += step;
+    }
+}
+
+// draws count pixels of tile row tileY (starting from tileX), returns where the framebuffer ends up (tiles with a bad direction aren't drawn or stepped over)
+uint16 *DrawHLineTile(uint16 *frameBuffer, int32 chunk, int32 tileX, int32 tileY, int32 count)
+{
+    int32 gfxDataPos = tiles128x128.gfxDataPos[chunk];
+    int32 row        = tileY;
+    int32 step       = 1;
+    uint8 *pixels    = NULL;
+
+    switch (tiles128x128.direction[chunk]) {
+        default: return frameBuffer;
+
+        case FLIP_NONE: pixels = &tilesetGFXData[TILE_SIZE * row + gfxDataPos + tileX]; break;
+
+        case FLIP_X:
+            step   = -1;
+            pixels = &tilesetGFXData[TILE_SIZE * row + 0xF + gfxDataPos - tileX];
+            break;
+
+        case FLIP_Y:
+            row    = 0xF - tileY;
+            pixels = &tilesetGFXData[TILE_SIZE * row + gfxDataPos + tileX];
+            break;
+
+        case FLIP_XY:
+            row    = 0xF - tileY;
+            step   = -1;
+            pixels = &tilesetGFXData[TILE_SIZE * row + 0xF + gfxDataPos - tileX];
+            break;
+    }
+
+    uint32 mask = GetTileSpanMask(tilesetRowMasks, gfxDataPos, row, step < 0, tileX, count, pixels, step);
+    DrawTileSpan(frameBuffer, 1, pixels, step, count, mask);
+    return frameBuffer + count;
+}
+
+// draws count pixels of tile column tileX (starting from tileY), returns where the framebuffer ends up (tiles with a bad direction aren't drawn or stepped over)
+uint16 *DrawVLineTile(uint16 *frameBuffer, int32 chunk, int32 tileX, int32 tileY, int32 count)
+{
+    int32 gfxDataPos = tiles128x128.gfxDataPos[chunk];
+    int32 column     = tileX;
+    int32 step       = TILE_SIZE;
+    uint8 *pixels    = NULL;
+
+    switch (tiles128x128.direction[chunk]) {
+        default: return frameBuffer;
+
+        case FLIP_NONE: pixels = &tilesetGFXData[TILE_SIZE * tileY + column + gfxDataPos]; break;
+
+        case FLIP_X:
+            column = 0xF - tileX;
+            pixels = &tilesetGFXData[TILE_SIZE * tileY + column + gfxDataPos];
+            break;
+
+        case FLIP_Y:
+            step   = -TILE_SIZE;
+            pixels = &tilesetGFXData[column + TILE_SIZE * (0xF - tileY) + gfxDataPos];
+            break;
+
+        case FLIP_XY:
+            column = 0xF - tileX;
+            step   = -TILE_SIZE;
+            pixels = &tilesetGFXData[column + TILE_SIZE * (0xF - tileY) + gfxDataPos];
+            break;
+    }
+
+    uint32 mask = GetTileSpanMask(tilesetColumnMasks, gfxDataPos, column, step < 0, tileY, count, pixels, step);
+    DrawTileSpan(frameBuffer, GFX_LINESIZE, pixels, step, count, mask);
+    return frameBuffer + GFX_LINESIZE * count;
+}
+
+} // namespace Legacy
+} // namespace RSDK
+#endif
+
 void RSDK::Legacy::DrawHLineScrollLayer(int32 layerID)
 {
     TileLayer *layer = &stageLayouts[activeTileLayers[layerID]];
@@ -139,6 +303,61 @@ void RSDK::Legacy::DrawHLineScrollLayer(int32 layerID)
             int32 tilePxXPos        = chunkX & 0xF;
             int32 tileXPxRemain     = TILE_SIZE - tilePxXPos;
             int32 chunk             = (layer->tiles[(chunkX >> 7) + (chunkY << 8)] << 6) + ((chunkX & 0x7F) >> 4) + 8 * tileY;
+#if RETRO_USE_FAST_SCROLL_LAYERS
+            int32 lineRemain    = GFX_LINESIZE;
+            int32 tilePxLineCnt = tileXPxRemain;
+
+            // Draw the first tile to the left
+            lineRemain -= tilePxLineCnt;
+            if (tiles128x128.visualPlane[chunk] == (uint8)aboveMidPoint)
+                frameBuffer = DrawHLineTile(frameBuffer, chunk, tilePxXPos, tileY16, tilePxLineCnt);
+            else
+                frameBuffer += tilePxLineCnt;
+
+            // Draw the bulk of the tiles
+            int32 chunkTileX   = ((chunkX & 0x7F) >> 4) + 1;
+            int32 tilesPerLine = screenwidth16;
+            while (tilesPerLine--) {
+                if (chunkTileX < 8) {
+                    ++chunk;
+                }
+                else {
+                    if (++chunkXPos == layerwidth)
+                        chunkXPos = 0;
+
+                    chunkTileX = 0;
+                    chunk      = (layer->tiles[chunkXPos + (chunkY << 8)] << 6) + 8 * tileY;
+                }
+                lineRemain -= TILE_SIZE;
+
+                if (tiles128x128.visualPlane[chunk] == (uint8)aboveMidPoint)
+                    frameBuffer = DrawHLineTile(frameBuffer, chunk, 0, tileY16, TILE_SIZE);
+                else
+                    frameBuffer += TILE_SIZE;
+                ++chunkTileX;
+            }
+
+            // Draw any remaining tiles
+            while (lineRemain > 0) {
+                if (chunkTileX++ < 8) {
+                    ++chunk;
+                }
+                else {
+                    chunkTileX = 0;
+                    if (++chunkXPos == layerwidth)
+                        chunkXPos = 0;
+
+                    chunk = (layer->tiles[chunkXPos + (chunkY << 8)] << 6) + 8 * tileY;
+                }
+
+                tilePxLineCnt = lineRemain >= TILE_SIZE ? TILE_SIZE : lineRemain;
+                lineRemain -= tilePxLineCnt;
+                if (tiles128x128.visualPlane[chunk] == (uint8)aboveMidPoint)
+                    frameBuffer = DrawHLineTile(frameBuffer, chunk, 0, tileY16, tilePxLineCnt);
+                else
+                    frameBuffer += tilePxLineCnt;
+            }
+#else
             int32 tileOffsetY       = TILE_SIZE * tileY16;
             int32 tileOffsetYFlipX  = TILE_SIZE * tileY16 + 0xF;
             int32 tileOffsetYFlipY  = TILE_SIZE * (0xF - tileY16);
@@ -619,6 +838,7 @@ void RSDK::Legacy::DrawHLineScrollLayer(int32 layerID)
                     frameBuffer += tilePxLineCnt;
                 }
             }
+#endif
 
             if (++tileY16 >= TILE_SIZE) {
                 tileY16 = 0;
@@ -716,6 +936,64 @@ void RSDK::Legacy::DrawVLineScrollLayer(int32 layerID)
         int32 tileY             = chunkY & 0xF;
         int32 tileYPxRemain     = TILE_SIZE - tileY;
         int32 chunk             = (layer->tiles[chunkX + (chunkY >> 7 << 8)] << 6) + tileX + 8 * ((chunkY & 0x7F) >> 4);
+#if RETRO_USE_FAST_SCROLL_LAYERS
+        int32 lineRemain    = SCREEN_YSIZE;
+        int32 tilePxLineCnt = tileYPxRemain;
+
+        // Draw the first tile to the left
+        lineRemain -= tilePxLineCnt;
+        if (tiles128x128.visualPlane[chunk] == (uint8)aboveMidPoint)
+            frameBuffer = DrawVLineTile(frameBuffer, chunk, tileX16, tileY, tilePxLineCnt);
+        else
+            frameBuffer += GFX_LINESIZE * tileYPxRemain;
+
+        // Draw the bulk of the tiles
+        int32 chunkTileY   = ((chunkY & 0x7F) >> 4) + 1;
+        int32 tilesPerLine = (SCREEN_YSIZE >> 4) - 1;
+
+        while (tilesPerLine--) {
+            if (chunkTileY < 8) {
+                chunk += 8;
+            }
+            else {
+                if (++chunkYPos == layerheight)
+                    chunkYPos = 0;
+
+                chunkTileY = 0;
+                chunk      = (layer->tiles[chunkX + (chunkYPos << 8)] << 6) + tileX;
+            }
+            lineRemain -= TILE_SIZE;
+
+            if (tiles128x128.visualPlane[chunk] == (uint8)aboveMidPoint)
+                frameBuffer = DrawVLineTile(frameBuffer, chunk, tileX16, 0, TILE_SIZE);
+            else
+                frameBuffer += GFX_LINESIZE * TILE_SIZE;
+            ++chunkTileY;
+        }
+
+        // Draw any remaining tiles
+        while (lineRemain > 0) {
+            if (chunkTileY < 8) {
+                chunk += 8;
+            }
+            else {
+                if (++chunkYPos == layerheight)
+                    chunkYPos = 0;
+
+                chunkTileY = 0;
+                chunk      = (layer->tiles[chunkX + (chunkYPos << 8)] << 6) + tileX;
+            }
+
+            tilePxLineCnt = lineRemain >= TILE_SIZE ? TILE_SIZE : lineRemain;
+            lineRemain -= tilePxLineCnt;
+
+            if (tiles128x128.visualPlane[chunk] == (uint8)aboveMidPoint)
+                frameBuffer = DrawVLineTile(frameBuffer, chunk, tileX16, 0, tilePxLineCnt);
+            else
+                frameBuffer += GFX_LINESIZE * tilePxLineCnt;
+            chunkTileY++;
+        }
+#else
         int32 tileOffsetXFlipX  = 0xF - tileX16;
         int32 tileOffsetXFlipY  = tileX16 + SCREEN_YSIZE;
         int32 tileOffsetXFlipXY = 0xFF - tileX16;
@@ -1197,6 +1475,7 @@ void RSDK::Legacy::DrawVLineScrollLayer(int32 layerID)
             }
             chunkTileY++;
         }
+#endif
 
         if (++tileX16 >= TILE_SIZE) {
             tileX16 = 0;
@@ -1214,12 +1493,52 @@ void RSDK::Legacy::DrawVLineScrollLayer(int32 layerID)
         frameBuffer -= GFX_FBUFFERMINUSONE;
     }
 }
+#if RETRO_USE_FAST_3D_FLOOR
+namespace RSDK
+{
+namespace Legacy
+{
+
+// the pixel at a 3D floor position (in 1/4096ths of a pixel), from the flipped tile cache if the tile's in it
+inline uint8 *GetFloor3DPixel(int32 XPos, int32 YPos)
+{
+    int32 tileX = XPos >> 12;
+    int32 tileY = YPos >> 12;
+    int32 cell  = (YPos >> 16 << 8) + (XPos >> 16);
+
+    if (cell < 0x100 * 0x100) {
+        int32 offset = floor3DTileOffsets[cell];
+        if (offset >= 0)
+            return &floor3DTiles[offset + TILE_SIZE * (tileY & 0xF) + (tileX & 0xF)];
+    }
+
+    int32 chunk   = tile3DFloorBuffer[cell];
+    uint8 *pixels = &tilesetGFXData[tiles128x128.gfxDataPos[chunk]];
+    switch (tiles128x128.direction[chunk]) {
+        case FLIP_NONE: pixels += TILE_SIZE * (tileY & 0xF) + (tileX & 0xF); break;
+        case FLIP_X: pixels += TILE_SIZE * (tileY & 0xF) + 15 - (tileX & 0xF); break;
+        case FLIP_Y: pixels += (tileX & 0xF) + SCREEN_YSIZE - TILE_SIZE * (tileY & 0xF); break;
+        case FLIP_XY: pixels += 15 - (tileX & 0xF) + SCREEN_YSIZE - TILE_SIZE * (tileY & 0xF); break;
+        default: break;
+    }
+    return pixels;
+}
+
+} // namespace Legacy
+} // namespace RSDK
+#endif
+
 void RSDK::Legacy::Draw3DFloorLayer(int32 layerID)
 {
     TileLayer *layer = &stageLayouts[activeTileLayers[layerID]];
     if (!layer->xsize || !layer->ysize)
         return;
 
+#if RETRO_USE_FAST_3D_FLOOR
+    if (floor3DTileOffsetsDirty)
+        UpdateFloor3DTileOffsets();
+#endif
+
     int32 layerWidth    = layer->xsize << 7;
     int32 layerHeight   = layer->ysize << 7;
     int32 layerYPos     = layer->ypos;
@@ -1245,6 +1564,9 @@ void RSDK::Legacy::Draw3DFloorLayer(int32 layerID)
             int32 tileX = XPos >> 12;
             int32 tileY = YPos >> 12;
             if (tileX > -1 && tileX < layerWidth && tileY > -1 && tileY < layerHeight) {
+#if RETRO_USE_FAST_3D_FLOOR
+                uint8 *pixels = GetFloor3DPixel(XPos, YPos);
+#else
                 int32 chunk   = tile3DFloorBuffer[(YPos >> 16 << 8) + (XPos >> 16)];
                 uint8 *pixels = &tilesetGFXData[tiles128x128.gfxDataPos[chunk]];
                 switch (tiles128x128.direction[chunk]) {
@@ -1254,6 +1576,7 @@ void RSDK::Legacy::Draw3DFloorLayer(int32 layerID)
                     case FLIP_XY: pixels += 15 - (tileX & 0xF) + SCREEN_YSIZE - TILE_SIZE * (tileY & 0xF); break;
                     default: break;
                 }
+#endif
 
                 if (*pixels > 0)
                     *frameBuffer = activePalette[*pixels];
@@ -1272,6 +1595,11 @@ void RSDK::Legacy::Draw3DSkyLayer(int32 layerID)
     if (!layer->xsize || !layer->ysize)
         return;
 
+#if RETRO_USE_FAST_3D_FLOOR
+    if (floor3DTileOffsetsDirty)
+        UpdateFloor3DTileOffsets();
+#endif
+
     int32 layerWidth    = layer->xsize << 7;
     int32 layerHeight   = layer->ysize << 7;
     int32 layerYPos     = layer->ypos;
@@ -1297,6 +1625,9 @@ void RSDK::Legacy::Draw3DSkyLayer(int32 layerID)
             int32 tileX = XPos >> 12;
             int32 tileY = YPos >> 12;
             if (tileX > -1 && tileX < layerWidth && tileY > -1 && tileY < layerHeight) {
+#if RETRO_USE_FAST_3D_FLOOR
+                uint8 *pixels = GetFloor3DPixel(XPos, YPos);
+#else
                 int32 chunk   = tile3DFloorBuffer[(YPos >> 16 << 8) + (XPos >> 16)];
                 uint8 *pixels = &tilesetGFXData[tiles128x128.gfxDataPos[chunk]];
 
@@ -1307,6 +1638,7 @@ void RSDK::Legacy::Draw3DSkyLayer(int32 layerID)
                     case FLIP_XY: pixels += 0xF - (tileX & 0xF) + SCREEN_YSIZE - TILE_SIZE * (tileY & 0xF); break;
                     default: break;
                 }
+#endif
 
                 if (*pixels > 0)
                     *frameBuffer = activePalette[*pixels];
@@ -3219,3 +3551,4 @@ void RSDK::Legacy::DrawTextMenu(void *menu, int32 XPos, int32 YPos)
         default: break;
     }
 }
+
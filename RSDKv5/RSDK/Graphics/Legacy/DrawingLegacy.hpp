@@ -50,6 +50,10 @@ void DrawHLineScrollLayer(int32 layerID);
 void DrawVLineScrollLayer(int32 layerID);
 void Draw3DFloorLayer(int32 layerID);
 void Draw3DSkyLayer(int32 layerID);
+#if RETRO_USE_FAST_SCROLL_LAYERS
+uint16 *DrawHLineTile(uint16 *frameBuffer, int32 chunk, int32 tileX, int32 tileY, int32 count);
+uint16 *DrawVLineTile(uint16 *frameBuffer, int32 chunk, int32 tileX, int32 tileY, int32 count);
+#endif
 
 // Shape Drawing
 void DrawRectangle(int32 XPos, int32 YPos, int32 width, int32 height, int32 R, int32 G, int32 B, int32 A);
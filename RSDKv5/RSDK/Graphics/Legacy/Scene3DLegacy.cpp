@@ -107,4 +107,120 @@ void RSDK::Legacy::ProcessScanEdgeUV(Vertex *vertA, Vertex *vertB)
         fullU += deltaU;
         fullV += deltaV;
     }
-}
\ No newline at end of file
+}
+#if RETRO_USE_FAST_3D_DRAWLIST
+namespace RSDK
+{
+namespace Legacy
+{
+#if RETRO_USE_SSE2
+// SSE2 has no 32-bit mullo, so the low halves of the even & odd lane products are put back together by hand
+inline __m128i MultiplyMatrixRow(__m128i value, __m128i row, __m128i rowOdd)
+{
+    __m128i even = _mm_shuffle_epi32(_mm_mul_epu32(value, row), _MM_SHUFFLE(3, 1, 2, 0));
+    __m128i odd  = _mm_shuffle_epi32(_mm_mul_epu32(value, rowOdd), _MM_SHUFFLE(3, 1, 2, 0));
+    return _mm_srai_epi32(_mm_unpacklo_epi32(even, odd), 8);
+}
+#endif
+} // namespace Legacy
+} // namespace RSDK
+
+void RSDK::Legacy::TransformVertexSpan(Vertex *dst, Vertex *src, int32 count, Matrix *matrix)
+{
+#if RETRO_USE_SSE2
+    __m128i row0    = _mm_loadu_si128((__m128i *)matrix->values[0]);
+    __m128i row1    = _mm_loadu_si128((__m128i *)matrix->values[1]);
+    __m128i row2    = _mm_loadu_si128((__m128i *)matrix->values[2]);
+    __m128i row3    = _mm_loadu_si128((__m128i *)matrix->values[3]);
+    __m128i row0Odd = _mm_srli_epi64(row0, 32);
+    __m128i row1Odd = _mm_srli_epi64(row1, 32);
+    __m128i row2Odd = _mm_srli_epi64(row2, 32);
+
+    for (int32 v = 0; v < count; ++v) {
+        // x, y, z & u, the 4th lane is never stored
+        __m128i pos = _mm_loadu_si128((__m128i *)&src[v]);
+
+        __m128i out = _mm_add_epi32(MultiplyMatrixRow(_mm_shuffle_epi32(pos, 0x00), row0, row0Odd),
+                                    MultiplyMatrixRow(_mm_shuffle_epi32(pos, 0x55), row1, row1Odd));
+        out         = _mm_add_epi32(_mm_add_epi32(out, MultiplyMatrixRow(_mm_shuffle_epi32(pos, 0xAA), row2, row2Odd)), row3);
+
+        _mm_storel_epi64((__m128i *)&dst[v].x, out);
+        dst[v].z = _mm_cvtsi128_si32(_mm_shuffle_epi32(out, 0xAA));
+    }
+#elif RETRO_USE_NEON
+    int32x4_t row0 = vld1q_s32(matrix->values[0]);
+    int32x4_t row1 = vld1q_s32(matrix->values[1]);
+    int32x4_t row2 = vld1q_s32(matrix->values[2]);
+    int32x4_t row3 = vld1q_s32(matrix->values[3]);
+
+    for (int32 v = 0; v < count; ++v) {
+        int32x4_t out = vaddq_s32(vshrq_n_s32(vmulq_n_s32(row0, src[v].x), 8), vshrq_n_s32(vmulq_n_s32(row1, src[v].y), 8));
+        out           = vaddq_s32(vaddq_s32(out, vshrq_n_s32(vmulq_n_s32(row2, src[v].z), 8)), row3);
+
+        vst1_s32(&dst[v].x, vget_low_s32(out));
+        dst[v].z = vgetq_lane_s32(out, 2);
+    }
+#else
+    for (int32 v = 0; v < count; ++v) {
+        int32 vx = src[v].x;
+        int32 vy = src[v].y;
+        int32 vz = src[v].z;
+
+        dst[v].x = (vx * matrix->values[0][0] >> 8) + (vy * matrix->values[1][0] >> 8) + (vz * matrix->values[2][0] >> 8) + matrix->values[3][0];
+        dst[v].y = (vx * matrix->values[0][1] >> 8) + (vy * matrix->values[1][1] >> 8) + (vz * matrix->values[2][1] >> 8) + matrix->values[3][1];
+        dst[v].z = (vx * matrix->values[0][2] >> 8) + (vy * matrix->values[1][2] >> 8) + (vz * matrix->values[2][2] >> 8) + matrix->values[3][2];
+    }
+#endif
+}
+
+void RSDK::Legacy::SortDrawList3D(DrawListEntry3D *drawList, int32 count)
+{
+    static_assert(LEGACY_v3_FACEBUFFER_SIZE <= LEGACY_v4_FACEBUFFER_SIZE, "v3 drawlist won't fit in the sort buffer");
+
+    if (count > LEGACY_v4_FACEBUFFER_SIZE)
+        count = LEGACY_v4_FACEBUFFER_SIZE;
+    if (count < 2)
+        return;
+
+    // flipping every bit but the sign bit gives a key that orders the deepest faces first when sorted as unsigned
+    uint32 offsets[4][0x100];
+    memset(offsets, 0, sizeof(offsets));
+    for (int32 i = 0; i < count; ++i) {
+        uint32 key = (uint32)drawList[i].depth ^ 0x7FFFFFFF;
+        ++offsets[0][key & 0xFF];
+        ++offsets[1][(key >> 8) & 0xFF];
+        ++offsets[2][(key >> 16) & 0xFF];
+        ++offsets[3][key >> 24];
+    }
+
+    DrawListEntry3D sortBuffer[LEGACY_v4_FACEBUFFER_SIZE];
+    DrawListEntry3D *listIn  = drawList;
+    DrawListEntry3D *listOut = sortBuffer;
+    for (int32 b = 0; b < 4; ++b) {
+        int32 shift = b * 8;
+
+        // every face has the same byte here, so this pass wouldn't move anything
+        if (offsets[b][(((uint32)listIn[0].depth ^ 0x7FFFFFFF) >> shift) & 0xFF] == (uint32)count)
+            continue;
+
+        uint32 offset = 0;
+        for (int32 i = 0; i < 0x100; ++i) {
+            uint32 bucketSize = offsets[b][i];
+            offsets[b][i]     = offset;
+            offset += bucketSize;
+        }
+
+        for (int32 i = 0; i < count; ++i) {
+            uint32 key                                   = (uint32)listIn[i].depth ^ 0x7FFFFFFF;
+            listOut[offsets[b][(key >> shift) & 0xFF]++] = listIn[i];
+        }
+
+        DrawListEntry3D *swap = listIn;
+        listIn                = listOut;
+        listOut               = swap;
+    }
+
+    if (listIn != drawList)
+        memcpy(drawList, listIn, count * sizeof(DrawListEntry3D));
+}
+#endif
@@ -67,6 +67,13 @@ extern int32 faceLineEndV[SCREEN_YSIZE];
 void ProcessScanEdge(Vertex *vertA, Vertex *vertB);
 void ProcessScanEdgeUV(Vertex *vertA, Vertex *vertB);
 
+#if RETRO_USE_FAST_3D_DRAWLIST
+// transforms the positions of count vertices from src into dst (which can be the same as src), their uvs are left as they are
+void TransformVertexSpan(Vertex *dst, Vertex *src, int32 count, Matrix *matrix);
+// sorts drawList from the furthest face to the nearest, faces with the same depth stay in the order they were added
+void SortDrawList3D(DrawListEntry3D *drawList, int32 count);
+#endif
+
 } // namespace Legacy
 
 #include "v3/Scene3DLegacyv3.hpp"
@@ -26,8 +26,24 @@ int32 RSDK::Legacy::AddGraphicsFile(const char *filePath)
         gfxDataPosition += surface->width * surface->height;
 
         if (gfxDataPosition < LEGACY_GFXDATA_SIZE) {
+#if RETRO_USE_SPRITE_CACHE
+            RETRO_HASH_MD5(sourceKey);
+            if (LoadSpriteCache(sheetPath, &image.info, surface->width, surface->height, &graphicData[surface->dataPosition], sourceKey)) {
+                image.Close();
+            }
+            else {
+                int32 fileOffset = image.info.fileOffset;
+                int32 fileSize   = image.info.fileSize;
+
+                image.pixels = &graphicData[surface->dataPosition];
+                image.Load(NULL, false);
+
+                SaveSpriteCache(sheetPath, sourceKey, fileOffset, fileSize, surface->width, surface->height, &graphicData[surface->dataPosition]);
+            }
+#else
             image.pixels = &graphicData[surface->dataPosition];
             image.Load(NULL, false);
+#endif
         }
         else {
             gfxDataPosition = 0;
@@ -192,6 +192,13 @@ void RSDK::Legacy::v3::TransformVertexBuffer()
     }
     MatrixMultiply(&matFinal, &matView);
 
+#if RETRO_USE_SCRIPT_PROFILER
+    Scene3DProfileScope profile(SCENE3D_PROFILE_TRANSFORM, vertexCount);
+#endif
+
+#if RETRO_USE_FAST_3D_DRAWLIST
+    TransformVertexSpan(vertexBufferT, vertexBuffer, vertexCount, &matFinal);
+#else
     if (vertexCount <= 0)
         return;
 
@@ -207,12 +214,21 @@ void RSDK::Legacy::v3::TransformVertexBuffer()
         vert->y = (vx * matFinal.values[0][1] >> 8) + (vy * matFinal.values[1][1] >> 8) + (vz * matFinal.values[2][1] >> 8) + matFinal.values[3][1];
         vert->z = (vx * matFinal.values[0][2] >> 8) + (vy * matFinal.values[1][2] >> 8) + (vz * matFinal.values[2][2] >> 8) + matFinal.values[3][2];
     } while (++outVertexID != vertexCount);
+#endif
 }
 void RSDK::Legacy::v3::TransformVerticies(Matrix *matrix, int32 startIndex, int32 endIndex)
 {
     if (startIndex > endIndex)
         return;
 
+#if RETRO_USE_SCRIPT_PROFILER
+    Scene3DProfileScope profile(SCENE3D_PROFILE_TRANSFORM, endIndex - startIndex + 1);
+#endif
+
+#if RETRO_USE_FAST_3D_DRAWLIST
+    // the loop this replaced always transformed startIndex, even when it matched endIndex
+    TransformVertexSpan(&vertexBuffer[startIndex], &vertexBuffer[startIndex], startIndex < endIndex ? endIndex - startIndex : 1, matrix);
+#else
     do {
         int32 vx     = vertexBuffer[startIndex].x;
         int32 vy     = vertexBuffer[startIndex].y;
@@ -222,9 +238,14 @@ void RSDK::Legacy::v3::TransformVerticies(Matrix *matrix, int32 startIndex, int3
         vert->y      = (vx * matrix->values[0][1] >> 8) + (vy * matrix->values[1][1] >> 8) + (vz * matrix->values[2][1] >> 8) + matrix->values[3][1];
         vert->z      = (vx * matrix->values[0][2] >> 8) + (vy * matrix->values[1][2] >> 8) + (vz * matrix->values[2][2] >> 8) + matrix->values[3][2];
     } while (++startIndex < endIndex);
+#endif
 }
 void RSDK::Legacy::v3::Sort3DDrawList()
 {
+#if RETRO_USE_SCRIPT_PROFILER
+    Scene3DProfileScope profile(SCENE3D_PROFILE_SORT, faceCount);
+#endif
+
     for (int32 i = 0; i < faceCount; ++i) {
         drawList3D[i].depth = (vertexBufferT[faceBuffer[i].d].z + vertexBufferT[faceBuffer[i].c].z + vertexBufferT[faceBuffer[i].b].z
                                + vertexBufferT[faceBuffer[i].a].z)
@@ -232,6 +253,9 @@ void RSDK::Legacy::v3::Sort3DDrawList()
         drawList3D[i].faceID = i;
     }
 
+#if RETRO_USE_FAST_3D_DRAWLIST
+    SortDrawList3D(drawList3D, faceCount);
+#else
     for (int32 i = 0; i < faceCount; ++i) {
         for (int32 j = faceCount - 1; j > i; --j) {
             if (drawList3D[j].depth > drawList3D[j - 1].depth) {
@@ -244,9 +268,14 @@ void RSDK::Legacy::v3::Sort3DDrawList()
             }
         }
     }
+#endif
 }
 void RSDK::Legacy::v3::Draw3DScene(int32 spriteSheetID)
 {
+#if RETRO_USE_SCRIPT_PROFILER
+    Scene3DProfileScope profile(SCENE3D_PROFILE_DRAW, faceCount);
+#endif
+
     Vertex quad[4];
     for (int32 i = 0; i < faceCount; ++i) {
         Face *face = &faceBuffer[drawList3D[i].faceID];
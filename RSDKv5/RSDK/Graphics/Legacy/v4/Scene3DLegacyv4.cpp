@@ -265,6 +265,13 @@ void RSDK::Legacy::v4::TransformVertexBuffer()
     matFinal.values[3][3] = matWorld.values[3][3];
     MatrixMultiply(&matFinal, &matView);
 
+#if RETRO_USE_SCRIPT_PROFILER
+    Scene3DProfileScope profile(SCENE3D_PROFILE_TRANSFORM, vertexCount);
+#endif
+
+#if RETRO_USE_FAST_3D_DRAWLIST
+    TransformVertexSpan(vertexBufferT, vertexBuffer, vertexCount, &matFinal);
+#else
     for (int32 v = 0; v < vertexCount; ++v) {
         int32 vx = vertexBuffer[v].x;
         int32 vy = vertexBuffer[v].y;
@@ -277,9 +284,18 @@ void RSDK::Legacy::v4::TransformVertexBuffer()
         vertexBufferT[v].z =
             (vx * matFinal.values[0][2] >> 8) + (vy * matFinal.values[1][2] >> 8) + (vz * matFinal.values[2][2] >> 8) + matFinal.values[3][2];
     }
+#endif
 }
 void RSDK::Legacy::v4::TransformVertices(Matrix *matrix, int32 startIndex, int32 endIndex)
 {
+#if RETRO_USE_SCRIPT_PROFILER
+    Scene3DProfileScope profile(SCENE3D_PROFILE_TRANSFORM, endIndex - startIndex);
+#endif
+
+#if RETRO_USE_FAST_3D_DRAWLIST
+    if (startIndex < endIndex)
+        TransformVertexSpan(&vertexBuffer[startIndex], &vertexBuffer[startIndex], endIndex - startIndex, matrix);
+#else
     for (int32 v = startIndex; v < endIndex; ++v) {
         int32 vx     = vertexBuffer[v].x;
         int32 vy     = vertexBuffer[v].y;
@@ -289,9 +305,14 @@ void RSDK::Legacy::v4::TransformVertices(Matrix *matrix, int32 startIndex, int32
         vert->y      = (vx * matrix->values[0][1] >> 8) + (vy * matrix->values[1][1] >> 8) + (vz * matrix->values[2][1] >> 8) + matrix->values[3][1];
         vert->z      = (vx * matrix->values[0][2] >> 8) + (vy * matrix->values[1][2] >> 8) + (vz * matrix->values[2][2] >> 8) + matrix->values[3][2];
     }
+#endif
 }
 void RSDK::Legacy::v4::Sort3DDrawList()
 {
+#if RETRO_USE_SCRIPT_PROFILER
+    Scene3DProfileScope profile(SCENE3D_PROFILE_SORT, faceCount);
+#endif
+
     for (int32 i = 0; i < faceCount; ++i) {
         drawList3D[i].depth = (vertexBufferT[faceBuffer[i].d].z + vertexBufferT[faceBuffer[i].c].z + vertexBufferT[faceBuffer[i].b].z
                                + vertexBufferT[faceBuffer[i].a].z)
@@ -299,6 +320,9 @@ void RSDK::Legacy::v4::Sort3DDrawList()
         drawList3D[i].faceID = i;
     }
 
+#if RETRO_USE_FAST_3D_DRAWLIST
+    SortDrawList3D(drawList3D, faceCount);
+#else
     for (int32 i = 0; i < faceCount; ++i) {
         for (int32 j = faceCount - 1; j > i; --j) {
             if (drawList3D[j].depth > drawList3D[j - 1].depth) {
@@ -311,9 +335,14 @@ void RSDK::Legacy::v4::Sort3DDrawList()
             }
         }
     }
+#endif
 }
 void RSDK::Legacy::v4::Draw3DScene(int32 spriteSheetID)
 {
+#if RETRO_USE_SCRIPT_PROFILER
+    Scene3DProfileScope profile(SCENE3D_PROFILE_DRAW, faceCount);
+#endif
+
     Vertex quad[4];
     for (int32 i = 0; i < faceCount; ++i) {
         Face *face = &faceBuffer[drawList3D[i].faceID];
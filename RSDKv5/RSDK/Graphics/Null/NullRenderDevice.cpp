@@ -0,0 +1,151 @@
+
+int32 RenderDevice::frameLimit = 0;
+int32 RenderDevice::frameCount = 0;
+
+bool RenderDevice::Init()
+{
+    if (!SetupRendering() || !AudioDevice::Init())
+        return false;
+
+    InitInputDevices();
+    return true;
+}
+
+void RenderDevice::CopyFrameBuffer() {}
+
+void RenderDevice::FlipScreen()
+{
+    if (windowRefreshDelay > 0) {
+        windowRefreshDelay--;
+        if (!windowRefreshDelay)
+            UpdateGameWindow();
+    }
+}
+
+void RenderDevice::Release(bool32 isRefresh)
+{
+    if (!isRefresh) {
+        if (scanlines)
+            free(scanlines);
+        scanlines = NULL;
+    }
+}
+
+void RenderDevice::RefreshWindow()
+{
+    videoSettings.windowState = WINDOWSTATE_UNINITIALIZED;
+
+    Release(true);
+
+    if (!InitGraphicsAPI() || !InitShaders())
+        return;
+
+    videoSettings.windowState = WINDOWSTATE_ACTIVE;
+}
+
+void RenderDevice::GetWindowSize(int32 *width, int32 *height)
+{
+    if (width)
+        *width = videoSettings.pixWidth;
+
+    if (height)
+        *height = SCREEN_YSIZE;
+}
+
+// there's nothing to wait on, so every frame runs as soon as the last one's done
+void RenderDevice::InitFPSCap() { frameCount = 0; }
+bool RenderDevice::CheckFPSCap() { return true; }
+void RenderDevice::UpdateFPSCap() { ++frameCount; }
+
+bool RenderDevice::ProcessEvents() { return !frameLimit || frameCount < frameLimit; }
+
+void RenderDevice::InitVertexBuffer() {}
+
+bool RenderDevice::InitGraphicsAPI()
+{
+    videoSettings.shaderSupport = false;
+
+    viewSize.x = videoSettings.pixWidth;
+    viewSize.y = SCREEN_YSIZE;
+
+    for (int32 s = 0; s < SCREEN_COUNT; ++s) {
+        screens[s].size.y = videoSettings.pixHeight;
+
+        memset(&screens[s].frameBuffer, 0, sizeof(screens[s].frameBuffer));
+        SetScreenSize(s, videoSettings.pixWidth, screens[s].size.y);
+    }
+
+    pixelSize.x   = screens[0].size.x;
+    pixelSize.y   = screens[0].size.y;
+    textureSize.x = pixelSize.x;
+    textureSize.y = pixelSize.y;
+
+#if RETRO_USE_DIRTY_SCREEN_ROWS
+    InvalidateScreenRows();
+#endif
+
+    lastShaderID = -1;
+    InitVertexBuffer();
+    engine.inFocus          = 1;
+    videoSettings.viewportX = 0;
+    videoSettings.viewportY = 0;
+    videoSettings.viewportW = 1.0 / viewSize.x;
+    videoSettings.viewportH = 1.0 / viewSize.y;
+
+    return true;
+}
+
+void RenderDevice::LoadShader(const char *fileName, bool32 linear) {}
+
+bool RenderDevice::InitShaders()
+{
+    for (int32 s = 0; s < SHADER_COUNT; ++s) shaderList[s].linear = false;
+
+    shaderCount            = 1;
+    videoSettings.shaderID = 0;
+
+    return true;
+}
+
+bool RenderDevice::SetupRendering()
+{
+    GetDisplays();
+
+    if (!InitGraphicsAPI() || !InitShaders())
+        return false;
+
+    int32 size = videoSettings.pixWidth >= SCREEN_YSIZE ? videoSettings.pixWidth : SCREEN_YSIZE;
+    scanlines  = (ScanlineInfo *)malloc(size * sizeof(ScanlineInfo));
+    memset(scanlines, 0, size * sizeof(ScanlineInfo));
+
+    videoSettings.windowState = WINDOWSTATE_ACTIVE;
+    videoSettings.dimMax      = 1.0;
+    videoSettings.dimPercent  = 1.0;
+
+    return true;
+}
+
+void RenderDevice::GetDisplays()
+{
+    displayCount         = 0;
+    displayInfo.displays = NULL;
+
+    videoSettings.fsWidth     = 0;
+    videoSettings.fsHeight    = 0;
+    videoSettings.refreshRate = 60;
+}
+
+void RenderDevice::SetupImageTexture(int32 width, int32 height, uint8 *imagePixels) {}
+
+void RenderDevice::SetupVideoTexture_YUV420(int32 width, int32 height, uint8 *yPlane, uint8 *uPlane, uint8 *vPlane, int32 strideY, int32 strideU,
+                                            int32 strideV)
+{
+}
+void RenderDevice::SetupVideoTexture_YUV422(int32 width, int32 height, uint8 *yPlane, uint8 *uPlane, uint8 *vPlane, int32 strideY, int32 strideU,
+                                            int32 strideV)
+{
+}
+void RenderDevice::SetupVideoTexture_YUV444(int32 width, int32 height, uint8 *yPlane, uint8 *uPlane, uint8 *vPlane, int32 strideY, int32 strideU,
+                                            int32 strideV)
+{
+}
@@ -0,0 +1,55 @@
+using ShaderEntry = ShaderEntryBase;
+
+// draws into the software framebuffers as usual but never presents them, for running the engine with no display (CI, benchmarks, etc)
+class RenderDevice : public RenderDeviceBase
+{
+public:
+    struct WindowInfo {
+        struct {
+            int32 width;
+            int32 height;
+            int32 refresh_rate;
+        } * displays;
+    };
+    static WindowInfo displayInfo;
+
+    static bool Init();
+    static void CopyFrameBuffer();
+    static void FlipScreen();
+    static void Release(bool32 isRefresh);
+
+    static void RefreshWindow();
+    static void GetWindowSize(int32 *width, int32 *height);
+
+    static void SetupImageTexture(int32 width, int32 height, uint8 *imagePixels);
+    static void SetupVideoTexture_YUV420(int32 width, int32 height, uint8 *yPlane, uint8 *uPlane, uint8 *vPlane, int32 strideY, int32 strideU,
+                                         int32 strideV);
+    static void SetupVideoTexture_YUV422(int32 width, int32 height, uint8 *yPlane, uint8 *uPlane, uint8 *vPlane, int32 strideY, int32 strideU,
+                                         int32 strideV);
+    static void SetupVideoTexture_YUV444(int32 width, int32 height, uint8 *yPlane, uint8 *uPlane, uint8 *vPlane, int32 strideY, int32 strideU,
+                                         int32 strideV);
+
+    static bool ProcessEvents();
+
+    static void InitFPSCap();
+    static bool CheckFPSCap();
+    static void UpdateFPSCap();
+
+    static void LoadShader(const char *fileName, bool32 linear);
+
+    static inline void ShowCursor(bool32 shown) {}
+    static inline bool GetCursorPos(Vector2 *pos) { return false; }
+    static inline void SetWindowTitle() {}
+
+    // set with "frames=", the engine quits once it's run this many frames (0 keeps going until something else quits it)
+    static int32 frameLimit;
+    static int32 frameCount;
+
+private:
+    static bool InitShaders();
+    static bool SetupRendering();
+    static void InitVertexBuffer();
+    static bool InitGraphicsAPI();
+
+    static void GetDisplays();
+};
@@ -20,12 +20,85 @@ uint16 RSDK::fullPalette[PALETTE_BANK_COUNT][PALETTE_BANK_SIZE];
 uint8 RSDK::gfxLineBuffer[SCREEN_YSIZE];
 
 int32 RSDK::maskColor = 0;
+#if RETRO_USE_PALETTE_TRACKING
+uint8 RSDK::changedPaletteBanks = 0;
+uint32 RSDK::paletteGeneration[PALETTE_BANK_COUNT];
+uint32 RSDK::activePaletteGeneration = 0;
+#endif
 #if RETRO_REV02
 uint16 *RSDK::tintLookupTable = NULL;
 #else
 uint16 RSDK::tintLookupTable[0x10000];
 #endif
 
+#if RETRO_USE_FAST_PALETTE_BLENDING
+// blends 8 colors (8 bits per channel, one color per 16 bit lane) & packs them into RGB565
+// matches the scalar code exactly: (blendAmount * B + blendA * A) >> 8, which can never go above 0xFFFF
+#if RETRO_USE_SSE2
+inline __m128i BlendPaletteColors(__m128i rA, __m128i gA, __m128i bA, __m128i rB, __m128i gB, __m128i bB, __m128i blendAmount, __m128i blendA)
+{
+    __m128i r = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(rB, blendAmount), _mm_mullo_epi16(rA, blendA)), 8);
+    __m128i g = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(gB, blendAmount), _mm_mullo_epi16(gA, blendA)), 8);
+    __m128i b = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(bB, blendAmount), _mm_mullo_epi16(bA, blendA)), 8);
+
+    r = _mm_slli_epi16(_mm_and_si128(r, _mm_set1_epi16(0xF8)), 8);
+    g = _mm_slli_epi16(_mm_and_si128(g, _mm_set1_epi16(0xFC)), 3);
+    b = _mm_srli_epi16(b, 3);
+    return _mm_or_si128(_mm_or_si128(r, g), b);
+}
+
+// the same expansion GetPaletteEntry does
+inline void UnpackPaletteColors(__m128i clr, __m128i *r, __m128i *g, __m128i *b)
+{
+    *r = _mm_and_si128(_mm_srli_epi16(clr, 8), _mm_set1_epi16(0xF8));
+    *g = _mm_and_si128(_mm_srli_epi16(clr, 3), _mm_set1_epi16(0xFC));
+    *b = _mm_and_si128(_mm_slli_epi16(clr, 3), _mm_set1_epi16(0xF8));
+}
+
+// 8 0x00RRGGBB colors -> one channel per register
+inline void UnpackPaletteColors(uint32 *colors, __m128i *r, __m128i *g, __m128i *b)
+{
+    __m128i lo = _mm_loadu_si128((const __m128i *)&colors[0]);
+    __m128i hi = _mm_loadu_si128((const __m128i *)&colors[4]);
+
+    const __m128i mask = _mm_set1_epi32(0xFF);
+    *r = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(lo, 16), mask), _mm_and_si128(_mm_srli_epi32(hi, 16), mask));
+    *g = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(lo, 8), mask), _mm_and_si128(_mm_srli_epi32(hi, 8), mask));
+    *b = _mm_packs_epi32(_mm_and_si128(lo, mask), _mm_and_si128(hi, mask));
+}
+#elif RETRO_USE_NEON
+inline uint16x8_t BlendPaletteColors(uint16x8_t rA, uint16x8_t gA, uint16x8_t bA, uint16x8_t rB, uint16x8_t gB, uint16x8_t bB, uint16x8_t blendAmount,
+                                     uint16x8_t blendA)
+{
+    uint16x8_t r = vshrq_n_u16(vmlaq_u16(vmulq_u16(rB, blendAmount), rA, blendA), 8);
+    uint16x8_t g = vshrq_n_u16(vmlaq_u16(vmulq_u16(gB, blendAmount), gA, blendA), 8);
+    uint16x8_t b = vshrq_n_u16(vmlaq_u16(vmulq_u16(bB, blendAmount), bA, blendA), 8);
+
+    uint16x8_t color = vshlq_n_u16(r, 8);
+    color            = vsriq_n_u16(color, vshlq_n_u16(g, 8), 5);
+    color            = vsriq_n_u16(color, vshlq_n_u16(b, 8), 11);
+    return color;
+}
+
+// the same expansion GetPaletteEntry does
+inline void UnpackPaletteColors(uint16x8_t clr, uint16x8_t *r, uint16x8_t *g, uint16x8_t *b)
+{
+    *r = vandq_u16(vshrq_n_u16(clr, 8), vdupq_n_u16(0xF8));
+    *g = vandq_u16(vshrq_n_u16(clr, 3), vdupq_n_u16(0xFC));
+    *b = vandq_u16(vshlq_n_u16(clr, 3), vdupq_n_u16(0xF8));
+}
+
+// 8 0x00RRGGBB colors -> one channel per register
+inline void UnpackPaletteColors(uint32 *colors, uint16x8_t *r, uint16x8_t *g, uint16x8_t *b)
+{
+    uint8x8x4_t px = vld4_u8((const uint8 *)colors);
+    *r             = vmovl_u8(px.val[2]);
+    *g             = vmovl_u8(px.val[1]);
+    *b             = vmovl_u8(px.val[0]);
+}
+#endif
+#endif
+
 #if RETRO_REV02
 void RSDK::LoadPalette(uint8 bankID, const char *filename, uint16 disabledRows)
 {
@@ -49,6 +122,10 @@ void RSDK::LoadPalette(uint8 bankID, const char *filename, uint16 disabledRows)
             }
         }
 
+#if RETRO_USE_PALETTE_TRACKING
+        MarkPaletteChanged(bankID);
+#endif
+
         CloseFile(&info);
     }
 }
@@ -62,7 +139,33 @@ void RSDK::BlendColors(uint8 destBankID, uint32 *srcColorsA, uint32 *srcColorsB,
 
     uint8 blendA         = 0xFF - blendAmount;
     uint16 *paletteColor = &fullPalette[destBankID][startIndex];
-    for (int32 i = startIndex; i < startIndex + count; ++i) {
+    int32 i              = startIndex;
+
+#if RETRO_USE_FAST_PALETTE_BLENDING && RETRO_USE_SSE2
+    for (; i + 8 <= startIndex + count; i += 8) {
+        __m128i rA, gA, bA, rB, gB, bB;
+        UnpackPaletteColors(srcColorsA, &rA, &gA, &bA);
+        UnpackPaletteColors(srcColorsB, &rB, &gB, &bB);
+        _mm_storeu_si128((__m128i *)paletteColor, BlendPaletteColors(rA, gA, bA, rB, gB, bB, _mm_set1_epi16(blendAmount), _mm_set1_epi16(blendA)));
+
+        srcColorsA += 8;
+        srcColorsB += 8;
+        paletteColor += 8;
+    }
+#elif RETRO_USE_FAST_PALETTE_BLENDING && RETRO_USE_NEON
+    for (; i + 8 <= startIndex + count; i += 8) {
+        uint16x8_t rA, gA, bA, rB, gB, bB;
+        UnpackPaletteColors(srcColorsA, &rA, &gA, &bA);
+        UnpackPaletteColors(srcColorsB, &rB, &gB, &bB);
+        vst1q_u16(paletteColor, BlendPaletteColors(rA, gA, bA, rB, gB, bB, vdupq_n_u16(blendAmount), vdupq_n_u16(blendA)));
+
+        srcColorsA += 8;
+        srcColorsB += 8;
+        paletteColor += 8;
+    }
+#endif
+
+    for (; i < startIndex + count; ++i) {
         int32 r = blendAmount * ((*srcColorsB >> 0x10) & 0xFF) + blendA * ((*srcColorsA >> 0x10) & 0xFF);
         int32 g = blendAmount * ((*srcColorsB >> 0x08) & 0xFF) + blendA * ((*srcColorsA >> 0x08) & 0xFF);
         int32 b = blendAmount * ((*srcColorsB >> 0x00) & 0xFF) + blendA * ((*srcColorsA >> 0x00) & 0xFF);
@@ -73,6 +176,9 @@ void RSDK::BlendColors(uint8 destBankID, uint32 *srcColorsA, uint32 *srcColorsB,
         srcColorsB++;
         ++paletteColor;
     }
+#if RETRO_USE_PALETTE_TRACKING
+    MarkPaletteRangeChanged(destBankID, startIndex, count);
+#endif
 }
 #endif
 
@@ -89,7 +195,30 @@ void RSDK::SetPaletteFade(uint8 destBankID, uint8 srcBankA, uint8 srcBankB, int1
 
     uint32 blendA        = 0xFF - blendAmount;
     uint16 *paletteColor = &fullPalette[destBankID][startIndex];
-    for (int32 i = startIndex; i <= endIndex; ++i) {
+    int32 i              = startIndex;
+
+    // endIndex is inclusive & can be 0x100, that last entry is left to the plain loop so it wraps around the same way it always has
+#if RETRO_USE_FAST_PALETTE_BLENDING && RETRO_USE_SSE2
+    for (; i + 8 <= MIN(endIndex + 1, PALETTE_BANK_SIZE); i += 8) {
+        __m128i rA, gA, bA, rB, gB, bB;
+        UnpackPaletteColors(_mm_loadu_si128((const __m128i *)&fullPalette[srcBankA][i]), &rA, &gA, &bA);
+        UnpackPaletteColors(_mm_loadu_si128((const __m128i *)&fullPalette[srcBankB][i]), &rB, &gB, &bB);
+        _mm_storeu_si128((__m128i *)paletteColor, BlendPaletteColors(rA, gA, bA, rB, gB, bB, _mm_set1_epi16(blendAmount), _mm_set1_epi16(blendA)));
+
+        paletteColor += 8;
+    }
+#elif RETRO_USE_FAST_PALETTE_BLENDING && RETRO_USE_NEON
+    for (; i + 8 <= MIN(endIndex + 1, PALETTE_BANK_SIZE); i += 8) {
+        uint16x8_t rA, gA, bA, rB, gB, bB;
+        UnpackPaletteColors(vld1q_u16(&fullPalette[srcBankA][i]), &rA, &gA, &bA);
+        UnpackPaletteColors(vld1q_u16(&fullPalette[srcBankB][i]), &rB, &gB, &bB);
+        vst1q_u16(paletteColor, BlendPaletteColors(rA, gA, bA, rB, gB, bB, vdupq_n_u16(blendAmount), vdupq_n_u16(blendA)));
+
+        paletteColor += 8;
+    }
+#endif
+
+    for (; i <= endIndex; ++i) {
         uint32 clrA = GetPaletteEntry(srcBankA, i);
         uint32 clrB = GetPaletteEntry(srcBankB, i);
 
@@ -101,4 +230,7 @@ void RSDK::SetPaletteFade(uint8 destBankID, uint8 srcBankA, uint8 srcBankB, int1
 
         ++paletteColor;
     }
+#if RETRO_USE_PALETTE_TRACKING
+    MarkPaletteRangeChanged(destBankID, startIndex, endIndex + 1 - startIndex);
+#endif
 }
\ No newline at end of file
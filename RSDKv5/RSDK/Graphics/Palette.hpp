@@ -27,6 +27,35 @@ extern uint8 gfxLineBuffer[SCREEN_YSIZE]; // Pointers to active palette
 
 extern int32 maskColor;
 
+#if RETRO_USE_PALETTE_TRACKING
+// a bit for every bank that's changed since the last frame was presented
+extern uint8 changedPaletteBanks;
+// these only ever go up, for anything that needs to stay valid for longer than a frame
+extern uint32 paletteGeneration[PALETTE_BANK_COUNT];
+extern uint32 activePaletteGeneration; // gfxLineBuffer changes
+
+inline void MarkPaletteChanged(uint8 bankID)
+{
+    if (bankID < PALETTE_BANK_COUNT) {
+        changedPaletteBanks |= 1 << bankID;
+        ++paletteGeneration[bankID];
+    }
+}
+
+// marks every bank touched by colors [startIndex, startIndex + count) of bankID, some callers run past the end of their bank
+inline void MarkPaletteRangeChanged(uint8 bankID, int32 startIndex, int32 count)
+{
+    if (count <= 0)
+        return;
+
+    int32 lastBank = bankID + (startIndex + count - 1) / PALETTE_BANK_SIZE;
+    for (int32 b = bankID; b <= lastBank && b < PALETTE_BANK_COUNT; ++b) MarkPaletteChanged(b);
+}
+
+inline bool32 PaletteChanged(uint8 bankID) { return bankID < PALETTE_BANK_COUNT && (changedPaletteBanks >> bankID & 1); }
+inline void ClearPaletteChanges() { changedPaletteBanks = 0; }
+#endif
+
 #if RETRO_REV02
 extern uint16 *tintLookupTable;
 #else
@@ -43,8 +72,13 @@ void LoadPalette(uint8 bankID, const char *filePath, uint16 disabledRows);
 
 inline void SetActivePalette(uint8 newActiveBank, int32 startLine, int32 endLine)
 {
-    if (newActiveBank < PALETTE_BANK_COUNT)
+    if (newActiveBank < PALETTE_BANK_COUNT) {
         for (int32 l = startLine; l < endLine && l < SCREEN_YSIZE; l++) gfxLineBuffer[l] = newActiveBank;
+
+#if RETRO_USE_PALETTE_TRACKING
+        ++activePaletteGeneration;
+#endif
+    }
 }
 
 inline uint32 GetPaletteEntry(uint8 bankID, uint8 index)
@@ -63,6 +97,10 @@ inline uint32 GetPaletteEntry(uint8 bankID, uint8 index)
 inline void SetPaletteEntry(uint8 bankID, uint8 index, uint32 color)
 {
     fullPalette[bankID][index] = rgb32To16_B[(color >> 0) & 0xFF] | rgb32To16_G[(color >> 8) & 0xFF] | rgb32To16_R[(color >> 16) & 0xFF];
+
+#if RETRO_USE_PALETTE_TRACKING
+    MarkPaletteChanged(bankID);
+#endif
 }
 
 inline void SetPaletteMask(uint32 color)
@@ -82,6 +120,10 @@ inline void CopyPalette(uint8 sourceBank, uint8 srcBankStart, uint8 destinationB
         for (int32 i = 0; i < count; ++i) {
             fullPalette[destinationBank][destBankStart + i] = fullPalette[sourceBank][srcBankStart + i];
         }
+
+#if RETRO_USE_PALETTE_TRACKING
+        MarkPaletteRangeChanged(destinationBank, destBankStart, count);
+#endif
     }
 }
 
@@ -97,6 +139,10 @@ inline void RotatePalette(uint8 bankID, uint8 startIndex, uint8 endIndex, bool32
         for (int32 i = startIndex; i < endIndex; ++i) fullPalette[bankID][i] = fullPalette[bankID][i + 1];
         fullPalette[bankID][endIndex] = startClr;
     }
+
+#if RETRO_USE_PALETTE_TRACKING
+    MarkPaletteChanged(bankID);
+#endif
 }
 
 #if RETRO_REV02
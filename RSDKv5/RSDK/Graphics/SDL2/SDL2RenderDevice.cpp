@@ -82,10 +82,22 @@ void RenderDevice::CopyFrameBuffer()
     uint16 *pixels = NULL;
 
     for (int32 s = 0; s < videoSettings.screenCount; ++s) {
+#if RETRO_USE_DIRTY_SCREEN_ROWS
+        int32 firstRow = 0, rowCount = 0;
+        if (!GetDirtyScreenRows(s, screens[s].size.x, &firstRow, &rowCount))
+            continue;
+
+        SDL_Rect rect = { 0, firstRow, screens[s].size.x, rowCount };
+        SDL_LockTexture(screenTexture[s], &rect, (void **)&pixels, &pitch);
+
+        uint16 *frameBuffer = &screens[s].frameBuffer[firstRow * screens[s].pitch];
+        for (int32 y = 0; y < rowCount; ++y) {
+#else
         SDL_LockTexture(screenTexture[s], NULL, (void **)&pixels, &pitch);
 
         uint16 *frameBuffer = screens[s].frameBuffer;
         for (int32 y = 0; y < SCREEN_YSIZE; ++y) {
+#endif
             memcpy(pixels, frameBuffer, screens[s].size.x * sizeof(uint16));
             frameBuffer += screens[s].pitch;
             pixels += pitch / sizeof(uint16);
@@ -521,6 +533,9 @@ bool RenderDevice::InitGraphicsAPI()
             return 0;
         }
     }
+#if RETRO_USE_DIRTY_SCREEN_ROWS
+    InvalidateScreenRows();
+#endif
     SDL_SetHint(SDL_HINT_RENDER_SCALE_QUALITY, "linear");
     imageTexture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STREAMING, RETRO_VIDEO_TEXTURE_W, RETRO_VIDEO_TEXTURE_H);
     if (!imageTexture)
@@ -703,6 +718,12 @@ void RenderDevice::ProcessEvent(SDL_Event event)
             }
             break;
 
+#if RETRO_USE_DIRTY_SCREEN_ROWS
+        // texture contents may not survive these, so everything has to be uploaded again
+        case SDL_RENDER_TARGETS_RESET:
+        case SDL_RENDER_DEVICE_RESET: InvalidateScreenRows(); break;
+
+#endif
         case SDL_CONTROLLERDEVICEADDED: {
             uint32 id;
             char idBuffer[0x20];
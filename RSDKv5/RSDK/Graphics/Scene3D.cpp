@@ -8,6 +8,10 @@ using namespace RSDK;
 
 Model RSDK::modelList[MODEL_COUNT];
 Scene3D RSDK::scene3DList[SCENE3D_COUNT];
+#if RETRO_USE_RESOURCE_REGISTRY
+HashRegistry<MODEL_COUNT> RSDK::modelRegistry;
+HashRegistry<SCENE3D_COUNT> RSDK::scene3DRegistry;
+#endif
 
 ScanEdge RSDK::scanEdgeBuffer[SCREEN_YSIZE * 2];
 
@@ -384,6 +388,13 @@ uint16 RSDK::LoadMesh(const char *filename, Scopes scope)
     RETRO_HASH_MD5(hash);
     GEN_HASH_MD5(fullFilePath, hash);
 
+#if RETRO_USE_RESOURCE_REGISTRY
+    int32 existing = modelRegistry.Find(hash);
+    if (existing >= 0)
+        return existing;
+
+    uint16 id = modelRegistry.GetFreeSlot();
+#else
     for (int32 i = 0; i < MODEL_COUNT; ++i) {
         if (HASH_MATCH_MD5(hash, modelList[i].hash)) {
             return i;
@@ -395,6 +406,7 @@ uint16 RSDK::LoadMesh(const char *filename, Scopes scope)
         if (modelList[id].scope == SCOPE_NONE)
             break;
     }
+#endif
 
     if (id >= MODEL_COUNT)
         return -1;
@@ -412,6 +424,9 @@ uint16 RSDK::LoadMesh(const char *filename, Scopes scope)
 
         model->scope = scope;
         HASH_COPY_MD5(model->hash, hash);
+#if RETRO_USE_RESOURCE_REGISTRY
+        modelRegistry.Register(id, hash, scope);
+#endif
 
         model->flags         = ReadInt8(&info);
         model->faceVertCount = ReadInt8(&info);
@@ -469,6 +484,13 @@ uint16 RSDK::Create3DScene(const char *name, uint16 vertexLimit, Scopes scope)
     RETRO_HASH_MD5(hash);
     GEN_HASH_MD5(name, hash);
 
+#if RETRO_USE_RESOURCE_REGISTRY
+    int32 existing = scene3DRegistry.Find(hash);
+    if (existing >= 0)
+        return existing;
+
+    uint16 id = scene3DRegistry.GetFreeSlot();
+#else
     for (int32 i = 0; i < SCENE3D_COUNT; ++i) {
         if (HASH_MATCH_MD5(hash, scene3DList[i].hash)) {
             return i;
@@ -480,6 +502,7 @@ uint16 RSDK::Create3DScene(const char *name, uint16 vertexLimit, Scopes scope)
         if (scene3DList[id].scope == SCOPE_NONE)
             break;
     }
+#endif
 
     if (id >= SCENE3D_COUNT)
         return -1;
@@ -491,6 +514,9 @@ uint16 RSDK::Create3DScene(const char *name, uint16 vertexLimit, Scopes scope)
 
     scene->scope = scope;
     HASH_COPY_MD5(scene->hash, hash);
+#if RETRO_USE_RESOURCE_REGISTRY
+    scene3DRegistry.Register(id, hash, scope);
+#endif
     scene->vertLimit = vertexLimit;
     scene->faceCount = 6;
 
@@ -127,6 +127,10 @@ struct Scene3D {
 
 extern Model modelList[MODEL_COUNT];
 extern Scene3D scene3DList[SCENE3D_COUNT];
+#if RETRO_USE_RESOURCE_REGISTRY
+extern HashRegistry<MODEL_COUNT> modelRegistry;
+extern HashRegistry<SCENE3D_COUNT> scene3DRegistry;
+#endif
 
 extern ScanEdge scanEdgeBuffer[SCREEN_YSIZE * 2];
 
@@ -219,6 +223,19 @@ void Draw3DScene(uint16 sceneID);
 
 inline void Clear3DScenes()
 {
+#if RETRO_USE_RESOURCE_REGISTRY
+    // Unload Models
+    modelRegistry.ReleaseScope(SCOPE_STAGE, [](int32 m) {
+        MEM_ZERO(modelList[m]);
+        modelList[m].scope = SCOPE_NONE;
+    });
+
+    // Unload 3D Scenes
+    scene3DRegistry.ReleaseScope(SCOPE_STAGE, [](int32 s) {
+        MEM_ZERO(scene3DList[s]);
+        scene3DList[s].scope = SCOPE_NONE;
+    });
+#else
     // Unload Models
     for (int32 m = 0; m < MODEL_COUNT; ++m) {
         if (modelList[m].scope != SCOPE_GLOBAL) {
@@ -234,6 +251,7 @@ inline void Clear3DScenes()
             scene3DList[s].scope = SCOPE_NONE;
         }
     }
+#endif
 }
 
 #if RETRO_REV0U
@@ -1,5 +1,21 @@
 #include "RSDK/Core/RetroEngine.hpp"
 
+#if RETRO_USE_SPRITE_CACHE
+#include <filesystem>
+
+#if RETRO_PLATFORM == RETRO_ANDROID
+namespace fs = std::__fs::filesystem;
+#else
+namespace fs = std::filesystem;
+#endif
+#endif
+
+#if RETRO_USE_THREADED_SPRITES
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#endif
+
 #if RETRO_REV0U
 #include "Legacy/SpriteLegacy.cpp"
 #endif
@@ -15,9 +31,11 @@ const int32 NO_SUCH_CODE  = 4098;
 
 int32 codeMasks[] = { 0, 1, 3, 7, 15, 31, 63, 127, 255, 511, 1023, 2047, 4095 };
 
+#if !RETRO_USE_FAST_GIF_DECODER
 int32 ReadGifCode(ImageGIF *image);
 uint8 ReadGifByte(ImageGIF *image);
 uint8 TraceGifPrefix(uint32 *prefix, int32 code, int32 clearCode);
+#endif
 
 void InitGifDecoder(ImageGIF *image)
 {
@@ -39,6 +57,179 @@ void InitGifDecoder(ImageGIF *image)
 
     for (int32 i = 0; i <= LZ_MAX_CODE; ++i) image->decoder->prefix[i] = (uint8)NO_SUCH_CODE;
 }
+#if RETRO_USE_FAST_GIF_DECODER
+// moves dst onto the next row of an interlaced image, returns false once every pass is done
+bool32 NextGifRow(uint8 *pixels, int32 width, int32 height, int32 *pass, int32 *y, uint8 **dst, uint8 **dstEnd)
+{
+    int32 initialRows[] = { 0, 4, 2, 1 };
+    int32 rowInc[]      = { 8, 8, 4, 2 };
+
+    *y += rowInc[*pass];
+    while (*y >= height) {
+        if (++*pass >= 4)
+            return false;
+
+        *y = initialRows[*pass];
+    }
+
+    *dst    = &pixels[*y * width];
+    *dstEnd = *dst + width;
+    return true;
+}
+
+void ReadGifPictureData(ImageGIF *image, int32 width, int32 height, bool32 interlaced, uint8 *pixels)
+{
+    InitGifDecoder(image);
+    if (width <= 0 || height <= 0)
+        return;
+
+    GifDecoder *decoder = image->decoder;
+    uint32 *prefix      = decoder->prefix;
+    uint8 *suffix       = decoder->suffix;
+    uint16 *length      = decoder->length;
+    int32 clearCode     = decoder->clearCode;
+    int32 eofCode       = decoder->eofCode;
+
+    for (int32 c = 0; c < clearCode; ++c) length[c] = 1;
+
+    int32 runningCode    = decoder->runningCode;
+    int32 runningBits    = decoder->runningBits;
+    int32 maxCodePlusOne = decoder->maxCodePlusOne;
+    int32 prevCode       = NO_SUCH_CODE;
+    uint8 prevFirst      = 0;
+
+    uint64 bits      = 0;
+    int32 bitCount   = 0;
+    int32 position   = 0;
+    int32 bufferSize = 0;
+    bool32 loaded    = false;
+
+    // interlaced images get written a row at a time, everything else is treated as one big row
+    int32 pass    = 0;
+    int32 y       = 0;
+    uint8 *dst    = pixels;
+    uint8 *dstEnd = interlaced ? pixels + width : pixels + width * height;
+
+    while (true) {
+        if (bitCount < runningBits) {
+            // top the buffer up with as many bytes as it can take, so the next few codes won't need to touch the file at all
+            while (bitCount <= 56) {
+                if (position == bufferSize) {
+                    position   = 0;
+                    bufferSize = loaded ? 0 : ReadInt8(&image->info);
+                    if (!bufferSize) {
+                        // past the end of the data there's nothing but 0s
+                        loaded   = true;
+                        bitCount = 64;
+                        break;
+                    }
+
+                    ReadBytes(&image->info, decoder->buffer, bufferSize);
+                }
+
+                int32 count = MIN(bufferSize - position, (64 - bitCount) >> 3);
+                for (int32 i = 0; i < count; ++i) {
+                    bits |= (uint64)decoder->buffer[position++] << bitCount;
+                    bitCount += 8;
+                }
+            }
+        }
+
+        int32 code = (int32)(bits & (uint64)codeMasks[runningBits]);
+        bits >>= runningBits;
+        bitCount -= runningBits;
+        if (++runningCode > maxCodePlusOne && runningBits < LZ_BITS) {
+            maxCodePlusOne <<= 1;
+            runningBits++;
+        }
+
+        if (code == eofCode)
+            break;
+
+        if (code == clearCode) {
+            // nothing to actually clear, anything from runningCode up is treated as undefined anyways
+            runningCode    = eofCode + 1;
+            runningBits    = decoder->depth + 1;
+            maxCodePlusOne = 1 << runningBits;
+            prevCode       = NO_SUCH_CODE;
+            continue;
+        }
+
+        uint8 first = 0;
+        if (code < clearCode) {
+            first  = (uint8)code;
+            *dst++ = first;
+        }
+        else {
+            if (code >= runningCode - 2) {
+                // the code currently being defined, which is the previous string + its first pixel
+                if (code != runningCode - 2 || prevCode == NO_SUCH_CODE)
+                    break;
+
+                prefix[code] = prevCode;
+                suffix[code] = prevFirst;
+                length[code] = length[prevCode] + 1;
+            }
+
+            int32 len = length[code];
+            if (len >= LZ_MAX_CODE)
+                break;
+
+            if (dst + len <= dstEnd) {
+                // write the string backwards straight into the pixels
+                uint8 *out = dst + len - 1;
+                int32 c    = code;
+                for (int32 i = 1; i < len; ++i) {
+                    *out-- = suffix[c];
+                    c      = prefix[c];
+                }
+                *out = first = (uint8)c;
+                dst += len;
+            }
+            else {
+                // the string goes past the end of the row, so build it in the stack & copy it over in pieces
+                uint8 *out = &decoder->stack[len - 1];
+                int32 c    = code;
+                for (int32 i = 1; i < len; ++i) {
+                    *out-- = suffix[c];
+                    c      = prefix[c];
+                }
+                *out = first = (uint8)c;
+
+                uint8 *src = decoder->stack;
+                while (true) {
+                    int32 count = MIN(len, (int32)(dstEnd - dst));
+                    memcpy(dst, src, count);
+                    dst += count;
+                    src += count;
+                    len -= count;
+                    if (!len)
+                        break;
+
+                    if (!interlaced || !NextGifRow(pixels, width, height, &pass, &y, &dst, &dstEnd))
+                        return;
+                }
+            }
+        }
+
+        if (prevCode != NO_SUCH_CODE) {
+            // once the table's full it stays that way until the next clear code
+            if (runningCode <= FIRST_CODE) {
+                int32 id   = runningCode - 2;
+                prefix[id] = prevCode;
+                suffix[id] = code == id ? prevFirst : first;
+                length[id] = length[prevCode] + 1;
+            }
+        }
+
+        prevCode  = code;
+        prevFirst = first;
+
+        if (dst == dstEnd && (!interlaced || !NextGifRow(pixels, width, height, &pass, &y, &dst, &dstEnd)))
+            break;
+    }
+}
+#else
 void ReadGifLine(ImageGIF *image, uint8 *line, int32 length, int32 offset)
 {
     int32 i         = 0;
@@ -198,6 +389,7 @@ void ReadGifPictureData(ImageGIF *image, int32 width, int32 height, bool32 inter
     }
     for (int32 h = 0; h < height; ++h) ReadGifLine(image, pixels, width, h * width);
 }
+#endif
 
 bool32 ImageGIF::Load(const char *fileName, bool32 loadHeader)
 {
@@ -342,7 +534,42 @@ void RSDK::ImagePNG::UnpackPixels_Indexed(uint8 *pixelData)
 void RSDK::ImagePNG::UnpackPixels_RGB(uint8 *pixelData)
 {
     color *pixels = (color *)this->pixels;
-    for (int32 p = 0; p < this->width * this->height; ++p) {
+    int32 p       = 0;
+
+    // pixelData sits further into the same buffer as pixels, so the SIMD loops stop before the writes could catch up with the reads
+#if RETRO_USE_FAST_PNG_DECODER && RETRO_USE_SSE2
+    const __m128i alpha = _mm_set1_epi32(0xFF000000);
+    for (; p + 4 <= this->width * this->height; p += 4) {
+        // 4 pixels are only 12 bytes, the last 4 bytes loaded get thrown away
+        __m128i rgb = _mm_loadu_si128((const __m128i *)pixelData);
+        __m128i px  = _mm_unpacklo_epi64(_mm_unpacklo_epi32(rgb, _mm_srli_si128(rgb, 3)),
+                                         _mm_unpacklo_epi32(_mm_srli_si128(rgb, 6), _mm_srli_si128(rgb, 9)));
+
+        __m128i r = _mm_and_si128(px, _mm_set1_epi32(0xFF));
+        __m128i g = _mm_and_si128(px, _mm_set1_epi32(0xFF00));
+        __m128i b = _mm_and_si128(_mm_srli_epi32(px, 16), _mm_set1_epi32(0xFF));
+        _mm_storeu_si128((__m128i *)pixels, _mm_or_si128(_mm_or_si128(_mm_slli_epi32(r, _REDOFF), g), _mm_or_si128(_mm_slli_epi32(b, _BLUEOFF), alpha)));
+
+        pixelData += 4 * 3;
+        pixels += 4;
+    }
+#elif RETRO_USE_FAST_PNG_DECODER && RETRO_USE_NEON
+    for (; p + 16 <= this->width * this->height; p += 16) {
+        uint8x16x3_t rgb = vld3q_u8(pixelData);
+
+        uint8x16x4_t px;
+        px.val[_REDOFF / 8]  = rgb.val[0];
+        px.val[1]            = rgb.val[1];
+        px.val[_BLUEOFF / 8] = rgb.val[2];
+        px.val[3]            = vdupq_n_u8(0xFF);
+        vst4q_u8((uint8 *)pixels, px);
+
+        pixelData += 16 * 3;
+        pixels += 16;
+    }
+#endif
+
+    for (; p < this->width * this->height; ++p) {
         uint32 color = 0;
 
         // R
@@ -367,7 +594,37 @@ void RSDK::ImagePNG::UnpackPixels_RGB(uint8 *pixelData)
 void RSDK::ImagePNG::UnpackPixels_RGBA(uint8 *pixelData)
 {
     color *pixels = (color *)this->pixels;
-    for (int32 p = 0; p < this->width * this->height; ++p) {
+    int32 p       = 0;
+
+#if RETRO_USE_FAST_PNG_DECODER && RETRO_USE_SSE2
+    for (; p + 4 <= this->width * this->height; p += 4) {
+        __m128i px = _mm_loadu_si128((const __m128i *)pixelData);
+
+        __m128i r  = _mm_and_si128(px, _mm_set1_epi32(0xFF));
+        __m128i ga = _mm_and_si128(px, _mm_set1_epi32(0xFF00FF00));
+        __m128i b  = _mm_and_si128(_mm_srli_epi32(px, 16), _mm_set1_epi32(0xFF));
+        _mm_storeu_si128((__m128i *)pixels, _mm_or_si128(_mm_or_si128(_mm_slli_epi32(r, _REDOFF), ga), _mm_slli_epi32(b, _BLUEOFF)));
+
+        pixelData += 4 * 4;
+        pixels += 4;
+    }
+#elif RETRO_USE_FAST_PNG_DECODER && RETRO_USE_NEON
+    for (; p + 16 <= this->width * this->height; p += 16) {
+        uint8x16x4_t rgba = vld4q_u8(pixelData);
+
+        uint8x16x4_t px;
+        px.val[_REDOFF / 8]  = rgba.val[0];
+        px.val[1]            = rgba.val[1];
+        px.val[_BLUEOFF / 8] = rgba.val[2];
+        px.val[3]            = rgba.val[3];
+        vst4q_u8((uint8 *)pixels, px);
+
+        pixelData += 16 * 4;
+        pixels += 16;
+    }
+#endif
+
+    for (; p < this->width * this->height; ++p) {
         uint32 color = 0;
 
         // R
@@ -390,6 +647,335 @@ void RSDK::ImagePNG::UnpackPixels_RGBA(uint8 *pixelData)
     }
 }
 
+#if RETRO_USE_FAST_PNG_DECODER
+// same as lodepng's paethPredictor(), just without the branches
+inline uint8 PaethPredictor(int32 a, int32 b, int32 c)
+{
+    int32 pa = abs(b - c);
+    int32 pb = abs(a - c);
+    int32 pc = abs(a + b - c - c);
+
+    int32 useB = -(pb < pa);
+    a          = (a & ~useB) | (b & useB);
+    pa         = (pa & ~useB) | (pb & useB);
+
+    int32 useC = -(pc < pa);
+    return (a & ~useC) | (c & useC);
+}
+
+// Sub, Avg & Paeth all depend on the pixel before, so for 3+ byte pixels they're done one pixel at a time with every channel at once
+#if RETRO_USE_SSE2
+// pixels are moved in & out through registers, going through memory would stall on the 3 & 6 byte sizes
+template <int32 bpp> inline __m128i LoadPNGPixel(uint8 *src)
+{
+    __m128i px;
+    if (bpp == 8) {
+        px = _mm_loadl_epi64((const __m128i *)src);
+    }
+    else {
+        uint32 lo = 0;
+        if (bpp == 3)
+            lo = src[0] | (src[1] << 8) | (src[2] << 16);
+        else
+            memcpy(&lo, src, sizeof(uint32));
+
+        px = _mm_cvtsi32_si128(lo);
+        if (bpp == 6)
+            px = _mm_insert_epi16(px, src[4] | (src[5] << 8), 2);
+    }
+
+    return _mm_unpacklo_epi8(px, _mm_setzero_si128());
+}
+
+template <int32 bpp> inline void StorePNGPixel(uint8 *dst, __m128i px)
+{
+    __m128i packed = _mm_packus_epi16(px, px);
+    if (bpp == 8) {
+        _mm_storel_epi64((__m128i *)dst, packed);
+    }
+    else {
+        uint32 lo = _mm_cvtsi128_si32(packed);
+        if (bpp == 3) {
+            dst[0] = lo;
+            dst[1] = lo >> 8;
+            dst[2] = lo >> 16;
+        }
+        else {
+            memcpy(dst, &lo, sizeof(uint32));
+        }
+
+        if (bpp == 6) {
+            uint16 hi = _mm_extract_epi16(packed, 2);
+            memcpy(&dst[4], &hi, sizeof(uint16));
+        }
+    }
+}
+
+template <int32 bpp> void UnfilterRow_Sub(uint8 *recon, uint8 *scanline, int32 pitch)
+{
+    __m128i a = _mm_setzero_si128();
+    for (int32 c = 0; c < pitch; c += bpp) {
+        a = _mm_and_si128(_mm_add_epi16(a, LoadPNGPixel<bpp>(&scanline[c])), _mm_set1_epi16(0xFF));
+        StorePNGPixel<bpp>(&recon[c], a);
+    }
+}
+
+template <int32 bpp> void UnfilterRow_Avg(uint8 *recon, uint8 *precon, uint8 *scanline, int32 pitch)
+{
+    __m128i a = _mm_setzero_si128();
+    for (int32 c = 0; c < pitch; c += bpp) {
+        __m128i b = LoadPNGPixel<bpp>(&precon[c]);
+        a         = _mm_add_epi16(LoadPNGPixel<bpp>(&scanline[c]), _mm_srli_epi16(_mm_add_epi16(a, b), 1));
+        a         = _mm_and_si128(a, _mm_set1_epi16(0xFF));
+        StorePNGPixel<bpp>(&recon[c], a);
+    }
+}
+
+template <int32 bpp> void UnfilterRow_Paeth(uint8 *recon, uint8 *precon, uint8 *scanline, int32 pitch)
+{
+    __m128i a = _mm_setzero_si128();
+    __m128i c = _mm_setzero_si128();
+    for (int32 x = 0; x < pitch; x += bpp) {
+        __m128i b = LoadPNGPixel<bpp>(&precon[x]);
+
+        __m128i pa = _mm_sub_epi16(b, c);
+        __m128i pb = _mm_sub_epi16(a, c);
+        __m128i pc = _mm_add_epi16(pa, pb);
+        pa         = _mm_max_epi16(pa, _mm_sub_epi16(_mm_setzero_si128(), pa));
+        pb         = _mm_max_epi16(pb, _mm_sub_epi16(_mm_setzero_si128(), pb));
+        pc         = _mm_max_epi16(pc, _mm_sub_epi16(_mm_setzero_si128(), pc));
+
+        // ties go to a, then b, then c
+        __m128i smallest = _mm_min_epi16(pc, _mm_min_epi16(pa, pb));
+        __m128i useA     = _mm_cmpeq_epi16(smallest, pa);
+        __m128i useB     = _mm_andnot_si128(useA, _mm_cmpeq_epi16(smallest, pb));
+        __m128i useC     = _mm_andnot_si128(_mm_or_si128(useA, useB), _mm_set1_epi16(-1));
+        __m128i nearest  = _mm_or_si128(_mm_or_si128(_mm_and_si128(useA, a), _mm_and_si128(useB, b)), _mm_and_si128(useC, c));
+
+        a = _mm_and_si128(_mm_add_epi16(LoadPNGPixel<bpp>(&scanline[x]), nearest), _mm_set1_epi16(0xFF));
+        c = b;
+        StorePNGPixel<bpp>(&recon[x], a);
+    }
+}
+#elif RETRO_USE_NEON
+// pixels are moved in & out through registers, going through memory would stall on the 3 & 6 byte sizes
+template <int32 bpp> inline int16x8_t LoadPNGPixel(uint8 *src)
+{
+    uint8x8_t px;
+    if (bpp == 8) {
+        px = vld1_u8(src);
+    }
+    else {
+        uint32 lo = 0;
+        if (bpp == 3)
+            lo = src[0] | (src[1] << 8) | (src[2] << 16);
+        else
+            memcpy(&lo, src, sizeof(uint32));
+
+        uint64 value = lo;
+        if (bpp == 6)
+            value |= (uint64)(src[4] | (src[5] << 8)) << 32;
+        px = vcreate_u8(value);
+    }
+
+    return vreinterpretq_s16_u16(vmovl_u8(px));
+}
+
+template <int32 bpp> inline void StorePNGPixel(uint8 *dst, int16x8_t px)
+{
+    uint8x8_t packed = vmovn_u16(vreinterpretq_u16_s16(px));
+    if (bpp == 8) {
+        vst1_u8(dst, packed);
+    }
+    else {
+        uint32 lo = vget_lane_u32(vreinterpret_u32_u8(packed), 0);
+        if (bpp == 3) {
+            dst[0] = lo;
+            dst[1] = lo >> 8;
+            dst[2] = lo >> 16;
+        }
+        else {
+            memcpy(dst, &lo, sizeof(uint32));
+        }
+
+        if (bpp == 6) {
+            uint16 hi = vget_lane_u16(vreinterpret_u16_u8(packed), 2);
+            memcpy(&dst[4], &hi, sizeof(uint16));
+        }
+    }
+}
+
+template <int32 bpp> void UnfilterRow_Sub(uint8 *recon, uint8 *scanline, int32 pitch)
+{
+    int16x8_t a = vdupq_n_s16(0);
+    for (int32 c = 0; c < pitch; c += bpp) {
+        a = vandq_s16(vaddq_s16(a, LoadPNGPixel<bpp>(&scanline[c])), vdupq_n_s16(0xFF));
+        StorePNGPixel<bpp>(&recon[c], a);
+    }
+}
+
+template <int32 bpp> void UnfilterRow_Avg(uint8 *recon, uint8 *precon, uint8 *scanline, int32 pitch)
+{
+    int16x8_t a = vdupq_n_s16(0);
+    for (int32 c = 0; c < pitch; c += bpp) {
+        int16x8_t b = LoadPNGPixel<bpp>(&precon[c]);
+        a           = vaddq_s16(LoadPNGPixel<bpp>(&scanline[c]), vshrq_n_s16(vaddq_s16(a, b), 1));
+        a           = vandq_s16(a, vdupq_n_s16(0xFF));
+        StorePNGPixel<bpp>(&recon[c], a);
+    }
+}
+
+template <int32 bpp> void UnfilterRow_Paeth(uint8 *recon, uint8 *precon, uint8 *scanline, int32 pitch)
+{
+    int16x8_t a = vdupq_n_s16(0);
+    int16x8_t c = vdupq_n_s16(0);
+    for (int32 x = 0; x < pitch; x += bpp) {
+        int16x8_t b = LoadPNGPixel<bpp>(&precon[x]);
+
+        int16x8_t pa = vabdq_s16(b, c);
+        int16x8_t pb = vabdq_s16(a, c);
+        int16x8_t pc = vabsq_s16(vsubq_s16(vaddq_s16(a, b), vaddq_s16(c, c)));
+
+        // ties go to a, then b, then c
+        int16x8_t smallest = vminq_s16(pc, vminq_s16(pa, pb));
+        int16x8_t nearest  = vbslq_s16(vceqq_s16(smallest, pa), a, vbslq_s16(vceqq_s16(smallest, pb), b, c));
+
+        a = vandq_s16(vaddq_s16(LoadPNGPixel<bpp>(&scanline[x]), nearest), vdupq_n_s16(0xFF));
+        c = b;
+        StorePNGPixel<bpp>(&recon[x], a);
+    }
+}
+#endif
+
+void RSDK::ImagePNG::Unfilter(uint8 *recon)
+{
+    int32 bpp = (this->bitDepth + 7) >> 3;
+    switch (this->colorFormat) {
+        default: break;
+
+        case PNGCLR_RGB: bpp *= sizeof(color) - 1; break;
+
+        case PNGCLR_GREYSCALEA: bpp *= 2 * sizeof(uint8); break;
+
+        case PNGCLR_RGBA: bpp *= sizeof(color); break;
+    }
+
+    int32 pitch     = bpp * this->width;
+    uint8 *scanline = recon;
+
+    for (int32 y = 0; y < this->height; ++y) {
+        int32 filter = *scanline++;
+
+        // prev scanline
+        uint8 *precon = y ? &recon[-pitch] : NULL;
+
+        // the first scanline has nothing above it, Paeth becomes Sub and Up becomes None
+        if (!precon && filter == PNGFILTER_PAETH)
+            filter = PNGFILTER_SUB;
+        if (!precon && filter == PNGFILTER_UP)
+            filter = PNGFILTER_NONE;
+
+        // recon is always behind scanline, so rows can be unfiltered in place as long as each pixel is read before it's written
+        int32 c = 0;
+        switch (filter) {
+            default: PrintLog(PRINT_NORMAL, "Invalid PNG Filter: %d", filter); return;
+
+            case PNGFILTER_NONE: memmove(recon, scanline, pitch); break;
+
+            case PNGFILTER_SUB:
+#if RETRO_USE_SSE2 || RETRO_USE_NEON
+                switch (bpp) {
+                    case 3: UnfilterRow_Sub<3>(recon, scanline, pitch); c = pitch; break;
+                    case 4: UnfilterRow_Sub<4>(recon, scanline, pitch); c = pitch; break;
+                    case 6: UnfilterRow_Sub<6>(recon, scanline, pitch); c = pitch; break;
+                    case 8: UnfilterRow_Sub<8>(recon, scanline, pitch); c = pitch; break;
+                    default: break;
+                }
+#endif
+
+                for (; c < bpp; ++c) {
+                    recon[c] = scanline[c];
+                }
+
+                for (int32 p = c - bpp; c < pitch; ++c, ++p) {
+                    recon[c] = scanline[c] + recon[p];
+                }
+                break;
+
+            case PNGFILTER_UP:
+#if RETRO_USE_SSE2
+                for (; c + 16 <= pitch; c += 16) {
+                    __m128i sum = _mm_add_epi8(_mm_loadu_si128((const __m128i *)&scanline[c]), _mm_loadu_si128((const __m128i *)&precon[c]));
+                    _mm_storeu_si128((__m128i *)&recon[c], sum);
+                }
+#elif RETRO_USE_NEON
+                for (; c + 16 <= pitch; c += 16) {
+                    vst1q_u8(&recon[c], vaddq_u8(vld1q_u8(&scanline[c]), vld1q_u8(&precon[c])));
+                }
+#endif
+
+                for (; c < pitch; ++c) {
+                    recon[c] = precon[c] + scanline[c];
+                }
+                break;
+
+            case PNGFILTER_AVG:
+                if (precon) {
+#if RETRO_USE_SSE2 || RETRO_USE_NEON
+                    // 3 byte pixels are quicker through the plain loop here, there isn't enough work per pixel to make up for the packing
+                    switch (bpp) {
+                        case 4: UnfilterRow_Avg<4>(recon, precon, scanline, pitch); c = pitch; break;
+                        case 6: UnfilterRow_Avg<6>(recon, precon, scanline, pitch); c = pitch; break;
+                        case 8: UnfilterRow_Avg<8>(recon, precon, scanline, pitch); c = pitch; break;
+                        default: break;
+                    }
+#endif
+
+                    for (; c < bpp; ++c) {
+                        recon[c] = scanline[c] + (precon[c] >> 1);
+                    }
+
+                    for (int32 p = c - bpp; c < pitch; ++c, ++p) {
+                        recon[c] = scanline[c] + ((recon[p] + precon[c]) >> 1);
+                    }
+                }
+                else {
+                    for (; c < bpp; ++c) {
+                        recon[c] = scanline[c];
+                    }
+
+                    for (int32 p = 0; c < pitch; ++c, ++p) {
+                        recon[c] = scanline[c] + (recon[p] >> 1);
+                    }
+                }
+                break;
+
+            case PNGFILTER_PAETH:
+#if RETRO_USE_SSE2 || RETRO_USE_NEON
+                switch (bpp) {
+                    case 3: UnfilterRow_Paeth<3>(recon, precon, scanline, pitch); c = pitch; break;
+                    case 4: UnfilterRow_Paeth<4>(recon, precon, scanline, pitch); c = pitch; break;
+                    case 6: UnfilterRow_Paeth<6>(recon, precon, scanline, pitch); c = pitch; break;
+                    case 8: UnfilterRow_Paeth<8>(recon, precon, scanline, pitch); c = pitch; break;
+                    default: break;
+                }
+#endif
+
+                for (; c < bpp; ++c) {
+                    recon[c] = (scanline[c] + precon[c]);
+                }
+
+                for (int32 p = c - bpp; c < pitch; ++c, ++p) {
+                    recon[c] = (scanline[c] + PaethPredictor(recon[c - bpp], precon[c], precon[p]));
+                }
+                break;
+        }
+
+        recon += pitch;
+        scanline += pitch;
+    }
+}
+#else
 // from: https://raw.githubusercontent.com/lvandeve/lodepng/master/lodepng.cpp - paethPredictor()
 uint8 paethPredictor(int16 a, int16 b, int16 c)
 {
@@ -512,6 +1098,8 @@ void RSDK::ImagePNG::Unfilter(uint8 *recon)
     }
 }
 
+#endif
+
 bool32 RSDK::ImagePNG::AllocatePixels()
 {
     dataSize = sizeof(color) * height * (width + 1);
@@ -903,6 +1491,297 @@ bool32 RSDK::ImageTGA::Load(const char *fileName, bool32 loadHeader)
 }
 #endif
 
+#if RETRO_USE_SPRITE_CACHE
+bool32 RSDK::useSpriteCache = false;
+
+void GetSpriteCachePath(char *buffer, int32 bufferSize, const char *filePath, uint32 *hash)
+{
+    char pathBuffer[0x100];
+    sprintf_s(pathBuffer, (int32)sizeof(pathBuffer), "%s", filePath);
+    GEN_HASH_MD5_BUFFER(pathBuffer, hash);
+
+    sprintf_s(buffer, bufferSize, "%sSpriteCache/%08X%08X%08X%08X.bin", SKU::userFileDir, hash[0], hash[1], hash[2], hash[3]);
+}
+
+// only used when the gif can't be identified any other way, since it means reading the whole file
+bool32 GetSpriteContentKey(FileInfo *info, uint32 *key)
+{
+    if (info->fileSize <= 0)
+        return false;
+
+    uint8 *buffer = (uint8 *)malloc(info->fileSize);
+    if (!buffer)
+        return false;
+
+    int32 readPos = info->readPos;
+    Seek_Set(info, 0);
+    bool32 success = ReadBytes(info, buffer, info->fileSize) == (size_t)info->fileSize;
+    Seek_Set(info, readPos);
+
+    if (success)
+        GenerateHashMD5(key, (char *)buffer, info->fileSize);
+
+    free(buffer);
+    return success;
+}
+
+// identifies the gif without reading it: files in a data pack are keyed by their entry's hash, offset & size plus the pack's own size &
+// modification time, loose files by their size & modification time. files a mod redirected somewhere else get their contents hashed instead
+bool32 GetSpriteSourceKey(const char *filePath, FileInfo *info, uint32 *key)
+{
+    struct {
+        RETRO_HASH_MD5(entryHash);
+        int64 sourceSize;
+        int64 sourceTime;
+        int32 fileOffset;
+        int32 fileSize;
+    } source;
+    memset(&source, 0, sizeof(source));
+
+    if (info->externalFile)
+        return GetSpriteContentKey(info, key);
+
+    const char *sourcePath = filePath;
+    if (useDataPack) {
+        sourcePath = NULL;
+
+        char hashBuffer[0x400];
+        StringLowerCase(hashBuffer, filePath);
+        GEN_HASH_MD5_BUFFER(hashBuffer, source.entryHash);
+
+        for (int32 f = 0; f < dataFileListCount; ++f) {
+            if (HASH_MATCH_MD5(source.entryHash, dataFileList[f].hash)) {
+                sourcePath = dataPacks[dataFileList[f].packID].name;
+                break;
+            }
+        }
+    }
+
+    std::error_code err;
+    if (sourcePath) {
+        source.sourceSize = (int64)fs::file_size(fs::path(sourcePath), err);
+        if (!err)
+            source.sourceTime = (int64)fs::last_write_time(fs::path(sourcePath), err).time_since_epoch().count();
+    }
+
+    if (!sourcePath || err)
+        return GetSpriteContentKey(info, key);
+
+    source.fileOffset = info->fileOffset;
+    source.fileSize   = info->fileSize;
+    GenerateHashMD5(key, (char *)&source, sizeof(source));
+    return true;
+}
+
+bool32 RSDK::LoadSpriteCache(const char *filePath, FileInfo *info, int32 width, int32 height, uint8 *pixels, uint32 *sourceKey)
+{
+    memset(sourceKey, 0, HASH_SIZE_MD5);
+    if (!useSpriteCache || !pixels)
+        return false;
+
+    if (!GetSpriteSourceKey(filePath, info, sourceKey))
+        return false;
+
+    RETRO_HASH_MD5(hash);
+    char cachePath[0x200];
+    GetSpriteCachePath(cachePath, (int32)sizeof(cachePath), filePath, hash);
+
+    FileIO *file = fOpen(cachePath, "rb");
+    if (!file)
+        return false;
+
+    SpriteCacheHeader header;
+    size_t bytesRead = fRead(&header, 1, sizeof(SpriteCacheHeader), file);
+    bool32 valid     = bytesRead == sizeof(SpriteCacheHeader) && header.signature == SPRITECACHE_SIGNATURE && header.version == SPRITECACHE_VERSION
+                   && HASH_MATCH_MD5(header.hash, hash) && HASH_MATCH_MD5(header.sourceKey, sourceKey) && header.fileOffset == info->fileOffset && header.fileSize == info->fileSize
+                   && header.width == width && header.height == height;
+
+    if (valid) {
+        bytesRead = fRead(pixels, 1, width * height, file);
+        valid     = bytesRead == (size_t)(width * height);
+    }
+
+    fClose(file);
+    return valid;
+}
+
+void RSDK::SaveSpriteCache(const char *filePath, uint32 *sourceKey, int32 fileOffset, int32 fileSize, int32 width, int32 height, uint8 *pixels)
+{
+    if (!useSpriteCache || !pixels)
+        return;
+
+    SpriteCacheHeader header;
+    char cachePath[0x200];
+    GetSpriteCachePath(cachePath, (int32)sizeof(cachePath), filePath, header.hash);
+
+    std::error_code err;
+    fs::create_directories(fs::path(cachePath).parent_path(), err);
+
+    FileIO *file = fOpen(cachePath, "wb");
+    if (!file) {
+        PrintLog(PRINT_NORMAL, "WARNING: Failed to write sprite cache for %s", filePath);
+        return;
+    }
+
+    header.signature  = SPRITECACHE_SIGNATURE;
+    header.version    = SPRITECACHE_VERSION;
+    HASH_COPY_MD5(header.sourceKey, sourceKey);
+    header.fileOffset = fileOffset;
+    header.fileSize   = fileSize;
+    header.width      = width;
+    header.height     = height;
+
+    fWrite(&header, sizeof(SpriteCacheHeader), 1, file);
+    fWrite(pixels, 1, width * height, file);
+    fClose(file);
+}
+#endif
+
+#if RETRO_USE_THREADED_SPRITES
+bool32 RSDK::useThreadedSprites = false;
+
+SpriteSheetJob spriteSheetJobs[SURFACE_COUNT];
+int32 spriteSheetJobCount = 0;
+int32 spriteSheetJobNext  = 0;
+bool32 batchSpriteSheets  = false;
+bool32 spriteSheetsQueued = false; // set once no more jobs will be added, so the workers know to exit once the queue is empty
+
+std::thread spriteSheetWorkers[SPRITESHEET_WORKER_COUNT];
+int32 spriteSheetWorkerCount = 0;
+std::mutex spriteSheetMutex;
+std::condition_variable spriteSheetCondition;
+
+void DecodeSpriteSheetJob(SpriteSheetJob *job, GifDecoder *decoder)
+{
+    color palette[0x100];
+
+    ImageGIF image(decoder);
+    image.info    = job->info;
+    image.width   = job->width;
+    image.height  = job->height;
+    image.palette = palette;
+    image.pixels  = job->pixels;
+    image.Load(NULL, false); // closes the file once it's done
+}
+
+void SpriteSheetWorker()
+{
+    // storage isn't safe to use from here, so each worker gets its own decoder
+    GifDecoder *decoder = (GifDecoder *)calloc(1, sizeof(GifDecoder));
+    if (!decoder)
+        return;
+
+    std::unique_lock<std::mutex> lock(spriteSheetMutex);
+    while (true) {
+        spriteSheetCondition.wait(lock, [] { return spriteSheetJobNext < spriteSheetJobCount || spriteSheetsQueued; });
+
+        if (spriteSheetJobNext >= spriteSheetJobCount)
+            break;
+
+        SpriteSheetJob *job = &spriteSheetJobs[spriteSheetJobNext++];
+
+        lock.unlock();
+        DecodeSpriteSheetJob(job, decoder);
+        lock.lock();
+    }
+    lock.unlock();
+
+    free(decoder);
+}
+
+bool32 QueueSpriteSheet(uint16 id, const char *filePath, ImageGIF *image, uint32 *sourceKey)
+{
+    if (!batchSpriteSheets || spriteSheetJobCount >= SURFACE_COUNT)
+        return false;
+
+    uint8 *pixels = (uint8 *)malloc(image->width * image->height);
+    if (!pixels)
+        return false;
+
+    SpriteSheetJob *job = &spriteSheetJobs[spriteSheetJobCount];
+    sprintf_s(job->filePath, (int32)sizeof(job->filePath), "%s", filePath);
+    job->info       = image->info;
+    job->pixels     = pixels;
+    job->width      = image->width;
+    job->height     = image->height;
+    job->fileOffset = image->info.fileOffset;
+    job->fileSize   = image->info.fileSize;
+    job->surfaceID  = id;
+#if RETRO_USE_SPRITE_CACHE
+    if (sourceKey)
+        HASH_COPY_MD5(job->sourceKey, sourceKey);
+#endif
+
+    // the job owns the file now, so make sure image.Close() doesn't touch it
+    InitFileInfo(&image->info);
+
+    spriteSheetMutex.lock();
+    ++spriteSheetJobCount;
+    spriteSheetMutex.unlock();
+    spriteSheetCondition.notify_one();
+
+    return true;
+}
+
+void RSDK::BeginSpriteSheetDecoding()
+{
+    if (!useThreadedSprites)
+        return;
+
+    int32 coreCount = (int32)std::thread::hardware_concurrency();
+    if (coreCount <= 1)
+        return; // nothing to gain here, just decode them as they're loaded
+
+    spriteSheetJobCount    = 0;
+    spriteSheetJobNext     = 0;
+    spriteSheetsQueued     = false;
+    spriteSheetWorkerCount = MIN(coreCount - 1, SPRITESHEET_WORKER_COUNT);
+
+    for (int32 w = 0; w < spriteSheetWorkerCount; ++w) spriteSheetWorkers[w] = std::thread(SpriteSheetWorker);
+
+    batchSpriteSheets = true;
+}
+
+void RSDK::FinishSpriteSheetDecoding()
+{
+    if (!batchSpriteSheets)
+        return;
+
+    batchSpriteSheets = false;
+
+    spriteSheetMutex.lock();
+    spriteSheetsQueued = true;
+    spriteSheetMutex.unlock();
+    spriteSheetCondition.notify_all();
+
+    // may as well help out rather than just waiting around
+    SpriteSheetWorker();
+
+    for (int32 w = 0; w < spriteSheetWorkerCount; ++w) spriteSheetWorkers[w].join();
+    spriteSheetWorkerCount = 0;
+
+    for (int32 j = 0; j < spriteSheetJobCount; ++j) {
+        SpriteSheetJob *job = &spriteSheetJobs[j];
+
+        // surface storage may have moved while the workers were busy, so this has to be looked up again
+        GFXSurface *surface = &gfxSurface[job->surfaceID];
+        if (surface->pixels) {
+            memcpy(surface->pixels, job->pixels, job->width * job->height);
+#if RETRO_USE_SPRITE_CACHE
+            SaveSpriteCache(job->filePath, job->sourceKey, job->fileOffset, job->fileSize, job->width, job->height, surface->pixels);
+#endif
+        }
+
+        free(job->pixels);
+        job->pixels = NULL;
+    }
+
+    spriteSheetJobCount = 0;
+    spriteSheetJobNext  = 0;
+    spriteSheetsQueued  = false;
+}
+#endif
+
 uint16 RSDK::LoadSpriteSheet(const char *filename, int32 scope)
 {
     char fullFilePath[0x100];
@@ -911,6 +1790,13 @@ uint16 RSDK::LoadSpriteSheet(const char *filename, int32 scope)
     RETRO_HASH_MD5(hash);
     GEN_HASH_MD5(filename, hash);
 
+#if RETRO_USE_RESOURCE_REGISTRY
+    int32 existing = surfaceRegistry.Find(hash);
+    if (existing >= 0)
+        return existing;
+
+    uint16 id = surfaceRegistry.GetFreeSlot();
+#else
     for (int32 i = 0; i < SURFACE_COUNT; ++i) {
         if (HASH_MATCH_MD5(gfxSurface[i].hash, hash)) {
             return i;
@@ -922,6 +1808,7 @@ uint16 RSDK::LoadSpriteSheet(const char *filename, int32 scope)
         if (gfxSurface[id].scope == SCOPE_NONE)
             break;
     }
+#endif
 
     if (id >= SURFACE_COUNT)
         return -1;
@@ -935,6 +1822,9 @@ uint16 RSDK::LoadSpriteSheet(const char *filename, int32 scope)
         surface->height   = image.height;
         surface->lineSize = 0;
         memcpy(surface->hash, hash, 4 * sizeof(int32));
+#if RETRO_USE_RESOURCE_REGISTRY
+        surfaceRegistry.Register(id, hash, scope);
+#endif
 
         int32 w = surface->width;
         if (w > 1) {
@@ -948,8 +1838,30 @@ uint16 RSDK::LoadSpriteSheet(const char *filename, int32 scope)
 
         surface->pixels = NULL;
         AllocateStorage((void **)&surface->pixels, surface->width * surface->height, DATASET_STG, false);
+#if RETRO_USE_SPRITE_CACHE
+        RETRO_HASH_MD5(sourceKey);
+        if (!LoadSpriteCache(fullFilePath, &image.info, surface->width, surface->height, surface->pixels, sourceKey)
+#if RETRO_USE_THREADED_SPRITES
+            && !QueueSpriteSheet(id, fullFilePath, &image, sourceKey)
+#endif
+        ) {
+            int32 fileOffset = image.info.fileOffset;
+            int32 fileSize   = image.info.fileSize;
+
+            image.pixels = surface->pixels;
+            image.Load(NULL, false);
+
+            SaveSpriteCache(fullFilePath, sourceKey, fileOffset, fileSize, surface->width, surface->height, surface->pixels);
+        }
+#elif RETRO_USE_THREADED_SPRITES
+        if (!QueueSpriteSheet(id, fullFilePath, &image, NULL)) {
+            image.pixels = surface->pixels;
+            image.Load(NULL, false);
+        }
+#else
         image.pixels = surface->pixels;
         image.Load(NULL, false);
+#endif
 
         image.palette = NULL;
         image.decoder = NULL;
@@ -53,10 +53,17 @@ struct GifDecoder {
     uint8 stack[4096];
     uint8 suffix[4096];
     uint32 prefix[4096];
+#if RETRO_USE_FAST_GIF_DECODER
+    uint16 length[4096]; // how many pixels each code expands to
+#endif
 };
 
 struct ImageGIF : public Image {
     ImageGIF() { AllocateStorage((void **)&decoder, sizeof(GifDecoder), DATASET_TMP, true); }
+#if RETRO_USE_THREADED_SPRITES
+    // for decoding off the main thread, where storage can't be touched
+    ImageGIF(GifDecoder *decoder) : decoder(decoder) {}
+#endif
 
     bool32 Load(const char *fileName, bool32 loadHeader);
 
@@ -111,6 +118,54 @@ struct ImageTGA : public Image {
 };
 #endif
 
+#if RETRO_USE_SPRITE_CACHE
+#define SPRITECACHE_SIGNATURE (0x43505352) // "RSPC"
+#define SPRITECACHE_VERSION   (3)
+
+struct SpriteCacheHeader {
+    uint32 signature;
+    uint32 version;
+    RETRO_HASH_MD5(hash);
+    // where the gif came from (see GetSpriteSourceKey), if any of these change the cache is stale
+    RETRO_HASH_MD5(sourceKey);
+    int32 fileOffset;
+    int32 fileSize;
+    int32 width;
+    int32 height;
+};
+
+extern bool32 useSpriteCache;
+
+// sourceKey is set to what identifies the gif's current contents, which SaveSpriteCache needs if this misses
+bool32 LoadSpriteCache(const char *filePath, FileInfo *info, int32 width, int32 height, uint8 *pixels, uint32 *sourceKey);
+void SaveSpriteCache(const char *filePath, uint32 *sourceKey, int32 fileOffset, int32 fileSize, int32 width, int32 height, uint8 *pixels);
+#endif
+
+#if RETRO_USE_THREADED_SPRITES
+#define SPRITESHEET_WORKER_COUNT (8)
+
+struct SpriteSheetJob {
+    FileInfo info;
+    char filePath[0x100];
+    uint8 *pixels; // the workers decode into this, it gets copied into the surface once they're all done
+    int32 width;
+    int32 height;
+    int32 fileOffset;
+    int32 fileSize;
+#if RETRO_USE_SPRITE_CACHE
+    RETRO_HASH_MD5(sourceKey);
+#endif
+    uint16 surfaceID;
+};
+
+// set with "threadedsprites=true", stageLoad callbacks that read sprite pixels would see garbage otherwise, so it's off by default
+extern bool32 useThreadedSprites;
+
+// if useThreadedSprites is set, any sheets loaded between these get decoded in parallel & their pixels aren't valid until FinishSpriteSheetDecoding returns
+void BeginSpriteSheetDecoding();
+void FinishSpriteSheetDecoding();
+#endif
+
 uint16 LoadSpriteSheet(const char *filename, int32 scope);
 bool32 LoadImage(const char *filename, double displayLength, double fadeSpeed, bool32 (*skipCallback)());
 
@@ -1,5 +1,11 @@
 #include "RSDK/Core/RetroEngine.hpp"
 
+#if RETRO_USE_THREADED_VIDEO
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#endif
+
 using namespace RSDK;
 
 FileInfo VideoManager::file;
@@ -18,6 +24,438 @@ th_pixel_fmt VideoManager::pixelFormat;
 ogg_int64_t VideoManager::granulePos = 0;
 bool32 VideoManager::initializing    = false;
 
+#if RETRO_USE_THREADED_VIDEO
+VideoFrame videoFrames[VIDEO_FRAME_COUNT];
+int32 videoFrameRead        = 0;
+int32 videoFrameCount       = 0;
+double videoFrameTime       = 0.0; // time of the frame currently on screen
+bool32 videoDecoderFinished = false;
+bool32 videoDecoderQuit     = false;
+
+std::thread videoDecoderThread;
+std::mutex videoFrameMutex;
+std::condition_variable videoFrameSignal;
+#endif
+
+#if RETRO_USE_SOFTWARE_VIDEO
+bool32 VideoManager::softwareOutput = RETRO_RENDERDEVICE_NX || RETRO_RENDERDEVICE_NULL; // the NX & null RenderDevices have no video textures
+
+uint16 videoRowBuffer[VIDEO_ROW_MAX];
+
+// all of the converters below use the same fixed point BT.601 (studio range) math, so every path gives the exact same output
+// C = Y - 16, D = U - 128, E = V - 128
+// R = (298C + 409E + 128) >> 8
+// G = (298C - 100D - 208E + 128) >> 8
+// B = (298C + 516D + 128) >> 8
+inline uint8 ClampVideoColor(int32 c) { return c < 0 ? 0 : (c > 0xFF ? 0xFF : c); }
+
+inline void ConvertVideoPixel(uint8 y, uint8 u, uint8 v, uint8 *r, uint8 *g, uint8 *b)
+{
+    int32 c = 298 * (y - 16);
+    int32 d = u - 128;
+    int32 e = v - 128;
+
+    *r = ClampVideoColor((c + 409 * e + 128) >> 8);
+    *g = ClampVideoColor((c - 100 * d - 208 * e + 128) >> 8);
+    *b = ClampVideoColor((c + 516 * d + 128) >> 8);
+}
+
+#if RETRO_USE_SSE2
+// converts 8 pixels, chroma is either 8 samples or 4 that get doubled up
+inline void ConvertVideoPixels_SSE2(uint8 *yRow, uint8 *uRow, uint8 *vRow, int32 x, int32 shiftX, __m128i *r, __m128i *g, __m128i *b)
+{
+    const __m128i zero = _mm_setzero_si128();
+
+    __m128i y8 = _mm_loadl_epi64((const __m128i *)&yRow[x]);
+    __m128i u8, v8;
+    if (shiftX) {
+        int32 u4, v4;
+        memcpy(&u4, &uRow[x >> 1], sizeof(int32));
+        memcpy(&v4, &vRow[x >> 1], sizeof(int32));
+        u8 = _mm_cvtsi32_si128(u4);
+        v8 = _mm_cvtsi32_si128(v4);
+        u8 = _mm_unpacklo_epi8(u8, u8);
+        v8 = _mm_unpacklo_epi8(v8, v8);
+    }
+    else {
+        u8 = _mm_loadl_epi64((const __m128i *)&uRow[x]);
+        v8 = _mm_loadl_epi64((const __m128i *)&vRow[x]);
+    }
+
+    __m128i c = _mm_sub_epi16(_mm_unpacklo_epi8(y8, zero), _mm_set1_epi16(16));
+    __m128i d = _mm_sub_epi16(_mm_unpacklo_epi8(u8, zero), _mm_set1_epi16(128));
+    __m128i e = _mm_sub_epi16(_mm_unpacklo_epi8(v8, zero), _mm_set1_epi16(128));
+
+    // interleave the terms so each madd does two of the multiplies at once
+    __m128i ceLo = _mm_unpacklo_epi16(c, e);
+    __m128i ceHi = _mm_unpackhi_epi16(c, e);
+    __m128i cdLo = _mm_unpacklo_epi16(c, d);
+    __m128i cdHi = _mm_unpackhi_epi16(c, d);
+    __m128i eLo  = _mm_unpacklo_epi16(e, zero);
+    __m128i eHi  = _mm_unpackhi_epi16(e, zero);
+
+    const __m128i round = _mm_set1_epi32(128);
+    const __m128i mulR  = _mm_set_epi16(409, 298, 409, 298, 409, 298, 409, 298);
+    const __m128i mulG  = _mm_set_epi16(-100, 298, -100, 298, -100, 298, -100, 298);
+    const __m128i mulGE = _mm_set_epi16(0, -208, 0, -208, 0, -208, 0, -208);
+    const __m128i mulB  = _mm_set_epi16(516, 298, 516, 298, 516, 298, 516, 298);
+
+    __m128i rLo = _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(ceLo, mulR), round), 8);
+    __m128i rHi = _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(ceHi, mulR), round), 8);
+    __m128i gLo = _mm_srai_epi32(_mm_add_epi32(_mm_add_epi32(_mm_madd_epi16(cdLo, mulG), _mm_madd_epi16(eLo, mulGE)), round), 8);
+    __m128i gHi = _mm_srai_epi32(_mm_add_epi32(_mm_add_epi32(_mm_madd_epi16(cdHi, mulG), _mm_madd_epi16(eHi, mulGE)), round), 8);
+    __m128i bLo = _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(cdLo, mulB), round), 8);
+    __m128i bHi = _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(cdHi, mulB), round), 8);
+
+    // packus does the clamping for us, the 8 results end up in the low half
+    __m128i r16 = _mm_packs_epi32(rLo, rHi);
+    __m128i g16 = _mm_packs_epi32(gLo, gHi);
+    __m128i b16 = _mm_packs_epi32(bLo, bHi);
+    *r          = _mm_packus_epi16(r16, r16);
+    *g          = _mm_packus_epi16(g16, g16);
+    *b          = _mm_packus_epi16(b16, b16);
+}
+#elif RETRO_USE_NEON
+inline void ConvertVideoPixels_NEON(uint8 *yRow, uint8 *uRow, uint8 *vRow, int32 x, int32 shiftX, uint8x8_t *r, uint8x8_t *g, uint8x8_t *b)
+{
+    uint8x8_t y8 = vld1_u8(&yRow[x]);
+    uint8x8_t u8, v8;
+    if (shiftX) {
+        uint32 u4, v4;
+        memcpy(&u4, &uRow[x >> 1], sizeof(uint32));
+        memcpy(&v4, &vRow[x >> 1], sizeof(uint32));
+        u8 = vreinterpret_u8_u32(vdup_n_u32(u4));
+        v8 = vreinterpret_u8_u32(vdup_n_u32(v4));
+        u8 = vzip_u8(u8, u8).val[0];
+        v8 = vzip_u8(v8, v8).val[0];
+    }
+    else {
+        u8 = vld1_u8(&uRow[x]);
+        v8 = vld1_u8(&vRow[x]);
+    }
+
+    int16x8_t c = vreinterpretq_s16_u16(vsubl_u8(y8, vdup_n_u8(16)));
+    int16x8_t d = vreinterpretq_s16_u16(vsubl_u8(u8, vdup_n_u8(128)));
+    int16x8_t e = vreinterpretq_s16_u16(vsubl_u8(v8, vdup_n_u8(128)));
+
+    int32x4_t cLo = vmull_n_s16(vget_low_s16(c), 298);
+    int32x4_t cHi = vmull_n_s16(vget_high_s16(c), 298);
+
+    int32x4_t rLo = vmlal_n_s16(cLo, vget_low_s16(e), 409);
+    int32x4_t rHi = vmlal_n_s16(cHi, vget_high_s16(e), 409);
+    int32x4_t gLo = vmlal_n_s16(vmlal_n_s16(cLo, vget_low_s16(d), -100), vget_low_s16(e), -208);
+    int32x4_t gHi = vmlal_n_s16(vmlal_n_s16(cHi, vget_high_s16(d), -100), vget_high_s16(e), -208);
+    int32x4_t bLo = vmlal_n_s16(cLo, vget_low_s16(d), 516);
+    int32x4_t bHi = vmlal_n_s16(cHi, vget_high_s16(d), 516);
+
+    // the rounding shift adds the 128 & clamps the bottom, the narrow clamps the top
+    *r = vqmovn_u16(vcombine_u16(vqrshrun_n_s32(rLo, 8), vqrshrun_n_s32(rHi, 8)));
+    *g = vqmovn_u16(vcombine_u16(vqrshrun_n_s32(gLo, 8), vqrshrun_n_s32(gHi, 8)));
+    *b = vqmovn_u16(vcombine_u16(vqrshrun_n_s32(bLo, 8), vqrshrun_n_s32(bHi, 8)));
+}
+#endif
+
+void ConvertVideoRow_XRGB8888(uint32 *pixels, uint8 *yRow, uint8 *uRow, uint8 *vRow, int32 width, int32 shiftX, bool32 swapRB)
+{
+    int32 x = 0;
+
+#if RETRO_USE_SSE2
+    const __m128i alpha = _mm_set1_epi8((char)0xFF);
+    for (; x + 8 <= width; x += 8) {
+        __m128i r, g, b;
+        ConvertVideoPixels_SSE2(yRow, uRow, vRow, x, shiftX, &r, &g, &b);
+        if (swapRB) {
+            __m128i t = r;
+            r         = b;
+            b         = t;
+        }
+
+        // B, G, R, A in memory == 0xAARRGGBB
+        __m128i bg = _mm_unpacklo_epi8(b, g);
+        __m128i ra = _mm_unpacklo_epi8(r, alpha);
+        _mm_storeu_si128((__m128i *)&pixels[x], _mm_unpacklo_epi16(bg, ra));
+        _mm_storeu_si128((__m128i *)&pixels[x + 4], _mm_unpackhi_epi16(bg, ra));
+    }
+#elif RETRO_USE_NEON
+    for (; x + 8 <= width; x += 8) {
+        uint8x8x4_t px;
+        ConvertVideoPixels_NEON(yRow, uRow, vRow, x, shiftX, swapRB ? &px.val[0] : &px.val[2], &px.val[1], swapRB ? &px.val[2] : &px.val[0]);
+        px.val[3] = vdup_n_u8(0xFF);
+        vst4_u8((uint8 *)&pixels[x], px);
+    }
+#endif
+
+    for (; x < width; ++x) {
+        uint8 r, g, b;
+        ConvertVideoPixel(yRow[x], uRow[x >> shiftX], vRow[x >> shiftX], &r, &g, &b);
+        if (swapRB)
+            pixels[x] = 0xFF000000 | (b << 16) | (g << 8) | r;
+        else
+            pixels[x] = 0xFF000000 | (r << 16) | (g << 8) | b;
+    }
+}
+
+void ConvertVideoRow_RGB565(uint16 *pixels, uint8 *yRow, uint8 *uRow, uint8 *vRow, int32 width, int32 shiftX)
+{
+    int32 x = 0;
+
+#if RETRO_USE_SSE2
+    const __m128i zero = _mm_setzero_si128();
+    for (; x + 8 <= width; x += 8) {
+        __m128i r, g, b;
+        ConvertVideoPixels_SSE2(yRow, uRow, vRow, x, shiftX, &r, &g, &b);
+
+        r = _mm_slli_epi16(_mm_and_si128(_mm_unpacklo_epi8(r, zero), _mm_set1_epi16(0xF8)), 8);
+        g = _mm_slli_epi16(_mm_and_si128(_mm_unpacklo_epi8(g, zero), _mm_set1_epi16(0xFC)), 3);
+        b = _mm_srli_epi16(_mm_unpacklo_epi8(b, zero), 3);
+        _mm_storeu_si128((__m128i *)&pixels[x], _mm_or_si128(_mm_or_si128(r, g), b));
+    }
+#elif RETRO_USE_NEON
+    for (; x + 8 <= width; x += 8) {
+        uint8x8_t r, g, b;
+        ConvertVideoPixels_NEON(yRow, uRow, vRow, x, shiftX, &r, &g, &b);
+
+        uint16x8_t color = vshll_n_u8(r, 8);
+        color            = vsriq_n_u16(color, vshll_n_u8(g, 8), 5);
+        color            = vsriq_n_u16(color, vshll_n_u8(b, 8), 11);
+        vst1q_u16(&pixels[x], color);
+    }
+#endif
+
+    for (; x < width; ++x) {
+        uint8 r, g, b;
+        ConvertVideoPixel(yRow[x], uRow[x >> shiftX], vRow[x >> shiftX], &r, &g, &b);
+        pixels[x] = ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3);
+    }
+}
+
+void RSDK::ConvertVideoFrame_XRGB8888(uint32 *pixels, int32 pitch, int32 width, int32 height, uint8 *yPlane, uint8 *uPlane, uint8 *vPlane,
+                                      int32 strideY, int32 strideU, int32 strideV, th_pixel_fmt format, bool32 swapRB)
+{
+    int32 shiftX = format == TH_PF_444 ? 0 : 1;
+    int32 shiftY = format == TH_PF_420 ? 1 : 0;
+
+    for (int32 y = 0; y < height; ++y) {
+        int32 chromaY = y >> shiftY;
+        ConvertVideoRow_XRGB8888(pixels, yPlane, &uPlane[chromaY * strideU], &vPlane[chromaY * strideV], width, shiftX, swapRB);
+
+        pixels += pitch;
+        yPlane += strideY;
+    }
+}
+
+void RSDK::ConvertVideoFrame_RGB565(uint16 *pixels, int32 pitch, int32 dstWidth, int32 dstHeight, int32 width, int32 height, uint8 *yPlane,
+                                    uint8 *uPlane, uint8 *vPlane, int32 strideY, int32 strideU, int32 strideV, th_pixel_fmt format)
+{
+    if (dstWidth <= 0 || dstHeight <= 0 || width <= 0 || height <= 0)
+        return;
+
+    if (width > VIDEO_ROW_MAX)
+        width = VIDEO_ROW_MAX;
+
+    int32 shiftX = format == TH_PF_444 ? 0 : 1;
+    int32 shiftY = format == TH_PF_420 ? 1 : 0;
+
+    // nearest neighbour, same as the texture path does when it gets stretched over the screen
+    int32 stepX   = (width << 16) / dstWidth;
+    int32 stepY   = (height << 16) / dstHeight;
+    int32 srcY    = 0;
+    int32 lastRow = -1;
+
+    for (int32 y = 0; y < dstHeight; ++y) {
+        int32 row     = srcY >> 16;
+        int32 chromaY = row >> shiftY;
+        uint8 *yRow   = &yPlane[row * strideY];
+        uint8 *uRow   = &uPlane[chromaY * strideU];
+        uint8 *vRow   = &vPlane[chromaY * strideV];
+
+        if (dstWidth == width) {
+            ConvertVideoRow_RGB565(pixels, yRow, uRow, vRow, width, shiftX);
+        }
+        else {
+            if (row != lastRow)
+                ConvertVideoRow_RGB565(videoRowBuffer, yRow, uRow, vRow, width, shiftX);
+
+            int32 srcX = 0;
+            for (int32 x = 0; x < dstWidth; ++x) {
+                pixels[x] = videoRowBuffer[srcX >> 16];
+                srcX += stepX;
+            }
+        }
+
+        lastRow = row;
+        pixels += pitch;
+        srcY += stepY;
+    }
+}
+#endif
+
+void UploadVideoFrame(th_ycbcr_buffer yuv)
+{
+    int32 dataPos = (VideoManager::ti.pic_x & 0xFFFFFFFE) + (VideoManager::ti.pic_y & 0xFFFFFFFE) * yuv[0].stride;
+
+    uint8 *yPlane = &yuv[0].data[dataPos];
+    uint8 *uPlane = NULL;
+    uint8 *vPlane = NULL;
+    switch (VideoManager::pixelFormat) {
+        default: return;
+
+        case TH_PF_444:
+            uPlane = &yuv[1].data[dataPos];
+            vPlane = &yuv[2].data[dataPos];
+            break;
+
+        case TH_PF_422:
+            uPlane = &yuv[1].data[yuv[1].stride * VideoManager::ti.pic_y + (VideoManager::ti.pic_x >> 1)];
+            vPlane = &yuv[2].data[yuv[1].stride * VideoManager::ti.pic_y + (VideoManager::ti.pic_x >> 1)];
+            break;
+
+        case TH_PF_420:
+            uPlane = &yuv[1].data[yuv[1].stride * (VideoManager::ti.pic_y >> 1) + (VideoManager::ti.pic_x >> 1)];
+            vPlane = &yuv[2].data[yuv[1].stride * (VideoManager::ti.pic_y >> 1) + (VideoManager::ti.pic_x >> 1)];
+            break;
+    }
+
+#if RETRO_USE_SOFTWARE_VIDEO
+    if (VideoManager::softwareOutput) {
+        ScreenInfo *screen = &screens[0];
+        ConvertVideoFrame_RGB565(screen->frameBuffer, screen->pitch, screen->size.x, screen->size.y, VideoManager::ti.pic_width,
+                                 VideoManager::ti.pic_height, yPlane, uPlane, vPlane, yuv[0].stride, yuv[1].stride, yuv[2].stride,
+                                 VideoManager::pixelFormat);
+        return;
+    }
+#endif
+
+    switch (VideoManager::pixelFormat) {
+        default: break;
+
+        case TH_PF_444:
+            RenderDevice::SetupVideoTexture_YUV444(yuv[0].width, yuv[0].height, yPlane, uPlane, vPlane, yuv[0].stride, yuv[1].stride, yuv[2].stride);
+            break;
+
+        case TH_PF_422:
+            RenderDevice::SetupVideoTexture_YUV422(yuv[0].width, yuv[0].height, yPlane, uPlane, vPlane, yuv[0].stride, yuv[1].stride, yuv[2].stride);
+            break;
+
+        case TH_PF_420:
+            RenderDevice::SetupVideoTexture_YUV420(yuv[0].width, yuv[0].height, yPlane, uPlane, vPlane, yuv[0].stride, yuv[1].stride, yuv[2].stride);
+            break;
+    }
+}
+
+#if RETRO_USE_THREADED_VIDEO
+// reads & decodes the next packet into frame, returns false once the end of the file is reached
+bool32 DecodeVideoFrame(VideoFrame *frame)
+{
+    while (ogg_stream_packetout(&VideoManager::to, &VideoManager::op) <= 0) {
+        char *buffer = ogg_sync_buffer(&VideoManager::oy, 0x1000);
+        if (!ReadBytes(&VideoManager::file, buffer, 0x1000))
+            return false;
+
+        ogg_sync_wrote(&VideoManager::oy, 0x1000);
+
+        while (ogg_sync_pageout(&VideoManager::oy, &VideoManager::og) > 0) ogg_stream_pagein(&VideoManager::to, &VideoManager::og);
+    }
+
+    frame->hasImage = !th_decode_packetin(VideoManager::td, &VideoManager::op, &VideoManager::granulePos);
+    frame->time     = th_granule_time(VideoManager::td, VideoManager::granulePos);
+
+    if (frame->hasImage) {
+        th_ycbcr_buffer yuv;
+        th_decode_ycbcr_out(VideoManager::td, yuv);
+
+        for (int32 p = 0; p < 3; ++p) {
+            // theora hands out its own buffers (possibly flipped with a negative stride), so copy the planes into ones we own
+            // the upload reads a full frame starting from the picture offset, so leave room for that past the last row too
+            int32 width = yuv[p].width;
+            int32 size  = width * (yuv[p].height + VideoManager::ti.pic_y + 1);
+            if (frame->planeSize[p] < size) {
+                free(frame->yuv[p].data);
+                frame->yuv[p].data  = (unsigned char *)calloc(size, sizeof(unsigned char));
+                frame->planeSize[p] = frame->yuv[p].data ? size : 0;
+            }
+
+            if (!frame->yuv[p].data) {
+                frame->hasImage = false;
+                break;
+            }
+
+            frame->yuv[p].width  = yuv[p].width;
+            frame->yuv[p].height = yuv[p].height;
+            frame->yuv[p].stride = width;
+            for (int32 y = 0; y < yuv[p].height; ++y) memcpy(&frame->yuv[p].data[y * width], &yuv[p].data[y * yuv[p].stride], width);
+        }
+    }
+
+    return true;
+}
+
+void VideoDecoderThread()
+{
+    std::unique_lock<std::mutex> lock(videoFrameMutex);
+
+    while (!videoDecoderQuit) {
+        if (videoFrameCount >= VIDEO_FRAME_COUNT) {
+            videoFrameSignal.wait(lock);
+            continue;
+        }
+
+        // the main thread never touches frames that haven't been queued yet, so this can be filled without holding the lock
+        VideoFrame *frame = &videoFrames[(videoFrameRead + videoFrameCount) % VIDEO_FRAME_COUNT];
+
+        lock.unlock();
+        bool32 decoded = DecodeVideoFrame(frame);
+        lock.lock();
+
+        if (!decoded) {
+            videoDecoderFinished = true;
+            videoFrameSignal.notify_all();
+            break;
+        }
+
+        ++videoFrameCount;
+        videoFrameSignal.notify_all();
+    }
+}
+
+void StopVideoDecoder()
+{
+    if (videoDecoderThread.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(videoFrameMutex);
+            videoDecoderQuit = true;
+        }
+
+        videoFrameSignal.notify_all();
+        videoDecoderThread.join();
+    }
+}
+
+void StartVideoDecoder()
+{
+    // LoadVideo should've already stopped the last video's decoder, but assigning over a running thread would terminate
+    StopVideoDecoder();
+
+    videoFrameRead       = 0;
+    videoFrameCount      = 0;
+    videoFrameTime       = 0.0;
+    videoDecoderFinished = false;
+    videoDecoderQuit     = false;
+
+    videoDecoderThread = std::thread(VideoDecoderThread);
+}
+
+void RSDK::ReleaseVideo()
+{
+    StopVideoDecoder();
+
+    for (int32 f = 0; f < VIDEO_FRAME_COUNT; ++f) {
+        for (int32 p = 0; p < 3; ++p) free(videoFrames[f].yuv[p].data);
+        memset(&videoFrames[f], 0, sizeof(VideoFrame));
+    }
+}
+#endif
+
 bool32 RSDK::LoadVideo(const char *filename, double startDelay, bool32 (*skipCallback)())
 {
     if (ENGINE_VERSION == 5 && sceneInfo.state == ENGINESTATE_VIDEOPLAYBACK)
@@ -30,6 +468,11 @@ bool32 RSDK::LoadVideo(const char *filename, double startDelay, bool32 (*skipCal
     char fullFilePath[0x80];
     sprintf_s(fullFilePath, (int32)sizeof(fullFilePath), "Data/Video/%s", filename);
 
+#if RETRO_USE_THREADED_VIDEO
+    // a video that's started again before the last one finished still has a decoder reading from VideoManager, stop it before that's reset
+    StopVideoDecoder();
+#endif
+
     InitFileInfo(&VideoManager::file);
     if (LoadFile(&VideoManager::file, fullFilePath, FMODE_RB)) {
         // Init
@@ -146,8 +589,12 @@ bool32 RSDK::LoadVideo(const char *filename, double startDelay, bool32 (*skipCal
 
                 th_setup_free(VideoManager::ts);
 
-                engine.storedShaderID     = videoSettings.shaderID;
-                videoSettings.screenCount = 0;
+                engine.storedShaderID = videoSettings.shaderID;
+#if RETRO_USE_SOFTWARE_VIDEO
+                // software videos get drawn straight into screens[0], so it needs to stay up
+                if (!VideoManager::softwareOutput)
+#endif
+                    videoSettings.screenCount = 0;
 
                 if (ENGINE_VERSION == 5)
                     engine.storedState = sceneInfo.state;
@@ -164,12 +611,22 @@ bool32 RSDK::LoadVideo(const char *filename, double startDelay, bool32 (*skipCal
                 if (AudioDevice::audioState == 1)
                     engine.videoStartDelay = startDelay;
 
-                switch (VideoManager::pixelFormat) {
-                    default: break;
-                    case TH_PF_420: videoSettings.shaderID = SHADER_YUV_420; break;
-                    case TH_PF_422: videoSettings.shaderID = SHADER_YUV_422; break;
-                    case TH_PF_444: videoSettings.shaderID = SHADER_YUV_444; break;
+#if RETRO_USE_SOFTWARE_VIDEO
+                if (!VideoManager::softwareOutput) {
+#endif
+                    switch (VideoManager::pixelFormat) {
+                        default: break;
+                        case TH_PF_420: videoSettings.shaderID = SHADER_YUV_420; break;
+                        case TH_PF_422: videoSettings.shaderID = SHADER_YUV_422; break;
+                        case TH_PF_444: videoSettings.shaderID = SHADER_YUV_444; break;
+                    }
+#if RETRO_USE_SOFTWARE_VIDEO
                 }
+#endif
+
+#if RETRO_USE_THREADED_VIDEO
+                StartVideoDecoder();
+#endif
 
                 engine.skipCallback = NULL;
                 ProcessVideo();
@@ -205,7 +662,12 @@ void RSDK::ProcessVideo()
         else
             engine.displayTime = streamPos;
 
+#if RETRO_USE_THREADED_VIDEO
+        // td belongs to the decoder thread now, which is usually a few frames ahead anyways
+        curTime = videoFrameTime;
+#else
         curTime = th_granule_time(VideoManager::td, VideoManager::granulePos);
+#endif
 
 #if RETRO_USE_MOD_LOADER
         RunModCallbacks(MODCB_ONVIDEOSKIPCB, (void *)engine.skipCallback);
@@ -216,6 +678,40 @@ void RSDK::ProcessVideo()
     }
 
     if (!finished && (VideoManager::initializing || engine.displayTime >= engine.videoStartDelay + curTime)) {
+#if RETRO_USE_THREADED_VIDEO
+        VideoFrame *frame = NULL;
+        {
+            std::unique_lock<std::mutex> lock(videoFrameMutex);
+
+            // LoadVideo needs the first frame up before it returns
+            if (VideoManager::initializing)
+                videoFrameSignal.wait(lock, [] { return videoFrameCount || videoDecoderFinished; });
+
+            // if we've fallen behind, skip ahead to the frame that's actually due
+            while (!VideoManager::initializing && videoFrameCount > 1 && videoFrames[(videoFrameRead + 1) % VIDEO_FRAME_COUNT].hasImage
+                   && engine.displayTime >= engine.videoStartDelay + videoFrames[videoFrameRead].time) {
+                videoFrameRead = (videoFrameRead + 1) % VIDEO_FRAME_COUNT;
+                --videoFrameCount;
+            }
+
+            if (videoFrameCount)
+                frame = &videoFrames[videoFrameRead];
+            else if (videoDecoderFinished && !VideoManager::initializing)
+                finished = true;
+            // otherwise the decoder is running late, so keep showing the current frame for now
+        }
+
+        if (frame) {
+            if (frame->hasImage)
+                UploadVideoFrame(frame->yuv);
+            videoFrameTime = frame->time;
+
+            std::lock_guard<std::mutex> lock(videoFrameMutex);
+            videoFrameRead = (videoFrameRead + 1) % VIDEO_FRAME_COUNT;
+            --videoFrameCount;
+            videoFrameSignal.notify_all();
+        }
+#else
         while (ogg_stream_packetout(&VideoManager::to, &VideoManager::op) <= 0) {
             char *buffer = ogg_sync_buffer(&VideoManager::oy, 0x1000);
             // if we're playing and reached the end of file
@@ -233,36 +729,18 @@ void RSDK::ProcessVideo()
             th_ycbcr_buffer yuv;
             th_decode_ycbcr_out(VideoManager::td, yuv);
 
-            int32 dataPos = (VideoManager::ti.pic_x & 0xFFFFFFFE) + (VideoManager::ti.pic_y & 0xFFFFFFFE) * yuv[0].stride;
-            switch (VideoManager::pixelFormat) {
-                default: break;
-
-                case TH_PF_444:
-                    RenderDevice::SetupVideoTexture_YUV444(yuv[0].width, yuv[0].height, &yuv[0].data[dataPos], &yuv[1].data[dataPos],
-                                                           &yuv[2].data[dataPos], yuv[0].stride, yuv[1].stride, yuv[2].stride);
-                    break;
-
-                case TH_PF_422:
-                    RenderDevice::SetupVideoTexture_YUV422(yuv[0].width, yuv[0].height, &yuv[0].data[dataPos],
-                                                           &yuv[1].data[yuv[1].stride * VideoManager::ti.pic_y + (VideoManager::ti.pic_x >> 1)],
-                                                           &yuv[2].data[yuv[1].stride * VideoManager::ti.pic_y + (VideoManager::ti.pic_x >> 1)],
-                                                           yuv[0].stride, yuv[1].stride, yuv[2].stride);
-                    break;
-
-                case TH_PF_420:
-                    RenderDevice::SetupVideoTexture_YUV420(
-                        yuv[0].width, yuv[0].height, &yuv[0].data[dataPos],
-                        &yuv[1].data[yuv[1].stride * (VideoManager::ti.pic_y >> 1) + (VideoManager::ti.pic_x >> 1)],
-                        &yuv[2].data[yuv[1].stride * (VideoManager::ti.pic_y >> 1) + (VideoManager::ti.pic_x >> 1)], yuv[0].stride, yuv[1].stride,
-                        yuv[2].stride);
-                    break;
-            }
+            UploadVideoFrame(yuv);
         }
+#endif
 
         VideoManager::initializing = false;
     }
 
     if (finished) {
+#if RETRO_USE_THREADED_VIDEO
+        ReleaseVideo();
+#endif
+
         CloseFile(&VideoManager::file);
 
         // Flush everything out
@@ -4,6 +4,18 @@
 namespace RSDK
 {
 
+#if RETRO_USE_THREADED_VIDEO
+// how many decoded frames the decoder thread is allowed to get ahead by
+#define VIDEO_FRAME_COUNT (4)
+
+struct VideoFrame {
+    th_ycbcr_buffer yuv;
+    int32 planeSize[3];
+    double time;
+    bool32 hasImage; // false for dropped/duplicate frames, which only move the clock along
+};
+#endif
+
 struct VideoManager {
     static FileInfo file;
 
@@ -20,10 +32,28 @@ struct VideoManager {
     static th_pixel_fmt pixelFormat;
     static ogg_int64_t granulePos;
     static bool32 initializing;
+#if RETRO_USE_SOFTWARE_VIDEO
+    static bool32 softwareOutput; // draws frames into screens[0] instead of handing them to the RenderDevice
+#endif
 };
 
 bool32 LoadVideo(const char *filename, double startDelay, bool32 (*skipCallback)());
 void ProcessVideo();
+#if RETRO_USE_THREADED_VIDEO
+void ReleaseVideo();
+#endif
+
+#if RETRO_USE_SOFTWARE_VIDEO
+// the widest row ConvertVideoFrame_RGB565 can scale from
+#define VIDEO_ROW_MAX (0x1000)
+
+// BT.601 YUV -> RGB, pitch is in pixels. XRGB8888 writes 0xFFRRGGBB (or 0xFFBBGGRR if swapRB is set)
+void ConvertVideoFrame_XRGB8888(uint32 *pixels, int32 pitch, int32 width, int32 height, uint8 *yPlane, uint8 *uPlane, uint8 *vPlane, int32 strideY,
+                                int32 strideU, int32 strideV, th_pixel_fmt format, bool32 swapRB);
+// same as above but for the RGB565 screen buffers, scaling the frame to dstWidth x dstHeight
+void ConvertVideoFrame_RGB565(uint16 *pixels, int32 pitch, int32 dstWidth, int32 dstHeight, int32 width, int32 height, uint8 *yPlane, uint8 *uPlane,
+                              uint8 *vPlane, int32 strideY, int32 strideU, int32 strideV, th_pixel_fmt format);
+#endif
 
 } // namespace RSDK
 
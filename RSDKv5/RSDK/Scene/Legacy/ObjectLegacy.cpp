@@ -114,4 +114,155 @@ bool32 RSDK::Legacy::ConvertStringToInteger(const char *text, int32 *value)
         *value = -*value;
 
     return true;
-}
\ No newline at end of file
+}
+
+#if RETRO_USE_SCRIPT_PROFILER
+bool32 RSDK::Legacy::scriptProfilerEnabled        = false;
+uint64 RSDK::Legacy::scriptProfileOpcodeTotal     = 0;
+uint64 RSDK::Legacy::scriptProfileTimeTotal       = 0;
+uint64 RSDK::Legacy::scriptProfileExcludedTime    = 0;
+uint64 RSDK::Legacy::scriptProfileExcludedOpcodes = 0;
+RSDK::Legacy::ScriptEventProfile RSDK::Legacy::scriptEventProfiles[LEGACY_PROFILE_TYPE_COUNT][LEGACY_PROFILE_EVENT_COUNT];
+uint64 RSDK::Legacy::scriptOpcodeProfiles[LEGACY_PROFILE_OPCODE_COUNT];
+RSDK::Legacy::Scene3DProfile RSDK::Legacy::scene3DProfiles[SCENE3D_PROFILE_COUNT];
+
+static_assert(RSDK::Legacy::v3::FUNC_MAX_CNT <= LEGACY_PROFILE_OPCODE_COUNT, "v3 opcodes won't fit in scriptOpcodeProfiles");
+static_assert(RSDK::Legacy::v4::FUNC_MAX_CNT <= LEGACY_PROFILE_OPCODE_COUNT, "v4 opcodes won't fit in scriptOpcodeProfiles");
+
+uint64 RSDK::Legacy::GetScriptProfileTime()
+{
+    return (uint64)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void RSDK::Legacy::ClearScriptProfile()
+{
+    memset(scriptEventProfiles, 0, sizeof(scriptEventProfiles));
+    memset(scriptOpcodeProfiles, 0, sizeof(scriptOpcodeProfiles));
+    memset(scene3DProfiles, 0, sizeof(scene3DProfiles));
+    scriptProfileOpcodeTotal = 0;
+    scriptProfileTimeTotal   = 0;
+}
+
+const char *RSDK::Legacy::GetScriptProfileTypeName(int32 type)
+{
+    if ((uint32)type >= LEGACY_PROFILE_TYPE_COUNT)
+        return "";
+
+    switch (ENGINE_VERSION) {
+        default: return "";
+        case 3: return v3::typeNames[type];
+        case 4: return v4::typeNames[type];
+    }
+}
+
+const char *RSDK::Legacy::GetScriptProfileEventName(int32 event)
+{
+    const char *v3Names[] = { "Main", "PlayerInteraction", "Draw", "Startup" };
+    const char *v4Names[] = { "Main", "Draw", "Startup", "" };
+    if ((uint32)event >= LEGACY_PROFILE_EVENT_COUNT)
+        return "";
+
+    return ENGINE_VERSION == 3 ? v3Names[event] : v4Names[event];
+}
+
+const char *RSDK::Legacy::GetScene3DProfileStageName(int32 stage)
+{
+    const char *names[] = { "Transform", "Sort", "Draw" };
+    if ((uint32)stage >= SCENE3D_PROFILE_COUNT)
+        return "";
+
+    return names[stage];
+}
+
+namespace RSDK
+{
+namespace Legacy
+{
+// writes one row of the profile, if it doesn't fit in the line buffer it's cut short but still ends the row
+void WriteScriptProfileRow(FileIO *file, const char *format, ...)
+{
+    char line[0x100];
+
+    va_list args;
+    va_start(args, format);
+    int32 length = vsnprintf(line, sizeof(line), format, args);
+    va_end(args);
+
+    if (length < 0)
+        return;
+
+    if (length >= (int32)sizeof(line)) {
+        length           = (int32)sizeof(line) - 1;
+        line[length - 1] = '\n';
+    }
+
+    fWrite(line, 1, length, file);
+}
+} // namespace Legacy
+} // namespace RSDK
+
+bool32 RSDK::Legacy::SaveScriptProfile()
+{
+    char filePath[0x100];
+    int32 pathLength = snprintf(filePath, sizeof(filePath), "%sScriptProfile.csv", SKU::userFileDir);
+    if (pathLength < 0 || pathLength >= (int32)sizeof(filePath)) {
+        PrintLog(PRINT_NORMAL, "WARNING: Failed to write script profile, the path is too long");
+        return false;
+    }
+
+    FileIO *file = fOpen(filePath, "w");
+    if (!file) {
+        PrintLog(PRINT_NORMAL, "WARNING: Failed to write script profile to %s", filePath);
+        return false;
+    }
+
+    WriteScriptProfileRow(file, "Section,ID,Name,Event,Runs,Opcodes,Time (us),Items\n");
+
+    for (int32 t = 0; t < LEGACY_PROFILE_TYPE_COUNT; ++t) {
+        for (int32 e = 0; e < LEGACY_PROFILE_EVENT_COUNT; ++e) {
+            ScriptEventProfile *profile = &scriptEventProfiles[t][e];
+            if (!profile->runCount)
+                continue;
+
+            WriteScriptProfileRow(file, "Event,%d,\"%s\",%s,%u,%llu,%llu\n", t, GetScriptProfileTypeName(t), GetScriptProfileEventName(e), profile->runCount,
+                                  (unsigned long long)profile->opcodeCount, (unsigned long long)(profile->time / 1000));
+        }
+    }
+
+    int32 opcodeCount = ENGINE_VERSION == 3 ? (int32)v3::FUNC_MAX_CNT : (int32)v4::FUNC_MAX_CNT;
+    for (int32 o = 0; o < opcodeCount; ++o) {
+        if (!scriptOpcodeProfiles[o])
+            continue;
+
+        const char *name = ENGINE_VERSION == 3 ? v3::functions[o].name : v4::functions[o].name;
+        WriteScriptProfileRow(file, "Opcode,%d,%s,,%llu,,\n", o, name, (unsigned long long)scriptOpcodeProfiles[o]);
+    }
+
+    // the scene3D functions, split into the time spent on each stage
+    for (int32 s = 0; s < SCENE3D_PROFILE_COUNT; ++s) {
+        Scene3DProfile *profile = &scene3DProfiles[s];
+        if (!profile->runCount)
+            continue;
+
+        WriteScriptProfileRow(file, "Scene3D,%d,%s,,%u,,%llu,%llu\n", s, GetScene3DProfileStageName(s), profile->runCount,
+                              (unsigned long long)(profile->time / 1000), (unsigned long long)profile->itemCount);
+    }
+
+    fClose(file);
+    PrintLog(PRINT_NORMAL, "Saved script profile to %s", filePath);
+    return true;
+}
+
+void RSDK::Legacy::PrintStageBenchmark(int32 frameCount)
+{
+    if (!scriptProfileOpcodeTotal) {
+        PrintLog(PRINT_NORMAL, "Stage benchmark: no legacy scripts ran in %d frames", frameCount);
+        return;
+    }
+
+    PrintLog(PRINT_NORMAL, "Stage benchmark: %llu opcodes over %d frames in %.2fms (%.3fms a frame), %.2fM opcodes/sec",
+             (unsigned long long)scriptProfileOpcodeTotal, frameCount, scriptProfileTimeTotal / 1000000.0,
+             frameCount ? scriptProfileTimeTotal / 1000000.0 / frameCount : 0.0,
+             scriptProfileTimeTotal ? scriptProfileOpcodeTotal * 1000.0 / scriptProfileTimeTotal : 0.0);
+}
+#endif
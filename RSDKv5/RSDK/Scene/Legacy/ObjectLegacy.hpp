@@ -1,6 +1,28 @@
 
 #define LEGACY_RETRO_USE_COMPILER (1)
 
+#if RETRO_USE_COMPUTED_GOTO
+// every opcode case in ProcessScript also gets a label, so it can be jumped to through the opcodeHandlers table
+#define LEGACY_SCRIPT_CASE(opcode)                                                                                                                   \
+    case opcode:                                                                                                                                     \
+        opcode##_HANDLER
+#define LEGACY_SCRIPT_DEFAULT                                                                                                                        \
+    default:                                                                                                                                         \
+        DEFAULT_HANDLER
+#define LEGACY_SCRIPT_INLINE inline
+#else
+#define LEGACY_SCRIPT_CASE(opcode) case opcode
+#define LEGACY_SCRIPT_DEFAULT      default
+// the switch only reads & writes operands in one place, so they're forced inline to keep it as tight as it was before they were split out
+#if defined(_MSC_VER)
+#define LEGACY_SCRIPT_INLINE __forceinline
+#elif defined(__GNUC__) || defined(__clang__)
+#define LEGACY_SCRIPT_INLINE inline __attribute__((always_inline))
+#else
+#define LEGACY_SCRIPT_INLINE inline
+#endif
+#endif
+
 #include "v3/ObjectLegacyv3.hpp"
 #include "v3/PlayerLegacyv3.hpp"
 #include "v3/ScriptLegacyv3.hpp"
@@ -24,4 +46,129 @@ extern char scriptErrorMessage[0x400];
 
 bool32 ConvertStringToInteger(const char *text, int32 *value);
 
+#if RETRO_USE_SCRIPT_PROFILER
+#define LEGACY_PROFILE_TYPE_COUNT   (0x100)
+#define LEGACY_PROFILE_EVENT_COUNT  (4) // v3 has a player interaction sub on top of main, draw & startup
+#define LEGACY_PROFILE_OPCODE_COUNT (0x200)
+
+struct ScriptEventProfile {
+    uint64 time;        // in nanoseconds, not counting any other event run from this one or the 3D scene (that's in scene3DProfiles)
+    uint64 opcodeCount; // includes any functions called from the event, but not any other event run from it
+    uint32 runCount;
+};
+
+enum Scene3DProfileStages { SCENE3D_PROFILE_TRANSFORM, SCENE3D_PROFILE_SORT, SCENE3D_PROFILE_DRAW, SCENE3D_PROFILE_COUNT };
+
+struct Scene3DProfile {
+    uint64 time;      // in nanoseconds
+    uint64 itemCount; // vertices transformed, or faces sorted/drawn
+    uint32 runCount;
+};
+
+extern bool32 scriptProfilerEnabled;
+extern uint64 scriptProfileOpcodeTotal;
+extern uint64 scriptProfileTimeTotal; // in nanoseconds, the sum of every event's own time
+// running totals of what the script scopes leave out of their own counts: other events run from inside them & the 3D scene stages
+extern uint64 scriptProfileExcludedTime;
+extern uint64 scriptProfileExcludedOpcodes;
+extern ScriptEventProfile scriptEventProfiles[LEGACY_PROFILE_TYPE_COUNT][LEGACY_PROFILE_EVENT_COUNT];
+extern uint64 scriptOpcodeProfiles[LEGACY_PROFILE_OPCODE_COUNT];
+extern Scene3DProfile scene3DProfiles[SCENE3D_PROFILE_COUNT];
+
+uint64 GetScriptProfileTime();
+
+// profiles a single ProcessScript call, from when it's created until it goes out of scope
+// anything run from another ProcessScript call inside it is left out, so each event only gets what it ran itself
+struct ScriptProfileScope {
+    ScriptProfileScope(int32 type, int32 event)
+    {
+        profile = NULL;
+        counted = scriptProfilerEnabled;
+        if (counted) {
+            startOpcode          = scriptProfileOpcodeTotal;
+            startExcludedOpcodes = scriptProfileExcludedOpcodes;
+            startExcludedTime    = scriptProfileExcludedTime;
+            startTime            = GetScriptProfileTime();
+
+            if ((uint32)type < LEGACY_PROFILE_TYPE_COUNT && (uint32)event < LEGACY_PROFILE_EVENT_COUNT)
+                profile = &scriptEventProfiles[type][event];
+        }
+    }
+
+    ~ScriptProfileScope()
+    {
+        if (counted) {
+            uint64 time    = GetScriptProfileTime() - startTime - (scriptProfileExcludedTime - startExcludedTime);
+            uint64 opcodes = scriptProfileOpcodeTotal - startOpcode - (scriptProfileExcludedOpcodes - startExcludedOpcodes);
+
+            // so whichever call this was run from leaves it out too
+            scriptProfileExcludedTime += time;
+            scriptProfileExcludedOpcodes += opcodes;
+            scriptProfileTimeTotal += time;
+
+            if (profile) {
+                profile->time += time;
+                profile->opcodeCount += opcodes;
+                profile->runCount++;
+            }
+        }
+    }
+
+    ScriptEventProfile *profile;
+    bool32 counted;
+    uint64 startOpcode;
+    uint64 startExcludedOpcodes;
+    uint64 startExcludedTime;
+    uint64 startTime;
+};
+
+// profiles one stage of the 3D scene (transforming, sorting or drawing), from when it's created until it goes out of scope
+// the time's left out of the script event that ran it, so it isn't counted twice
+struct Scene3DProfileScope {
+    Scene3DProfileScope(int32 stage, int32 itemCount)
+    {
+        profile = NULL;
+        if (scriptProfilerEnabled) {
+            profile   = &scene3DProfiles[stage];
+            items     = itemCount > 0 ? itemCount : 0;
+            startTime = GetScriptProfileTime();
+        }
+    }
+
+    ~Scene3DProfileScope()
+    {
+        if (profile) {
+            uint64 time = GetScriptProfileTime() - startTime;
+            scriptProfileExcludedTime += time;
+
+            profile->time += time;
+            profile->itemCount += items;
+            profile->runCount++;
+        }
+    }
+
+    Scene3DProfile *profile;
+    uint64 items;
+    uint64 startTime;
+};
+
+inline void ProfileScriptOpcode(int32 opcode)
+{
+    if (scriptProfilerEnabled && (uint32)opcode < LEGACY_PROFILE_OPCODE_COUNT) {
+        scriptOpcodeProfiles[opcode]++;
+        scriptProfileOpcodeTotal++;
+    }
+}
+
+void ClearScriptProfile();
+// writes ScriptProfile.csv to the user file dir
+bool32 SaveScriptProfile();
+// logs how many opcodes a second the scripts ran at since the profile was last cleared, for "stagebench=true"
+void PrintStageBenchmark(int32 frameCount);
+
+const char *GetScriptProfileTypeName(int32 type);
+const char *GetScriptProfileEventName(int32 event);
+const char *GetScene3DProfileStageName(int32 stage);
+#endif
+
 } // namespace Legacy
\ No newline at end of file
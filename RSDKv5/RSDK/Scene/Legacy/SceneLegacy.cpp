@@ -63,11 +63,20 @@ RSDK::Legacy::LineScroll RSDK::Legacy::hParallax;
 RSDK::Legacy::LineScroll RSDK::Legacy::vParallax;
 
 uint16 RSDK::Legacy::tile3DFloorBuffer[0x100 * 0x100];
+#if RETRO_USE_FAST_3D_FLOOR
+uint8 RSDK::Legacy::floor3DTiles[4 * LEGACY_TILESET_SIZE];
+int32 RSDK::Legacy::floor3DTileOffsets[0x100 * 0x100];
+bool32 RSDK::Legacy::floor3DTileOffsetsDirty = true;
+#endif
 
 RSDK::Legacy::Tiles128x128 RSDK::Legacy::tiles128x128;
 RSDK::Legacy::CollisionMasks RSDK::Legacy::collisionMasks[2];
 
 uint8 RSDK::Legacy::tilesetGFXData[LEGACY_TILESET_SIZE];
+#if RETRO_USE_FAST_SCROLL_LAYERS
+uint16 RSDK::Legacy::tilesetRowMasks[LEGACY_TILE_COUNT * LEGACY_TILE_SIZE];
+uint16 RSDK::Legacy::tilesetColumnMasks[LEGACY_TILE_COUNT * LEGACY_TILE_SIZE];
+#endif
 
 void RSDK::Legacy::GetStageFilepath(char *dest, const char *filePath)
 {
@@ -123,6 +132,10 @@ void RSDK::Legacy::LoadStageChunks()
             tiles128x128.collisionFlags[1][i] = entry[2] - ((entry[2] >> 4) << 4);
         }
         CloseFile(&info);
+
+#if RETRO_USE_FAST_3D_FLOOR
+        floor3DTileOffsetsDirty = true;
+#endif
     }
 }
 
@@ -320,7 +333,80 @@ void RSDK::Legacy::LoadStageGIFFile()
 
         tileset.Close();
     }
+
+#if RETRO_USE_FAST_SCROLL_LAYERS
+    UpdateTilesetMasks(0, LEGACY_TILE_COUNT);
+#endif
+#if RETRO_USE_FAST_3D_FLOOR
+    UpdateFloor3DTiles(0, LEGACY_TILE_COUNT);
+#endif
+}
+
+#if RETRO_USE_FAST_SCROLL_LAYERS
+void RSDK::Legacy::UpdateTilesetMasks(int32 tile, int32 count)
+{
+    for (int32 t = MAX(tile, 0); t < tile + count && t < LEGACY_TILE_COUNT; ++t) {
+        uint8 *pixels      = &tilesetGFXData[t * LEGACY_TILE_DATASIZE];
+        uint16 *rowMask    = &tilesetRowMasks[t * LEGACY_TILE_SIZE];
+        uint16 *columnMask = &tilesetColumnMasks[t * LEGACY_TILE_SIZE];
+
+        memset(rowMask, 0, LEGACY_TILE_SIZE * sizeof(uint16));
+        memset(columnMask, 0, LEGACY_TILE_SIZE * sizeof(uint16));
+        for (int32 y = 0; y < LEGACY_TILE_SIZE; ++y) {
+            for (int32 x = 0; x < LEGACY_TILE_SIZE; ++x) {
+                if (*pixels++ > 0) {
+                    rowMask[y] |= 1 << x;
+                    columnMask[x] |= 1 << y;
+                }
+            }
+        }
+    }
+}
+#endif
+
+#if RETRO_USE_FAST_3D_FLOOR
+void RSDK::Legacy::UpdateFloor3DTiles(int32 tile, int32 count)
+{
+    for (int32 t = MAX(tile, 0); t < tile + count && t < LEGACY_TILE_COUNT; ++t) {
+        uint8 *pixels = &tilesetGFXData[t * LEGACY_TILE_DATASIZE];
+        uint8 *tiles  = &floor3DTiles[t * LEGACY_TILE_DATASIZE];
+
+        for (int32 y = 0; y < LEGACY_TILE_SIZE; ++y) {
+            for (int32 x = 0; x < LEGACY_TILE_SIZE; ++x) {
+                int32 flipX = LEGACY_TILE_SIZE - 1 - x;
+                int32 flipY = LEGACY_TILE_SIZE - 1 - y;
+
+                tiles[FLIP_NONE * LEGACY_TILESET_SIZE + x + y * LEGACY_TILE_SIZE]       = *pixels;
+                tiles[FLIP_X * LEGACY_TILESET_SIZE + flipX + y * LEGACY_TILE_SIZE]      = *pixels;
+                tiles[FLIP_Y * LEGACY_TILESET_SIZE + x + flipY * LEGACY_TILE_SIZE]      = *pixels;
+                tiles[FLIP_XY * LEGACY_TILESET_SIZE + flipX + flipY * LEGACY_TILE_SIZE] = *pixels;
+                ++pixels;
+            }
+        }
+    }
+}
+
+void RSDK::Legacy::UpdateFloor3DTileOffsets()
+{
+    for (int32 i = 0; i < 0x100 * 0x100; ++i) {
+        int32 chunk = tile3DFloorBuffer[i];
+        if (chunk >= LEGACY_CHUNKTILE_COUNT) {
+            floor3DTileOffsets[i] = -1;
+            continue;
+        }
+
+        // tiles with a bad direction or a gfxDataPos outside the tileset (both only possible from scripts) are left to the original lookup
+        int32 gfxDataPos = tiles128x128.gfxDataPos[chunk];
+        uint8 direction  = tiles128x128.direction[chunk];
+        if (direction > FLIP_XY || gfxDataPos < 0 || gfxDataPos >= LEGACY_TILESET_SIZE || (gfxDataPos % LEGACY_TILE_DATASIZE))
+            floor3DTileOffsets[i] = -1;
+        else
+            floor3DTileOffsets[i] = direction * LEGACY_TILESET_SIZE + gfxDataPos;
+    }
+
+    floor3DTileOffsetsDirty = false;
 }
+#endif
 
 void RSDK::Legacy::ProcessInput()
 {
@@ -198,8 +198,19 @@ extern Tiles128x128 tiles128x128;
 extern CollisionMasks collisionMasks[2];
 
 extern uint16 tile3DFloorBuffer[0x100 * 0x100];
+#if RETRO_USE_FAST_3D_FLOOR
+// every tile flipped each way (FLIP_ type * LEGACY_TILESET_SIZE + gfxDataPos), & where each tile of the 3D floor starts in it (-1 if it can't be cached)
+extern uint8 floor3DTiles[4 * LEGACY_TILESET_SIZE];
+extern int32 floor3DTileOffsets[0x100 * 0x100];
+extern bool32 floor3DTileOffsetsDirty;
+#endif
 
 extern uint8 tilesetGFXData[LEGACY_TILESET_SIZE];
+#if RETRO_USE_FAST_SCROLL_LAYERS
+// a bit for every pixel that isn't transparent, for each row & column of every tile
+extern uint16 tilesetRowMasks[LEGACY_TILE_COUNT * LEGACY_TILE_SIZE];
+extern uint16 tilesetColumnMasks[LEGACY_TILE_COUNT * LEGACY_TILE_SIZE];
+#endif
 
 inline void ResetCurrentStageFolder() { strcpy(currentStageFolder, ""); }
 inline bool CheckCurrentStageFolder()
@@ -220,6 +231,13 @@ int32 LoadActFile(const char *ext, FileInfo *info);
 void LoadStageChunks();
 void LoadStageCollisions();
 void LoadStageGIFFile();
+#if RETRO_USE_FAST_3D_FLOOR
+void UpdateFloor3DTiles(int32 tile, int32 count);
+void UpdateFloor3DTileOffsets();
+#endif
+#if RETRO_USE_FAST_SCROLL_LAYERS
+void UpdateTilesetMasks(int32 tile, int32 count);
+#endif
 
 void ProcessInput();
 void ProcessSceneTimer();
@@ -236,6 +254,10 @@ inline void Init3DFloorBuffer(int32 layerID)
             tile3DFloorBuffer[x + (y << 8)] = c + tx + ((y & 7) << 3);
         }
     }
+
+#if RETRO_USE_FAST_3D_FLOOR
+    floor3DTileOffsetsDirty = true;
+#endif
 }
 
 inline void Copy16x16Tile(uint16 dest, uint16 src)
@@ -245,6 +267,13 @@ inline void Copy16x16Tile(uint16 dest, uint16 src)
 
     int32 cnt = LEGACY_TILE_DATASIZE;
     while (cnt--) *destPtr++ = *srcPtr++;
+
+#if RETRO_USE_FAST_SCROLL_LAYERS
+    UpdateTilesetMasks(dest, 1);
+#endif
+#if RETRO_USE_FAST_3D_FLOOR
+    UpdateFloor3DTiles(dest, 1);
+#endif
 }
 
 void InitCameras();
@@ -2017,691 +2017,1449 @@ void RSDK::Legacy::v3::ClearScriptData()
     SetObjectTypeName((char *)"Blank Object", 0);
 }
 
-void RSDK::Legacy::v3::ProcessScript(int32 scriptCodeStart, int32 jumpTableStart, uint8 scriptSub)
+namespace RSDK
 {
-    bool running        = true;
-    int32 scriptCodePtr = scriptCodeStart;
 
-    jumpTableStackPos = 0;
-    functionStackPos  = 0;
-    while (running) {
-        int32 opcode           = scriptCode[scriptCodePtr++];
-        int32 opcodeSize       = functions[opcode].opcodeSize;
-        int32 scriptCodeOffset = scriptCodePtr;
+namespace Legacy
+{
 
-        // Get Values
-        for (int32 i = 0; i < opcodeSize; ++i) {
-            int32 opcodeType = scriptCode[scriptCodePtr++];
-
-            if (opcodeType == SCRIPTVAR_VAR) {
-                int32 arrayVal = 0;
-                switch (scriptCode[scriptCodePtr++]) {
-                    case VARARR_NONE: arrayVal = objectLoop; break;
-                    case VARARR_ARRAY:
-                        if (scriptCode[scriptCodePtr++] == 1)
-                            arrayVal = scriptEng.arrayPosition[scriptCode[scriptCodePtr++]];
-                        else
-                            arrayVal = scriptCode[scriptCodePtr++];
-                        break;
-                    case VARARR_ENTNOPLUS1:
-                        if (scriptCode[scriptCodePtr++] == 1)
-                            arrayVal = scriptEng.arrayPosition[scriptCode[scriptCodePtr++]] + objectLoop;
-                        else
-                            arrayVal = scriptCode[scriptCodePtr++] + objectLoop;
-                        break;
-                    case VARARR_ENTNOMINUS1:
-                        if (scriptCode[scriptCodePtr++] == 1)
-                            arrayVal = objectLoop - scriptEng.arrayPosition[scriptCode[scriptCodePtr++]];
-                        else
-                            arrayVal = objectLoop - scriptCode[scriptCodePtr++];
-                        break;
-                    default: break;
-                }
+namespace v3
+{
 
-                // Variables
-                switch (scriptCode[scriptCodePtr++]) {
-                    default: break;
-                    case VAR_TEMPVALUE0: scriptEng.operands[i] = scriptEng.tempValue[0]; break;
-                    case VAR_TEMPVALUE1: scriptEng.operands[i] = scriptEng.tempValue[1]; break;
-                    case VAR_TEMPVALUE2: scriptEng.operands[i] = scriptEng.tempValue[2]; break;
-                    case VAR_TEMPVALUE3: scriptEng.operands[i] = scriptEng.tempValue[3]; break;
-                    case VAR_TEMPVALUE4: scriptEng.operands[i] = scriptEng.tempValue[4]; break;
-                    case VAR_TEMPVALUE5: scriptEng.operands[i] = scriptEng.tempValue[5]; break;
-                    case VAR_TEMPVALUE6: scriptEng.operands[i] = scriptEng.tempValue[6]; break;
-                    case VAR_TEMPVALUE7: scriptEng.operands[i] = scriptEng.tempValue[7]; break;
-                    case VAR_CHECKRESULT: scriptEng.operands[i] = scriptEng.checkResult; break;
-                    case VAR_ARRAYPOS0: scriptEng.operands[i] = scriptEng.arrayPosition[0]; break;
-                    case VAR_ARRAYPOS1: scriptEng.operands[i] = scriptEng.arrayPosition[1]; break;
-                    case VAR_GLOBAL: scriptEng.operands[i] = globalVariables[arrayVal].value; break;
-                    case VAR_OBJECTENTITYNO: scriptEng.operands[i] = arrayVal; break;
-                    case VAR_OBJECTTYPE: {
-                        scriptEng.operands[i] = objectEntityList[arrayVal].type;
-                        break;
-                    }
-                    case VAR_OBJECTPROPERTYVALUE: {
-                        scriptEng.operands[i] = objectEntityList[arrayVal].propertyValue;
-                        break;
-                    }
-                    case VAR_OBJECTXPOS: {
-                        scriptEng.operands[i] = objectEntityList[arrayVal].XPos;
-                        break;
-                    }
-                    case VAR_OBJECTYPOS: {
-                        scriptEng.operands[i] = objectEntityList[arrayVal].YPos;
-                        break;
-                    }
-                    case VAR_OBJECTIXPOS: {
-                        scriptEng.operands[i] = objectEntityList[arrayVal].XPos >> 16;
-                        break;
-                    }
-                    case VAR_OBJECTIYPOS: {
-                        scriptEng.operands[i] = objectEntityList[arrayVal].YPos >> 16;
-                        break;
-                    }
-                    case VAR_OBJECTSTATE: {
-                        scriptEng.operands[i] = objectEntityList[arrayVal].state;
-                        break;
-                    }
-                    case VAR_OBJECTROTATION: {
-                        scriptEng.operands[i] = objectEntityList[arrayVal].rotation;
-                        break;
-                    }
-                    case VAR_OBJECTSCALE: {
-                        scriptEng.operands[i] = objectEntityList[arrayVal].scale;
-                        break;
-                    }
-                    case VAR_OBJECTPRIORITY: {
-                        scriptEng.operands[i] = objectEntityList[arrayVal].priority;
-                        break;
-                    }
-                    case VAR_OBJECTDRAWORDER: {
-                        scriptEng.operands[i] = objectEntityList[arrayVal].drawOrder;
-                        break;
-                    }
-                    case VAR_OBJECTDIRECTION: {
-                        scriptEng.operands[i] = objectEntityList[arrayVal].direction;
-                        break;
-                    }
-                    case VAR_OBJECTINKEFFECT: {
-                        scriptEng.operands[i] = objectEntityList[arrayVal].inkEffect;
-                        break;
-                    }
-                    case VAR_OBJECTALPHA: {
-                        scriptEng.operands[i] = objectEntityList[arrayVal].alpha;
-                        break;
-                    }
-                    case VAR_OBJECTFRAME: {
-                        scriptEng.operands[i] = objectEntityList[arrayVal].frame;
-                        break;
-                    }
-                    case VAR_OBJECTANIMATION: {
-                        scriptEng.operands[i] = objectEntityList[arrayVal].animation;
-                        break;
-                    }
-                    case VAR_OBJECTPREVANIMATION: {
-                        scriptEng.operands[i] = objectEntityList[arrayVal].prevAnimation;
-                        break;
-                    }
-                    case VAR_OBJECTANIMATIONSPEED: {
-                        scriptEng.operands[i] = objectEntityList[arrayVal].animationSpeed;
-                        break;
-                    }
-                    case VAR_OBJECTANIMATIONTIMER: {
-                        scriptEng.operands[i] = objectEntityList[arrayVal].animationTimer;
-                        break;
-                    }
-                    case VAR_OBJECTVALUE0: {
-                        scriptEng.operands[i] = objectEntityList[arrayVal].values[0];
-                        break;
-                    }
-                    case VAR_OBJECTVALUE1: {
-                        scriptEng.operands[i] = objectEntityList[arrayVal].values[1];
-                        break;
-                    }
-                    case VAR_OBJECTVALUE2: {
-                        scriptEng.operands[i] = objectEntityList[arrayVal].values[2];
-                        break;
-                    }
-                    case VAR_OBJECTVALUE3: {
-                        scriptEng.operands[i] = objectEntityList[arrayVal].values[3];
-                        break;
-                    }
-                    case VAR_OBJECTVALUE4: {
-                        scriptEng.operands[i] = objectEntityList[arrayVal].values[4];
-                        break;
-                    }
-                    case VAR_OBJECTVALUE5: {
-                        scriptEng.operands[i] = objectEntityList[arrayVal].values[5];
-                        break;
-                    }
-                    case VAR_OBJECTVALUE6: {
-                        scriptEng.operands[i] = objectEntityList[arrayVal].values[6];
-                        break;
-                    }
-                    case VAR_OBJECTVALUE7: {
-                        scriptEng.operands[i] = objectEntityList[arrayVal].values[7];
-                        break;
-                    }
-                    case VAR_OBJECTOUTOFBOUNDS: {
-                        int32 pos = objectEntityList[arrayVal].XPos >> 16;
-                        if (pos <= xScrollOffset - OBJECT_BORDER_X1 || pos >= OBJECT_BORDER_X2 + xScrollOffset) {
-                            scriptEng.operands[i] = 1;
-                        }
-                        else {
-                            int32 pos             = objectEntityList[arrayVal].YPos >> 16;
-                            scriptEng.operands[i] = pos <= yScrollOffset - OBJECT_BORDER_Y1 || pos >= yScrollOffset + OBJECT_BORDER_Y2;
-                        }
-                        break;
-                    }
-                    case VAR_PLAYERSTATE: {
-                        scriptEng.operands[i] = playerList[activePlayer].boundEntity->state;
-                        break;
+// what ProcessScript keeps about the opcode it's running, so its operands can be written back once its handler's done
+struct ScriptOpcodeState {
+    int32 opcodeSize;
+    int32 scriptCodeOffset;
+};
+
+// fetches the opcode at scriptCodePtr & reads its operands into scriptEng.operands
+LEGACY_SCRIPT_INLINE int32 ReadScriptOpcode(ScriptOpcodeState *state, int32 &scriptCodePtr)
+{
+    int32 opcode           = scriptCode[scriptCodePtr++];
+    int32 opcodeSize       = functions[opcode].opcodeSize;
+    int32 scriptCodeOffset = scriptCodePtr;
+
+#if RETRO_USE_SCRIPT_PROFILER
+    ProfileScriptOpcode(opcode);
+#endif
+
+
+    // Get Values
+    for (int32 i = 0; i < opcodeSize; ++i) {
+        int32 opcodeType = scriptCode[scriptCodePtr++];
+
+        if (opcodeType == SCRIPTVAR_VAR) {
+            int32 arrayVal = 0;
+            switch (scriptCode[scriptCodePtr++]) {
+                case VARARR_NONE: arrayVal = objectLoop; break;
+                case VARARR_ARRAY:
+                    if (scriptCode[scriptCodePtr++] == 1)
+                        arrayVal = scriptEng.arrayPosition[scriptCode[scriptCodePtr++]];
+                    else
+                        arrayVal = scriptCode[scriptCodePtr++];
+                    break;
+                case VARARR_ENTNOPLUS1:
+                    if (scriptCode[scriptCodePtr++] == 1)
+                        arrayVal = scriptEng.arrayPosition[scriptCode[scriptCodePtr++]] + objectLoop;
+                    else
+                        arrayVal = scriptCode[scriptCodePtr++] + objectLoop;
+                    break;
+                case VARARR_ENTNOMINUS1:
+                    if (scriptCode[scriptCodePtr++] == 1)
+                        arrayVal = objectLoop - scriptEng.arrayPosition[scriptCode[scriptCodePtr++]];
+                    else
+                        arrayVal = objectLoop - scriptCode[scriptCodePtr++];
+                    break;
+                default: break;
+            }
+
+            // Variables
+            switch (scriptCode[scriptCodePtr++]) {
+                default: break;
+                case VAR_TEMPVALUE0: scriptEng.operands[i] = scriptEng.tempValue[0]; break;
+                case VAR_TEMPVALUE1: scriptEng.operands[i] = scriptEng.tempValue[1]; break;
+                case VAR_TEMPVALUE2: scriptEng.operands[i] = scriptEng.tempValue[2]; break;
+                case VAR_TEMPVALUE3: scriptEng.operands[i] = scriptEng.tempValue[3]; break;
+                case VAR_TEMPVALUE4: scriptEng.operands[i] = scriptEng.tempValue[4]; break;
+                case VAR_TEMPVALUE5: scriptEng.operands[i] = scriptEng.tempValue[5]; break;
+                case VAR_TEMPVALUE6: scriptEng.operands[i] = scriptEng.tempValue[6]; break;
+                case VAR_TEMPVALUE7: scriptEng.operands[i] = scriptEng.tempValue[7]; break;
+                case VAR_CHECKRESULT: scriptEng.operands[i] = scriptEng.checkResult; break;
+                case VAR_ARRAYPOS0: scriptEng.operands[i] = scriptEng.arrayPosition[0]; break;
+                case VAR_ARRAYPOS1: scriptEng.operands[i] = scriptEng.arrayPosition[1]; break;
+                case VAR_GLOBAL: scriptEng.operands[i] = globalVariables[arrayVal].value; break;
+                case VAR_OBJECTENTITYNO: scriptEng.operands[i] = arrayVal; break;
+                case VAR_OBJECTTYPE: {
+                    scriptEng.operands[i] = objectEntityList[arrayVal].type;
+                    break;
+                }
+                case VAR_OBJECTPROPERTYVALUE: {
+                    scriptEng.operands[i] = objectEntityList[arrayVal].propertyValue;
+                    break;
+                }
+                case VAR_OBJECTXPOS: {
+                    scriptEng.operands[i] = objectEntityList[arrayVal].XPos;
+                    break;
+                }
+                case VAR_OBJECTYPOS: {
+                    scriptEng.operands[i] = objectEntityList[arrayVal].YPos;
+                    break;
+                }
+                case VAR_OBJECTIXPOS: {
+                    scriptEng.operands[i] = objectEntityList[arrayVal].XPos >> 16;
+                    break;
+                }
+                case VAR_OBJECTIYPOS: {
+                    scriptEng.operands[i] = objectEntityList[arrayVal].YPos >> 16;
+                    break;
+                }
+                case VAR_OBJECTSTATE: {
+                    scriptEng.operands[i] = objectEntityList[arrayVal].state;
+                    break;
+                }
+                case VAR_OBJECTROTATION: {
+                    scriptEng.operands[i] = objectEntityList[arrayVal].rotation;
+                    break;
+                }
+                case VAR_OBJECTSCALE: {
+                    scriptEng.operands[i] = objectEntityList[arrayVal].scale;
+                    break;
+                }
+                case VAR_OBJECTPRIORITY: {
+                    scriptEng.operands[i] = objectEntityList[arrayVal].priority;
+                    break;
+                }
+                case VAR_OBJECTDRAWORDER: {
+                    scriptEng.operands[i] = objectEntityList[arrayVal].drawOrder;
+                    break;
+                }
+                case VAR_OBJECTDIRECTION: {
+                    scriptEng.operands[i] = objectEntityList[arrayVal].direction;
+                    break;
+                }
+                case VAR_OBJECTINKEFFECT: {
+                    scriptEng.operands[i] = objectEntityList[arrayVal].inkEffect;
+                    break;
+                }
+                case VAR_OBJECTALPHA: {
+                    scriptEng.operands[i] = objectEntityList[arrayVal].alpha;
+                    break;
+                }
+                case VAR_OBJECTFRAME: {
+                    scriptEng.operands[i] = objectEntityList[arrayVal].frame;
+                    break;
+                }
+                case VAR_OBJECTANIMATION: {
+                    scriptEng.operands[i] = objectEntityList[arrayVal].animation;
+                    break;
+                }
+                case VAR_OBJECTPREVANIMATION: {
+                    scriptEng.operands[i] = objectEntityList[arrayVal].prevAnimation;
+                    break;
+                }
+                case VAR_OBJECTANIMATIONSPEED: {
+                    scriptEng.operands[i] = objectEntityList[arrayVal].animationSpeed;
+                    break;
+                }
+                case VAR_OBJECTANIMATIONTIMER: {
+                    scriptEng.operands[i] = objectEntityList[arrayVal].animationTimer;
+                    break;
+                }
+                case VAR_OBJECTVALUE0: {
+                    scriptEng.operands[i] = objectEntityList[arrayVal].values[0];
+                    break;
+                }
+                case VAR_OBJECTVALUE1: {
+                    scriptEng.operands[i] = objectEntityList[arrayVal].values[1];
+                    break;
+                }
+                case VAR_OBJECTVALUE2: {
+                    scriptEng.operands[i] = objectEntityList[arrayVal].values[2];
+                    break;
+                }
+                case VAR_OBJECTVALUE3: {
+                    scriptEng.operands[i] = objectEntityList[arrayVal].values[3];
+                    break;
+                }
+                case VAR_OBJECTVALUE4: {
+                    scriptEng.operands[i] = objectEntityList[arrayVal].values[4];
+                    break;
+                }
+                case VAR_OBJECTVALUE5: {
+                    scriptEng.operands[i] = objectEntityList[arrayVal].values[5];
+                    break;
+                }
+                case VAR_OBJECTVALUE6: {
+                    scriptEng.operands[i] = objectEntityList[arrayVal].values[6];
+                    break;
+                }
+                case VAR_OBJECTVALUE7: {
+                    scriptEng.operands[i] = objectEntityList[arrayVal].values[7];
+                    break;
+                }
+                case VAR_OBJECTOUTOFBOUNDS: {
+                    int32 pos = objectEntityList[arrayVal].XPos >> 16;
+                    if (pos <= xScrollOffset - OBJECT_BORDER_X1 || pos >= OBJECT_BORDER_X2 + xScrollOffset) {
+                        scriptEng.operands[i] = 1;
                     }
-                    case VAR_PLAYERCONTROLMODE: {
-                        scriptEng.operands[i] = playerList[activePlayer].controlMode;
-                        break;
+                    else {
+                        int32 pos             = objectEntityList[arrayVal].YPos >> 16;
+                        scriptEng.operands[i] = pos <= yScrollOffset - OBJECT_BORDER_Y1 || pos >= yScrollOffset + OBJECT_BORDER_Y2;
                     }
-                    case VAR_PLAYERCONTROLLOCK: {
-                        scriptEng.operands[i] = playerList[activePlayer].controlLock;
-                        break;
+                    break;
+                }
+                case VAR_PLAYERSTATE: {
+                    scriptEng.operands[i] = playerList[activePlayer].boundEntity->state;
+                    break;
+                }
+                case VAR_PLAYERCONTROLMODE: {
+                    scriptEng.operands[i] = playerList[activePlayer].controlMode;
+                    break;
+                }
+                case VAR_PLAYERCONTROLLOCK: {
+                    scriptEng.operands[i] = playerList[activePlayer].controlLock;
+                    break;
+                }
+                case VAR_PLAYERCOLLISIONMODE: {
+                    scriptEng.operands[i] = playerList[activePlayer].collisionMode;
+                    break;
+                }
+                case VAR_PLAYERCOLLISIONPLANE: {
+                    scriptEng.operands[i] = playerList[activePlayer].collisionPlane;
+                    break;
+                }
+                case VAR_PLAYERXPOS: {
+                    scriptEng.operands[i] = playerList[activePlayer].XPos;
+                    break;
+                }
+                case VAR_PLAYERYPOS: {
+                    scriptEng.operands[i] = playerList[activePlayer].YPos;
+                    break;
+                }
+                case VAR_PLAYERIXPOS: {
+                    scriptEng.operands[i] = playerList[activePlayer].XPos >> 16;
+                    break;
+                }
+                case VAR_PLAYERIYPOS: {
+                    scriptEng.operands[i] = playerList[activePlayer].YPos >> 16;
+                    break;
+                }
+                case VAR_PLAYERSCREENXPOS: {
+                    scriptEng.operands[i] = playerList[activePlayer].screenXPos;
+                    break;
+                }
+                case VAR_PLAYERSCREENYPOS: {
+                    scriptEng.operands[i] = playerList[activePlayer].screenYPos;
+                    break;
+                }
+                case VAR_PLAYERSPEED: {
+                    scriptEng.operands[i] = playerList[activePlayer].speed;
+                    break;
+                }
+                case VAR_PLAYERXVELOCITY: {
+                    scriptEng.operands[i] = playerList[activePlayer].XVelocity;
+                    break;
+                }
+                case VAR_PLAYERYVELOCITY: {
+                    scriptEng.operands[i] = playerList[activePlayer].YVelocity;
+                    break;
+                }
+                case VAR_PLAYERGRAVITY: {
+                    scriptEng.operands[i] = playerList[activePlayer].gravity;
+                    break;
+                }
+                case VAR_PLAYERANGLE: {
+                    scriptEng.operands[i] = playerList[activePlayer].angle;
+                    break;
+                }
+                case VAR_PLAYERSKIDDING: {
+                    scriptEng.operands[i] = playerList[activePlayer].skidding;
+                    break;
+                }
+                case VAR_PLAYERPUSHING: {
+                    scriptEng.operands[i] = playerList[activePlayer].pushing;
+                    break;
+                }
+                case VAR_PLAYERTRACKSCROLL: {
+                    scriptEng.operands[i] = playerList[activePlayer].trackScroll;
+                    break;
+                }
+                case VAR_PLAYERUP: {
+                    scriptEng.operands[i] = playerList[activePlayer].up;
+                    break;
+                }
+                case VAR_PLAYERDOWN: {
+                    scriptEng.operands[i] = playerList[activePlayer].down;
+                    break;
+                }
+                case VAR_PLAYERLEFT: {
+                    scriptEng.operands[i] = playerList[activePlayer].left;
+                    break;
+                }
+                case VAR_PLAYERRIGHT: {
+                    scriptEng.operands[i] = playerList[activePlayer].right;
+                    break;
+                }
+                case VAR_PLAYERJUMPPRESS: {
+                    scriptEng.operands[i] = playerList[activePlayer].jumpPress;
+                    break;
+                }
+                case VAR_PLAYERJUMPHOLD: {
+                    scriptEng.operands[i] = playerList[activePlayer].jumpHold;
+                    break;
+                }
+                case VAR_PLAYERFOLLOWPLAYER1: {
+                    scriptEng.operands[i] = playerList[activePlayer].followPlayer1;
+                    break;
+                }
+                case VAR_PLAYERLOOKPOS: {
+                    scriptEng.operands[i] = playerList[activePlayer].lookPos;
+                    break;
+                }
+                case VAR_PLAYERWATER: {
+                    scriptEng.operands[i] = playerList[activePlayer].water;
+                    break;
+                }
+                case VAR_PLAYERTOPSPEED: {
+                    scriptEng.operands[i] = playerList[activePlayer].topSpeed;
+                    break;
+                }
+                case VAR_PLAYERACCELERATION: {
+                    scriptEng.operands[i] = playerList[activePlayer].acceleration;
+                    break;
+                }
+                case VAR_PLAYERDECELERATION: {
+                    scriptEng.operands[i] = playerList[activePlayer].deceleration;
+                    break;
+                }
+                case VAR_PLAYERAIRACCELERATION: {
+                    scriptEng.operands[i] = playerList[activePlayer].airAcceleration;
+                    break;
+                }
+                case VAR_PLAYERAIRDECELERATION: {
+                    scriptEng.operands[i] = playerList[activePlayer].airDeceleration;
+                    break;
+                }
+                case VAR_PLAYERGRAVITYSTRENGTH: {
+                    scriptEng.operands[i] = playerList[activePlayer].gravityStrength;
+                    break;
+                }
+                case VAR_PLAYERJUMPSTRENGTH: {
+                    scriptEng.operands[i] = playerList[activePlayer].jumpStrength;
+                    break;
+                }
+                case VAR_PLAYERJUMPCAP: {
+                    scriptEng.operands[i] = playerList[activePlayer].jumpCap;
+                    break;
+                }
+                case VAR_PLAYERROLLINGACCELERATION: {
+                    scriptEng.operands[i] = playerList[activePlayer].rollingAcceleration;
+                    break;
+                }
+                case VAR_PLAYERROLLINGDECELERATION: {
+                    scriptEng.operands[i] = playerList[activePlayer].rollingDeceleration;
+                    break;
+                }
+                case VAR_PLAYERENTITYNO: {
+                    scriptEng.operands[i] = playerList[activePlayer].entityNo;
+                    break;
+                }
+                case VAR_PLAYERCOLLISIONLEFT: {
+                    AnimationFile *animFile = playerList[activePlayer].animationFile;
+                    Player *plr             = &playerList[activePlayer];
+                    if (animFile) {
+                        int32 h = animFrames[animationList[animFile->aniListOffset + plr->boundEntity->animation].frameListOffset
+                                             + plr->boundEntity->frame]
+                                      .hitboxID;
+
+                        scriptEng.operands[i] = hitboxList[animFile->hitboxListOffset + h].left[0];
                     }
-                    case VAR_PLAYERCOLLISIONMODE: {
-                        scriptEng.operands[i] = playerList[activePlayer].collisionMode;
-                        break;
+                    else {
+                        scriptEng.operands[i] = 0;
                     }
-                    case VAR_PLAYERCOLLISIONPLANE: {
-                        scriptEng.operands[i] = playerList[activePlayer].collisionPlane;
-                        break;
+                    break;
+                }
+                case VAR_PLAYERCOLLISIONTOP: {
+                    AnimationFile *animFile = playerList[activePlayer].animationFile;
+                    Player *plr             = &playerList[activePlayer];
+                    if (animFile) {
+                        int32 h = animFrames[animationList[animFile->aniListOffset + plr->boundEntity->animation].frameListOffset
+                                             + plr->boundEntity->frame]
+                                      .hitboxID;
+
+                        scriptEng.operands[i] = hitboxList[animFile->hitboxListOffset + h].top[0];
                     }
-                    case VAR_PLAYERXPOS: {
-                        scriptEng.operands[i] = playerList[activePlayer].XPos;
-                        break;
+                    else {
+                        scriptEng.operands[i] = 0;
                     }
-                    case VAR_PLAYERYPOS: {
-                        scriptEng.operands[i] = playerList[activePlayer].YPos;
-                        break;
+                    break;
+                }
+                case VAR_PLAYERCOLLISIONRIGHT: {
+                    AnimationFile *animFile = playerList[activePlayer].animationFile;
+                    Player *plr             = &playerList[activePlayer];
+                    if (animFile) {
+                        int32 h = animFrames[animationList[animFile->aniListOffset + plr->boundEntity->animation].frameListOffset
+                                             + plr->boundEntity->frame]
+                                      .hitboxID;
+
+                        scriptEng.operands[i] = hitboxList[animFile->hitboxListOffset + h].right[0];
                     }
-                    case VAR_PLAYERIXPOS: {
-                        scriptEng.operands[i] = playerList[activePlayer].XPos >> 16;
-                        break;
+                    else {
+                        scriptEng.operands[i] = 0;
                     }
-                    case VAR_PLAYERIYPOS: {
-                        scriptEng.operands[i] = playerList[activePlayer].YPos >> 16;
-                        break;
+                    break;
+                }
+                case VAR_PLAYERCOLLISIONBOTTOM: {
+                    AnimationFile *animFile = playerList[activePlayer].animationFile;
+                    Player *plr             = &playerList[activePlayer];
+                    if (animFile) {
+                        int32 h = animFrames[animationList[animFile->aniListOffset + plr->boundEntity->animation].frameListOffset
+                                             + plr->boundEntity->frame]
+                                      .hitboxID;
+
+                        scriptEng.operands[i] = hitboxList[animFile->hitboxListOffset + h].bottom[0];
                     }
-                    case VAR_PLAYERSCREENXPOS: {
-                        scriptEng.operands[i] = playerList[activePlayer].screenXPos;
-                        break;
+                    else {
+                        scriptEng.operands[i] = 0;
                     }
-                    case VAR_PLAYERSCREENYPOS: {
-                        scriptEng.operands[i] = playerList[activePlayer].screenYPos;
-                        break;
-                    }
-                    case VAR_PLAYERSPEED: {
-                        scriptEng.operands[i] = playerList[activePlayer].speed;
-                        break;
-                    }
-                    case VAR_PLAYERXVELOCITY: {
-                        scriptEng.operands[i] = playerList[activePlayer].XVelocity;
-                        break;
-                    }
-                    case VAR_PLAYERYVELOCITY: {
-                        scriptEng.operands[i] = playerList[activePlayer].YVelocity;
-                        break;
-                    }
-                    case VAR_PLAYERGRAVITY: {
-                        scriptEng.operands[i] = playerList[activePlayer].gravity;
-                        break;
-                    }
-                    case VAR_PLAYERANGLE: {
-                        scriptEng.operands[i] = playerList[activePlayer].angle;
-                        break;
-                    }
-                    case VAR_PLAYERSKIDDING: {
-                        scriptEng.operands[i] = playerList[activePlayer].skidding;
-                        break;
-                    }
-                    case VAR_PLAYERPUSHING: {
-                        scriptEng.operands[i] = playerList[activePlayer].pushing;
-                        break;
-                    }
-                    case VAR_PLAYERTRACKSCROLL: {
-                        scriptEng.operands[i] = playerList[activePlayer].trackScroll;
-                        break;
-                    }
-                    case VAR_PLAYERUP: {
-                        scriptEng.operands[i] = playerList[activePlayer].up;
-                        break;
-                    }
-                    case VAR_PLAYERDOWN: {
-                        scriptEng.operands[i] = playerList[activePlayer].down;
-                        break;
-                    }
-                    case VAR_PLAYERLEFT: {
-                        scriptEng.operands[i] = playerList[activePlayer].left;
-                        break;
-                    }
-                    case VAR_PLAYERRIGHT: {
-                        scriptEng.operands[i] = playerList[activePlayer].right;
-                        break;
-                    }
-                    case VAR_PLAYERJUMPPRESS: {
-                        scriptEng.operands[i] = playerList[activePlayer].jumpPress;
-                        break;
-                    }
-                    case VAR_PLAYERJUMPHOLD: {
-                        scriptEng.operands[i] = playerList[activePlayer].jumpHold;
-                        break;
-                    }
-                    case VAR_PLAYERFOLLOWPLAYER1: {
-                        scriptEng.operands[i] = playerList[activePlayer].followPlayer1;
-                        break;
-                    }
-                    case VAR_PLAYERLOOKPOS: {
-                        scriptEng.operands[i] = playerList[activePlayer].lookPos;
-                        break;
-                    }
-                    case VAR_PLAYERWATER: {
-                        scriptEng.operands[i] = playerList[activePlayer].water;
-                        break;
-                    }
-                    case VAR_PLAYERTOPSPEED: {
-                        scriptEng.operands[i] = playerList[activePlayer].topSpeed;
-                        break;
-                    }
-                    case VAR_PLAYERACCELERATION: {
-                        scriptEng.operands[i] = playerList[activePlayer].acceleration;
-                        break;
-                    }
-                    case VAR_PLAYERDECELERATION: {
-                        scriptEng.operands[i] = playerList[activePlayer].deceleration;
-                        break;
-                    }
-                    case VAR_PLAYERAIRACCELERATION: {
-                        scriptEng.operands[i] = playerList[activePlayer].airAcceleration;
-                        break;
-                    }
-                    case VAR_PLAYERAIRDECELERATION: {
-                        scriptEng.operands[i] = playerList[activePlayer].airDeceleration;
-                        break;
-                    }
-                    case VAR_PLAYERGRAVITYSTRENGTH: {
-                        scriptEng.operands[i] = playerList[activePlayer].gravityStrength;
-                        break;
-                    }
-                    case VAR_PLAYERJUMPSTRENGTH: {
-                        scriptEng.operands[i] = playerList[activePlayer].jumpStrength;
-                        break;
-                    }
-                    case VAR_PLAYERJUMPCAP: {
-                        scriptEng.operands[i] = playerList[activePlayer].jumpCap;
-                        break;
-                    }
-                    case VAR_PLAYERROLLINGACCELERATION: {
-                        scriptEng.operands[i] = playerList[activePlayer].rollingAcceleration;
-                        break;
-                    }
-                    case VAR_PLAYERROLLINGDECELERATION: {
-                        scriptEng.operands[i] = playerList[activePlayer].rollingDeceleration;
-                        break;
-                    }
-                    case VAR_PLAYERENTITYNO: {
-                        scriptEng.operands[i] = playerList[activePlayer].entityNo;
-                        break;
-                    }
-                    case VAR_PLAYERCOLLISIONLEFT: {
-                        AnimationFile *animFile = playerList[activePlayer].animationFile;
-                        Player *plr             = &playerList[activePlayer];
-                        if (animFile) {
-                            int32 h = animFrames[animationList[animFile->aniListOffset + plr->boundEntity->animation].frameListOffset
-                                                 + plr->boundEntity->frame]
-                                          .hitboxID;
-
-                            scriptEng.operands[i] = hitboxList[animFile->hitboxListOffset + h].left[0];
-                        }
-                        else {
-                            scriptEng.operands[i] = 0;
-                        }
-                        break;
-                    }
-                    case VAR_PLAYERCOLLISIONTOP: {
-                        AnimationFile *animFile = playerList[activePlayer].animationFile;
-                        Player *plr             = &playerList[activePlayer];
-                        if (animFile) {
-                            int32 h = animFrames[animationList[animFile->aniListOffset + plr->boundEntity->animation].frameListOffset
-                                                 + plr->boundEntity->frame]
-                                          .hitboxID;
-
-                            scriptEng.operands[i] = hitboxList[animFile->hitboxListOffset + h].top[0];
-                        }
-                        else {
-                            scriptEng.operands[i] = 0;
-                        }
-                        break;
-                    }
-                    case VAR_PLAYERCOLLISIONRIGHT: {
-                        AnimationFile *animFile = playerList[activePlayer].animationFile;
-                        Player *plr             = &playerList[activePlayer];
-                        if (animFile) {
-                            int32 h = animFrames[animationList[animFile->aniListOffset + plr->boundEntity->animation].frameListOffset
-                                                 + plr->boundEntity->frame]
-                                          .hitboxID;
-
-                            scriptEng.operands[i] = hitboxList[animFile->hitboxListOffset + h].right[0];
-                        }
-                        else {
-                            scriptEng.operands[i] = 0;
-                        }
-                        break;
-                    }
-                    case VAR_PLAYERCOLLISIONBOTTOM: {
-                        AnimationFile *animFile = playerList[activePlayer].animationFile;
-                        Player *plr             = &playerList[activePlayer];
-                        if (animFile) {
-                            int32 h = animFrames[animationList[animFile->aniListOffset + plr->boundEntity->animation].frameListOffset
-                                                 + plr->boundEntity->frame]
-                                          .hitboxID;
-
-                            scriptEng.operands[i] = hitboxList[animFile->hitboxListOffset + h].bottom[0];
-                        }
-                        else {
-                            scriptEng.operands[i] = 0;
-                        }
-                        break;
-                    }
-                    case VAR_PLAYERFLAILING: {
-                        scriptEng.operands[i] = playerList[activePlayer].flailing[arrayVal];
-                        break;
-                    }
-                    case VAR_PLAYERTIMER: {
-                        scriptEng.operands[i] = playerList[activePlayer].timer;
-                        break;
-                    }
-                    case VAR_PLAYERTILECOLLISIONS: {
-                        scriptEng.operands[i] = playerList[activePlayer].tileCollisions;
-                        break;
-                    }
-                    case VAR_PLAYEROBJECTINTERACTION: {
-                        scriptEng.operands[i] = playerList[activePlayer].objectInteractions;
-                        break;
-                    }
-                    case VAR_PLAYERVISIBLE: {
-                        scriptEng.operands[i] = playerList[activePlayer].visible;
-                        break;
-                    }
-                    case VAR_PLAYERROTATION: {
-                        scriptEng.operands[i] = playerList[activePlayer].boundEntity->rotation;
-                        break;
-                    }
-                    case VAR_PLAYERSCALE: {
-                        scriptEng.operands[i] = playerList[activePlayer].boundEntity->scale;
-                        break;
-                    }
-                    case VAR_PLAYERPRIORITY: {
-                        scriptEng.operands[i] = playerList[activePlayer].boundEntity->priority;
-                        break;
-                    }
-                    case VAR_PLAYERDRAWORDER: {
-                        scriptEng.operands[i] = playerList[activePlayer].boundEntity->drawOrder;
-                        break;
-                    }
-                    case VAR_PLAYERDIRECTION: {
-                        scriptEng.operands[i] = playerList[activePlayer].boundEntity->direction;
-                        break;
-                    }
-                    case VAR_PLAYERINKEFFECT: {
-                        scriptEng.operands[i] = playerList[activePlayer].boundEntity->inkEffect;
-                        break;
-                    }
-                    case VAR_PLAYERALPHA: {
-                        scriptEng.operands[i] = playerList[activePlayer].boundEntity->alpha;
-                        break;
-                    }
-                    case VAR_PLAYERFRAME: {
-                        scriptEng.operands[i] = playerList[activePlayer].boundEntity->frame;
-                        break;
-                    }
-                    case VAR_PLAYERANIMATION: {
-                        scriptEng.operands[i] = playerList[activePlayer].boundEntity->animation;
-                        break;
-                    }
-                    case VAR_PLAYERPREVANIMATION: {
-                        scriptEng.operands[i] = playerList[activePlayer].boundEntity->prevAnimation;
-                        break;
-                    }
-                    case VAR_PLAYERANIMATIONSPEED: {
-                        scriptEng.operands[i] = playerList[activePlayer].boundEntity->animationSpeed;
-                        break;
-                    }
-                    case VAR_PLAYERANIMATIONTIMER: {
-                        scriptEng.operands[i] = playerList[activePlayer].boundEntity->animationTimer;
-                        break;
-                    }
-                    case VAR_PLAYERVALUE0: {
-                        scriptEng.operands[i] = playerList[activePlayer].boundEntity->values[0];
-                        break;
-                    }
-                    case VAR_PLAYERVALUE1: {
-                        scriptEng.operands[i] = playerList[activePlayer].boundEntity->values[1];
-                        break;
-                    }
-                    case VAR_PLAYERVALUE2: {
-                        scriptEng.operands[i] = playerList[activePlayer].boundEntity->values[2];
-                        break;
-                    }
-                    case VAR_PLAYERVALUE3: {
-                        scriptEng.operands[i] = playerList[activePlayer].boundEntity->values[3];
-                        break;
-                    }
-                    case VAR_PLAYERVALUE4: {
-                        scriptEng.operands[i] = playerList[activePlayer].boundEntity->values[4];
-                        break;
-                    }
-                    case VAR_PLAYERVALUE5: {
-                        scriptEng.operands[i] = playerList[activePlayer].boundEntity->values[5];
-                        break;
-                    }
-                    case VAR_PLAYERVALUE6: {
-                        scriptEng.operands[i] = playerList[activePlayer].boundEntity->values[6];
-                        break;
-                    }
-                    case VAR_PLAYERVALUE7: {
-                        scriptEng.operands[i] = playerList[activePlayer].boundEntity->values[7];
-                        break;
+                    break;
+                }
+                case VAR_PLAYERFLAILING: {
+                    scriptEng.operands[i] = playerList[activePlayer].flailing[arrayVal];
+                    break;
+                }
+                case VAR_PLAYERTIMER: {
+                    scriptEng.operands[i] = playerList[activePlayer].timer;
+                    break;
+                }
+                case VAR_PLAYERTILECOLLISIONS: {
+                    scriptEng.operands[i] = playerList[activePlayer].tileCollisions;
+                    break;
+                }
+                case VAR_PLAYEROBJECTINTERACTION: {
+                    scriptEng.operands[i] = playerList[activePlayer].objectInteractions;
+                    break;
+                }
+                case VAR_PLAYERVISIBLE: {
+                    scriptEng.operands[i] = playerList[activePlayer].visible;
+                    break;
+                }
+                case VAR_PLAYERROTATION: {
+                    scriptEng.operands[i] = playerList[activePlayer].boundEntity->rotation;
+                    break;
+                }
+                case VAR_PLAYERSCALE: {
+                    scriptEng.operands[i] = playerList[activePlayer].boundEntity->scale;
+                    break;
+                }
+                case VAR_PLAYERPRIORITY: {
+                    scriptEng.operands[i] = playerList[activePlayer].boundEntity->priority;
+                    break;
+                }
+                case VAR_PLAYERDRAWORDER: {
+                    scriptEng.operands[i] = playerList[activePlayer].boundEntity->drawOrder;
+                    break;
+                }
+                case VAR_PLAYERDIRECTION: {
+                    scriptEng.operands[i] = playerList[activePlayer].boundEntity->direction;
+                    break;
+                }
+                case VAR_PLAYERINKEFFECT: {
+                    scriptEng.operands[i] = playerList[activePlayer].boundEntity->inkEffect;
+                    break;
+                }
+                case VAR_PLAYERALPHA: {
+                    scriptEng.operands[i] = playerList[activePlayer].boundEntity->alpha;
+                    break;
+                }
+                case VAR_PLAYERFRAME: {
+                    scriptEng.operands[i] = playerList[activePlayer].boundEntity->frame;
+                    break;
+                }
+                case VAR_PLAYERANIMATION: {
+                    scriptEng.operands[i] = playerList[activePlayer].boundEntity->animation;
+                    break;
+                }
+                case VAR_PLAYERPREVANIMATION: {
+                    scriptEng.operands[i] = playerList[activePlayer].boundEntity->prevAnimation;
+                    break;
+                }
+                case VAR_PLAYERANIMATIONSPEED: {
+                    scriptEng.operands[i] = playerList[activePlayer].boundEntity->animationSpeed;
+                    break;
+                }
+                case VAR_PLAYERANIMATIONTIMER: {
+                    scriptEng.operands[i] = playerList[activePlayer].boundEntity->animationTimer;
+                    break;
+                }
+                case VAR_PLAYERVALUE0: {
+                    scriptEng.operands[i] = playerList[activePlayer].boundEntity->values[0];
+                    break;
+                }
+                case VAR_PLAYERVALUE1: {
+                    scriptEng.operands[i] = playerList[activePlayer].boundEntity->values[1];
+                    break;
+                }
+                case VAR_PLAYERVALUE2: {
+                    scriptEng.operands[i] = playerList[activePlayer].boundEntity->values[2];
+                    break;
+                }
+                case VAR_PLAYERVALUE3: {
+                    scriptEng.operands[i] = playerList[activePlayer].boundEntity->values[3];
+                    break;
+                }
+                case VAR_PLAYERVALUE4: {
+                    scriptEng.operands[i] = playerList[activePlayer].boundEntity->values[4];
+                    break;
+                }
+                case VAR_PLAYERVALUE5: {
+                    scriptEng.operands[i] = playerList[activePlayer].boundEntity->values[5];
+                    break;
+                }
+                case VAR_PLAYERVALUE6: {
+                    scriptEng.operands[i] = playerList[activePlayer].boundEntity->values[6];
+                    break;
+                }
+                case VAR_PLAYERVALUE7: {
+                    scriptEng.operands[i] = playerList[activePlayer].boundEntity->values[7];
+                    break;
+                }
+                case VAR_PLAYERVALUE8: {
+                    scriptEng.operands[i] = playerList[activePlayer].values[0];
+                    break;
+                }
+                case VAR_PLAYERVALUE9: {
+                    scriptEng.operands[i] = playerList[activePlayer].values[1];
+                    break;
+                }
+                case VAR_PLAYERVALUE10: {
+                    scriptEng.operands[i] = playerList[activePlayer].values[2];
+                    break;
+                }
+                case VAR_PLAYERVALUE11: {
+                    scriptEng.operands[i] = playerList[activePlayer].values[3];
+                    break;
+                }
+                case VAR_PLAYERVALUE12: {
+                    scriptEng.operands[i] = playerList[activePlayer].values[4];
+                    break;
+                }
+                case VAR_PLAYERVALUE13: {
+                    scriptEng.operands[i] = playerList[activePlayer].values[5];
+                    break;
+                }
+                case VAR_PLAYERVALUE14: {
+                    scriptEng.operands[i] = playerList[activePlayer].values[6];
+                    break;
+                }
+                case VAR_PLAYERVALUE15: {
+                    scriptEng.operands[i] = playerList[activePlayer].values[7];
+                    break;
+                }
+                case VAR_PLAYEROUTOFBOUNDS: {
+                    int32 pos = playerList[activePlayer].XPos >> 16;
+                    if (pos <= xScrollOffset - OBJECT_BORDER_X1 || pos >= OBJECT_BORDER_X2 + xScrollOffset) {
+                        scriptEng.operands[i] = 1;
                     }
-                    case VAR_PLAYERVALUE8: {
-                        scriptEng.operands[i] = playerList[activePlayer].values[0];
-                        break;
+                    else {
+                        int32 pos             = playerList[activePlayer].YPos >> 16;
+                        scriptEng.operands[i] = pos <= yScrollOffset - OBJECT_BORDER_Y1 || pos >= yScrollOffset + OBJECT_BORDER_Y2;
                     }
-                    case VAR_PLAYERVALUE9: {
-                        scriptEng.operands[i] = playerList[activePlayer].values[1];
+                    break;
+                }
+                case VAR_STAGESTATE: scriptEng.operands[i] = stageMode; break;
+                case VAR_STAGEACTIVELIST: scriptEng.operands[i] = sceneInfo.activeCategory; break;
+                case VAR_STAGELISTPOS:
+                    scriptEng.operands[i] = sceneInfo.listPos - sceneInfo.listCategory[sceneInfo.activeCategory].sceneOffsetStart;
+                    break;
+                case VAR_STAGETIMEENABLED: scriptEng.operands[i] = timeEnabled; break;
+                case VAR_STAGEMILLISECONDS: scriptEng.operands[i] = stageMilliseconds; break;
+                case VAR_STAGESECONDS: scriptEng.operands[i] = stageSeconds; break;
+                case VAR_STAGEMINUTES: scriptEng.operands[i] = stageMinutes; break;
+                case VAR_STAGEACTNO: scriptEng.operands[i] = actID; break;
+                case VAR_STAGEPAUSEENABLED: scriptEng.operands[i] = pauseEnabled; break;
+                case VAR_STAGELISTSIZE: scriptEng.operands[i] = sceneInfo.listCategory[RSDK::sceneInfo.activeCategory].sceneCount; break;
+                case VAR_STAGENEWXBOUNDARY1: scriptEng.operands[i] = newXBoundary1; break;
+                case VAR_STAGENEWXBOUNDARY2: scriptEng.operands[i] = newXBoundary2; break;
+                case VAR_STAGENEWYBOUNDARY1: scriptEng.operands[i] = newYBoundary1; break;
+                case VAR_STAGENEWYBOUNDARY2: scriptEng.operands[i] = newYBoundary2; break;
+                case VAR_STAGEXBOUNDARY1: scriptEng.operands[i] = curXBoundary1; break;
+                case VAR_STAGEXBOUNDARY2: scriptEng.operands[i] = curXBoundary2; break;
+                case VAR_STAGEYBOUNDARY1: scriptEng.operands[i] = curYBoundary1; break;
+                case VAR_STAGEYBOUNDARY2: scriptEng.operands[i] = curYBoundary2; break;
+                case VAR_STAGEDEFORMATIONDATA0: scriptEng.operands[i] = bgDeformationData0[arrayVal]; break;
+                case VAR_STAGEDEFORMATIONDATA1: scriptEng.operands[i] = bgDeformationData1[arrayVal]; break;
+                case VAR_STAGEDEFORMATIONDATA2: scriptEng.operands[i] = bgDeformationData2[arrayVal]; break;
+                case VAR_STAGEDEFORMATIONDATA3: scriptEng.operands[i] = bgDeformationData3[arrayVal]; break;
+                case VAR_STAGEWATERLEVEL: scriptEng.operands[i] = waterLevel; break;
+                case VAR_STAGEACTIVELAYER: scriptEng.operands[i] = activeTileLayers[arrayVal]; break;
+                case VAR_STAGEMIDPOINT: scriptEng.operands[i] = tLayerMidPoint; break;
+                case VAR_STAGEPLAYERLISTPOS: scriptEng.operands[i] = playerListPos; break;
+                case VAR_STAGEACTIVEPLAYER: scriptEng.operands[i] = activePlayer; break;
+                case VAR_SCREENCAMERAENABLED: scriptEng.operands[i] = currentCamera->enabled; break;
+                case VAR_SCREENCAMERATARGET: scriptEng.operands[i] = currentCamera->target; break;
+                case VAR_SCREENCAMERASTYLE: scriptEng.operands[i] = currentCamera->style; break;
+                case VAR_SCREENDRAWLISTSIZE: scriptEng.operands[i] = drawListEntries[arrayVal].listSize; break;
+                case VAR_SCREENCENTERX: scriptEng.operands[i] = SCREEN_CENTERX; break;
+                case VAR_SCREENCENTERY: scriptEng.operands[i] = SCREEN_CENTERY; break;
+                case VAR_SCREENXSIZE: scriptEng.operands[i] = SCREEN_XSIZE; break;
+                case VAR_SCREENYSIZE: scriptEng.operands[i] = SCREEN_YSIZE; break;
+                case VAR_SCREENXOFFSET: scriptEng.operands[i] = xScrollOffset; break;
+                case VAR_SCREENYOFFSET: scriptEng.operands[i] = yScrollOffset; break;
+                case VAR_SCREENSHAKEX: scriptEng.operands[i] = cameraShakeX; break;
+                case VAR_SCREENSHAKEY: scriptEng.operands[i] = cameraShakeY; break;
+                case VAR_SCREENADJUSTCAMERAY: scriptEng.operands[i] = currentCamera->adjustY; break;
+                case VAR_TOUCHSCREENDOWN: scriptEng.operands[i] = touchInfo.down[arrayVal]; break;
+                case VAR_TOUCHSCREENXPOS: scriptEng.operands[i] = (int32)(touchInfo.x[arrayVal] * SCREEN_XSIZE); break;
+                case VAR_TOUCHSCREENYPOS: scriptEng.operands[i] = (int32)(touchInfo.y[arrayVal] * SCREEN_YSIZE); break;
+                case VAR_MUSICVOLUME: scriptEng.operands[i] = musicVolume; break;
+                case VAR_MUSICCURRENTTRACK: scriptEng.operands[i] = musicCurrentTrack; break;
+                case VAR_KEYDOWNUP: scriptEng.operands[i] = controller[arrayVal].keyUp.down; break;
+                case VAR_KEYDOWNDOWN: scriptEng.operands[i] = controller[arrayVal].keyDown.down; break;
+                case VAR_KEYDOWNLEFT: scriptEng.operands[i] = controller[arrayVal].keyLeft.down; break;
+                case VAR_KEYDOWNRIGHT: scriptEng.operands[i] = controller[arrayVal].keyRight.down; break;
+                case VAR_KEYDOWNBUTTONA: scriptEng.operands[i] = controller[arrayVal].keyA.down; break;
+                case VAR_KEYDOWNBUTTONB: scriptEng.operands[i] = controller[arrayVal].keyB.down; break;
+                case VAR_KEYDOWNBUTTONC: scriptEng.operands[i] = controller[arrayVal].keyC.down; break;
+                case VAR_KEYDOWNSTART: scriptEng.operands[i] = controller[arrayVal].keyStart.down; break;
+                case VAR_KEYPRESSUP: scriptEng.operands[i] = controller[arrayVal].keyUp.press; break;
+                case VAR_KEYPRESSDOWN: scriptEng.operands[i] = controller[arrayVal].keyDown.press; break;
+                case VAR_KEYPRESSLEFT: scriptEng.operands[i] = controller[arrayVal].keyLeft.press; break;
+                case VAR_KEYPRESSRIGHT: scriptEng.operands[i] = controller[arrayVal].keyRight.press; break;
+                case VAR_KEYPRESSBUTTONA: scriptEng.operands[i] = controller[arrayVal].keyA.press; break;
+                case VAR_KEYPRESSBUTTONB: scriptEng.operands[i] = controller[arrayVal].keyB.press; break;
+                case VAR_KEYPRESSBUTTONC: scriptEng.operands[i] = controller[arrayVal].keyC.press; break;
+                case VAR_KEYPRESSSTART: scriptEng.operands[i] = controller[arrayVal].keyStart.press; break;
+                case VAR_MENU1SELECTION: scriptEng.operands[i] = gameMenu[0].selection1; break;
+                case VAR_MENU2SELECTION: scriptEng.operands[i] = gameMenu[1].selection1; break;
+                case VAR_TILELAYERXSIZE: scriptEng.operands[i] = stageLayouts[arrayVal].xsize; break;
+                case VAR_TILELAYERYSIZE: scriptEng.operands[i] = stageLayouts[arrayVal].ysize; break;
+                case VAR_TILELAYERTYPE: scriptEng.operands[i] = stageLayouts[arrayVal].type; break;
+                case VAR_TILELAYERANGLE: scriptEng.operands[i] = stageLayouts[arrayVal].angle; break;
+                case VAR_TILELAYERXPOS: scriptEng.operands[i] = stageLayouts[arrayVal].xpos; break;
+                case VAR_TILELAYERYPOS: scriptEng.operands[i] = stageLayouts[arrayVal].ypos; break;
+                case VAR_TILELAYERZPOS: scriptEng.operands[i] = stageLayouts[arrayVal].zpos; break;
+                case VAR_TILELAYERPARALLAXFACTOR: scriptEng.operands[i] = stageLayouts[arrayVal].parallaxFactor; break;
+                case VAR_TILELAYERSCROLLSPEED: scriptEng.operands[i] = stageLayouts[arrayVal].scrollSpeed; break;
+                case VAR_TILELAYERSCROLLPOS: scriptEng.operands[i] = stageLayouts[arrayVal].scrollPos; break;
+                case VAR_TILELAYERDEFORMATIONOFFSET: scriptEng.operands[i] = stageLayouts[arrayVal].deformationOffset; break;
+                case VAR_TILELAYERDEFORMATIONOFFSETW: scriptEng.operands[i] = stageLayouts[arrayVal].deformationOffsetW; break;
+                case VAR_HPARALLAXPARALLAXFACTOR: scriptEng.operands[i] = hParallax.parallaxFactor[arrayVal]; break;
+                case VAR_HPARALLAXSCROLLSPEED: scriptEng.operands[i] = hParallax.scrollSpeed[arrayVal]; break;
+                case VAR_HPARALLAXSCROLLPOS: scriptEng.operands[i] = hParallax.scrollPos[arrayVal]; break;
+                case VAR_VPARALLAXPARALLAXFACTOR: scriptEng.operands[i] = vParallax.parallaxFactor[arrayVal]; break;
+                case VAR_VPARALLAXSCROLLSPEED: scriptEng.operands[i] = vParallax.scrollSpeed[arrayVal]; break;
+                case VAR_VPARALLAXSCROLLPOS: scriptEng.operands[i] = vParallax.scrollPos[arrayVal]; break;
+                case VAR_3DSCENENOVERTICES: scriptEng.operands[i] = vertexCount; break;
+                case VAR_3DSCENENOFACES: scriptEng.operands[i] = faceCount; break;
+                case VAR_VERTEXBUFFERX: scriptEng.operands[i] = vertexBuffer[arrayVal].x; break;
+                case VAR_VERTEXBUFFERY: scriptEng.operands[i] = vertexBuffer[arrayVal].y; break;
+                case VAR_VERTEXBUFFERZ: scriptEng.operands[i] = vertexBuffer[arrayVal].z; break;
+                case VAR_VERTEXBUFFERU: scriptEng.operands[i] = vertexBuffer[arrayVal].u; break;
+                case VAR_VERTEXBUFFERV: scriptEng.operands[i] = vertexBuffer[arrayVal].v; break;
+                case VAR_FACEBUFFERA: scriptEng.operands[i] = faceBuffer[arrayVal].a; break;
+                case VAR_FACEBUFFERB: scriptEng.operands[i] = faceBuffer[arrayVal].b; break;
+                case VAR_FACEBUFFERC: scriptEng.operands[i] = faceBuffer[arrayVal].c; break;
+                case VAR_FACEBUFFERD: scriptEng.operands[i] = faceBuffer[arrayVal].d; break;
+                case VAR_FACEBUFFERFLAG: scriptEng.operands[i] = faceBuffer[arrayVal].flag; break;
+                case VAR_FACEBUFFERCOLOR: scriptEng.operands[i] = faceBuffer[arrayVal].color; break;
+                case VAR_3DSCENEPROJECTIONX: scriptEng.operands[i] = projectionX; break;
+                case VAR_3DSCENEPROJECTIONY: scriptEng.operands[i] = projectionY; break;
+                case VAR_ENGINESTATE: scriptEng.operands[i] = gameMode; break;
+                case VAR_STAGEDEBUGMODE: scriptEng.operands[i] = debugMode; break;
+                case VAR_ENGINEMESSAGE: scriptEng.operands[i] = engineMessage; break;
+                case VAR_SAVERAM: scriptEng.operands[i] = saveRAM[arrayVal]; break;
+                case VAR_ENGINELANGUAGE: scriptEng.operands[i] = language; break;
+                case VAR_OBJECTSPRITESHEET: {
+                    scriptEng.operands[i] = objectScriptList[objectEntityList[arrayVal].type].spriteSheetID;
+                    break;
+                }
+                case VAR_ENGINEONLINEACTIVE: scriptEng.operands[i] = onlineActive; break;
+                case VAR_ENGINEFRAMESKIPTIMER: break;
+                case VAR_ENGINEFRAMESKIPSETTING: break;
+                case VAR_ENGINESFXVOLUME: scriptEng.operands[i] = sfxVolume; break;
+                case VAR_ENGINEBGMVOLUME: scriptEng.operands[i] = bgmVolume; break;
+                case VAR_ENGINEPLATFORMID: scriptEng.operands[i] = gamePlatformID; break;
+                case VAR_ENGINETRIALMODE: scriptEng.operands[i] = trialMode; break;
+                case VAR_KEYPRESSANYSTART: scriptEng.operands[i] = anyPress; break;
+#if LEGACY_RETRO_USE_HAPTICS
+                case VAR_ENGINEHAPTICSENABLED: scriptEng.operands[i] = hapticsEnabled; break;
+#endif
+            }
+        }
+        else if (opcodeType == SCRIPTVAR_INTCONST) { // int32 constant
+            scriptEng.operands[i] = scriptCode[scriptCodePtr++];
+        }
+        else if (opcodeType == SCRIPTVAR_STRCONST) { // string constant
+            int32 strLen       = scriptCode[scriptCodePtr++];
+            scriptText[strLen] = 0;
+            for (int32 c = 0; c < strLen; ++c) {
+                switch (c % 4) {
+                    case 0: {
+                        scriptText[c] = scriptCode[scriptCodePtr] >> 24;
                         break;
                     }
-                    case VAR_PLAYERVALUE10: {
-                        scriptEng.operands[i] = playerList[activePlayer].values[2];
+                    case 1: {
+                        scriptText[c] = (0xFFFFFF & scriptCode[scriptCodePtr]) >> 16;
                         break;
                     }
-                    case VAR_PLAYERVALUE11: {
-                        scriptEng.operands[i] = playerList[activePlayer].values[3];
+                    case 2: {
+                        scriptText[c] = (0xFFFF & scriptCode[scriptCodePtr]) >> 8;
                         break;
                     }
-                    case VAR_PLAYERVALUE12: {
-                        scriptEng.operands[i] = playerList[activePlayer].values[4];
+                    case 3: {
+                        scriptText[c] = scriptCode[scriptCodePtr++];
                         break;
                     }
-                    case VAR_PLAYERVALUE13: {
-                        scriptEng.operands[i] = playerList[activePlayer].values[5];
-                        break;
+                    default: break;
+                }
+            }
+            scriptCodePtr++;
+        }
+    }
+
+    state->opcodeSize       = opcodeSize;
+    state->scriptCodeOffset = scriptCodeOffset;
+    return opcode;
+}
+
+// writes the operands back to wherever they were read from, once the opcode's handler has run
+LEGACY_SCRIPT_INLINE void WriteScriptOperands(ScriptOpcodeState *state, int32 &scriptCodePtr)
+{
+    int32 opcodeSize       = state->opcodeSize;
+    int32 scriptCodeOffset = state->scriptCodeOffset;
+
+
+    // Set Values
+    if (opcodeSize > 0)
+        scriptCodePtr -= scriptCodePtr - scriptCodeOffset;
+    for (int32 i = 0; i < opcodeSize; ++i) {
+        int32 opcodeType = scriptCode[scriptCodePtr++];
+        if (opcodeType == SCRIPTVAR_VAR) {
+            int32 arrayVal = 0;
+            switch (scriptCode[scriptCodePtr++]) { // variable
+                case VARARR_NONE: arrayVal = objectLoop; break;
+                case VARARR_ARRAY:
+                    if (scriptCode[scriptCodePtr++] == 1)
+                        arrayVal = scriptEng.arrayPosition[scriptCode[scriptCodePtr++]];
+                    else
+                        arrayVal = scriptCode[scriptCodePtr++];
+                    break;
+                case VARARR_ENTNOPLUS1:
+                    if (scriptCode[scriptCodePtr++] == 1)
+                        arrayVal = scriptEng.arrayPosition[scriptCode[scriptCodePtr++]] + objectLoop;
+                    else
+                        arrayVal = scriptCode[scriptCodePtr++] + objectLoop;
+                    break;
+                case VARARR_ENTNOMINUS1:
+                    if (scriptCode[scriptCodePtr++] == 1)
+                        arrayVal = objectLoop - scriptEng.arrayPosition[scriptCode[scriptCodePtr++]];
+                    else
+                        arrayVal = objectLoop - scriptCode[scriptCodePtr++];
+                    break;
+                default: break;
+            }
+
+            // Variables
+            switch (scriptCode[scriptCodePtr++]) {
+                default: break;
+                case VAR_TEMPVALUE0: scriptEng.tempValue[0] = scriptEng.operands[i]; break;
+                case VAR_TEMPVALUE1: scriptEng.tempValue[1] = scriptEng.operands[i]; break;
+                case VAR_TEMPVALUE2: scriptEng.tempValue[2] = scriptEng.operands[i]; break;
+                case VAR_TEMPVALUE3: scriptEng.tempValue[3] = scriptEng.operands[i]; break;
+                case VAR_TEMPVALUE4: scriptEng.tempValue[4] = scriptEng.operands[i]; break;
+                case VAR_TEMPVALUE5: scriptEng.tempValue[5] = scriptEng.operands[i]; break;
+                case VAR_TEMPVALUE6: scriptEng.tempValue[6] = scriptEng.operands[i]; break;
+                case VAR_TEMPVALUE7: scriptEng.tempValue[7] = scriptEng.operands[i]; break;
+                case VAR_CHECKRESULT: scriptEng.checkResult = scriptEng.operands[i]; break;
+                case VAR_ARRAYPOS0: scriptEng.arrayPosition[0] = scriptEng.operands[i]; break;
+                case VAR_ARRAYPOS1: scriptEng.arrayPosition[1] = scriptEng.operands[i]; break;
+                case VAR_GLOBAL: globalVariables[arrayVal].value = scriptEng.operands[i]; break;
+                case VAR_OBJECTENTITYNO: break;
+                case VAR_OBJECTTYPE: {
+                    objectEntityList[arrayVal].type = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTPROPERTYVALUE: {
+                    objectEntityList[arrayVal].propertyValue = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTXPOS: {
+                    objectEntityList[arrayVal].XPos = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTYPOS: {
+                    objectEntityList[arrayVal].YPos = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTIXPOS: {
+                    objectEntityList[arrayVal].XPos = scriptEng.operands[i] << 16;
+                    break;
+                }
+                case VAR_OBJECTIYPOS: {
+                    objectEntityList[arrayVal].YPos = scriptEng.operands[i] << 16;
+                    break;
+                }
+                case VAR_OBJECTSTATE: {
+                    objectEntityList[arrayVal].state = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTROTATION: {
+                    objectEntityList[arrayVal].rotation = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTSCALE: {
+                    objectEntityList[arrayVal].scale = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTPRIORITY: {
+                    objectEntityList[arrayVal].priority = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTDRAWORDER: {
+                    objectEntityList[arrayVal].drawOrder = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTDIRECTION: {
+                    objectEntityList[arrayVal].direction = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTINKEFFECT: {
+                    objectEntityList[arrayVal].inkEffect = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTALPHA: {
+                    objectEntityList[arrayVal].alpha = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTFRAME: {
+                    objectEntityList[arrayVal].frame = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTANIMATION: {
+                    objectEntityList[arrayVal].animation = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTPREVANIMATION: {
+                    objectEntityList[arrayVal].prevAnimation = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTANIMATIONSPEED: {
+                    objectEntityList[arrayVal].animationSpeed = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTANIMATIONTIMER: {
+                    objectEntityList[arrayVal].animationTimer = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTVALUE0: {
+                    objectEntityList[arrayVal].values[0] = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTVALUE1: {
+                    objectEntityList[arrayVal].values[1] = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTVALUE2: {
+                    objectEntityList[arrayVal].values[2] = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTVALUE3: {
+                    objectEntityList[arrayVal].values[3] = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTVALUE4: {
+                    objectEntityList[arrayVal].values[4] = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTVALUE5: {
+                    objectEntityList[arrayVal].values[5] = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTVALUE6: {
+                    objectEntityList[arrayVal].values[6] = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTVALUE7: {
+                    objectEntityList[arrayVal].values[7] = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTOUTOFBOUNDS: break;
+                case VAR_PLAYERSTATE: {
+                    playerList[activePlayer].boundEntity->state = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_PLAYERCONTROLMODE: {
+                    playerList[activePlayer].controlMode = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_PLAYERCONTROLLOCK: {
+                    playerList[activePlayer].controlLock = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_PLAYERCOLLISIONMODE: {
+                    playerList[activePlayer].collisionMode = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_PLAYERCOLLISIONPLANE: {
+                    playerList[activePlayer].collisionPlane = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_PLAYERXPOS: {
+                    playerList[activePlayer].XPos = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_PLAYERYPOS: {
+                    playerList[activePlayer].YPos = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_PLAYERIXPOS: {
+                    playerList[activePlayer].XPos = scriptEng.operands[i] << 16;
+                    break;
+                }
+                case VAR_PLAYERIYPOS: {
+                    playerList[activePlayer].YPos = scriptEng.operands[i] << 16;
+                    break;
+                }
+                case VAR_PLAYERSCREENXPOS: {
+                    playerList[activePlayer].screenXPos = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_PLAYERSCREENYPOS: {
+                    playerList[activePlayer].screenYPos = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_PLAYERSPEED: {
+                    playerList[activePlayer].speed = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_PLAYERXVELOCITY: {
+                    playerList[activePlayer].XVelocity = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_PLAYERYVELOCITY: {
+                    playerList[activePlayer].YVelocity = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_PLAYERGRAVITY: {
+                    playerList[activePlayer].gravity = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_PLAYERANGLE: {
+                    playerList[activePlayer].angle = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_PLAYERSKIDDING: {
+                    playerList[activePlayer].skidding = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_PLAYERPUSHING: {
+                    playerList[activePlayer].pushing = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_PLAYERTRACKSCROLL: {
+                    playerList[activePlayer].trackScroll = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_PLAYERUP: {
+                    playerList[activePlayer].up = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_PLAYERDOWN: {
+                    playerList[activePlayer].down = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_PLAYERLEFT: {
+                    playerList[activePlayer].left = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_PLAYERRIGHT: {
+                    playerList[activePlayer].right = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_PLAYERJUMPPRESS: {
+                    playerList[activePlayer].jumpPress = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_PLAYERJUMPHOLD: {
+                    playerList[activePlayer].jumpHold = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_PLAYERFOLLOWPLAYER1: {
+                    playerList[activePlayer].followPlayer1 = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_PLAYERLOOKPOS: {
+                    playerList[activePlayer].lookPos = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_PLAYERWATER: {
+                    playerList[activePlayer].water = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_PLAYERTOPSPEED: {
+                    playerList[activePlayer].topSpeed = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_PLAYERACCELERATION: {
+                    playerList[activePlayer].acceleration = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_PLAYERDECELERATION: {
+                    playerList[activePlayer].deceleration = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_PLAYERAIRACCELERATION: {
+                    playerList[activePlayer].airAcceleration = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_PLAYERAIRDECELERATION: {
+                    playerList[activePlayer].airDeceleration = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_PLAYERGRAVITYSTRENGTH: {
+                    playerList[activePlayer].gravityStrength = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_PLAYERJUMPSTRENGTH: {
+                    playerList[activePlayer].jumpStrength = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_PLAYERJUMPCAP: {
+                    playerList[activePlayer].jumpCap = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_PLAYERROLLINGACCELERATION: {
+                    scriptEng.operands[i] = playerList[activePlayer].rollingAcceleration = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_PLAYERROLLINGDECELERATION: {
+                    scriptEng.operands[i] = playerList[activePlayer].rollingDeceleration = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_PLAYERENTITYNO: break;
+                case VAR_PLAYERCOLLISIONLEFT: break;
+                case VAR_PLAYERCOLLISIONTOP: break;
+                case VAR_PLAYERCOLLISIONRIGHT: break;
+                case VAR_PLAYERCOLLISIONBOTTOM: break;
+                case VAR_PLAYERFLAILING: {
+                    scriptEng.operands[i] = playerList[activePlayer].flailing[arrayVal] = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_PLAYERTIMER: {
+                    playerList[activePlayer].timer = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_PLAYERTILECOLLISIONS: {
+                    playerList[activePlayer].tileCollisions = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_PLAYEROBJECTINTERACTION: {
+                    scriptEng.operands[i] = playerList[activePlayer].objectInteractions = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_PLAYERVISIBLE: {
+                    playerList[activePlayer].visible = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_PLAYERROTATION: {
+                    scriptEng.operands[i] = playerList[activePlayer].boundEntity->rotation = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_PLAYERSCALE: {
+                    playerList[activePlayer].boundEntity->scale = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_PLAYERPRIORITY: {
+                    scriptEng.operands[i] = playerList[activePlayer].boundEntity->priority = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_PLAYERDRAWORDER: {
+                    scriptEng.operands[i] = playerList[activePlayer].boundEntity->drawOrder = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_PLAYERDIRECTION: {
+                    scriptEng.operands[i] = playerList[activePlayer].boundEntity->direction = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_PLAYERINKEFFECT: {
+                    scriptEng.operands[i] = playerList[activePlayer].boundEntity->inkEffect = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_PLAYERALPHA: {
+                    playerList[activePlayer].boundEntity->alpha = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_PLAYERFRAME: {
+                    playerList[activePlayer].boundEntity->frame = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_PLAYERANIMATION: {
+                    scriptEng.operands[i] = playerList[activePlayer].boundEntity->animation = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_PLAYERPREVANIMATION: {
+                    scriptEng.operands[i] = playerList[activePlayer].boundEntity->prevAnimation = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_PLAYERANIMATIONSPEED: {
+                    scriptEng.operands[i] = playerList[activePlayer].boundEntity->animationSpeed = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_PLAYERANIMATIONTIMER: {
+                    scriptEng.operands[i] = playerList[activePlayer].boundEntity->animationTimer = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_PLAYERVALUE0: {
+                    scriptEng.operands[i] = playerList[activePlayer].boundEntity->values[0] = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_PLAYERVALUE1: {
+                    scriptEng.operands[i] = playerList[activePlayer].boundEntity->values[1] = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_PLAYERVALUE2: {
+                    scriptEng.operands[i] = playerList[activePlayer].boundEntity->values[2] = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_PLAYERVALUE3: {
+                    scriptEng.operands[i] = playerList[activePlayer].boundEntity->values[3] = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_PLAYERVALUE4: {
+                    scriptEng.operands[i] = playerList[activePlayer].boundEntity->values[4] = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_PLAYERVALUE5: {
+                    scriptEng.operands[i] = playerList[activePlayer].boundEntity->values[5] = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_PLAYERVALUE6: {
+                    scriptEng.operands[i] = playerList[activePlayer].boundEntity->values[6] = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_PLAYERVALUE7: {
+                    scriptEng.operands[i] = playerList[activePlayer].boundEntity->values[7] = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_PLAYERVALUE8: {
+                    playerList[activePlayer].values[0] = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_PLAYERVALUE9: {
+                    playerList[activePlayer].values[1] = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_PLAYERVALUE10: {
+                    playerList[activePlayer].values[2] = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_PLAYERVALUE11: {
+                    playerList[activePlayer].values[3] = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_PLAYERVALUE12: {
+                    playerList[activePlayer].values[4] = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_PLAYERVALUE13: {
+                    playerList[activePlayer].values[5] = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_PLAYERVALUE14: {
+                    playerList[activePlayer].values[6] = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_PLAYERVALUE15: {
+                    playerList[activePlayer].values[7] = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_PLAYEROUTOFBOUNDS: break;
+                case VAR_STAGESTATE: stageMode = scriptEng.operands[i]; break;
+                case VAR_STAGEACTIVELIST: {
+                    int32 listSlots[] = { 0, 1, 3, 2 };
+
+                    int32 listID = scriptEng.operands[i];
+                    if (listID <= 3)
+                        listID = listSlots[listID];
+                    else
+                        listID = 2; // BONUS_STAGE
+
+                    if (listID < sceneInfo.categoryCount) {
+                        int32 listPos = sceneInfo.listPos - sceneInfo.listCategory[sceneInfo.activeCategory].sceneOffsetStart;
+
+                        sceneInfo.activeCategory = listID;
+                        SceneListInfo *list      = &sceneInfo.listCategory[sceneInfo.activeCategory];
+
+                        sceneInfo.listPos = list->sceneOffsetStart + listPos;
+                        if (sceneInfo.listPos >= list->sceneOffsetEnd)
+                            sceneInfo.listPos = list->sceneOffsetEnd;
                     }
-                    case VAR_PLAYERVALUE14: {
-                        scriptEng.operands[i] = playerList[activePlayer].values[6];
-                        break;
+                    break;
+                }
+                case VAR_STAGELISTPOS: {
+                    SceneListInfo *list = &sceneInfo.listCategory[sceneInfo.activeCategory];
+
+                    if (list->sceneOffsetStart + scriptEng.operands[i] < list->sceneOffsetEnd)
+                        sceneInfo.listPos = list->sceneOffsetStart + scriptEng.operands[i];
+                    break;
+                }
+                case VAR_STAGETIMEENABLED: timeEnabled = scriptEng.operands[i]; break;
+                case VAR_STAGEMILLISECONDS: stageMilliseconds = scriptEng.operands[i]; break;
+                case VAR_STAGESECONDS: stageSeconds = scriptEng.operands[i]; break;
+                case VAR_STAGEMINUTES: stageMinutes = scriptEng.operands[i]; break;
+                case VAR_STAGEACTNO: actID = scriptEng.operands[i]; break;
+                case VAR_STAGEPAUSEENABLED: pauseEnabled = scriptEng.operands[i]; break;
+                case VAR_STAGELISTSIZE: break;
+                case VAR_STAGENEWXBOUNDARY1: newXBoundary1 = scriptEng.operands[i]; break;
+                case VAR_STAGENEWXBOUNDARY2: newXBoundary2 = scriptEng.operands[i]; break;
+                case VAR_STAGENEWYBOUNDARY1: newYBoundary1 = scriptEng.operands[i]; break;
+                case VAR_STAGENEWYBOUNDARY2: newYBoundary2 = scriptEng.operands[i]; break;
+                case VAR_STAGEXBOUNDARY1:
+                    if (curXBoundary1 != scriptEng.operands[i]) {
+                        curXBoundary1 = scriptEng.operands[i];
+                        newXBoundary1 = scriptEng.operands[i];
                     }
-                    case VAR_PLAYERVALUE15: {
-                        scriptEng.operands[i] = playerList[activePlayer].values[7];
-                        break;
+                    break;
+                case VAR_STAGEXBOUNDARY2:
+                    if (curXBoundary2 != scriptEng.operands[i]) {
+                        curXBoundary2 = scriptEng.operands[i];
+                        newXBoundary2 = scriptEng.operands[i];
                     }
-                    case VAR_PLAYEROUTOFBOUNDS: {
-                        int32 pos = playerList[activePlayer].XPos >> 16;
-                        if (pos <= xScrollOffset - OBJECT_BORDER_X1 || pos >= OBJECT_BORDER_X2 + xScrollOffset) {
-                            scriptEng.operands[i] = 1;
-                        }
-                        else {
-                            int32 pos             = playerList[activePlayer].YPos >> 16;
-                            scriptEng.operands[i] = pos <= yScrollOffset - OBJECT_BORDER_Y1 || pos >= yScrollOffset + OBJECT_BORDER_Y2;
-                        }
-                        break;
+                    break;
+                case VAR_STAGEYBOUNDARY1:
+                    if (curYBoundary1 != scriptEng.operands[i]) {
+                        curYBoundary1 = scriptEng.operands[i];
+                        newYBoundary1 = scriptEng.operands[i];
                     }
-                    case VAR_STAGESTATE: scriptEng.operands[i] = stageMode; break;
-                    case VAR_STAGEACTIVELIST: scriptEng.operands[i] = sceneInfo.activeCategory; break;
-                    case VAR_STAGELISTPOS:
-                        scriptEng.operands[i] = sceneInfo.listPos - sceneInfo.listCategory[sceneInfo.activeCategory].sceneOffsetStart;
-                        break;
-                    case VAR_STAGETIMEENABLED: scriptEng.operands[i] = timeEnabled; break;
-                    case VAR_STAGEMILLISECONDS: scriptEng.operands[i] = stageMilliseconds; break;
-                    case VAR_STAGESECONDS: scriptEng.operands[i] = stageSeconds; break;
-                    case VAR_STAGEMINUTES: scriptEng.operands[i] = stageMinutes; break;
-                    case VAR_STAGEACTNO: scriptEng.operands[i] = actID; break;
-                    case VAR_STAGEPAUSEENABLED: scriptEng.operands[i] = pauseEnabled; break;
-                    case VAR_STAGELISTSIZE: scriptEng.operands[i] = sceneInfo.listCategory[RSDK::sceneInfo.activeCategory].sceneCount; break;
-                    case VAR_STAGENEWXBOUNDARY1: scriptEng.operands[i] = newXBoundary1; break;
-                    case VAR_STAGENEWXBOUNDARY2: scriptEng.operands[i] = newXBoundary2; break;
-                    case VAR_STAGENEWYBOUNDARY1: scriptEng.operands[i] = newYBoundary1; break;
-                    case VAR_STAGENEWYBOUNDARY2: scriptEng.operands[i] = newYBoundary2; break;
-                    case VAR_STAGEXBOUNDARY1: scriptEng.operands[i] = curXBoundary1; break;
-                    case VAR_STAGEXBOUNDARY2: scriptEng.operands[i] = curXBoundary2; break;
-                    case VAR_STAGEYBOUNDARY1: scriptEng.operands[i] = curYBoundary1; break;
-                    case VAR_STAGEYBOUNDARY2: scriptEng.operands[i] = curYBoundary2; break;
-                    case VAR_STAGEDEFORMATIONDATA0: scriptEng.operands[i] = bgDeformationData0[arrayVal]; break;
-                    case VAR_STAGEDEFORMATIONDATA1: scriptEng.operands[i] = bgDeformationData1[arrayVal]; break;
-                    case VAR_STAGEDEFORMATIONDATA2: scriptEng.operands[i] = bgDeformationData2[arrayVal]; break;
-                    case VAR_STAGEDEFORMATIONDATA3: scriptEng.operands[i] = bgDeformationData3[arrayVal]; break;
-                    case VAR_STAGEWATERLEVEL: scriptEng.operands[i] = waterLevel; break;
-                    case VAR_STAGEACTIVELAYER: scriptEng.operands[i] = activeTileLayers[arrayVal]; break;
-                    case VAR_STAGEMIDPOINT: scriptEng.operands[i] = tLayerMidPoint; break;
-                    case VAR_STAGEPLAYERLISTPOS: scriptEng.operands[i] = playerListPos; break;
-                    case VAR_STAGEACTIVEPLAYER: scriptEng.operands[i] = activePlayer; break;
-                    case VAR_SCREENCAMERAENABLED: scriptEng.operands[i] = currentCamera->enabled; break;
-                    case VAR_SCREENCAMERATARGET: scriptEng.operands[i] = currentCamera->target; break;
-                    case VAR_SCREENCAMERASTYLE: scriptEng.operands[i] = currentCamera->style; break;
-                    case VAR_SCREENDRAWLISTSIZE: scriptEng.operands[i] = drawListEntries[arrayVal].listSize; break;
-                    case VAR_SCREENCENTERX: scriptEng.operands[i] = SCREEN_CENTERX; break;
-                    case VAR_SCREENCENTERY: scriptEng.operands[i] = SCREEN_CENTERY; break;
-                    case VAR_SCREENXSIZE: scriptEng.operands[i] = SCREEN_XSIZE; break;
-                    case VAR_SCREENYSIZE: scriptEng.operands[i] = SCREEN_YSIZE; break;
-                    case VAR_SCREENXOFFSET: scriptEng.operands[i] = xScrollOffset; break;
-                    case VAR_SCREENYOFFSET: scriptEng.operands[i] = yScrollOffset; break;
-                    case VAR_SCREENSHAKEX: scriptEng.operands[i] = cameraShakeX; break;
-                    case VAR_SCREENSHAKEY: scriptEng.operands[i] = cameraShakeY; break;
-                    case VAR_SCREENADJUSTCAMERAY: scriptEng.operands[i] = currentCamera->adjustY; break;
-                    case VAR_TOUCHSCREENDOWN: scriptEng.operands[i] = touchInfo.down[arrayVal]; break;
-                    case VAR_TOUCHSCREENXPOS: scriptEng.operands[i] = (int32)(touchInfo.x[arrayVal] * SCREEN_XSIZE); break;
-                    case VAR_TOUCHSCREENYPOS: scriptEng.operands[i] = (int32)(touchInfo.y[arrayVal] * SCREEN_YSIZE); break;
-                    case VAR_MUSICVOLUME: scriptEng.operands[i] = musicVolume; break;
-                    case VAR_MUSICCURRENTTRACK: scriptEng.operands[i] = musicCurrentTrack; break;
-                    case VAR_KEYDOWNUP: scriptEng.operands[i] = controller[arrayVal].keyUp.down; break;
-                    case VAR_KEYDOWNDOWN: scriptEng.operands[i] = controller[arrayVal].keyDown.down; break;
-                    case VAR_KEYDOWNLEFT: scriptEng.operands[i] = controller[arrayVal].keyLeft.down; break;
-                    case VAR_KEYDOWNRIGHT: scriptEng.operands[i] = controller[arrayVal].keyRight.down; break;
-                    case VAR_KEYDOWNBUTTONA: scriptEng.operands[i] = controller[arrayVal].keyA.down; break;
-                    case VAR_KEYDOWNBUTTONB: scriptEng.operands[i] = controller[arrayVal].keyB.down; break;
-                    case VAR_KEYDOWNBUTTONC: scriptEng.operands[i] = controller[arrayVal].keyC.down; break;
-                    case VAR_KEYDOWNSTART: scriptEng.operands[i] = controller[arrayVal].keyStart.down; break;
-                    case VAR_KEYPRESSUP: scriptEng.operands[i] = controller[arrayVal].keyUp.press; break;
-                    case VAR_KEYPRESSDOWN: scriptEng.operands[i] = controller[arrayVal].keyDown.press; break;
-                    case VAR_KEYPRESSLEFT: scriptEng.operands[i] = controller[arrayVal].keyLeft.press; break;
-                    case VAR_KEYPRESSRIGHT: scriptEng.operands[i] = controller[arrayVal].keyRight.press; break;
-                    case VAR_KEYPRESSBUTTONA: scriptEng.operands[i] = controller[arrayVal].keyA.press; break;
-                    case VAR_KEYPRESSBUTTONB: scriptEng.operands[i] = controller[arrayVal].keyB.press; break;
-                    case VAR_KEYPRESSBUTTONC: scriptEng.operands[i] = controller[arrayVal].keyC.press; break;
-                    case VAR_KEYPRESSSTART: scriptEng.operands[i] = controller[arrayVal].keyStart.press; break;
-                    case VAR_MENU1SELECTION: scriptEng.operands[i] = gameMenu[0].selection1; break;
-                    case VAR_MENU2SELECTION: scriptEng.operands[i] = gameMenu[1].selection1; break;
-                    case VAR_TILELAYERXSIZE: scriptEng.operands[i] = stageLayouts[arrayVal].xsize; break;
-                    case VAR_TILELAYERYSIZE: scriptEng.operands[i] = stageLayouts[arrayVal].ysize; break;
-                    case VAR_TILELAYERTYPE: scriptEng.operands[i] = stageLayouts[arrayVal].type; break;
-                    case VAR_TILELAYERANGLE: scriptEng.operands[i] = stageLayouts[arrayVal].angle; break;
-                    case VAR_TILELAYERXPOS: scriptEng.operands[i] = stageLayouts[arrayVal].xpos; break;
-                    case VAR_TILELAYERYPOS: scriptEng.operands[i] = stageLayouts[arrayVal].ypos; break;
-                    case VAR_TILELAYERZPOS: scriptEng.operands[i] = stageLayouts[arrayVal].zpos; break;
-                    case VAR_TILELAYERPARALLAXFACTOR: scriptEng.operands[i] = stageLayouts[arrayVal].parallaxFactor; break;
-                    case VAR_TILELAYERSCROLLSPEED: scriptEng.operands[i] = stageLayouts[arrayVal].scrollSpeed; break;
-                    case VAR_TILELAYERSCROLLPOS: scriptEng.operands[i] = stageLayouts[arrayVal].scrollPos; break;
-                    case VAR_TILELAYERDEFORMATIONOFFSET: scriptEng.operands[i] = stageLayouts[arrayVal].deformationOffset; break;
-                    case VAR_TILELAYERDEFORMATIONOFFSETW: scriptEng.operands[i] = stageLayouts[arrayVal].deformationOffsetW; break;
-                    case VAR_HPARALLAXPARALLAXFACTOR: scriptEng.operands[i] = hParallax.parallaxFactor[arrayVal]; break;
-                    case VAR_HPARALLAXSCROLLSPEED: scriptEng.operands[i] = hParallax.scrollSpeed[arrayVal]; break;
-                    case VAR_HPARALLAXSCROLLPOS: scriptEng.operands[i] = hParallax.scrollPos[arrayVal]; break;
-                    case VAR_VPARALLAXPARALLAXFACTOR: scriptEng.operands[i] = vParallax.parallaxFactor[arrayVal]; break;
-                    case VAR_VPARALLAXSCROLLSPEED: scriptEng.operands[i] = vParallax.scrollSpeed[arrayVal]; break;
-                    case VAR_VPARALLAXSCROLLPOS: scriptEng.operands[i] = vParallax.scrollPos[arrayVal]; break;
-                    case VAR_3DSCENENOVERTICES: scriptEng.operands[i] = vertexCount; break;
-                    case VAR_3DSCENENOFACES: scriptEng.operands[i] = faceCount; break;
-                    case VAR_VERTEXBUFFERX: scriptEng.operands[i] = vertexBuffer[arrayVal].x; break;
-                    case VAR_VERTEXBUFFERY: scriptEng.operands[i] = vertexBuffer[arrayVal].y; break;
-                    case VAR_VERTEXBUFFERZ: scriptEng.operands[i] = vertexBuffer[arrayVal].z; break;
-                    case VAR_VERTEXBUFFERU: scriptEng.operands[i] = vertexBuffer[arrayVal].u; break;
-                    case VAR_VERTEXBUFFERV: scriptEng.operands[i] = vertexBuffer[arrayVal].v; break;
-                    case VAR_FACEBUFFERA: scriptEng.operands[i] = faceBuffer[arrayVal].a; break;
-                    case VAR_FACEBUFFERB: scriptEng.operands[i] = faceBuffer[arrayVal].b; break;
-                    case VAR_FACEBUFFERC: scriptEng.operands[i] = faceBuffer[arrayVal].c; break;
-                    case VAR_FACEBUFFERD: scriptEng.operands[i] = faceBuffer[arrayVal].d; break;
-                    case VAR_FACEBUFFERFLAG: scriptEng.operands[i] = faceBuffer[arrayVal].flag; break;
-                    case VAR_FACEBUFFERCOLOR: scriptEng.operands[i] = faceBuffer[arrayVal].color; break;
-                    case VAR_3DSCENEPROJECTIONX: scriptEng.operands[i] = projectionX; break;
-                    case VAR_3DSCENEPROJECTIONY: scriptEng.operands[i] = projectionY; break;
-                    case VAR_ENGINESTATE: scriptEng.operands[i] = gameMode; break;
-                    case VAR_STAGEDEBUGMODE: scriptEng.operands[i] = debugMode; break;
-                    case VAR_ENGINEMESSAGE: scriptEng.operands[i] = engineMessage; break;
-                    case VAR_SAVERAM: scriptEng.operands[i] = saveRAM[arrayVal]; break;
-                    case VAR_ENGINELANGUAGE: scriptEng.operands[i] = language; break;
-                    case VAR_OBJECTSPRITESHEET: {
-                        scriptEng.operands[i] = objectScriptList[objectEntityList[arrayVal].type].spriteSheetID;
-                        break;
+                    break;
+                case VAR_STAGEYBOUNDARY2:
+                    if (curYBoundary2 != scriptEng.operands[i]) {
+                        curYBoundary2 = scriptEng.operands[i];
+                        newYBoundary2 = scriptEng.operands[i];
                     }
-                    case VAR_ENGINEONLINEACTIVE: scriptEng.operands[i] = onlineActive; break;
-                    case VAR_ENGINEFRAMESKIPTIMER: break;
-                    case VAR_ENGINEFRAMESKIPSETTING: break;
-                    case VAR_ENGINESFXVOLUME: scriptEng.operands[i] = sfxVolume; break;
-                    case VAR_ENGINEBGMVOLUME: scriptEng.operands[i] = bgmVolume; break;
-                    case VAR_ENGINEPLATFORMID: scriptEng.operands[i] = gamePlatformID; break;
-                    case VAR_ENGINETRIALMODE: scriptEng.operands[i] = trialMode; break;
-                    case VAR_KEYPRESSANYSTART: scriptEng.operands[i] = anyPress; break;
+                    break;
+                case VAR_STAGEDEFORMATIONDATA0: bgDeformationData0[arrayVal] = scriptEng.operands[i]; break;
+                case VAR_STAGEDEFORMATIONDATA1: bgDeformationData1[arrayVal] = scriptEng.operands[i]; break;
+                case VAR_STAGEDEFORMATIONDATA2: bgDeformationData2[arrayVal] = scriptEng.operands[i]; break;
+                case VAR_STAGEDEFORMATIONDATA3: bgDeformationData3[arrayVal] = scriptEng.operands[i]; break;
+                case VAR_STAGEWATERLEVEL: waterLevel = scriptEng.operands[i]; break;
+                case VAR_STAGEACTIVELAYER: activeTileLayers[arrayVal] = scriptEng.operands[i]; break;
+                case VAR_STAGEMIDPOINT: tLayerMidPoint = scriptEng.operands[i]; break;
+                case VAR_STAGEPLAYERLISTPOS: playerListPos = scriptEng.operands[i]; break;
+                case VAR_STAGEACTIVEPLAYER: activePlayer = scriptEng.operands[i]; break;
+                case VAR_SCREENCAMERAENABLED: currentCamera->enabled = scriptEng.operands[i]; break;
+                case VAR_SCREENCAMERATARGET: currentCamera->target = scriptEng.operands[i]; break;
+                case VAR_SCREENCAMERASTYLE: currentCamera->style = scriptEng.operands[i]; break;
+                case VAR_SCREENDRAWLISTSIZE: drawListEntries[arrayVal].listSize = scriptEng.operands[i]; break;
+                case VAR_SCREENCENTERX: break;
+                case VAR_SCREENCENTERY: break;
+                case VAR_SCREENXSIZE: break;
+                case VAR_SCREENYSIZE: break;
+                case VAR_SCREENXOFFSET:
+                    xScrollOffset = scriptEng.operands[i];
+                    xScrollA      = xScrollOffset;
+                    xScrollB      = SCREEN_XSIZE + xScrollOffset;
+                    break;
+                case VAR_SCREENYOFFSET:
+                    yScrollOffset = scriptEng.operands[i];
+                    yScrollA      = yScrollOffset;
+                    yScrollB      = SCREEN_YSIZE + yScrollOffset;
+                    break;
+                case VAR_SCREENSHAKEX: cameraShakeX = scriptEng.operands[i]; break;
+                case VAR_SCREENSHAKEY: cameraShakeY = scriptEng.operands[i]; break;
+                case VAR_SCREENADJUSTCAMERAY: currentCamera->adjustY = scriptEng.operands[i]; break;
+                case VAR_TOUCHSCREENDOWN: break;
+                case VAR_TOUCHSCREENXPOS: break;
+                case VAR_TOUCHSCREENYPOS: break;
+                case VAR_MUSICVOLUME: SetMusicVolume(scriptEng.operands[i]); break;
+                case VAR_MUSICCURRENTTRACK: break;
+                case VAR_KEYDOWNUP: controller[arrayVal].keyUp.down = scriptEng.operands[i]; break;
+                case VAR_KEYDOWNDOWN: controller[arrayVal].keyDown.down = scriptEng.operands[i]; break;
+                case VAR_KEYDOWNLEFT: controller[arrayVal].keyLeft.down = scriptEng.operands[i]; break;
+                case VAR_KEYDOWNRIGHT: controller[arrayVal].keyRight.down = scriptEng.operands[i]; break;
+                case VAR_KEYDOWNBUTTONA: controller[arrayVal].keyA.down = scriptEng.operands[i]; break;
+                case VAR_KEYDOWNBUTTONB: controller[arrayVal].keyB.down = scriptEng.operands[i]; break;
+                case VAR_KEYDOWNBUTTONC: controller[arrayVal].keyC.down = scriptEng.operands[i]; break;
+                case VAR_KEYDOWNSTART: controller[arrayVal].keyStart.down = scriptEng.operands[i]; break;
+                case VAR_KEYPRESSUP: controller[arrayVal].keyUp.press = scriptEng.operands[i]; break;
+                case VAR_KEYPRESSDOWN: controller[arrayVal].keyDown.press = scriptEng.operands[i]; break;
+                case VAR_KEYPRESSLEFT: controller[arrayVal].keyLeft.press = scriptEng.operands[i]; break;
+                case VAR_KEYPRESSRIGHT: controller[arrayVal].keyRight.press = scriptEng.operands[i]; break;
+                case VAR_KEYPRESSBUTTONA: controller[arrayVal].keyA.press = scriptEng.operands[i]; break;
+                case VAR_KEYPRESSBUTTONB: controller[arrayVal].keyB.press = scriptEng.operands[i]; break;
+                case VAR_KEYPRESSBUTTONC: controller[arrayVal].keyC.press = scriptEng.operands[i]; break;
+                case VAR_KEYPRESSSTART: controller[arrayVal].keyStart.press = scriptEng.operands[i]; break;
+                case VAR_MENU1SELECTION: gameMenu[0].selection1 = scriptEng.operands[i]; break;
+                case VAR_MENU2SELECTION: gameMenu[1].selection1 = scriptEng.operands[i]; break;
+                case VAR_TILELAYERXSIZE: stageLayouts[arrayVal].xsize = scriptEng.operands[i]; break;
+                case VAR_TILELAYERYSIZE: stageLayouts[arrayVal].ysize = scriptEng.operands[i]; break;
+                case VAR_TILELAYERTYPE: stageLayouts[arrayVal].type = scriptEng.operands[i]; break;
+                case VAR_TILELAYERANGLE:
+                    stageLayouts[arrayVal].angle = scriptEng.operands[i];
+                    if (stageLayouts[arrayVal].angle < 0)
+                        stageLayouts[arrayVal].angle += 0x200;
+                    stageLayouts[arrayVal].angle &= 0x1FF;
+                    break;
+                case VAR_TILELAYERXPOS: stageLayouts[arrayVal].xpos = scriptEng.operands[i]; break;
+                case VAR_TILELAYERYPOS: stageLayouts[arrayVal].ypos = scriptEng.operands[i]; break;
+                case VAR_TILELAYERZPOS: stageLayouts[arrayVal].zpos = scriptEng.operands[i]; break;
+                case VAR_TILELAYERPARALLAXFACTOR: stageLayouts[arrayVal].parallaxFactor = scriptEng.operands[i]; break;
+                case VAR_TILELAYERSCROLLSPEED: stageLayouts[arrayVal].scrollSpeed = scriptEng.operands[i]; break;
+                case VAR_TILELAYERSCROLLPOS: stageLayouts[arrayVal].scrollPos = scriptEng.operands[i]; break;
+                case VAR_TILELAYERDEFORMATIONOFFSET:
+                    stageLayouts[arrayVal].deformationOffset = scriptEng.operands[i];
+                    stageLayouts[arrayVal].deformationOffset &= 0xFFu;
+                    break;
+                case VAR_TILELAYERDEFORMATIONOFFSETW:
+                    stageLayouts[arrayVal].deformationOffsetW = scriptEng.operands[i];
+                    stageLayouts[arrayVal].deformationOffsetW &= 0xFFu;
+                    break;
+                case VAR_HPARALLAXPARALLAXFACTOR: hParallax.parallaxFactor[arrayVal] = scriptEng.operands[i]; break;
+                case VAR_HPARALLAXSCROLLSPEED: hParallax.scrollSpeed[arrayVal] = scriptEng.operands[i]; break;
+                case VAR_HPARALLAXSCROLLPOS: hParallax.scrollPos[arrayVal] = scriptEng.operands[i]; break;
+                case VAR_VPARALLAXPARALLAXFACTOR: vParallax.parallaxFactor[arrayVal] = scriptEng.operands[i]; break;
+                case VAR_VPARALLAXSCROLLSPEED: vParallax.scrollSpeed[arrayVal] = scriptEng.operands[i]; break;
+                case VAR_VPARALLAXSCROLLPOS: vParallax.scrollPos[arrayVal] = scriptEng.operands[i]; break;
+                case VAR_3DSCENENOVERTICES: vertexCount = scriptEng.operands[i]; break;
+                case VAR_3DSCENENOFACES: faceCount = scriptEng.operands[i]; break;
+                case VAR_VERTEXBUFFERX: vertexBuffer[arrayVal].x = scriptEng.operands[i]; break;
+                case VAR_VERTEXBUFFERY: vertexBuffer[arrayVal].y = scriptEng.operands[i]; break;
+                case VAR_VERTEXBUFFERZ: vertexBuffer[arrayVal].z = scriptEng.operands[i]; break;
+                case VAR_VERTEXBUFFERU: vertexBuffer[arrayVal].u = scriptEng.operands[i]; break;
+                case VAR_VERTEXBUFFERV: vertexBuffer[arrayVal].v = scriptEng.operands[i]; break;
+                case VAR_FACEBUFFERA: faceBuffer[arrayVal].a = scriptEng.operands[i]; break;
+                case VAR_FACEBUFFERB: faceBuffer[arrayVal].b = scriptEng.operands[i]; break;
+                case VAR_FACEBUFFERC: faceBuffer[arrayVal].c = scriptEng.operands[i]; break;
+                case VAR_FACEBUFFERD: faceBuffer[arrayVal].d = scriptEng.operands[i]; break;
+                case VAR_FACEBUFFERFLAG: faceBuffer[arrayVal].flag = scriptEng.operands[i]; break;
+                case VAR_FACEBUFFERCOLOR: faceBuffer[arrayVal].color = scriptEng.operands[i]; break;
+                case VAR_3DSCENEPROJECTIONX: projectionX = scriptEng.operands[i]; break;
+                case VAR_3DSCENEPROJECTIONY: projectionY = scriptEng.operands[i]; break;
+                case VAR_ENGINESTATE: gameMode = scriptEng.operands[i]; break;
+                case VAR_STAGEDEBUGMODE: debugMode = scriptEng.operands[i]; break;
+                case VAR_ENGINEMESSAGE: break;
+                case VAR_SAVERAM: saveRAM[arrayVal] = scriptEng.operands[i]; break;
+                case VAR_ENGINELANGUAGE: language = scriptEng.operands[i]; break;
+                case VAR_OBJECTSPRITESHEET: {
+                    objectScriptList[objectEntityList[arrayVal].type].spriteSheetID = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_ENGINEONLINEACTIVE: break;
+                case VAR_ENGINEFRAMESKIPTIMER: break;
+                case VAR_ENGINEFRAMESKIPSETTING: break;
+                case VAR_ENGINESFXVOLUME:
+                    sfxVolume = scriptEng.operands[i];
+                    // SetGameVolumes(bgmVolume, sfxVolume);
+                    break;
+                case VAR_ENGINEBGMVOLUME:
+                    bgmVolume = scriptEng.operands[i];
+                    // SetGameVolumes(bgmVolume, sfxVolume);
+                    break;
+                case VAR_ENGINEPLATFORMID: break;
+                case VAR_ENGINETRIALMODE: break;
+                case VAR_KEYPRESSANYSTART: break;
 #if LEGACY_RETRO_USE_HAPTICS
-                    case VAR_ENGINEHAPTICSENABLED: scriptEng.operands[i] = hapticsEnabled; break;
+                case VAR_ENGINEHAPTICSENABLED: hapticsEnabled = scriptEng.operands[i]; break;
 #endif
-                }
-            }
-            else if (opcodeType == SCRIPTVAR_INTCONST) { // int32 constant
-                scriptEng.operands[i] = scriptCode[scriptCodePtr++];
             }
-            else if (opcodeType == SCRIPTVAR_STRCONST) { // string constant
-                int32 strLen       = scriptCode[scriptCodePtr++];
-                scriptText[strLen] = 0;
-                for (int32 c = 0; c < strLen; ++c) {
-                    switch (c % 4) {
-                        case 0: {
-                            scriptText[c] = scriptCode[scriptCodePtr] >> 24;
-                            break;
-                        }
-                        case 1: {
-                            scriptText[c] = (0xFFFFFF & scriptCode[scriptCodePtr]) >> 16;
-                            break;
-                        }
-                        case 2: {
-                            scriptText[c] = (0xFFFF & scriptCode[scriptCodePtr]) >> 8;
-                            break;
-                        }
-                        case 3: {
-                            scriptText[c] = scriptCode[scriptCodePtr++];
-                            break;
-                        }
-                        default: break;
-                    }
+        }
+        else if (opcodeType == SCRIPTVAR_INTCONST) { // int32 constant
+            scriptCodePtr++;
+        }
+        else if (opcodeType == SCRIPTVAR_STRCONST) { // string constant
+            int32 strLen = scriptCode[scriptCodePtr++];
+            for (int32 c = 0; c < strLen; ++c) {
+                switch (c % 4) {
+                    case 0: break;
+                    case 1: break;
+                    case 2: break;
+                    case 3: ++scriptCodePtr; break;
+                    default: break;
                 }
-                scriptCodePtr++;
             }
+            scriptCodePtr++;
         }
+    }
+}
+
+} // namespace v3
+
+} // namespace Legacy
+
+} // namespace RSDK
+
+#if RETRO_USE_COMPUTED_GOTO
+// each handler writes back its own operands, then reads in the next opcode & jumps straight to its handler, rather than going back round to the switch
+#define LEGACY_SCRIPT_NEXT                                                                                                                            \
+    WriteScriptOperands(&opcodeState, scriptCodePtr);                                                                                                 \
+    if (!running)                                                                                                                                     \
+        return;                                                                                                                                       \
+    opcode      = ReadScriptOpcode(&opcodeState, scriptCodePtr);                                                                                      \
+    scriptInfo  = &objectScriptList[objectEntityList[objectLoop].type];                                                                               \
+    entity      = &objectEntityList[objectLoop];                                                                                                      \
+    player      = &playerList[activePlayer];                                                                                                          \
+    spriteFrame = nullptr;                                                                                                                            \
+    goto *((uint32)opcode < FUNC_MAX_CNT ? opcodeHandlers[opcode] : &&DEFAULT_HANDLER)
+#else
+#define LEGACY_SCRIPT_NEXT break
+#endif
+
+void RSDK::Legacy::v3::ProcessScript(int32 scriptCodeStart, int32 jumpTableStart, uint8 scriptSub)
+{
+#if RETRO_USE_COMPUTED_GOTO
+    static const void *const opcodeHandlers[FUNC_MAX_CNT] = {
+        &&FUNC_END_HANDLER, &&FUNC_EQUAL_HANDLER, &&FUNC_ADD_HANDLER, &&FUNC_SUB_HANDLER, &&FUNC_INC_HANDLER, &&FUNC_DEC_HANDLER, &&FUNC_MUL_HANDLER,
+        &&FUNC_DIV_HANDLER, &&FUNC_SHR_HANDLER, &&FUNC_SHL_HANDLER, &&FUNC_AND_HANDLER, &&FUNC_OR_HANDLER, &&FUNC_XOR_HANDLER, &&FUNC_MOD_HANDLER,
+        &&FUNC_FLIPSIGN_HANDLER, &&FUNC_CHECKEQUAL_HANDLER, &&FUNC_CHECKGREATER_HANDLER, &&FUNC_CHECKLOWER_HANDLER, &&FUNC_CHECKNOTEQUAL_HANDLER,
+        &&FUNC_IFEQUAL_HANDLER, &&FUNC_IFGREATER_HANDLER, &&FUNC_IFGREATEROREQUAL_HANDLER, &&FUNC_IFLOWER_HANDLER, &&FUNC_IFLOWEROREQUAL_HANDLER,
+        &&FUNC_IFNOTEQUAL_HANDLER, &&FUNC_ELSE_HANDLER, &&FUNC_ENDIF_HANDLER, &&FUNC_WEQUAL_HANDLER, &&FUNC_WGREATER_HANDLER,
+        &&FUNC_WGREATEROREQUAL_HANDLER, &&FUNC_WLOWER_HANDLER, &&FUNC_WLOWEROREQUAL_HANDLER, &&FUNC_WNOTEQUAL_HANDLER, &&FUNC_LOOP_HANDLER,
+        &&FUNC_SWITCH_HANDLER, &&FUNC_BREAK_HANDLER, &&FUNC_ENDSWITCH_HANDLER, &&FUNC_RAND_HANDLER, &&FUNC_SIN_HANDLER, &&FUNC_COS_HANDLER,
+        &&FUNC_SIN256_HANDLER, &&FUNC_COS256_HANDLER, &&FUNC_SINCHANGE_HANDLER, &&FUNC_COSCHANGE_HANDLER, &&FUNC_ATAN2_HANDLER,
+        &&FUNC_INTERPOLATE_HANDLER, &&FUNC_INTERPOLATEXY_HANDLER, &&FUNC_LOADSPRITESHEET_HANDLER, &&FUNC_REMOVESPRITESHEET_HANDLER,
+        &&FUNC_DRAWSPRITE_HANDLER, &&FUNC_DRAWSPRITEXY_HANDLER, &&FUNC_DRAWSPRITESCREENXY_HANDLER, &&FUNC_DRAWTINTRECT_HANDLER,
+        &&FUNC_DRAWNUMBERS_HANDLER, &&FUNC_DRAWACTNAME_HANDLER, &&FUNC_DRAWMENU_HANDLER, &&FUNC_SPRITEFRAME_HANDLER, &&FUNC_EDITFRAME_HANDLER,
+        &&FUNC_LOADPALETTE_HANDLER, &&FUNC_ROTATEPALETTE_HANDLER, &&FUNC_SETSCREENFADE_HANDLER, &&FUNC_SETACTIVEPALETTE_HANDLER,
+        &&FUNC_SETPALETTEFADE_HANDLER, &&FUNC_COPYPALETTE_HANDLER, &&FUNC_CLEARSCREEN_HANDLER, &&FUNC_DRAWSPRITEFX_HANDLER,
+        &&FUNC_DRAWSPRITESCREENFX_HANDLER, &&FUNC_LOADANIMATION_HANDLER, &&FUNC_SETUPMENU_HANDLER, &&FUNC_ADDMENUENTRY_HANDLER,
+        &&FUNC_EDITMENUENTRY_HANDLER, &&FUNC_LOADSTAGE_HANDLER, &&FUNC_DRAWRECT_HANDLER, &&FUNC_RESETOBJECTENTITY_HANDLER,
+        &&FUNC_PLAYEROBJECTCOLLISION_HANDLER, &&FUNC_CREATETEMPOBJECT_HANDLER, &&FUNC_BINDPLAYERTOOBJECT_HANDLER, &&FUNC_PLAYERTILECOLLISION_HANDLER,
+        &&FUNC_PROCESSPLAYERCONTROL_HANDLER, &&FUNC_PROCESSANIMATION_HANDLER, &&FUNC_DRAWOBJECTANIMATION_HANDLER, &&FUNC_DRAWPLAYERANIMATION_HANDLER,
+        &&FUNC_SETMUSICTRACK_HANDLER, &&FUNC_PLAYMUSIC_HANDLER, &&FUNC_STOPMUSIC_HANDLER, &&FUNC_PLAYSFX_HANDLER, &&FUNC_STOPSFX_HANDLER,
+        &&FUNC_SETSFXATTRIBUTES_HANDLER, &&FUNC_OBJECTTILECOLLISION_HANDLER, &&FUNC_OBJECTTILEGRIP_HANDLER, &&FUNC_LOADVIDEO_HANDLER,
+        &&FUNC_NEXTVIDEOFRAME_HANDLER, &&FUNC_PLAYSTAGESFX_HANDLER, &&FUNC_STOPSTAGESFX_HANDLER, &&FUNC_NOT_HANDLER, &&FUNC_DRAW3DSCENE_HANDLER,
+        &&FUNC_SETIDENTITYMATRIX_HANDLER, &&FUNC_MATRIXMULTIPLY_HANDLER, &&FUNC_MATRIXTRANSLATEXYZ_HANDLER, &&FUNC_MATRIXSCALEXYZ_HANDLER,
+        &&FUNC_MATRIXROTATEX_HANDLER, &&FUNC_MATRIXROTATEY_HANDLER, &&FUNC_MATRIXROTATEZ_HANDLER, &&FUNC_MATRIXROTATEXYZ_HANDLER,
+        &&FUNC_TRANSFORMVERTICES_HANDLER, &&FUNC_CALLFUNCTION_HANDLER, &&FUNC_ENDFUNCTION_HANDLER, &&FUNC_SETLAYERDEFORMATION_HANDLER,
+        &&FUNC_CHECKTOUCHRECT_HANDLER, &&FUNC_GETTILELAYERENTRY_HANDLER, &&FUNC_SETTILELAYERENTRY_HANDLER, &&FUNC_GETBIT_HANDLER,
+        &&FUNC_SETBIT_HANDLER, &&FUNC_PAUSEMUSIC_HANDLER, &&FUNC_RESUMEMUSIC_HANDLER, &&FUNC_CLEARDRAWLIST_HANDLER,
+        &&FUNC_ADDDRAWLISTENTITYREF_HANDLER, &&FUNC_GETDRAWLISTENTITYREF_HANDLER, &&FUNC_SETDRAWLISTENTITYREF_HANDLER,
+        &&FUNC_GET16X16TILEINFO_HANDLER, &&FUNC_COPY16X16TILE_HANDLER, &&FUNC_SET16X16TILEINFO_HANDLER, &&FUNC_GETANIMATIONBYNAME_HANDLER,
+        &&FUNC_READSAVERAM_HANDLER, &&FUNC_WRITESAVERAM_HANDLER, &&FUNC_LOADTEXTFONT_HANDLER, &&FUNC_LOADTEXTFILE_HANDLER, &&FUNC_DRAWTEXT_HANDLER,
+        &&FUNC_GETTEXTINFO_HANDLER, &&FUNC_GETVERSIONNUMBER_HANDLER, &&FUNC_SETACHIEVEMENT_HANDLER, &&FUNC_SETLEADERBOARD_HANDLER,
+        &&FUNC_LOADONLINEMENU_HANDLER, &&FUNC_ENGINECALLBACK_HANDLER,
+#if LEGACY_RETRO_USE_HAPTICS
+        &&FUNC_HAPTICEFFECT_HANDLER,
+#endif
+    };
+#endif
+
+#if RETRO_USE_SCRIPT_PROFILER
+    ScriptProfileScope profile(objectEntityList[objectLoop].type, scriptSub);
+#endif
+
+    bool running        = true;
+    int32 scriptCodePtr = scriptCodeStart;
+
+    jumpTableStackPos = 0;
+    functionStackPos  = 0;
+
+    ScriptOpcodeState opcodeState;
+    int32 &opcodeSize = opcodeState.opcodeSize;
+
+    while (running) {
+        int32 opcode = ReadScriptOpcode(&opcodeState, scriptCodePtr);
 
         ObjectScript *scriptInfo = &objectScriptList[objectEntityList[objectLoop].type];
         Entity *entity           = &objectEntityList[objectLoop];
@@ -2709,130 +3467,133 @@ void RSDK::Legacy::v3::ProcessScript(int32 scriptCodeStart, int32 jumpTableStart
         SpriteFrame *spriteFrame = nullptr;
 
         // Functions
+#if RETRO_USE_COMPUTED_GOTO
+        goto *((uint32)opcode < FUNC_MAX_CNT ? opcodeHandlers[opcode] : &&DEFAULT_HANDLER);
+#endif
         switch (opcode) {
-            default: break;
-            case FUNC_END: running = false; break;
-            case FUNC_EQUAL: scriptEng.operands[0] = scriptEng.operands[1]; break;
-            case FUNC_ADD: scriptEng.operands[0] += scriptEng.operands[1]; break;
-            case FUNC_SUB: scriptEng.operands[0] -= scriptEng.operands[1]; break;
-            case FUNC_INC: ++scriptEng.operands[0]; break;
-            case FUNC_DEC: --scriptEng.operands[0]; break;
-            case FUNC_MUL: scriptEng.operands[0] *= scriptEng.operands[1]; break;
-            case FUNC_DIV: scriptEng.operands[0] /= scriptEng.operands[1]; break;
-            case FUNC_SHR: scriptEng.operands[0] >>= scriptEng.operands[1]; break;
-            case FUNC_SHL: scriptEng.operands[0] <<= scriptEng.operands[1]; break;
-            case FUNC_AND: scriptEng.operands[0] &= scriptEng.operands[1]; break;
-            case FUNC_OR: scriptEng.operands[0] |= scriptEng.operands[1]; break;
-            case FUNC_XOR: scriptEng.operands[0] ^= scriptEng.operands[1]; break;
-            case FUNC_MOD: scriptEng.operands[0] %= scriptEng.operands[1]; break;
-            case FUNC_FLIPSIGN: scriptEng.operands[0] = -scriptEng.operands[0]; break;
-            case FUNC_CHECKEQUAL:
+            LEGACY_SCRIPT_DEFAULT: LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_END): running = false; LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_EQUAL): scriptEng.operands[0] = scriptEng.operands[1]; LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_ADD): scriptEng.operands[0] += scriptEng.operands[1]; LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_SUB): scriptEng.operands[0] -= scriptEng.operands[1]; LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_INC): ++scriptEng.operands[0]; LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_DEC): --scriptEng.operands[0]; LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_MUL): scriptEng.operands[0] *= scriptEng.operands[1]; LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_DIV): scriptEng.operands[0] /= scriptEng.operands[1]; LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_SHR): scriptEng.operands[0] >>= scriptEng.operands[1]; LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_SHL): scriptEng.operands[0] <<= scriptEng.operands[1]; LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_AND): scriptEng.operands[0] &= scriptEng.operands[1]; LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_OR): scriptEng.operands[0] |= scriptEng.operands[1]; LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_XOR): scriptEng.operands[0] ^= scriptEng.operands[1]; LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_MOD): scriptEng.operands[0] %= scriptEng.operands[1]; LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_FLIPSIGN): scriptEng.operands[0] = -scriptEng.operands[0]; LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_CHECKEQUAL):
                 scriptEng.checkResult = scriptEng.operands[0] == scriptEng.operands[1];
                 opcodeSize            = 0;
-                break;
-            case FUNC_CHECKGREATER:
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_CHECKGREATER):
                 scriptEng.checkResult = scriptEng.operands[0] > scriptEng.operands[1];
                 opcodeSize            = 0;
-                break;
-            case FUNC_CHECKLOWER:
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_CHECKLOWER):
                 scriptEng.checkResult = scriptEng.operands[0] < scriptEng.operands[1];
                 opcodeSize            = 0;
-                break;
-            case FUNC_CHECKNOTEQUAL:
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_CHECKNOTEQUAL):
                 scriptEng.checkResult = scriptEng.operands[0] != scriptEng.operands[1];
                 opcodeSize            = 0;
-                break;
-            case FUNC_IFEQUAL:
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_IFEQUAL):
                 if (scriptEng.operands[1] != scriptEng.operands[2])
                     scriptCodePtr = scriptCodeStart + jumpTable[jumpTableStart + scriptEng.operands[0]];
                 jumpTableStack[++jumpTableStackPos] = scriptEng.operands[0];
                 opcodeSize                          = 0;
-                break;
-            case FUNC_IFGREATER:
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_IFGREATER):
                 if (scriptEng.operands[1] <= scriptEng.operands[2])
                     scriptCodePtr = scriptCodeStart + jumpTable[jumpTableStart + scriptEng.operands[0]];
                 jumpTableStack[++jumpTableStackPos] = scriptEng.operands[0];
                 opcodeSize                          = 0;
-                break;
-            case FUNC_IFGREATEROREQUAL:
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_IFGREATEROREQUAL):
                 if (scriptEng.operands[1] < scriptEng.operands[2])
                     scriptCodePtr = scriptCodeStart + jumpTable[jumpTableStart + scriptEng.operands[0]];
                 jumpTableStack[++jumpTableStackPos] = scriptEng.operands[0];
                 opcodeSize                          = 0;
-                break;
-            case FUNC_IFLOWER:
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_IFLOWER):
                 if (scriptEng.operands[1] >= scriptEng.operands[2])
                     scriptCodePtr = scriptCodeStart + jumpTable[jumpTableStart + scriptEng.operands[0]];
                 jumpTableStack[++jumpTableStackPos] = scriptEng.operands[0];
                 opcodeSize                          = 0;
-                break;
-            case FUNC_IFLOWEROREQUAL:
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_IFLOWEROREQUAL):
                 if (scriptEng.operands[1] > scriptEng.operands[2])
                     scriptCodePtr = scriptCodeStart + jumpTable[jumpTableStart + scriptEng.operands[0]];
                 jumpTableStack[++jumpTableStackPos] = scriptEng.operands[0];
                 opcodeSize                          = 0;
-                break;
-            case FUNC_IFNOTEQUAL:
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_IFNOTEQUAL):
                 if (scriptEng.operands[1] == scriptEng.operands[2])
                     scriptCodePtr = scriptCodeStart + jumpTable[jumpTableStart + scriptEng.operands[0]];
                 jumpTableStack[++jumpTableStackPos] = scriptEng.operands[0];
                 opcodeSize                          = 0;
-                break;
-            case FUNC_ELSE:
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_ELSE):
                 opcodeSize    = 0;
                 scriptCodePtr = scriptCodeStart + jumpTable[jumpTableStart + jumpTableStack[jumpTableStackPos--] + 1];
-                break;
-            case FUNC_ENDIF:
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_ENDIF):
                 opcodeSize = 0;
                 --jumpTableStackPos;
-                break;
-            case FUNC_WEQUAL:
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_WEQUAL):
                 if (scriptEng.operands[1] != scriptEng.operands[2])
                     scriptCodePtr = scriptCodeStart + jumpTable[jumpTableStart + scriptEng.operands[0] + 1];
                 else
                     jumpTableStack[++jumpTableStackPos] = scriptEng.operands[0];
                 opcodeSize = 0;
-                break;
-            case FUNC_WGREATER:
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_WGREATER):
                 if (scriptEng.operands[1] <= scriptEng.operands[2])
                     scriptCodePtr = scriptCodeStart + jumpTable[jumpTableStart + scriptEng.operands[0] + 1];
                 else
                     jumpTableStack[++jumpTableStackPos] = scriptEng.operands[0];
                 opcodeSize = 0;
-                break;
-            case FUNC_WGREATEROREQUAL:
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_WGREATEROREQUAL):
                 if (scriptEng.operands[1] < scriptEng.operands[2])
                     scriptCodePtr = scriptCodeStart + jumpTable[jumpTableStart + scriptEng.operands[0] + 1];
                 else
                     jumpTableStack[++jumpTableStackPos] = scriptEng.operands[0];
                 opcodeSize = 0;
-                break;
-            case FUNC_WLOWER:
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_WLOWER):
                 if (scriptEng.operands[1] >= scriptEng.operands[2])
                     scriptCodePtr = scriptCodeStart + jumpTable[jumpTableStart + scriptEng.operands[0] + 1];
                 else
                     jumpTableStack[++jumpTableStackPos] = scriptEng.operands[0];
                 opcodeSize = 0;
-                break;
-            case FUNC_WLOWEROREQUAL:
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_WLOWEROREQUAL):
                 if (scriptEng.operands[1] > scriptEng.operands[2])
                     scriptCodePtr = scriptCodeStart + jumpTable[jumpTableStart + scriptEng.operands[0] + 1];
                 else
                     jumpTableStack[++jumpTableStackPos] = scriptEng.operands[0];
                 opcodeSize = 0;
-                break;
-            case FUNC_WNOTEQUAL:
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_WNOTEQUAL):
                 if (scriptEng.operands[1] == scriptEng.operands[2])
                     scriptCodePtr = scriptCodeStart + jumpTable[jumpTableStart + scriptEng.operands[0] + 1];
                 else
                     jumpTableStack[++jumpTableStackPos] = scriptEng.operands[0];
                 opcodeSize = 0;
-                break;
-            case FUNC_LOOP:
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_LOOP):
                 opcodeSize    = 0;
                 scriptCodePtr = scriptCodeStart + jumpTable[jumpTableStart + jumpTableStack[jumpTableStackPos--]];
-                break;
-            case FUNC_SWITCH:
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_SWITCH):
                 jumpTableStack[++jumpTableStackPos] = scriptEng.operands[0];
                 if (scriptEng.operands[1] < jumpTable[jumpTableStart + scriptEng.operands[0]]
                     || scriptEng.operands[1] > jumpTable[jumpTableStart + scriptEng.operands[0] + 1])
@@ -2842,86 +3603,86 @@ void RSDK::Legacy::v3::ProcessScript(int32 scriptCodeStart, int32 jumpTableStart
                                     + jumpTable[jumpTableStart + scriptEng.operands[0] + 4
                                                 + (scriptEng.operands[1] - jumpTable[jumpTableStart + scriptEng.operands[0]])];
                 opcodeSize = 0;
-                break;
-            case FUNC_BREAK:
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_BREAK):
                 opcodeSize    = 0;
                 scriptCodePtr = scriptCodeStart + jumpTable[jumpTableStart + jumpTableStack[jumpTableStackPos--] + 3];
-                break;
-            case FUNC_ENDSWITCH:
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_ENDSWITCH):
                 opcodeSize = 0;
                 --jumpTableStackPos;
-                break;
-            case FUNC_RAND: scriptEng.operands[0] = rand() % scriptEng.operands[1]; break;
-            case FUNC_SIN: {
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_RAND): scriptEng.operands[0] = rand() % scriptEng.operands[1]; LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_SIN): {
                 scriptEng.operands[0] = Sin512(scriptEng.operands[1]);
-                break;
+                LEGACY_SCRIPT_NEXT;
             }
-            case FUNC_COS: {
+            LEGACY_SCRIPT_CASE(FUNC_COS): {
                 scriptEng.operands[0] = Cos512(scriptEng.operands[1]);
-                break;
+                LEGACY_SCRIPT_NEXT;
             }
-            case FUNC_SIN256: {
+            LEGACY_SCRIPT_CASE(FUNC_SIN256): {
                 scriptEng.operands[0] = Sin256(scriptEng.operands[1]);
-                break;
+                LEGACY_SCRIPT_NEXT;
             }
-            case FUNC_COS256: {
+            LEGACY_SCRIPT_CASE(FUNC_COS256): {
                 scriptEng.operands[0] = Cos256(scriptEng.operands[1]);
-                break;
+                LEGACY_SCRIPT_NEXT;
             }
-            case FUNC_SINCHANGE: {
+            LEGACY_SCRIPT_CASE(FUNC_SINCHANGE): {
                 scriptEng.operands[0] = scriptEng.operands[3] + (Sin512(scriptEng.operands[1]) >> scriptEng.operands[2]) - scriptEng.operands[4];
-                break;
+                LEGACY_SCRIPT_NEXT;
             }
-            case FUNC_COSCHANGE: {
+            LEGACY_SCRIPT_CASE(FUNC_COSCHANGE): {
                 scriptEng.operands[0] = scriptEng.operands[3] + (Cos512(scriptEng.operands[1]) >> scriptEng.operands[2]) - scriptEng.operands[4];
-                break;
+                LEGACY_SCRIPT_NEXT;
             }
-            case FUNC_ATAN2: {
+            LEGACY_SCRIPT_CASE(FUNC_ATAN2): {
                 scriptEng.operands[0] = ArcTanLookup(scriptEng.operands[1], scriptEng.operands[2]);
-                break;
+                LEGACY_SCRIPT_NEXT;
             }
-            case FUNC_INTERPOLATE:
+            LEGACY_SCRIPT_CASE(FUNC_INTERPOLATE):
                 scriptEng.operands[0] =
                     (scriptEng.operands[2] * (0x100 - scriptEng.operands[3]) + scriptEng.operands[3] * scriptEng.operands[1]) >> 8;
-                break;
-            case FUNC_INTERPOLATEXY:
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_INTERPOLATEXY):
                 scriptEng.operands[0] =
                     (scriptEng.operands[3] * (0x100 - scriptEng.operands[6]) >> 8) + ((scriptEng.operands[6] * scriptEng.operands[2]) >> 8);
                 scriptEng.operands[1] =
                     (scriptEng.operands[5] * (0x100 - scriptEng.operands[6]) >> 8) + (scriptEng.operands[6] * scriptEng.operands[4] >> 8);
-                break;
-            case FUNC_LOADSPRITESHEET:
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_LOADSPRITESHEET):
                 opcodeSize                = 0;
                 scriptInfo->spriteSheetID = AddGraphicsFile(scriptText);
-                break;
-            case FUNC_REMOVESPRITESHEET:
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_REMOVESPRITESHEET):
                 opcodeSize = 0;
                 RemoveGraphicsFile(scriptText, -1);
-                break;
-            case FUNC_DRAWSPRITE:
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_DRAWSPRITE):
                 opcodeSize  = 0;
                 spriteFrame = &scriptFrames[scriptInfo->frameListOffset + scriptEng.operands[0]];
                 DrawSprite((entity->XPos >> 16) - xScrollOffset + spriteFrame->pivotX, (entity->YPos >> 16) - yScrollOffset + spriteFrame->pivotY,
                            spriteFrame->width, spriteFrame->height, spriteFrame->sprX, spriteFrame->sprY, scriptInfo->spriteSheetID);
-                break;
-            case FUNC_DRAWSPRITEXY:
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_DRAWSPRITEXY):
                 opcodeSize  = 0;
                 spriteFrame = &scriptFrames[scriptInfo->frameListOffset + scriptEng.operands[0]];
                 DrawSprite((scriptEng.operands[1] >> 16) - xScrollOffset + spriteFrame->pivotX,
                            (scriptEng.operands[2] >> 16) - yScrollOffset + spriteFrame->pivotY, spriteFrame->width, spriteFrame->height,
                            spriteFrame->sprX, spriteFrame->sprY, scriptInfo->spriteSheetID);
-                break;
-            case FUNC_DRAWSPRITESCREENXY:
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_DRAWSPRITESCREENXY):
                 opcodeSize  = 0;
                 spriteFrame = &scriptFrames[scriptInfo->frameListOffset + scriptEng.operands[0]];
                 DrawSprite(scriptEng.operands[1] + spriteFrame->pivotX, scriptEng.operands[2] + spriteFrame->pivotY, spriteFrame->width,
                            spriteFrame->height, spriteFrame->sprX, spriteFrame->sprY, scriptInfo->spriteSheetID);
-                break;
-            case FUNC_DRAWTINTRECT:
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_DRAWTINTRECT):
                 opcodeSize = 0;
                 DrawTintRectangle(scriptEng.operands[0], scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]);
-                break;
-            case FUNC_DRAWNUMBERS: {
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_DRAWNUMBERS): {
                 opcodeSize = 0;
                 int32 i    = 10;
                 if (scriptEng.operands[6]) {
@@ -2951,9 +3712,9 @@ void RSDK::Legacy::v3::ProcessScript(int32 scriptCodeStart, int32 jumpTableStart
                         --scriptEng.operands[4];
                     }
                 }
-                break;
+                LEGACY_SCRIPT_NEXT;
             }
-            case FUNC_DRAWACTNAME: {
+            LEGACY_SCRIPT_CASE(FUNC_DRAWACTNAME): {
                 opcodeSize   = 0;
                 int32 charID = 0;
 
@@ -3071,14 +3832,14 @@ void RSDK::Legacy::v3::ProcessScript(int32 scriptCodeStart, int32 jumpTableStart
                         }
                         break;
                 }
-                break;
+                LEGACY_SCRIPT_NEXT;
             }
-            case FUNC_DRAWMENU:
+            LEGACY_SCRIPT_CASE(FUNC_DRAWMENU):
                 opcodeSize        = 0;
                 textMenuSurfaceNo = scriptInfo->spriteSheetID;
                 DrawTextMenu(&gameMenu[scriptEng.operands[0]], scriptEng.operands[1], scriptEng.operands[2]);
-                break;
-            case FUNC_SPRITEFRAME:
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_SPRITEFRAME):
                 opcodeSize = 0;
                 if (scriptSub == SUB_SETUP && scriptFrameCount < LEGACY_SPRITEFRAME_COUNT) {
                     scriptFrames[scriptFrameCount].pivotX = scriptEng.operands[0];
@@ -3089,8 +3850,8 @@ void RSDK::Legacy::v3::ProcessScript(int32 scriptCodeStart, int32 jumpTableStart
                     scriptFrames[scriptFrameCount].sprY   = scriptEng.operands[5];
                     ++scriptFrameCount;
                 }
-                break;
-            case FUNC_EDITFRAME: {
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_EDITFRAME): {
                 opcodeSize  = 0;
                 spriteFrame = &scriptFrames[scriptInfo->frameListOffset + scriptEng.operands[0]];
 
@@ -3100,38 +3861,38 @@ void RSDK::Legacy::v3::ProcessScript(int32 scriptCodeStart, int32 jumpTableStart
                 spriteFrame->height = scriptEng.operands[4];
                 spriteFrame->sprX   = scriptEng.operands[5];
                 spriteFrame->sprY   = scriptEng.operands[6];
-                break;
+                LEGACY_SCRIPT_NEXT;
             }
-            case FUNC_LOADPALETTE:
+            LEGACY_SCRIPT_CASE(FUNC_LOADPALETTE):
                 opcodeSize = 0;
                 LoadPalette(scriptText, scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3], scriptEng.operands[4]);
-                break;
-            case FUNC_ROTATEPALETTE:
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_ROTATEPALETTE):
                 opcodeSize = 0;
                 RotatePalette(scriptEng.operands[0], scriptEng.operands[1], scriptEng.operands[2]);
-                break;
-            case FUNC_SETSCREENFADE:
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_SETSCREENFADE):
                 opcodeSize = 0;
                 SetFade(scriptEng.operands[0], scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]);
-                break;
-            case FUNC_SETACTIVEPALETTE:
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_SETACTIVEPALETTE):
                 opcodeSize = 0;
                 SetActivePalette(scriptEng.operands[0], scriptEng.operands[1], scriptEng.operands[2]);
-                break;
-            case FUNC_SETPALETTEFADE:
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_SETPALETTEFADE):
                 opcodeSize = 0;
                 SetLimitedFade(scriptEng.operands[0], scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3], scriptEng.operands[4],
                                scriptEng.operands[5], scriptEng.operands[6]);
-                break;
-            case FUNC_COPYPALETTE:
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_COPYPALETTE):
                 opcodeSize = 0;
                 CopyPalette(scriptEng.operands[0], scriptEng.operands[1]);
-                break;
-            case FUNC_CLEARSCREEN:
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_CLEARSCREEN):
                 opcodeSize = 0;
                 ClearScreen(scriptEng.operands[0]);
-                break;
-            case FUNC_DRAWSPRITEFX:
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_DRAWSPRITEFX):
                 opcodeSize  = 0;
                 spriteFrame = &scriptFrames[scriptInfo->frameListOffset + scriptEng.operands[0]];
                 switch (scriptEng.operands[1]) {
@@ -3228,8 +3989,8 @@ void RSDK::Legacy::v3::ProcessScript(int32 scriptCodeStart, int32 jumpTableStart
                         }
                         break;
                 }
-                break;
-            case FUNC_DRAWSPRITESCREENFX:
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_DRAWSPRITESCREENFX):
                 opcodeSize  = 0;
                 spriteFrame = &scriptFrames[scriptInfo->frameListOffset + scriptEng.operands[0]];
                 switch (scriptEng.operands[1]) {
@@ -3315,43 +4076,43 @@ void RSDK::Legacy::v3::ProcessScript(int32 scriptCodeStart, int32 jumpTableStart
                         }
                         break;
                 }
-                break;
-            case FUNC_LOADANIMATION:
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_LOADANIMATION):
                 opcodeSize           = 0;
                 scriptInfo->animFile = AddAnimationFile(scriptText);
-                break;
-            case FUNC_SETUPMENU: {
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_SETUPMENU): {
                 opcodeSize     = 0;
                 TextMenu *menu = &gameMenu[scriptEng.operands[0]];
                 SetupTextMenu(menu, scriptEng.operands[1]);
                 menu->selectionCount = scriptEng.operands[2];
                 menu->alignment      = scriptEng.operands[3];
-                break;
+                LEGACY_SCRIPT_NEXT;
             }
-            case FUNC_ADDMENUENTRY: {
+            LEGACY_SCRIPT_CASE(FUNC_ADDMENUENTRY): {
                 opcodeSize                           = 0;
                 TextMenu *menu                       = &gameMenu[scriptEng.operands[0]];
                 menu->entryHighlight[menu->rowCount] = scriptEng.operands[2];
                 AddTextMenuEntry(menu, scriptText);
-                break;
+                LEGACY_SCRIPT_NEXT;
             }
-            case FUNC_EDITMENUENTRY: {
+            LEGACY_SCRIPT_CASE(FUNC_EDITMENUENTRY): {
                 opcodeSize     = 0;
                 TextMenu *menu = &gameMenu[scriptEng.operands[0]];
                 EditTextMenuEntry(menu, scriptText, scriptEng.operands[2]);
                 menu->entryHighlight[scriptEng.operands[2]] = scriptEng.operands[3];
-                break;
+                LEGACY_SCRIPT_NEXT;
             }
-            case FUNC_LOADSTAGE:
+            LEGACY_SCRIPT_CASE(FUNC_LOADSTAGE):
                 opcodeSize = 0;
                 stageMode  = STAGEMODE_LOAD;
-                break;
-            case FUNC_DRAWRECT:
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_DRAWRECT):
                 opcodeSize = 0;
                 DrawRectangle(scriptEng.operands[0], scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3], scriptEng.operands[4],
                               scriptEng.operands[5], scriptEng.operands[6], scriptEng.operands[7]);
-                break;
-            case FUNC_RESETOBJECTENTITY: {
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_RESETOBJECTENTITY): {
                 opcodeSize            = 0;
                 Entity *newEnt        = &objectEntityList[scriptEng.operands[0]];
                 newEnt->type          = scriptEng.operands[1];
@@ -3374,9 +4135,9 @@ void RSDK::Legacy::v3::ProcessScript(int32 scriptCodeStart, int32 jumpTableStart
                 newEnt->values[5]     = 0;
                 newEnt->values[6]     = 0;
                 newEnt->values[7]     = 0;
-                break;
+                LEGACY_SCRIPT_NEXT;
             }
-            case FUNC_PLAYEROBJECTCOLLISION:
+            LEGACY_SCRIPT_CASE(FUNC_PLAYEROBJECTCOLLISION):
                 opcodeSize = 0;
                 switch (scriptEng.operands[0]) {
                     default: break;
@@ -3399,8 +4160,8 @@ void RSDK::Legacy::v3::ProcessScript(int32 scriptCodeStart, int32 jumpTableStart
                                           entity->XPos + (scriptEng.operands[3] << 16), entity->YPos + (scriptEng.operands[4] << 16));
                         break;
                 }
-                break;
-            case FUNC_CREATETEMPOBJECT: {
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_CREATETEMPOBJECT): {
                 opcodeSize = 0;
                 if (objectEntityList[scriptEng.arrayPosition[2]].type > 0 && ++scriptEng.arrayPosition[2] == LEGACY_v3_ENTITY_COUNT)
                     scriptEng.arrayPosition[2] = LEGACY_v3_TEMPENTITY_START;
@@ -3430,18 +4191,18 @@ void RSDK::Legacy::v3::ProcessScript(int32 scriptCodeStart, int32 jumpTableStart
                 temp->values[5]      = 0;
                 temp->values[6]      = 0;
                 temp->values[7]      = 0;
-                break;
+                LEGACY_SCRIPT_NEXT;
             }
-            case FUNC_BINDPLAYERTOOBJECT: {
+            LEGACY_SCRIPT_CASE(FUNC_BINDPLAYERTOOBJECT): {
                 opcodeSize   = 0;
                 Entity *pEnt = &objectEntityList[scriptEng.operands[1]];
 
                 playerList[scriptEng.operands[0]].animationFile = scriptInfo->animFile;
                 playerList[scriptEng.operands[0]].boundEntity   = pEnt;
                 playerList[scriptEng.operands[0]].entityNo      = scriptEng.operands[1];
-                break;
+                LEGACY_SCRIPT_NEXT;
             }
-            case FUNC_PLAYERTILECOLLISION:
+            LEGACY_SCRIPT_CASE(FUNC_PLAYERTILECOLLISION):
                 opcodeSize = 0;
                 if (player->tileCollisions) {
                     ProcessPlayerTileCollisions(player);
@@ -3450,20 +4211,20 @@ void RSDK::Legacy::v3::ProcessScript(int32 scriptCodeStart, int32 jumpTableStart
                     player->XPos += player->XVelocity;
                     player->YPos += player->YVelocity;
                 }
-                break;
-            case FUNC_PROCESSPLAYERCONTROL:
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_PROCESSPLAYERCONTROL):
                 opcodeSize = 0;
                 ProcessPlayerControl(player);
-                break;
-            case FUNC_PROCESSANIMATION:
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_PROCESSANIMATION):
                 ProcessObjectAnimation(scriptInfo, entity);
                 opcodeSize = 0;
-                break;
-            case FUNC_DRAWOBJECTANIMATION:
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_DRAWOBJECTANIMATION):
                 opcodeSize = 0;
                 DrawObjectAnimation(scriptInfo, entity, (entity->XPos >> 16) - xScrollOffset, (entity->YPos >> 16) - yScrollOffset);
-                break;
-            case FUNC_DRAWPLAYERANIMATION:
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_DRAWPLAYERANIMATION):
                 opcodeSize = 0;
                 if (player->visible) {
                     if (currentCamera->target == activePlayer)
@@ -3471,35 +4232,35 @@ void RSDK::Legacy::v3::ProcessScript(int32 scriptCodeStart, int32 jumpTableStart
                     else
                         DrawObjectAnimation(scriptInfo, entity, (player->XPos >> 16) - xScrollOffset, (player->YPos >> 16) - yScrollOffset);
                 }
-                break;
-            case FUNC_SETMUSICTRACK:
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_SETMUSICTRACK):
                 opcodeSize = 0;
                 if (scriptEng.operands[2] <= 1)
                     SetMusicTrack(scriptText, scriptEng.operands[1], scriptEng.operands[2], 0);
                 else
                     SetMusicTrack(scriptText, scriptEng.operands[1], true, scriptEng.operands[2]);
-                break;
-            case FUNC_PLAYMUSIC:
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_PLAYMUSIC):
                 opcodeSize = 0;
                 PlayMusic(scriptEng.operands[0]);
-                break;
-            case FUNC_STOPMUSIC:
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_STOPMUSIC):
                 opcodeSize = 0;
                 StopMusic();
-                break;
-            case FUNC_PLAYSFX:
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_PLAYSFX):
                 opcodeSize = 0;
                 PlaySfx(scriptEng.operands[0], scriptEng.operands[1]);
-                break;
-            case FUNC_STOPSFX:
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_STOPSFX):
                 opcodeSize = 0;
                 StopSfx(scriptEng.operands[0]);
-                break;
-            case FUNC_SETSFXATTRIBUTES:
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_SETSFXATTRIBUTES):
                 opcodeSize = 0;
                 SetSfxAttributes(scriptEng.operands[0], scriptEng.operands[1], scriptEng.operands[2]);
-                break;
-            case FUNC_OBJECTTILECOLLISION:
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_OBJECTTILECOLLISION):
                 opcodeSize = 0;
                 switch (scriptEng.operands[0]) {
                     default: break;
@@ -3508,8 +4269,8 @@ void RSDK::Legacy::v3::ProcessScript(int32 scriptCodeStart, int32 jumpTableStart
                     case CSIDE_RWALL: ObjectRWallCollision(scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]); break;
                     case CSIDE_ROOF: ObjectRoofCollision(scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]); break;
                 }
-                break;
-            case FUNC_OBJECTTILEGRIP:
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_OBJECTTILEGRIP):
                 opcodeSize = 0;
                 switch (scriptEng.operands[0]) {
                     default: break;
@@ -3518,37 +4279,37 @@ void RSDK::Legacy::v3::ProcessScript(int32 scriptCodeStart, int32 jumpTableStart
                     case CSIDE_RWALL: ObjectRWallGrip(scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]); break;
                     case CSIDE_ROOF: ObjectRoofGrip(scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]); break;
                 }
-                break;
-            case FUNC_LOADVIDEO:
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_LOADVIDEO):
                 opcodeSize = 0;
                 StrAdd(scriptText, ".ogv");
                 LoadVideo(scriptText, 0.0, VideoSkipCB);
-                break;
-            case FUNC_NEXTVIDEOFRAME: opcodeSize = 0; break;
-            case FUNC_PLAYSTAGESFX:
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_NEXTVIDEOFRAME): opcodeSize = 0; LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_PLAYSTAGESFX):
                 opcodeSize = 0;
                 PlaySfx(globalSFXCount + scriptEng.operands[0], scriptEng.operands[1]);
-                break;
-            case FUNC_STOPSTAGESFX:
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_STOPSTAGESFX):
                 opcodeSize = 0;
                 StopSfx(globalSFXCount + scriptEng.operands[0]);
-                break;
-            case FUNC_NOT: scriptEng.operands[0] = ~scriptEng.operands[0]; break;
-            case FUNC_DRAW3DSCENE:
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_NOT): scriptEng.operands[0] = ~scriptEng.operands[0]; LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_DRAW3DSCENE):
                 opcodeSize = 0;
                 TransformVertexBuffer();
                 Sort3DDrawList();
                 Draw3DScene(scriptInfo->spriteSheetID);
-                break;
-            case FUNC_SETIDENTITYMATRIX:
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_SETIDENTITYMATRIX):
                 opcodeSize = 0;
                 switch (scriptEng.operands[0]) {
                     case MAT_WORLD: SetIdentityMatrix(&matWorld); break;
                     case MAT_VIEW: SetIdentityMatrix(&matView); break;
                     case MAT_TEMP: SetIdentityMatrix(&matTemp); break;
                 }
-                break;
-            case FUNC_MATRIXMULTIPLY:
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_MATRIXMULTIPLY):
                 opcodeSize = 0;
                 switch (scriptEng.operands[0]) {
                     case MAT_WORLD:
@@ -3573,64 +4334,64 @@ void RSDK::Legacy::v3::ProcessScript(int32 scriptCodeStart, int32 jumpTableStart
                         }
                         break;
                 }
-                break;
-            case FUNC_MATRIXTRANSLATEXYZ:
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_MATRIXTRANSLATEXYZ):
                 opcodeSize = 0;
                 switch (scriptEng.operands[0]) {
                     case MAT_WORLD: MatrixTranslateXYZ(&matWorld, scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]); break;
                     case MAT_VIEW: MatrixTranslateXYZ(&matView, scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]); break;
                     case MAT_TEMP: MatrixTranslateXYZ(&matTemp, scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]); break;
                 }
-                break;
-            case FUNC_MATRIXSCALEXYZ:
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_MATRIXSCALEXYZ):
                 opcodeSize = 0;
                 switch (scriptEng.operands[0]) {
                     case MAT_WORLD: MatrixScaleXYZ(&matWorld, scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]); break;
                     case MAT_VIEW: MatrixScaleXYZ(&matView, scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]); break;
                     case MAT_TEMP: MatrixScaleXYZ(&matTemp, scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]); break;
                 }
-                break;
-            case FUNC_MATRIXROTATEX:
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_MATRIXROTATEX):
                 opcodeSize = 0;
                 switch (scriptEng.operands[0]) {
                     case MAT_WORLD: MatrixRotateX(&matWorld, scriptEng.operands[1]); break;
                     case MAT_VIEW: MatrixRotateX(&matView, scriptEng.operands[1]); break;
                     case MAT_TEMP: MatrixRotateX(&matTemp, scriptEng.operands[1]); break;
                 }
-                break;
-            case FUNC_MATRIXROTATEY:
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_MATRIXROTATEY):
                 opcodeSize = 0;
                 switch (scriptEng.operands[0]) {
                     case MAT_WORLD: MatrixRotateY(&matWorld, scriptEng.operands[1]); break;
                     case MAT_VIEW: MatrixRotateY(&matView, scriptEng.operands[1]); break;
                     case MAT_TEMP: MatrixRotateY(&matTemp, scriptEng.operands[1]); break;
                 }
-                break;
-            case FUNC_MATRIXROTATEZ:
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_MATRIXROTATEZ):
                 opcodeSize = 0;
                 switch (scriptEng.operands[0]) {
                     case MAT_WORLD: MatrixRotateZ(&matWorld, scriptEng.operands[1]); break;
                     case MAT_VIEW: MatrixRotateZ(&matView, scriptEng.operands[1]); break;
                     case MAT_TEMP: MatrixRotateZ(&matTemp, scriptEng.operands[1]); break;
                 }
-                break;
-            case FUNC_MATRIXROTATEXYZ:
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_MATRIXROTATEXYZ):
                 opcodeSize = 0;
                 switch (scriptEng.operands[0]) {
                     case MAT_WORLD: MatrixRotateXYZ(&matWorld, scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]); break;
                     case MAT_VIEW: MatrixRotateXYZ(&matView, scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]); break;
                     case MAT_TEMP: MatrixRotateXYZ(&matTemp, scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]); break;
                 }
-                break;
-            case FUNC_TRANSFORMVERTICES:
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_TRANSFORMVERTICES):
                 opcodeSize = 0;
                 switch (scriptEng.operands[0]) {
                     case MAT_WORLD: TransformVerticies(&matWorld, scriptEng.operands[1], scriptEng.operands[2]); break;
                     case MAT_VIEW: TransformVerticies(&matView, scriptEng.operands[1], scriptEng.operands[2]); break;
                     case MAT_TEMP: TransformVerticies(&matTemp, scriptEng.operands[1], scriptEng.operands[2]); break;
                 }
-                break;
-            case FUNC_CALLFUNCTION: {
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_CALLFUNCTION): {
                 opcodeSize                        = 0;
                 functionStack[functionStackPos++] = scriptCodePtr;
                 functionStack[functionStackPos++] = jumpTableStart;
@@ -3639,18 +4400,18 @@ void RSDK::Legacy::v3::ProcessScript(int32 scriptCodeStart, int32 jumpTableStart
                 jumpTableStart                    = scriptFunctionList[scriptEng.operands[0]].ptr.jumpTablePtr;
                 scriptCodePtr                     = scriptCodeStart;
             } break;
-            case FUNC_ENDFUNCTION:
+            LEGACY_SCRIPT_CASE(FUNC_ENDFUNCTION):
                 opcodeSize      = 0;
                 scriptCodeStart = functionStack[--functionStackPos];
                 jumpTableStart  = functionStack[--functionStackPos];
                 scriptCodePtr   = functionStack[--functionStackPos];
-                break;
-            case FUNC_SETLAYERDEFORMATION:
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_SETLAYERDEFORMATION):
                 opcodeSize = 0;
                 SetLayerDeformation(scriptEng.operands[0], scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3], scriptEng.operands[4],
                                     scriptEng.operands[5]);
-                break;
-            case FUNC_CHECKTOUCHRECT:
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_CHECKTOUCHRECT):
                 opcodeSize            = 0;
                 scriptEng.checkResult = -1;
 
@@ -3665,43 +4426,43 @@ void RSDK::Legacy::v3::ProcessScript(int32 scriptCodeStart, int32 jumpTableStart
                         }
                     }
                 }
-                break;
-            case FUNC_GETTILELAYERENTRY:
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_GETTILELAYERENTRY):
                 scriptEng.operands[0] = stageLayouts[scriptEng.operands[1]].tiles[scriptEng.operands[2] + 0x100 * scriptEng.operands[3]];
-                break;
-            case FUNC_SETTILELAYERENTRY:
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_SETTILELAYERENTRY):
                 stageLayouts[scriptEng.operands[1]].tiles[scriptEng.operands[2] + 0x100 * scriptEng.operands[3]] = scriptEng.operands[0];
-                break;
-            case FUNC_GETBIT: scriptEng.operands[0] = (scriptEng.operands[1] & (1 << scriptEng.operands[2])) >> scriptEng.operands[2]; break;
-            case FUNC_SETBIT:
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_GETBIT): scriptEng.operands[0] = (scriptEng.operands[1] & (1 << scriptEng.operands[2])) >> scriptEng.operands[2]; LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_SETBIT):
                 if (scriptEng.operands[2] <= 0)
                     scriptEng.operands[0] &= ~(1 << scriptEng.operands[1]);
                 else
                     scriptEng.operands[0] |= 1 << scriptEng.operands[1];
-                break;
-            case FUNC_PAUSEMUSIC:
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_PAUSEMUSIC):
                 opcodeSize = 0;
                 PauseSound();
-                break;
-            case FUNC_RESUMEMUSIC:
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_RESUMEMUSIC):
                 opcodeSize = 0;
                 ResumeSound();
-                break;
-            case FUNC_CLEARDRAWLIST:
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_CLEARDRAWLIST):
                 opcodeSize                                      = 0;
                 drawListEntries[scriptEng.operands[0]].listSize = 0;
-                break;
-            case FUNC_ADDDRAWLISTENTITYREF: {
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_ADDDRAWLISTENTITYREF): {
                 opcodeSize                                                                                           = 0;
                 drawListEntries[scriptEng.operands[0]].entityRefs[drawListEntries[scriptEng.operands[0]].listSize++] = scriptEng.operands[1];
-                break;
+                LEGACY_SCRIPT_NEXT;
             }
-            case FUNC_GETDRAWLISTENTITYREF: scriptEng.operands[0] = drawListEntries[scriptEng.operands[1]].entityRefs[scriptEng.operands[2]]; break;
-            case FUNC_SETDRAWLISTENTITYREF:
+            LEGACY_SCRIPT_CASE(FUNC_GETDRAWLISTENTITYREF): scriptEng.operands[0] = drawListEntries[scriptEng.operands[1]].entityRefs[scriptEng.operands[2]]; LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_SETDRAWLISTENTITYREF):
                 opcodeSize                                                               = 0;
                 drawListEntries[scriptEng.operands[1]].entityRefs[scriptEng.operands[2]] = scriptEng.operands[0];
-                break;
-            case FUNC_GET16X16TILEINFO: {
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_GET16X16TILEINFO): {
                 scriptEng.operands[4] = scriptEng.operands[1] >> 7;
                 scriptEng.operands[5] = scriptEng.operands[2] >> 7;
                 scriptEng.operands[6] = stageLayouts[0].tiles[scriptEng.operands[4] + (scriptEng.operands[5] << 8)] << 6;
@@ -3719,13 +4480,13 @@ void RSDK::Legacy::v3::ProcessScript(int32 scriptCodeStart, int32 jumpTableStart
                     case TILEINFO_ANGLEB: scriptEng.operands[0] = collisionMasks[1].angles[index]; break;
                     default: break;
                 }
-                break;
+                LEGACY_SCRIPT_NEXT;
             }
-            case FUNC_COPY16X16TILE:
+            LEGACY_SCRIPT_CASE(FUNC_COPY16X16TILE):
                 opcodeSize = 0;
                 Copy16x16Tile(scriptEng.operands[0], scriptEng.operands[1]);
-                break;
-            case FUNC_SET16X16TILEINFO: {
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_SET16X16TILEINFO): {
                 scriptEng.operands[4] = scriptEng.operands[1] >> 7;
                 scriptEng.operands[5] = scriptEng.operands[2] >> 7;
                 scriptEng.operands[6] = stageLayouts[0].tiles[scriptEng.operands[4] + (scriptEng.operands[5] << 8)] << 6;
@@ -3734,8 +4495,16 @@ void RSDK::Legacy::v3::ProcessScript(int32 scriptCodeStart, int32 jumpTableStart
                     case TILEINFO_INDEX:
                         tiles128x128.tileIndex[scriptEng.operands[6]]  = scriptEng.operands[0];
                         tiles128x128.gfxDataPos[scriptEng.operands[6]] = scriptEng.operands[0] << 8;
+#if RETRO_USE_FAST_3D_FLOOR
+                        floor3DTileOffsetsDirty = true;
+#endif
+                        break;
+                    case TILEINFO_DIRECTION:
+                        tiles128x128.direction[scriptEng.operands[6]] = scriptEng.operands[0];
+#if RETRO_USE_FAST_3D_FLOOR
+                        floor3DTileOffsetsDirty = true;
+#endif
                         break;
-                    case TILEINFO_DIRECTION: tiles128x128.direction[scriptEng.operands[6]] = scriptEng.operands[0]; break;
                     case TILEINFO_VISUALPLANE: tiles128x128.visualPlane[scriptEng.operands[6]] = scriptEng.operands[0]; break;
                     case TILEINFO_SOLIDITYA: tiles128x128.collisionFlags[0][scriptEng.operands[6]] = scriptEng.operands[0]; break;
                     case TILEINFO_SOLIDITYB: tiles128x128.collisionFlags[1][scriptEng.operands[6]] = scriptEng.operands[0]; break;
@@ -3743,9 +4512,9 @@ void RSDK::Legacy::v3::ProcessScript(int32 scriptCodeStart, int32 jumpTableStart
                     case TILEINFO_ANGLEA: collisionMasks[1].angles[tiles128x128.tileIndex[scriptEng.operands[6]]] = scriptEng.operands[0]; break;
                     default: break;
                 }
-                break;
+                LEGACY_SCRIPT_NEXT;
             }
-            case FUNC_GETANIMATIONBYNAME: {
+            LEGACY_SCRIPT_CASE(FUNC_GETANIMATIONBYNAME): {
                 AnimationFile *animFile = scriptInfo->animFile;
                 scriptEng.operands[0]   = -1;
                 int32 id                = 0;
@@ -3756,35 +4525,35 @@ void RSDK::Legacy::v3::ProcessScript(int32 scriptCodeStart, int32 jumpTableStart
                     else if (++id == animFile->animCount)
                         scriptEng.operands[0] = 0;
                 }
-                break;
+                LEGACY_SCRIPT_NEXT;
             }
-            case FUNC_READSAVERAM:
+            LEGACY_SCRIPT_CASE(FUNC_READSAVERAM):
                 opcodeSize            = 0;
                 scriptEng.checkResult = ReadSaveRAM();
-                break;
-            case FUNC_WRITESAVERAM:
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_WRITESAVERAM):
                 opcodeSize            = 0;
                 scriptEng.checkResult = WriteSaveRAM();
-                break;
-            case FUNC_LOADTEXTFONT:
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_LOADTEXTFONT):
                 opcodeSize = 0;
                 LoadFontFile(scriptText);
-                break;
-            case FUNC_LOADTEXTFILE: {
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_LOADTEXTFILE): {
                 opcodeSize     = 0;
                 TextMenu *menu = &gameMenu[scriptEng.operands[0]];
                 LoadTextFile(menu, scriptText, scriptEng.operands[2] != 0);
-                break;
+                LEGACY_SCRIPT_NEXT;
             }
-            case FUNC_DRAWTEXT: {
+            LEGACY_SCRIPT_CASE(FUNC_DRAWTEXT): {
                 opcodeSize        = 0;
                 textMenuSurfaceNo = scriptInfo->spriteSheetID;
                 TextMenu *menu    = &gameMenu[scriptEng.operands[0]];
                 DrawBitmapText(menu, scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3], scriptEng.operands[4],
                                scriptEng.operands[5], scriptEng.operands[6]);
-                break;
+                LEGACY_SCRIPT_NEXT;
             }
-            case FUNC_GETTEXTINFO: {
+            LEGACY_SCRIPT_CASE(FUNC_GETTEXTINFO): {
                 TextMenu *menu = &gameMenu[scriptEng.operands[1]];
                 switch (scriptEng.operands[2]) {
                     case TEXTINFO_TEXTDATA:
@@ -3793,690 +4562,43 @@ void RSDK::Legacy::v3::ProcessScript(int32 scriptCodeStart, int32 jumpTableStart
                     case TEXTINFO_TEXTSIZE: scriptEng.operands[0] = menu->entrySize[scriptEng.operands[3]]; break;
                     case TEXTINFO_ROWCOUNT: scriptEng.operands[0] = menu->rowCount; break;
                 }
-                break;
+                LEGACY_SCRIPT_NEXT;
             }
-            case FUNC_GETVERSIONNUMBER: {
+            LEGACY_SCRIPT_CASE(FUNC_GETVERSIONNUMBER): {
                 opcodeSize                           = 0;
                 TextMenu *menu                       = &gameMenu[scriptEng.operands[0]];
                 menu->entryHighlight[menu->rowCount] = scriptEng.operands[1];
                 AddTextMenuEntry(menu, gameVerInfo.version);
-                break;
+                LEGACY_SCRIPT_NEXT;
             }
-            case FUNC_SETACHIEVEMENT:
+            LEGACY_SCRIPT_CASE(FUNC_SETACHIEVEMENT):
                 opcodeSize = 0;
                 SetAchievement(scriptEng.operands[0], scriptEng.operands[1]);
-                break;
-            case FUNC_SETLEADERBOARD:
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_SETLEADERBOARD):
                 opcodeSize = 0;
                 SetLeaderboard(scriptEng.operands[0], scriptEng.operands[1]);
-                break;
-            case FUNC_LOADONLINEMENU:
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_LOADONLINEMENU):
                 opcodeSize = 0;
                 switch (scriptEng.operands[0]) {
                     default: break;
                     case 0: LoadAchievementsMenu(); break;
                     case 1: LoadLeaderboardsMenu(); break;
                 }
-                break;
-            case FUNC_ENGINECALLBACK:
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_ENGINECALLBACK):
                 opcodeSize = 0;
                 RetroEngineCallback(scriptEng.operands[0]);
-                break;
+                LEGACY_SCRIPT_NEXT;
 #if LEGACY_RETRO_USE_HAPTICS
-            case FUNC_HAPTICEFFECT: opcodeSize = 0; break;
+            LEGACY_SCRIPT_CASE(FUNC_HAPTICEFFECT): opcodeSize = 0; LEGACY_SCRIPT_NEXT;
 #endif
         }
 
         // Set Values
-        if (opcodeSize > 0)
-            scriptCodePtr -= scriptCodePtr - scriptCodeOffset;
-        for (int32 i = 0; i < opcodeSize; ++i) {
-            int32 opcodeType = scriptCode[scriptCodePtr++];
-            if (opcodeType == SCRIPTVAR_VAR) {
-                int32 arrayVal = 0;
-                switch (scriptCode[scriptCodePtr++]) { // variable
-                    case VARARR_NONE: arrayVal = objectLoop; break;
-                    case VARARR_ARRAY:
-                        if (scriptCode[scriptCodePtr++] == 1)
-                            arrayVal = scriptEng.arrayPosition[scriptCode[scriptCodePtr++]];
-                        else
-                            arrayVal = scriptCode[scriptCodePtr++];
-                        break;
-                    case VARARR_ENTNOPLUS1:
-                        if (scriptCode[scriptCodePtr++] == 1)
-                            arrayVal = scriptEng.arrayPosition[scriptCode[scriptCodePtr++]] + objectLoop;
-                        else
-                            arrayVal = scriptCode[scriptCodePtr++] + objectLoop;
-                        break;
-                    case VARARR_ENTNOMINUS1:
-                        if (scriptCode[scriptCodePtr++] == 1)
-                            arrayVal = objectLoop - scriptEng.arrayPosition[scriptCode[scriptCodePtr++]];
-                        else
-                            arrayVal = objectLoop - scriptCode[scriptCodePtr++];
-                        break;
-                    default: break;
-                }
-
-                // Variables
-                switch (scriptCode[scriptCodePtr++]) {
-                    default: break;
-                    case VAR_TEMPVALUE0: scriptEng.tempValue[0] = scriptEng.operands[i]; break;
-                    case VAR_TEMPVALUE1: scriptEng.tempValue[1] = scriptEng.operands[i]; break;
-                    case VAR_TEMPVALUE2: scriptEng.tempValue[2] = scriptEng.operands[i]; break;
-                    case VAR_TEMPVALUE3: scriptEng.tempValue[3] = scriptEng.operands[i]; break;
-                    case VAR_TEMPVALUE4: scriptEng.tempValue[4] = scriptEng.operands[i]; break;
-                    case VAR_TEMPVALUE5: scriptEng.tempValue[5] = scriptEng.operands[i]; break;
-                    case VAR_TEMPVALUE6: scriptEng.tempValue[6] = scriptEng.operands[i]; break;
-                    case VAR_TEMPVALUE7: scriptEng.tempValue[7] = scriptEng.operands[i]; break;
-                    case VAR_CHECKRESULT: scriptEng.checkResult = scriptEng.operands[i]; break;
-                    case VAR_ARRAYPOS0: scriptEng.arrayPosition[0] = scriptEng.operands[i]; break;
-                    case VAR_ARRAYPOS1: scriptEng.arrayPosition[1] = scriptEng.operands[i]; break;
-                    case VAR_GLOBAL: globalVariables[arrayVal].value = scriptEng.operands[i]; break;
-                    case VAR_OBJECTENTITYNO: break;
-                    case VAR_OBJECTTYPE: {
-                        objectEntityList[arrayVal].type = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTPROPERTYVALUE: {
-                        objectEntityList[arrayVal].propertyValue = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTXPOS: {
-                        objectEntityList[arrayVal].XPos = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTYPOS: {
-                        objectEntityList[arrayVal].YPos = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTIXPOS: {
-                        objectEntityList[arrayVal].XPos = scriptEng.operands[i] << 16;
-                        break;
-                    }
-                    case VAR_OBJECTIYPOS: {
-                        objectEntityList[arrayVal].YPos = scriptEng.operands[i] << 16;
-                        break;
-                    }
-                    case VAR_OBJECTSTATE: {
-                        objectEntityList[arrayVal].state = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTROTATION: {
-                        objectEntityList[arrayVal].rotation = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTSCALE: {
-                        objectEntityList[arrayVal].scale = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTPRIORITY: {
-                        objectEntityList[arrayVal].priority = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTDRAWORDER: {
-                        objectEntityList[arrayVal].drawOrder = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTDIRECTION: {
-                        objectEntityList[arrayVal].direction = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTINKEFFECT: {
-                        objectEntityList[arrayVal].inkEffect = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTALPHA: {
-                        objectEntityList[arrayVal].alpha = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTFRAME: {
-                        objectEntityList[arrayVal].frame = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTANIMATION: {
-                        objectEntityList[arrayVal].animation = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTPREVANIMATION: {
-                        objectEntityList[arrayVal].prevAnimation = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTANIMATIONSPEED: {
-                        objectEntityList[arrayVal].animationSpeed = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTANIMATIONTIMER: {
-                        objectEntityList[arrayVal].animationTimer = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTVALUE0: {
-                        objectEntityList[arrayVal].values[0] = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTVALUE1: {
-                        objectEntityList[arrayVal].values[1] = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTVALUE2: {
-                        objectEntityList[arrayVal].values[2] = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTVALUE3: {
-                        objectEntityList[arrayVal].values[3] = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTVALUE4: {
-                        objectEntityList[arrayVal].values[4] = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTVALUE5: {
-                        objectEntityList[arrayVal].values[5] = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTVALUE6: {
-                        objectEntityList[arrayVal].values[6] = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTVALUE7: {
-                        objectEntityList[arrayVal].values[7] = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTOUTOFBOUNDS: break;
-                    case VAR_PLAYERSTATE: {
-                        playerList[activePlayer].boundEntity->state = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_PLAYERCONTROLMODE: {
-                        playerList[activePlayer].controlMode = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_PLAYERCONTROLLOCK: {
-                        playerList[activePlayer].controlLock = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_PLAYERCOLLISIONMODE: {
-                        playerList[activePlayer].collisionMode = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_PLAYERCOLLISIONPLANE: {
-                        playerList[activePlayer].collisionPlane = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_PLAYERXPOS: {
-                        playerList[activePlayer].XPos = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_PLAYERYPOS: {
-                        playerList[activePlayer].YPos = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_PLAYERIXPOS: {
-                        playerList[activePlayer].XPos = scriptEng.operands[i] << 16;
-                        break;
-                    }
-                    case VAR_PLAYERIYPOS: {
-                        playerList[activePlayer].YPos = scriptEng.operands[i] << 16;
-                        break;
-                    }
-                    case VAR_PLAYERSCREENXPOS: {
-                        playerList[activePlayer].screenXPos = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_PLAYERSCREENYPOS: {
-                        playerList[activePlayer].screenYPos = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_PLAYERSPEED: {
-                        playerList[activePlayer].speed = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_PLAYERXVELOCITY: {
-                        playerList[activePlayer].XVelocity = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_PLAYERYVELOCITY: {
-                        playerList[activePlayer].YVelocity = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_PLAYERGRAVITY: {
-                        playerList[activePlayer].gravity = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_PLAYERANGLE: {
-                        playerList[activePlayer].angle = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_PLAYERSKIDDING: {
-                        playerList[activePlayer].skidding = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_PLAYERPUSHING: {
-                        playerList[activePlayer].pushing = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_PLAYERTRACKSCROLL: {
-                        playerList[activePlayer].trackScroll = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_PLAYERUP: {
-                        playerList[activePlayer].up = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_PLAYERDOWN: {
-                        playerList[activePlayer].down = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_PLAYERLEFT: {
-                        playerList[activePlayer].left = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_PLAYERRIGHT: {
-                        playerList[activePlayer].right = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_PLAYERJUMPPRESS: {
-                        playerList[activePlayer].jumpPress = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_PLAYERJUMPHOLD: {
-                        playerList[activePlayer].jumpHold = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_PLAYERFOLLOWPLAYER1: {
-                        playerList[activePlayer].followPlayer1 = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_PLAYERLOOKPOS: {
-                        playerList[activePlayer].lookPos = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_PLAYERWATER: {
-                        playerList[activePlayer].water = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_PLAYERTOPSPEED: {
-                        playerList[activePlayer].topSpeed = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_PLAYERACCELERATION: {
-                        playerList[activePlayer].acceleration = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_PLAYERDECELERATION: {
-                        playerList[activePlayer].deceleration = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_PLAYERAIRACCELERATION: {
-                        playerList[activePlayer].airAcceleration = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_PLAYERAIRDECELERATION: {
-                        playerList[activePlayer].airDeceleration = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_PLAYERGRAVITYSTRENGTH: {
-                        playerList[activePlayer].gravityStrength = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_PLAYERJUMPSTRENGTH: {
-                        playerList[activePlayer].jumpStrength = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_PLAYERJUMPCAP: {
-                        playerList[activePlayer].jumpCap = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_PLAYERROLLINGACCELERATION: {
-                        scriptEng.operands[i] = playerList[activePlayer].rollingAcceleration = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_PLAYERROLLINGDECELERATION: {
-                        scriptEng.operands[i] = playerList[activePlayer].rollingDeceleration = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_PLAYERENTITYNO: break;
-                    case VAR_PLAYERCOLLISIONLEFT: break;
-                    case VAR_PLAYERCOLLISIONTOP: break;
-                    case VAR_PLAYERCOLLISIONRIGHT: break;
-                    case VAR_PLAYERCOLLISIONBOTTOM: break;
-                    case VAR_PLAYERFLAILING: {
-                        scriptEng.operands[i] = playerList[activePlayer].flailing[arrayVal] = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_PLAYERTIMER: {
-                        playerList[activePlayer].timer = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_PLAYERTILECOLLISIONS: {
-                        playerList[activePlayer].tileCollisions = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_PLAYEROBJECTINTERACTION: {
-                        scriptEng.operands[i] = playerList[activePlayer].objectInteractions = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_PLAYERVISIBLE: {
-                        playerList[activePlayer].visible = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_PLAYERROTATION: {
-                        scriptEng.operands[i] = playerList[activePlayer].boundEntity->rotation = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_PLAYERSCALE: {
-                        playerList[activePlayer].boundEntity->scale = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_PLAYERPRIORITY: {
-                        scriptEng.operands[i] = playerList[activePlayer].boundEntity->priority = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_PLAYERDRAWORDER: {
-                        scriptEng.operands[i] = playerList[activePlayer].boundEntity->drawOrder = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_PLAYERDIRECTION: {
-                        scriptEng.operands[i] = playerList[activePlayer].boundEntity->direction = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_PLAYERINKEFFECT: {
-                        scriptEng.operands[i] = playerList[activePlayer].boundEntity->inkEffect = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_PLAYERALPHA: {
-                        playerList[activePlayer].boundEntity->alpha = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_PLAYERFRAME: {
-                        playerList[activePlayer].boundEntity->frame = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_PLAYERANIMATION: {
-                        scriptEng.operands[i] = playerList[activePlayer].boundEntity->animation = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_PLAYERPREVANIMATION: {
-                        scriptEng.operands[i] = playerList[activePlayer].boundEntity->prevAnimation = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_PLAYERANIMATIONSPEED: {
-                        scriptEng.operands[i] = playerList[activePlayer].boundEntity->animationSpeed = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_PLAYERANIMATIONTIMER: {
-                        scriptEng.operands[i] = playerList[activePlayer].boundEntity->animationTimer = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_PLAYERVALUE0: {
-                        scriptEng.operands[i] = playerList[activePlayer].boundEntity->values[0] = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_PLAYERVALUE1: {
-                        scriptEng.operands[i] = playerList[activePlayer].boundEntity->values[1] = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_PLAYERVALUE2: {
-                        scriptEng.operands[i] = playerList[activePlayer].boundEntity->values[2] = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_PLAYERVALUE3: {
-                        scriptEng.operands[i] = playerList[activePlayer].boundEntity->values[3] = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_PLAYERVALUE4: {
-                        scriptEng.operands[i] = playerList[activePlayer].boundEntity->values[4] = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_PLAYERVALUE5: {
-                        scriptEng.operands[i] = playerList[activePlayer].boundEntity->values[5] = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_PLAYERVALUE6: {
-                        scriptEng.operands[i] = playerList[activePlayer].boundEntity->values[6] = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_PLAYERVALUE7: {
-                        scriptEng.operands[i] = playerList[activePlayer].boundEntity->values[7] = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_PLAYERVALUE8: {
-                        playerList[activePlayer].values[0] = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_PLAYERVALUE9: {
-                        playerList[activePlayer].values[1] = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_PLAYERVALUE10: {
-                        playerList[activePlayer].values[2] = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_PLAYERVALUE11: {
-                        playerList[activePlayer].values[3] = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_PLAYERVALUE12: {
-                        playerList[activePlayer].values[4] = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_PLAYERVALUE13: {
-                        playerList[activePlayer].values[5] = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_PLAYERVALUE14: {
-                        playerList[activePlayer].values[6] = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_PLAYERVALUE15: {
-                        playerList[activePlayer].values[7] = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_PLAYEROUTOFBOUNDS: break;
-                    case VAR_STAGESTATE: stageMode = scriptEng.operands[i]; break;
-                    case VAR_STAGEACTIVELIST: {
-                        int32 listSlots[] = { 0, 1, 3, 2 };
-
-                        int32 listID = scriptEng.operands[i];
-                        if (listID <= 3)
-                            listID = listSlots[listID];
-                        else
-                            listID = 2; // BONUS_STAGE
-
-                        if (listID < sceneInfo.categoryCount) {
-                            int32 listPos = sceneInfo.listPos - sceneInfo.listCategory[sceneInfo.activeCategory].sceneOffsetStart;
-
-                            sceneInfo.activeCategory = listID;
-                            SceneListInfo *list      = &sceneInfo.listCategory[sceneInfo.activeCategory];
-
-                            sceneInfo.listPos = list->sceneOffsetStart + listPos;
-                            if (sceneInfo.listPos >= list->sceneOffsetEnd)
-                                sceneInfo.listPos = list->sceneOffsetEnd;
-                        }
-                        break;
-                    }
-                    case VAR_STAGELISTPOS: {
-                        SceneListInfo *list = &sceneInfo.listCategory[sceneInfo.activeCategory];
-
-                        if (list->sceneOffsetStart + scriptEng.operands[i] < list->sceneOffsetEnd)
-                            sceneInfo.listPos = list->sceneOffsetStart + scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_STAGETIMEENABLED: timeEnabled = scriptEng.operands[i]; break;
-                    case VAR_STAGEMILLISECONDS: stageMilliseconds = scriptEng.operands[i]; break;
-                    case VAR_STAGESECONDS: stageSeconds = scriptEng.operands[i]; break;
-                    case VAR_STAGEMINUTES: stageMinutes = scriptEng.operands[i]; break;
-                    case VAR_STAGEACTNO: actID = scriptEng.operands[i]; break;
-                    case VAR_STAGEPAUSEENABLED: pauseEnabled = scriptEng.operands[i]; break;
-                    case VAR_STAGELISTSIZE: break;
-                    case VAR_STAGENEWXBOUNDARY1: newXBoundary1 = scriptEng.operands[i]; break;
-                    case VAR_STAGENEWXBOUNDARY2: newXBoundary2 = scriptEng.operands[i]; break;
-                    case VAR_STAGENEWYBOUNDARY1: newYBoundary1 = scriptEng.operands[i]; break;
-                    case VAR_STAGENEWYBOUNDARY2: newYBoundary2 = scriptEng.operands[i]; break;
-                    case VAR_STAGEXBOUNDARY1:
-                        if (curXBoundary1 != scriptEng.operands[i]) {
-                            curXBoundary1 = scriptEng.operands[i];
-                            newXBoundary1 = scriptEng.operands[i];
-                        }
-                        break;
-                    case VAR_STAGEXBOUNDARY2:
-                        if (curXBoundary2 != scriptEng.operands[i]) {
-                            curXBoundary2 = scriptEng.operands[i];
-                            newXBoundary2 = scriptEng.operands[i];
-                        }
-                        break;
-                    case VAR_STAGEYBOUNDARY1:
-                        if (curYBoundary1 != scriptEng.operands[i]) {
-                            curYBoundary1 = scriptEng.operands[i];
-                            newYBoundary1 = scriptEng.operands[i];
-                        }
-                        break;
-                    case VAR_STAGEYBOUNDARY2:
-                        if (curYBoundary2 != scriptEng.operands[i]) {
-                            curYBoundary2 = scriptEng.operands[i];
-                            newYBoundary2 = scriptEng.operands[i];
-                        }
-                        break;
-                    case VAR_STAGEDEFORMATIONDATA0: bgDeformationData0[arrayVal] = scriptEng.operands[i]; break;
-                    case VAR_STAGEDEFORMATIONDATA1: bgDeformationData1[arrayVal] = scriptEng.operands[i]; break;
-                    case VAR_STAGEDEFORMATIONDATA2: bgDeformationData2[arrayVal] = scriptEng.operands[i]; break;
-                    case VAR_STAGEDEFORMATIONDATA3: bgDeformationData3[arrayVal] = scriptEng.operands[i]; break;
-                    case VAR_STAGEWATERLEVEL: waterLevel = scriptEng.operands[i]; break;
-                    case VAR_STAGEACTIVELAYER: activeTileLayers[arrayVal] = scriptEng.operands[i]; break;
-                    case VAR_STAGEMIDPOINT: tLayerMidPoint = scriptEng.operands[i]; break;
-                    case VAR_STAGEPLAYERLISTPOS: playerListPos = scriptEng.operands[i]; break;
-                    case VAR_STAGEACTIVEPLAYER: activePlayer = scriptEng.operands[i]; break;
-                    case VAR_SCREENCAMERAENABLED: currentCamera->enabled = scriptEng.operands[i]; break;
-                    case VAR_SCREENCAMERATARGET: currentCamera->target = scriptEng.operands[i]; break;
-                    case VAR_SCREENCAMERASTYLE: currentCamera->style = scriptEng.operands[i]; break;
-                    case VAR_SCREENDRAWLISTSIZE: drawListEntries[arrayVal].listSize = scriptEng.operands[i]; break;
-                    case VAR_SCREENCENTERX: break;
-                    case VAR_SCREENCENTERY: break;
-                    case VAR_SCREENXSIZE: break;
-                    case VAR_SCREENYSIZE: break;
-                    case VAR_SCREENXOFFSET:
-                        xScrollOffset = scriptEng.operands[i];
-                        xScrollA      = xScrollOffset;
-                        xScrollB      = SCREEN_XSIZE + xScrollOffset;
-                        break;
-                    case VAR_SCREENYOFFSET:
-                        yScrollOffset = scriptEng.operands[i];
-                        yScrollA      = yScrollOffset;
-                        yScrollB      = SCREEN_YSIZE + yScrollOffset;
-                        break;
-                    case VAR_SCREENSHAKEX: cameraShakeX = scriptEng.operands[i]; break;
-                    case VAR_SCREENSHAKEY: cameraShakeY = scriptEng.operands[i]; break;
-                    case VAR_SCREENADJUSTCAMERAY: currentCamera->adjustY = scriptEng.operands[i]; break;
-                    case VAR_TOUCHSCREENDOWN: break;
-                    case VAR_TOUCHSCREENXPOS: break;
-                    case VAR_TOUCHSCREENYPOS: break;
-                    case VAR_MUSICVOLUME: SetMusicVolume(scriptEng.operands[i]); break;
-                    case VAR_MUSICCURRENTTRACK: break;
-                    case VAR_KEYDOWNUP: controller[arrayVal].keyUp.down = scriptEng.operands[i]; break;
-                    case VAR_KEYDOWNDOWN: controller[arrayVal].keyDown.down = scriptEng.operands[i]; break;
-                    case VAR_KEYDOWNLEFT: controller[arrayVal].keyLeft.down = scriptEng.operands[i]; break;
-                    case VAR_KEYDOWNRIGHT: controller[arrayVal].keyRight.down = scriptEng.operands[i]; break;
-                    case VAR_KEYDOWNBUTTONA: controller[arrayVal].keyA.down = scriptEng.operands[i]; break;
-                    case VAR_KEYDOWNBUTTONB: controller[arrayVal].keyB.down = scriptEng.operands[i]; break;
-                    case VAR_KEYDOWNBUTTONC: controller[arrayVal].keyC.down = scriptEng.operands[i]; break;
-                    case VAR_KEYDOWNSTART: controller[arrayVal].keyStart.down = scriptEng.operands[i]; break;
-                    case VAR_KEYPRESSUP: controller[arrayVal].keyUp.press = scriptEng.operands[i]; break;
-                    case VAR_KEYPRESSDOWN: controller[arrayVal].keyDown.press = scriptEng.operands[i]; break;
-                    case VAR_KEYPRESSLEFT: controller[arrayVal].keyLeft.press = scriptEng.operands[i]; break;
-                    case VAR_KEYPRESSRIGHT: controller[arrayVal].keyRight.press = scriptEng.operands[i]; break;
-                    case VAR_KEYPRESSBUTTONA: controller[arrayVal].keyA.press = scriptEng.operands[i]; break;
-                    case VAR_KEYPRESSBUTTONB: controller[arrayVal].keyB.press = scriptEng.operands[i]; break;
-                    case VAR_KEYPRESSBUTTONC: controller[arrayVal].keyC.press = scriptEng.operands[i]; break;
-                    case VAR_KEYPRESSSTART: controller[arrayVal].keyStart.press = scriptEng.operands[i]; break;
-                    case VAR_MENU1SELECTION: gameMenu[0].selection1 = scriptEng.operands[i]; break;
-                    case VAR_MENU2SELECTION: gameMenu[1].selection1 = scriptEng.operands[i]; break;
-                    case VAR_TILELAYERXSIZE: stageLayouts[arrayVal].xsize = scriptEng.operands[i]; break;
-                    case VAR_TILELAYERYSIZE: stageLayouts[arrayVal].ysize = scriptEng.operands[i]; break;
-                    case VAR_TILELAYERTYPE: stageLayouts[arrayVal].type = scriptEng.operands[i]; break;
-                    case VAR_TILELAYERANGLE:
-                        stageLayouts[arrayVal].angle = scriptEng.operands[i];
-                        if (stageLayouts[arrayVal].angle < 0)
-                            stageLayouts[arrayVal].angle += 0x200;
-                        stageLayouts[arrayVal].angle &= 0x1FF;
-                        break;
-                    case VAR_TILELAYERXPOS: stageLayouts[arrayVal].xpos = scriptEng.operands[i]; break;
-                    case VAR_TILELAYERYPOS: stageLayouts[arrayVal].ypos = scriptEng.operands[i]; break;
-                    case VAR_TILELAYERZPOS: stageLayouts[arrayVal].zpos = scriptEng.operands[i]; break;
-                    case VAR_TILELAYERPARALLAXFACTOR: stageLayouts[arrayVal].parallaxFactor = scriptEng.operands[i]; break;
-                    case VAR_TILELAYERSCROLLSPEED: stageLayouts[arrayVal].scrollSpeed = scriptEng.operands[i]; break;
-                    case VAR_TILELAYERSCROLLPOS: stageLayouts[arrayVal].scrollPos = scriptEng.operands[i]; break;
-                    case VAR_TILELAYERDEFORMATIONOFFSET:
-                        stageLayouts[arrayVal].deformationOffset = scriptEng.operands[i];
-                        stageLayouts[arrayVal].deformationOffset &= 0xFFu;
-                        break;
-                    case VAR_TILELAYERDEFORMATIONOFFSETW:
-                        stageLayouts[arrayVal].deformationOffsetW = scriptEng.operands[i];
-                        stageLayouts[arrayVal].deformationOffsetW &= 0xFFu;
-                        break;
-                    case VAR_HPARALLAXPARALLAXFACTOR: hParallax.parallaxFactor[arrayVal] = scriptEng.operands[i]; break;
-                    case VAR_HPARALLAXSCROLLSPEED: hParallax.scrollSpeed[arrayVal] = scriptEng.operands[i]; break;
-                    case VAR_HPARALLAXSCROLLPOS: hParallax.scrollPos[arrayVal] = scriptEng.operands[i]; break;
-                    case VAR_VPARALLAXPARALLAXFACTOR: vParallax.parallaxFactor[arrayVal] = scriptEng.operands[i]; break;
-                    case VAR_VPARALLAXSCROLLSPEED: vParallax.scrollSpeed[arrayVal] = scriptEng.operands[i]; break;
-                    case VAR_VPARALLAXSCROLLPOS: vParallax.scrollPos[arrayVal] = scriptEng.operands[i]; break;
-                    case VAR_3DSCENENOVERTICES: vertexCount = scriptEng.operands[i]; break;
-                    case VAR_3DSCENENOFACES: faceCount = scriptEng.operands[i]; break;
-                    case VAR_VERTEXBUFFERX: vertexBuffer[arrayVal].x = scriptEng.operands[i]; break;
-                    case VAR_VERTEXBUFFERY: vertexBuffer[arrayVal].y = scriptEng.operands[i]; break;
-                    case VAR_VERTEXBUFFERZ: vertexBuffer[arrayVal].z = scriptEng.operands[i]; break;
-                    case VAR_VERTEXBUFFERU: vertexBuffer[arrayVal].u = scriptEng.operands[i]; break;
-                    case VAR_VERTEXBUFFERV: vertexBuffer[arrayVal].v = scriptEng.operands[i]; break;
-                    case VAR_FACEBUFFERA: faceBuffer[arrayVal].a = scriptEng.operands[i]; break;
-                    case VAR_FACEBUFFERB: faceBuffer[arrayVal].b = scriptEng.operands[i]; break;
-                    case VAR_FACEBUFFERC: faceBuffer[arrayVal].c = scriptEng.operands[i]; break;
-                    case VAR_FACEBUFFERD: faceBuffer[arrayVal].d = scriptEng.operands[i]; break;
-                    case VAR_FACEBUFFERFLAG: faceBuffer[arrayVal].flag = scriptEng.operands[i]; break;
-                    case VAR_FACEBUFFERCOLOR: faceBuffer[arrayVal].color = scriptEng.operands[i]; break;
-                    case VAR_3DSCENEPROJECTIONX: projectionX = scriptEng.operands[i]; break;
-                    case VAR_3DSCENEPROJECTIONY: projectionY = scriptEng.operands[i]; break;
-                    case VAR_ENGINESTATE: gameMode = scriptEng.operands[i]; break;
-                    case VAR_STAGEDEBUGMODE: debugMode = scriptEng.operands[i]; break;
-                    case VAR_ENGINEMESSAGE: break;
-                    case VAR_SAVERAM: saveRAM[arrayVal] = scriptEng.operands[i]; break;
-                    case VAR_ENGINELANGUAGE: language = scriptEng.operands[i]; break;
-                    case VAR_OBJECTSPRITESHEET: {
-                        objectScriptList[objectEntityList[arrayVal].type].spriteSheetID = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_ENGINEONLINEACTIVE: break;
-                    case VAR_ENGINEFRAMESKIPTIMER: break;
-                    case VAR_ENGINEFRAMESKIPSETTING: break;
-                    case VAR_ENGINESFXVOLUME:
-                        sfxVolume = scriptEng.operands[i];
-                        // SetGameVolumes(bgmVolume, sfxVolume);
-                        break;
-                    case VAR_ENGINEBGMVOLUME:
-                        bgmVolume = scriptEng.operands[i];
-                        // SetGameVolumes(bgmVolume, sfxVolume);
-                        break;
-                    case VAR_ENGINEPLATFORMID: break;
-                    case VAR_ENGINETRIALMODE: break;
-                    case VAR_KEYPRESSANYSTART: break;
-#if LEGACY_RETRO_USE_HAPTICS
-                    case VAR_ENGINEHAPTICSENABLED: hapticsEnabled = scriptEng.operands[i]; break;
-#endif
-                }
-            }
-            else if (opcodeType == SCRIPTVAR_INTCONST) { // int32 constant
-                scriptCodePtr++;
-            }
-            else if (opcodeType == SCRIPTVAR_STRCONST) { // string constant
-                int32 strLen = scriptCode[scriptCodePtr++];
-                for (int32 c = 0; c < strLen; ++c) {
-                    switch (c % 4) {
-                        case 0: break;
-                        case 1: break;
-                        case 2: break;
-                        case 3: ++scriptCodePtr; break;
-                        default: break;
-                    }
-                }
-                scriptCodePtr++;
-            }
-        }
+        WriteScriptOperands(&opcodeState, scriptCodePtr);
     }
 }
+
+#undef LEGACY_SCRIPT_NEXT
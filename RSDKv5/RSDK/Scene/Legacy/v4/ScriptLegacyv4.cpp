@@ -1,4 +1,14 @@
+#if LEGACY_RETRO_USE_COMPILER && RETRO_USE_SCRIPT_CACHE
+#include <filesystem>
 
+#if RETRO_PLATFORM == RETRO_ANDROID
+namespace fs = std::__fs::filesystem;
+#else
+namespace fs = std::filesystem;
+#endif
+#endif
+
+#include "ScriptLegacyv4Opcodes.hpp"
 
 RSDK::Legacy::v4::ObjectScript RSDK::Legacy::v4::objectScriptList[LEGACY_v4_OBJECT_COUNT];
 RSDK::Legacy::v4::ScriptFunction RSDK::Legacy::v4::scriptFunctionList[LEGACY_v4_FUNCTION_COUNT];
@@ -23,6 +33,14 @@ int32 RSDK::Legacy::v4::foreachStackPos   = 0;
 RSDK::Legacy::v4::ScriptEngine RSDK::Legacy::v4::scriptEng = ScriptEngine();
 char RSDK::Legacy::v4::scriptText[0x4000];
 
+#if RETRO_USE_PREDECODED_SCRIPTS
+RSDK::Legacy::v4::ScriptInstruction RSDK::Legacy::v4::scriptInstructionList[LEGACY_v4_SCRIPTCODE_COUNT];
+RSDK::Legacy::v4::ScriptOperand RSDK::Legacy::v4::scriptOperandList[LEGACY_v4_OPERAND_COUNT];
+int32 RSDK::Legacy::v4::scriptOperandPos = 0;
+char RSDK::Legacy::v4::scriptStringList[LEGACY_v4_STRING_COUNT];
+int32 RSDK::Legacy::v4::scriptStringPos = 0;
+#endif
+
 #if LEGACY_RETRO_USE_COMPILER
 #if RETRO_USE_ORIGINAL_CODE
 
@@ -711,424 +729,119 @@ enum ScriptParseModes {
 };
 #endif
 
-enum ScriptVarTypes { SCRIPTVAR_VAR = 1, SCRIPTVAR_INTCONST = 2, SCRIPTVAR_STRCONST = 3 };
-enum ScriptVarArrTypes { VARARR_NONE = 0, VARARR_ARRAY = 1, VARARR_ENTNOPLUS1 = 2, VARARR_ENTNOMINUS1 = 3 };
-
-enum ScrVar {
-    VAR_TEMP0,
-    VAR_TEMP1,
-    VAR_TEMP2,
-    VAR_TEMP3,
-    VAR_TEMP4,
-    VAR_TEMP5,
-    VAR_TEMP6,
-    VAR_TEMP7,
-    VAR_CHECKRESULT,
-    VAR_ARRAYPOS0,
-    VAR_ARRAYPOS1,
-    VAR_ARRAYPOS2,
-    VAR_ARRAYPOS3,
-    VAR_ARRAYPOS4,
-    VAR_ARRAYPOS5,
-    VAR_ARRAYPOS6,
-    VAR_ARRAYPOS7,
-    VAR_GLOBAL,
-    VAR_LOCAL,
-    VAR_OBJECTENTITYPOS,
-    VAR_OBJECTGROUPID,
-    VAR_OBJECTTYPE,
-    VAR_OBJECTPROPERTYVALUE,
-    VAR_OBJECTXPOS,
-    VAR_OBJECTYPOS,
-    VAR_OBJECTIXPOS,
-    VAR_OBJECTIYPOS,
-    VAR_OBJECTXVEL,
-    VAR_OBJECTYVEL,
-    VAR_OBJECTSPEED,
-    VAR_OBJECTSTATE,
-    VAR_OBJECTROTATION,
-    VAR_OBJECTSCALE,
-    VAR_OBJECTPRIORITY,
-    VAR_OBJECTDRAWORDER,
-    VAR_OBJECTDIRECTION,
-    VAR_OBJECTINKEFFECT,
-    VAR_OBJECTALPHA,
-    VAR_OBJECTFRAME,
-    VAR_OBJECTANIMATION,
-    VAR_OBJECTPREVANIMATION,
-    VAR_OBJECTANIMATIONSPEED,
-    VAR_OBJECTANIMATIONTIMER,
-    VAR_OBJECTANGLE,
-    VAR_OBJECTLOOKPOSX,
-    VAR_OBJECTLOOKPOSY,
-    VAR_OBJECTCOLLISIONMODE,
-    VAR_OBJECTCOLLISIONPLANE,
-    VAR_OBJECTCONTROLMODE,
-    VAR_OBJECTCONTROLLOCK,
-    VAR_OBJECTPUSHING,
-    VAR_OBJECTVISIBLE,
-    VAR_OBJECTTILECOLLISIONS,
-    VAR_OBJECTINTERACTION,
-    VAR_OBJECTGRAVITY,
-    VAR_OBJECTUP,
-    VAR_OBJECTDOWN,
-    VAR_OBJECTLEFT,
-    VAR_OBJECTRIGHT,
-    VAR_OBJECTJUMPPRESS,
-    VAR_OBJECTJUMPHOLD,
-    VAR_OBJECTSCROLLTRACKING,
-    VAR_OBJECTFLOORSENSORL,
-    VAR_OBJECTFLOORSENSORC,
-    VAR_OBJECTFLOORSENSORR,
-    VAR_OBJECTFLOORSENSORLC,
-    VAR_OBJECTFLOORSENSORRC,
-    VAR_OBJECTCOLLISIONLEFT,
-    VAR_OBJECTCOLLISIONTOP,
-    VAR_OBJECTCOLLISIONRIGHT,
-    VAR_OBJECTCOLLISIONBOTTOM,
-    VAR_OBJECTOUTOFBOUNDS,
-    VAR_OBJECTSPRITESHEET,
-    VAR_OBJECTVALUE0,
-    VAR_OBJECTVALUE1,
-    VAR_OBJECTVALUE2,
-    VAR_OBJECTVALUE3,
-    VAR_OBJECTVALUE4,
-    VAR_OBJECTVALUE5,
-    VAR_OBJECTVALUE6,
-    VAR_OBJECTVALUE7,
-    VAR_OBJECTVALUE8,
-    VAR_OBJECTVALUE9,
-    VAR_OBJECTVALUE10,
-    VAR_OBJECTVALUE11,
-    VAR_OBJECTVALUE12,
-    VAR_OBJECTVALUE13,
-    VAR_OBJECTVALUE14,
-    VAR_OBJECTVALUE15,
-    VAR_OBJECTVALUE16,
-    VAR_OBJECTVALUE17,
-    VAR_OBJECTVALUE18,
-    VAR_OBJECTVALUE19,
-    VAR_OBJECTVALUE20,
-    VAR_OBJECTVALUE21,
-    VAR_OBJECTVALUE22,
-    VAR_OBJECTVALUE23,
-    VAR_OBJECTVALUE24,
-    VAR_OBJECTVALUE25,
-    VAR_OBJECTVALUE26,
-    VAR_OBJECTVALUE27,
-    VAR_OBJECTVALUE28,
-    VAR_OBJECTVALUE29,
-    VAR_OBJECTVALUE30,
-    VAR_OBJECTVALUE31,
-    VAR_OBJECTVALUE32,
-    VAR_OBJECTVALUE33,
-    VAR_OBJECTVALUE34,
-    VAR_OBJECTVALUE35,
-    VAR_OBJECTVALUE36,
-    VAR_OBJECTVALUE37,
-    VAR_OBJECTVALUE38,
-    VAR_OBJECTVALUE39,
-    VAR_OBJECTVALUE40,
-    VAR_OBJECTVALUE41,
-    VAR_OBJECTVALUE42,
-    VAR_OBJECTVALUE43,
-    VAR_OBJECTVALUE44,
-    VAR_OBJECTVALUE45,
-    VAR_OBJECTVALUE46,
-    VAR_OBJECTVALUE47,
-    VAR_STAGESTATE,
-    VAR_STAGEACTIVELIST,
-    VAR_STAGELISTPOS,
-    VAR_STAGETIMEENABLED,
-    VAR_STAGEMILLISECONDS,
-    VAR_STAGESECONDS,
-    VAR_STAGEMINUTES,
-    VAR_STAGEACTNUM,
-    VAR_STAGEPAUSEENABLED,
-    VAR_STAGELISTSIZE,
-    VAR_STAGENEWXBOUNDARY1,
-    VAR_STAGENEWXBOUNDARY2,
-    VAR_STAGENEWYBOUNDARY1,
-    VAR_STAGENEWYBOUNDARY2,
-    VAR_STAGECURXBOUNDARY1,
-    VAR_STAGECURXBOUNDARY2,
-    VAR_STAGECURYBOUNDARY1,
-    VAR_STAGECURYBOUNDARY2,
-    VAR_STAGEDEFORMATIONDATA0,
-    VAR_STAGEDEFORMATIONDATA1,
-    VAR_STAGEDEFORMATIONDATA2,
-    VAR_STAGEDEFORMATIONDATA3,
-    VAR_STAGEWATERLEVEL,
-    VAR_STAGEACTIVELAYER,
-    VAR_STAGEMIDPOINT,
-    VAR_STAGEPLAYERLISTPOS,
-    VAR_STAGEDEBUGMODE,
-    VAR_STAGEENTITYPOS,
-    VAR_SCREENCAMERAENABLED,
-    VAR_SCREENCAMERATARGET,
-    VAR_SCREENCAMERASTYLE,
-    VAR_SCREENCAMERAX,
-    VAR_SCREENCAMERAY,
-    VAR_SCREENDRAWLISTSIZE,
-    VAR_SCREENXCENTER,
-    VAR_SCREENYCENTER,
-    VAR_SCREENXSIZE,
-    VAR_SCREENYSIZE,
-    VAR_SCREENXOFFSET,
-    VAR_SCREENYOFFSET,
-    VAR_SCREENSHAKEX,
-    VAR_SCREENSHAKEY,
-    VAR_SCREENADJUSTCAMERAY,
-    VAR_TOUCHSCREENDOWN,
-    VAR_TOUCHSCREENXPOS,
-    VAR_TOUCHSCREENYPOS,
-    VAR_MUSICVOLUME,
-    VAR_MUSICCURRENTTRACK,
-    VAR_MUSICPOSITION,
-    VAR_KEYDOWNUP,
-    VAR_KEYDOWNDOWN,
-    VAR_KEYDOWNLEFT,
-    VAR_KEYDOWNRIGHT,
-    VAR_KEYDOWNBUTTONA,
-    VAR_KEYDOWNBUTTONB,
-    VAR_KEYDOWNBUTTONC,
-    VAR_KEYDOWNBUTTONX,
-    VAR_KEYDOWNBUTTONY,
-    VAR_KEYDOWNBUTTONZ,
-    VAR_KEYDOWNBUTTONL,
-    VAR_KEYDOWNBUTTONR,
-    VAR_KEYDOWNSTART,
-    VAR_KEYDOWNSELECT,
-    VAR_KEYPRESSUP,
-    VAR_KEYPRESSDOWN,
-    VAR_KEYPRESSLEFT,
-    VAR_KEYPRESSRIGHT,
-    VAR_KEYPRESSBUTTONA,
-    VAR_KEYPRESSBUTTONB,
-    VAR_KEYPRESSBUTTONC,
-    VAR_KEYPRESSBUTTONX,
-    VAR_KEYPRESSBUTTONY,
-    VAR_KEYPRESSBUTTONZ,
-    VAR_KEYPRESSBUTTONL,
-    VAR_KEYPRESSBUTTONR,
-    VAR_KEYPRESSSTART,
-    VAR_KEYPRESSSELECT,
-    VAR_MENU1SELECTION,
-    VAR_MENU2SELECTION,
-    VAR_TILELAYERXSIZE,
-    VAR_TILELAYERYSIZE,
-    VAR_TILELAYERTYPE,
-    VAR_TILELAYERANGLE,
-    VAR_TILELAYERXPOS,
-    VAR_TILELAYERYPOS,
-    VAR_TILELAYERZPOS,
-    VAR_TILELAYERPARALLAXFACTOR,
-    VAR_TILELAYERSCROLLSPEED,
-    VAR_TILELAYERSCROLLPOS,
-    VAR_TILELAYERDEFORMATIONOFFSET,
-    VAR_TILELAYERDEFORMATIONOFFSETW,
-    VAR_HPARALLAXPARALLAXFACTOR,
-    VAR_HPARALLAXSCROLLSPEED,
-    VAR_HPARALLAXSCROLLPOS,
-    VAR_VPARALLAXPARALLAXFACTOR,
-    VAR_VPARALLAXSCROLLSPEED,
-    VAR_VPARALLAXSCROLLPOS,
-    VAR_SCENE3DVERTEXCOUNT,
-    VAR_SCENE3DFACECOUNT,
-    VAR_SCENE3DPROJECTIONX,
-    VAR_SCENE3DPROJECTIONY,
-    VAR_SCENE3DFOGCOLOR,
-    VAR_SCENE3DFOGSTRENGTH,
-    VAR_VERTEXBUFFERX,
-    VAR_VERTEXBUFFERY,
-    VAR_VERTEXBUFFERZ,
-    VAR_VERTEXBUFFERU,
-    VAR_VERTEXBUFFERV,
-    VAR_FACEBUFFERA,
-    VAR_FACEBUFFERB,
-    VAR_FACEBUFFERC,
-    VAR_FACEBUFFERD,
-    VAR_FACEBUFFERFLAG,
-    VAR_FACEBUFFERCOLOR,
-    VAR_SAVERAM,
-    VAR_ENGINESTATE,
-    VAR_ENGINELANGUAGE,
-    VAR_ENGINEONLINEACTIVE,
-    VAR_ENGINESFXVOLUME,
-    VAR_ENGINEBGMVOLUME,
-    VAR_ENGINETRIALMODE,
-    VAR_ENGINEDEVICETYPE,
+#if LEGACY_RETRO_USE_COMPILER && RETRO_USE_SCRIPT_NAME_LOOKUP
+// StrComp sees characters 0x20 apart as the same & lets a space stand in for the end of the string,
+// so only the low 5 bits of each character up to the first space/terminator can go into the hash
+inline uint32 HashScriptName(const char *name)
+{
+    uint32 hash = 0x811C9DC5;
+    for (; *name & 0x1F; ++name) hash = (hash ^ (*name & 0x1F)) * 0x01000193;
+    return hash;
+}
 
-    // Extras
-    VAR_SCREENCURRENTID,
-    VAR_CAMERAENABLED,
-    VAR_CAMERATARGET,
-    VAR_CAMERASTYLE,
-    VAR_CAMERAXPOS,
-    VAR_CAMERAYPOS,
-    VAR_CAMERAADJUSTY,
+// indexes a list of names by hash, so the compiler doesn't need to StrComp through the whole list for every identifier
+// new names are picked up as the list grows, anything that renames or removes names needs to Clear() it
+template <int32 COUNT, int32 SIZE> class ScriptNameLookup
+{
+    static_assert(SIZE >= COUNT * 2 && !(SIZE & (SIZE - 1)), "ScriptNameLookup size must be a power of 2 & at least twice the list size");
 
-#if LEGACY_RETRO_USE_HAPTICS
-    VAR_HAPTICSENABLED,
-#endif
-    VAR_MAX_CNT
-};
+    const char *(*getName)(int32 id);
+    uint16 lookup[SIZE]; // id + 1, 0 if the entry is empty
+    int32 count;         // how many names from the list have been added so far
 
-enum ScrFunc {
-    FUNC_END,
-    FUNC_EQUAL,
-    FUNC_ADD,
-    FUNC_SUB,
-    FUNC_INC,
-    FUNC_DEC,
-    FUNC_MUL,
-    FUNC_DIV,
-    FUNC_SHR,
-    FUNC_SHL,
-    FUNC_AND,
-    FUNC_OR,
-    FUNC_XOR,
-    FUNC_MOD,
-    FUNC_FLIPSIGN,
-    FUNC_CHECKEQUAL,
-    FUNC_CHECKGREATER,
-    FUNC_CHECKLOWER,
-    FUNC_CHECKNOTEQUAL,
-    FUNC_IFEQUAL,
-    FUNC_IFGREATER,
-    FUNC_IFGREATEROREQUAL,
-    FUNC_IFLOWER,
-    FUNC_IFLOWEROREQUAL,
-    FUNC_IFNOTEQUAL,
-    FUNC_ELSE,
-    FUNC_ENDIF,
-    FUNC_WEQUAL,
-    FUNC_WGREATER,
-    FUNC_WGREATEROREQUAL,
-    FUNC_WLOWER,
-    FUNC_WLOWEROREQUAL,
-    FUNC_WNOTEQUAL,
-    FUNC_LOOP,
-    FUNC_FOREACHACTIVE,
-    FUNC_FOREACHALL,
-    FUNC_NEXT,
-    FUNC_SWITCH,
-    FUNC_BREAK,
-    FUNC_ENDSWITCH,
-    FUNC_RAND,
-    FUNC_SIN,
-    FUNC_COS,
-    FUNC_SIN256,
-    FUNC_COS256,
-    FUNC_ATAN2,
-    FUNC_INTERPOLATE,
-    FUNC_INTERPOLATEXY,
-    FUNC_LOADSPRITESHEET,
-    FUNC_REMOVESPRITESHEET,
-    FUNC_DRAWSPRITE,
-    FUNC_DRAWSPRITEXY,
-    FUNC_DRAWSPRITESCREENXY,
-    FUNC_DRAWTINTRECT,
-    FUNC_DRAWNUMBERS,
-    FUNC_DRAWACTNAME,
-    FUNC_DRAWMENU,
-    FUNC_SPRITEFRAME,
-    FUNC_EDITFRAME,
-    FUNC_LOADPALETTE,
-    FUNC_ROTATEPALETTE,
-    FUNC_SETSCREENFADE,
-    FUNC_SETACTIVEPALETTE,
-    FUNC_SETPALETTEFADE,
-    FUNC_SETPALETTEENTRY,
-    FUNC_GETPALETTEENTRY,
-    FUNC_COPYPALETTE,
-    FUNC_CLEARSCREEN,
-    FUNC_DRAWSPRITEFX,
-    FUNC_DRAWSPRITESCREENFX,
-    FUNC_LOADANIMATION,
-    FUNC_SETUPMENU,
-    FUNC_ADDMENUENTRY,
-    FUNC_EDITMENUENTRY,
-    FUNC_LOADSTAGE,
-    FUNC_DRAWRECT,
-    FUNC_RESETOBJECTENTITY,
-    FUNC_BOXCOLLISIONTEST,
-    FUNC_CREATETEMPOBJECT,
-    FUNC_PROCESSOBJECTMOVEMENT,
-    FUNC_PROCESSOBJECTCONTROL,
-    FUNC_PROCESSANIMATION,
-    FUNC_DRAWOBJECTANIMATION,
-    FUNC_SETMUSICTRACK,
-    FUNC_PLAYMUSIC,
-    FUNC_STOPMUSIC,
-    FUNC_PAUSEMUSIC,
-    FUNC_RESUMEMUSIC,
-    FUNC_SWAPMUSICTRACK,
-    FUNC_PLAYSFX,
-    FUNC_STOPSFX,
-    FUNC_SETSFXATTRIBUTES,
-    FUNC_OBJECTTILECOLLISION,
-    FUNC_OBJECTTILEGRIP,
-    FUNC_NOT,
-    FUNC_DRAW3DSCENE,
-    FUNC_SETIDENTITYMATRIX,
-    FUNC_MATRIXMULTIPLY,
-    FUNC_MATRIXTRANSLATEXYZ,
-    FUNC_MATRIXSCALEXYZ,
-    FUNC_MATRIXROTATEX,
-    FUNC_MATRIXROTATEY,
-    FUNC_MATRIXROTATEZ,
-    FUNC_MATRIXROTATEXYZ,
-    FUNC_MATRIXINVERSE,
-    FUNC_TRANSFORMVERTICES,
-    FUNC_CALLFUNCTION,
-    FUNC_RETURN,
-    FUNC_SETLAYERDEFORMATION,
-    FUNC_CHECKTOUCHRECT,
-    FUNC_GETTILELAYERENTRY,
-    FUNC_SETTILELAYERENTRY,
-    FUNC_GETBIT,
-    FUNC_SETBIT,
-    FUNC_CLEARDRAWLIST,
-    FUNC_ADDDRAWLISTENTITYREF,
-    FUNC_GETDRAWLISTENTITYREF,
-    FUNC_SETDRAWLISTENTITYREF,
-    FUNC_GET16X16TILEINFO,
-    FUNC_SET16X16TILEINFO,
-    FUNC_COPY16X16TILE,
-    FUNC_GETANIMATIONBYNAME,
-    FUNC_READSAVERAM,
-    FUNC_WRITESAVERAM,
-    FUNC_LOADTEXTFILE,
-    FUNC_GETTEXTINFO,
-    FUNC_GETVERSIONNUMBER,
-    FUNC_GETTABLEVALUE,
-    FUNC_SETTABLEVALUE,
-    FUNC_CHECKCURRENTSTAGEFOLDER,
-    FUNC_ABS,
-    FUNC_CALLNATIVEFUNCTION,
-    FUNC_CALLNATIVEFUNCTION2,
-    FUNC_CALLNATIVEFUNCTION4,
-    FUNC_SETOBJECTRANGE,
-    FUNC_GETOBJECTVALUE,
-    FUNC_SETOBJECTVALUE,
-    FUNC_COPYOBJECT,
-    FUNC_PRINT,
+public:
+    ScriptNameLookup(const char *(*getName)(int32 id)) : getName(getName) { Clear(); }
 
-    // Extras
-    FUNC_CHECKCAMERAPROXIMITY,
-    FUNC_SETSCREENCOUNT,
-    FUNC_SETSCREENVERTICES,
-    FUNC_GETINPUTDEVICEID,
-    FUNC_GETFILTEREDINPUTDEVICEID,
-    FUNC_GETINPUTDEVICETYPE,
-    FUNC_ISINPUTDEVICEASSIGNED,
-    FUNC_ASSIGNINPUTSLOTTODEVICE,
-    FUNC_ISSLOTASSIGNED,
-    FUNC_RESETINPUTSLOTASSIGNMENTS,
-    FUNC_MAX_CNT
+    void Clear()
+    {
+        memset(lookup, 0, sizeof(lookup));
+        count = 0;
+    }
+
+    void Update(int32 listCount)
+    {
+        if (listCount > COUNT)
+            listCount = COUNT;
+
+        if (listCount < count)
+            Clear();
+
+        for (; count < listCount; ++count) {
+            uint32 entry = HashScriptName(getName(count)) & (SIZE - 1);
+            while (lookup[entry]) entry = (entry + 1) & (SIZE - 1);
+            lookup[entry] = count + 1;
+        }
+    }
+
+    // the lowest id from start onwards that StrComp matches with name, same as a scan that stops at the first match
+    int32 Find(const char *name, int32 start)
+    {
+        int32 id = -1;
+        for (uint32 entry = HashScriptName(name) & (SIZE - 1); lookup[entry]; entry = (entry + 1) & (SIZE - 1)) {
+            int32 e = lookup[entry] - 1;
+            if (e >= start && (id == -1 || e < id) && StrComp(name, getName(e)))
+                id = e;
+        }
+
+        return id;
+    }
+
+    // the highest id that StrComp matches with name, same as a scan that keeps the last match
+    int32 FindLast(const char *name)
+    {
+        int32 id = -1;
+        for (uint32 entry = HashScriptName(name) & (SIZE - 1); lookup[entry]; entry = (entry + 1) & (SIZE - 1)) {
+            int32 e = lookup[entry] - 1;
+            if (e > id && StrComp(name, getName(e)))
+                id = e;
+        }
+
+        return id;
+    }
 };
 
+ScriptNameLookup<FUNC_MAX_CNT, 0x200> opcodeLookup([](int32 id) { return functions[id].name; });
+ScriptNameLookup<VAR_MAX_CNT, 0x400> variableLookup([](int32 id) { return variableNames[id]; });
+ScriptNameLookup<LEGACY_v4_SCRIPT_VAR_COUNT, 0x800> scriptValueLookup([](int32 id) { return (const char *)scriptValueList[id].name; });
+ScriptNameLookup<LEGACY_v4_FUNCTION_COUNT, 0x400> scriptFunctionLookup([](int32 id) { return (const char *)scriptFunctionList[id].name; });
+
+inline int32 FindOpcode(const char *name)
+{
+    opcodeLookup.Update(FUNC_MAX_CNT);
+    return opcodeLookup.Find(name, 0);
+}
+
+inline int32 FindVariable(const char *name)
+{
+    variableLookup.Update(VAR_MAX_CNT);
+    return variableLookup.FindLast(name);
+}
+
+inline int32 FindScriptValue(const char *name, int32 start)
+{
+    scriptValueLookup.Update(scriptValueListCount);
+    return scriptValueLookup.Find(name, start);
+}
+
+inline int32 FindScriptFunction(const char *name, int32 start)
+{
+    scriptFunctionLookup.Update(scriptFunctionCount);
+    return scriptFunctionLookup.Find(name, start);
+}
+
+inline int32 FindLastScriptFunction(const char *name)
+{
+    scriptFunctionLookup.Update(scriptFunctionCount);
+    return scriptFunctionLookup.FindLast(name);
+}
+
+inline void ClearScriptNameLookups()
+{
+    scriptValueLookup.Clear();
+    scriptFunctionLookup.Clear();
+}
+#endif
+
 } // namespace v4
 
 } // namespace Legacy
@@ -1173,10 +886,15 @@ void RSDK::Legacy::v4::CheckAliasText(char *text)
         variable->access = ACCESS_PUBLIC;
 
 #if !RETRO_USE_ORIGINAL_CODE
+#if RETRO_USE_SCRIPT_NAME_LOOKUP
+        for (int32 v = FindScriptValue(variable->name, 0); v >= 0; v = FindScriptValue(variable->name, v + 1))
+            PrintLog(PRINT_NORMAL, "WARNING: Variable Name '%s' has already been used!", variable->name);
+#else
         for (int32 v = 0; v < scriptValueListCount; ++v) {
             if (StrComp(scriptValueList[v].name, variable->name))
                 PrintLog(PRINT_NORMAL, "WARNING: Variable Name '%s' has already been used!", variable->name);
         }
+#endif
 #endif
 
         ++scriptValueListCount;
@@ -1216,10 +934,15 @@ void RSDK::Legacy::v4::CheckAliasText(char *text)
 
         variable->access = ACCESS_PRIVATE;
 
+#if RETRO_USE_SCRIPT_NAME_LOOKUP
+        for (int32 v = FindScriptValue(variable->name, 0); v >= 0; v = FindScriptValue(variable->name, v + 1))
+            PrintLog(PRINT_NORMAL, "WARNING: Variable Name '%s' has already been used!", variable->name);
+#else
         for (int32 v = 0; v < scriptValueListCount; ++v) {
             if (StrComp(scriptValueList[v].name, variable->name))
                 PrintLog(PRINT_NORMAL, "WARNING: Variable Name '%s' has already been used!", variable->name);
         }
+#endif
 
         ++scriptValueListCount;
     }
@@ -1270,10 +993,15 @@ void RSDK::Legacy::v4::CheckStaticText(char *text)
         StrAdd(variable->value, "]");
 
 #if !RETRO_USE_ORIGINAL_CODE
+#if RETRO_USE_SCRIPT_NAME_LOOKUP
+        for (int32 v = FindScriptValue(variable->name, 0); v >= 0; v = FindScriptValue(variable->name, v + 1))
+            PrintLog(PRINT_NORMAL, "WARNING: Variable Name '%s' has already been used!", variable->name);
+#else
         for (int32 v = 0; v < scriptValueListCount; ++v) {
             if (StrComp(scriptValueList[v].name, variable->name))
                 PrintLog(PRINT_NORMAL, "WARNING: Variable Name '%s' has already been used!", variable->name);
         }
+#endif
 #endif
 
         ++scriptValueListCount;
@@ -1322,10 +1050,15 @@ void RSDK::Legacy::v4::CheckStaticText(char *text)
         StrAdd(variable->value, "]");
 
 #if !RETRO_USE_ORIGINAL_CODE
+#if RETRO_USE_SCRIPT_NAME_LOOKUP
+        for (int32 v = FindScriptValue(variable->name, 0); v >= 0; v = FindScriptValue(variable->name, v + 1))
+            PrintLog(PRINT_NORMAL, "WARNING: Variable Name '%s' has already been used!", variable->name);
+#else
         for (int32 v = 0; v < scriptValueListCount; ++v) {
             if (StrComp(scriptValueList[v].name, variable->name))
                 PrintLog(PRINT_NORMAL, "WARNING: Variable Name '%s' has already been used!", variable->name);
         }
+#endif
 #endif
 
         ++scriptValueListCount;
@@ -1382,10 +1115,15 @@ bool32 RSDK::Legacy::v4::CheckTableText(char *text)
             }
 
             // array size can be an variable (alias), how cool!
+#if RETRO_USE_SCRIPT_NAME_LOOKUP
+            for (int32 v = FindScriptValue(variable->value, 0); v >= 0; v = FindScriptValue(variable->value, v + 1))
+                StrCopy(variable->value, scriptValueList[v].value);
+#else
             for (int32 v = 0; v < scriptValueListCount; ++v) {
                 if (StrComp(variable->value, scriptValueList[v].name))
                     StrCopy(variable->value, scriptValueList[v].value);
             }
+#endif
 
             if (!ConvertStringToInteger(variable->value, &scriptCode[scriptCodePos])) {
                 scriptCode[scriptCodePos] = 1;
@@ -1451,10 +1189,15 @@ bool32 RSDK::Legacy::v4::CheckTableText(char *text)
             }
 
             // array size can be an variable (alias), how cool!
+#if RETRO_USE_SCRIPT_NAME_LOOKUP
+            for (int32 v = FindScriptValue(variable->value, 0); v >= 0; v = FindScriptValue(variable->value, v + 1))
+                StrCopy(variable->value, scriptValueList[v].value);
+#else
             for (int32 v = 0; v < scriptValueListCount; ++v) {
                 if (StrComp(variable->value, scriptValueList[v].name))
                     StrCopy(variable->value, scriptValueList[v].value);
             }
+#endif
 
             if (!ConvertStringToInteger(variable->value, &scriptCode[scriptCodePos])) {
                 scriptCode[scriptCodePos] = 1;
@@ -1645,6 +1388,14 @@ void RSDK::Legacy::v4::ConvertFunctionText(char *text)
     for (namePos = 0; text[namePos] != '(' && text[namePos]; ++namePos) funcName[namePos] = text[namePos];
     funcName[namePos] = 0;
 
+#if RETRO_USE_SCRIPT_NAME_LOOKUP
+    int32 opcodeID = FindOpcode(funcName);
+    if (opcodeID >= 0) {
+        opcode     = opcodeID;
+        opcodeSize = functions[opcodeID].opcodeSize;
+        textPos    = StrLength(functions[opcodeID].name);
+    }
+#else
     for (int32 i = 0; i < FUNC_MAX_CNT; ++i) {
         if (StrComp(funcName, functions[i].name)) {
             opcode     = i;
@@ -1653,6 +1404,7 @@ void RSDK::Legacy::v4::ConvertFunctionText(char *text)
             i          = FUNC_MAX_CNT;
         }
     }
+#endif
 
     if (opcode <= 0) {
         PrintLog(PRINT_SCRIPTERR, "SCRIPT ERROR: Operand not found\nOPERAND: %s\nLINE: %d\nFILE: %s", funcName, lineID, scriptFile);
@@ -1738,6 +1490,14 @@ void RSDK::Legacy::v4::ConvertFunctionText(char *text)
             funcName[funcNamePos] = 0;
             arrayStr[arrayStrPos] = 0;
 
+#if RETRO_USE_SCRIPT_NAME_LOOKUP
+            // funcName changes with each match, so later aliases are checked against the new name
+            for (int32 v = FindScriptValue(funcName, 0); v >= 0; v = FindScriptValue(funcName, v + 1)) {
+                CopyAliasStr(funcName, scriptValueList[v].value, 0);
+                if (FindStringToken(scriptValueList[v].value, "[", 1) > -1)
+                    CopyAliasStr(arrayStr, scriptValueList[v].value, 1);
+            }
+#else
             for (int32 v = 0; v < scriptValueListCount; ++v) {
                 if (StrComp(funcName, scriptValueList[v].name)) {
                     CopyAliasStr(funcName, scriptValueList[v].value, 0);
@@ -1745,6 +1505,7 @@ void RSDK::Legacy::v4::ConvertFunctionText(char *text)
                         CopyAliasStr(arrayStr, scriptValueList[v].value, 1);
                 }
             }
+#endif
 
             if (arrayStr[0]) {
                 char arrStrBuf[0x80];
@@ -1755,6 +1516,18 @@ void RSDK::Legacy::v4::ConvertFunctionText(char *text)
                 while (arrayStr[arrPos]) arrStrBuf[bufPos++] = arrayStr[arrPos++];
                 arrStrBuf[bufPos] = 0;
 
+#if RETRO_USE_SCRIPT_NAME_LOOKUP
+                for (int32 v = FindScriptValue(arrStrBuf, 0); v >= 0; v = FindScriptValue(arrStrBuf, v + 1)) {
+                    char pref = arrayStr[0];
+                    CopyAliasStr(arrayStr, scriptValueList[v].value, 0);
+
+                    if (pref == '+' || pref == '-') {
+                        int32 len = StrLength(arrayStr);
+                        for (int32 i = len; i >= 0; --i) arrayStr[i + 1] = arrayStr[i];
+                        arrayStr[0] = pref;
+                    }
+                }
+#else
                 for (int32 v = 0; v < scriptValueListCount; ++v) {
                     if (StrComp(arrStrBuf, scriptValueList[v].name)) {
                         char pref = arrayStr[0];
@@ -1767,6 +1540,7 @@ void RSDK::Legacy::v4::ConvertFunctionText(char *text)
                         }
                     }
                 }
+#endif
             }
 
             // Eg: temp0 = game.variable
@@ -1779,12 +1553,19 @@ void RSDK::Legacy::v4::ConvertFunctionText(char *text)
             }
 
             // Eg: temp0 = Function1
+#if RETRO_USE_SCRIPT_NAME_LOOKUP
+            for (int32 f = FindScriptFunction(funcName, 0); f >= 0; f = FindScriptFunction(funcName, f + 1)) {
+                funcName[0] = 0;
+                AppendIntegerToString(funcName, f);
+            }
+#else
             for (int32 f = 0; f < scriptFunctionCount; ++f) {
                 if (StrComp(funcName, scriptFunctionList[f].name)) {
                     funcName[0] = 0;
                     AppendIntegerToString(funcName, f);
                 }
             }
+#endif
 
             // Eg: temp0 = TypeName[Player Object]
             if (StrComp(funcName, "TypeName")) {
@@ -2024,11 +1805,15 @@ void RSDK::Legacy::v4::ConvertFunctionText(char *text)
                     scriptCode[scriptCodePos++] = VARARR_NONE;
                 }
 
+#if RETRO_USE_SCRIPT_NAME_LOOKUP
+                constant = FindVariable(funcName);
+#else
                 constant = -1;
                 for (int32 i = 0; i < VAR_MAX_CNT; ++i) {
                     if (StrComp(funcName, variableNames[i]))
                         constant = i;
                 }
+#endif
 
                 if (constant == -1 && gameMode != ENGINE_SCRIPTERROR) {
                     PrintLog(PRINT_SCRIPTERR, "SCRIPT ERROR: Operand not found\nOPERAND: %s\nLINE: %d\nFILE: %s", funcName, lineID, scriptFile);
@@ -2232,12 +2017,20 @@ void RSDK::Legacy::v4::CheckCaseNumber(char *text)
         foundValue = true;
     }
 
+#if RETRO_USE_SCRIPT_NAME_LOOKUP
+    if (!foundValue) {
+        int32 a = FindScriptValue(caseString, 0);
+        if (a >= 0)
+            StrCopy(caseString, scriptValueList[a].value);
+    }
+#else
     for (int32 a = 0; a < scriptValueListCount && !foundValue; ++a) {
         if (StrComp(scriptValueList[a].name, caseString)) {
             StrCopy(caseString, scriptValueList[a].value);
             break;
         }
     }
+#endif
 
     int32 caseID = 0;
     if (ConvertStringToInteger(caseString, &caseID)) {
@@ -2437,12 +2230,20 @@ bool32 RSDK::Legacy::v4::ReadSwitchCase(char *text)
             foundValue = true;
         }
 
+#if RETRO_USE_SCRIPT_NAME_LOOKUP
+        if (!foundValue) {
+            int32 v = FindScriptValue(caseText, 0);
+            if (v >= 0)
+                StrCopy(caseText, scriptValueList[v].value);
+        }
+#else
         for (int32 v = 0; v < scriptValueListCount && !foundValue; ++v) {
             if (StrComp(caseText, scriptValueList[v].name)) {
                 StrCopy(caseText, scriptValueList[v].value);
                 break;
             }
         }
+#endif
 
         int32 val = 0;
 
@@ -2587,6 +2388,212 @@ bool32 RSDK::Legacy::v4::CheckOpcodeType(char *text)
     return true;
 }
 
+#if RETRO_USE_SCRIPT_CACHE
+bool32 RSDK::Legacy::v4::useScriptCache = false;
+
+#define SCRIPTCACHE_HASH_BASIS (0xCBF29CE484222325)
+
+namespace RSDK
+{
+namespace Legacy
+{
+namespace v4
+{
+
+inline uint64 HashScriptCacheData(uint64 hash, const void *data, size_t size)
+{
+    // FNV-1a
+    const uint8 *bytes = (const uint8 *)data;
+    for (size_t i = 0; i < size; ++i) hash = (hash ^ bytes[i]) * 0x100000001B3;
+    return hash;
+}
+
+inline uint64 HashScriptCacheString(uint64 hash, const char *text) { return HashScriptCacheData(hash, text ? text : "", strlen(text ? text : "") + 1); }
+
+uint64 GetScriptCacheContext()
+{
+    // the compiler's output depends on where it starts writing & on every name it can resolve, not just the script itself
+    int32 layout[] = { LEGACY_v4_SCRIPTCACHE_VERSION,
+                       RETRO_REVISION,
+                       (int32)sizeof(ScriptFunction),
+                       (int32)sizeof(ScriptVariableInfo),
+                       scriptCodePos,
+                       jumpTablePos,
+                       scriptFunctionCount,
+                       scriptValueListCount,
+                       globalVariablesCount,
+                       (int32)achievementList.size() };
+
+    uint64 hash = HashScriptCacheData(SCRIPTCACHE_HASH_BASIS, layout, sizeof(layout));
+    hash        = HashScriptCacheData(hash, scriptFunctionList, scriptFunctionCount * sizeof(ScriptFunction));
+    hash        = HashScriptCacheData(hash, scriptValueList, scriptValueListCount * sizeof(ScriptVariableInfo));
+
+    for (int32 v = 0; v < globalVariablesCount; ++v) hash = HashScriptCacheString(hash, globalVariables[v].name);
+    hash = HashScriptCacheData(hash, typeNames, sizeof(typeNames));
+    hash = HashScriptCacheData(hash, sfxNames, sizeof(sfxNames));
+    for (auto &achievement : achievementList) hash = HashScriptCacheString(hash, achievement.identifier.c_str());
+
+#if RETRO_USE_MOD_LOADER
+    hash = HashScriptCacheData(hash, modSettings.playerNames, sizeof(modSettings.playerNames));
+#endif
+
+    hash = HashScriptCacheString(hash, engine.gamePlatform);
+    hash = HashScriptCacheString(hash, engine.gameRenderType);
+    hash = HashScriptCacheString(hash, engine.gameHapticSetting);
+
+    return hash;
+}
+
+void GetScriptCachePath(char *buffer, int32 bufferSize, const char *scriptPath)
+{
+    RETRO_HASH_MD5(hash);
+    char pathBuffer[0x100];
+    sprintf_s(pathBuffer, (int32)sizeof(pathBuffer), "%s", scriptPath);
+    GEN_HASH_MD5_BUFFER(pathBuffer, hash);
+
+    sprintf_s(buffer, bufferSize, "%sScriptCache/%08X%08X%08X%08X.bin", SKU::userFileDir, hash[0], hash[1], hash[2], hash[3]);
+}
+
+} // namespace v4
+} // namespace Legacy
+} // namespace RSDK
+
+bool32 RSDK::Legacy::v4::LoadScriptCache(const char *scriptPath, FileInfo *info, int32 scriptID, ScriptCacheHeader *header)
+{
+    MEM_ZERO(*header);
+    if (!useScriptCache)
+        return false;
+
+    header->signature       = LEGACY_v4_SCRIPTCACHE_SIGNATURE;
+    header->version         = LEGACY_v4_SCRIPTCACHE_VERSION;
+    header->sourceSize      = info->fileSize;
+    header->scriptCodeStart = scriptCodePos;
+    header->jumpTableStart  = jumpTablePos;
+    header->contextHash     = GetScriptCacheContext();
+    header->sourceHash      = SCRIPTCACHE_HASH_BASIS;
+
+    if (info->fileSize > 0) {
+        uint8 *source = (uint8 *)malloc(info->fileSize);
+        if (!source)
+            return false;
+
+        ReadBytes(info, source, info->fileSize);
+        header->sourceHash = HashScriptCacheData(header->sourceHash, source, info->fileSize);
+        free(source);
+
+        Seek_Set(info, 0);
+    }
+
+    char cachePath[0x200];
+    GetScriptCachePath(cachePath, (int32)sizeof(cachePath), scriptPath);
+
+    FileIO *file = fOpen(cachePath, "rb");
+    if (!file)
+        return false;
+
+    ScriptCacheHeader cached;
+    size_t bytesRead = fRead(&cached, 1, sizeof(ScriptCacheHeader), file);
+    bool32 valid     = bytesRead == sizeof(ScriptCacheHeader) && cached.signature == header->signature && cached.version == header->version
+                   && cached.sourceHash == header->sourceHash && cached.contextHash == header->contextHash && cached.sourceSize == header->sourceSize
+                   && cached.scriptCodeStart == header->scriptCodeStart && cached.jumpTableStart == header->jumpTableStart
+                   && cached.scriptCodeEnd >= cached.scriptCodeStart && cached.scriptCodeEnd <= LEGACY_v4_SCRIPTCODE_COUNT
+                   && cached.jumpTableEnd >= cached.jumpTableStart && cached.jumpTableEnd <= LEGACY_v4_JUMPTABLE_COUNT
+                   && cached.functionCount >= scriptFunctionCount && cached.functionCount <= LEGACY_v4_FUNCTION_COUNT
+                   && cached.valueCount >= scriptValueListCount && cached.valueCount <= LEGACY_v4_SCRIPT_VAR_COUNT;
+
+    uint8 *buffer    = NULL;
+    size_t codeSize  = 0;
+    size_t tableSize = 0;
+    if (valid) {
+        codeSize    = (cached.scriptCodeEnd - cached.scriptCodeStart) * sizeof(int32);
+        tableSize   = (cached.jumpTableEnd - cached.jumpTableStart) * sizeof(int32);
+        size_t size = codeSize + tableSize + 3 * sizeof(ScriptPtr) + cached.functionCount * sizeof(ScriptFunction)
+                      + cached.valueCount * sizeof(ScriptVariableInfo);
+
+        buffer = (uint8 *)malloc(size);
+        valid  = buffer != NULL;
+        if (valid) {
+            bytesRead = fRead(buffer, 1, size, file);
+            valid     = bytesRead == size;
+        }
+    }
+
+    fClose(file);
+
+    if (valid) {
+        // only touch the script state once everything's been read, so a bad cache can still fall back to the compiler
+        uint8 *data          = buffer;
+        ObjectScript *script = &objectScriptList[scriptID];
+
+        memcpy(&scriptCode[cached.scriptCodeStart], data, codeSize);
+        data += codeSize;
+        memcpy(&jumpTable[cached.jumpTableStart], data, tableSize);
+        data += tableSize;
+
+        memcpy(&script->eventUpdate, data, sizeof(ScriptPtr));
+        data += sizeof(ScriptPtr);
+        memcpy(&script->eventDraw, data, sizeof(ScriptPtr));
+        data += sizeof(ScriptPtr);
+        memcpy(&script->eventStartup, data, sizeof(ScriptPtr));
+        data += sizeof(ScriptPtr);
+
+        memcpy(scriptFunctionList, data, cached.functionCount * sizeof(ScriptFunction));
+        data += cached.functionCount * sizeof(ScriptFunction);
+        memcpy(scriptValueList, data, cached.valueCount * sizeof(ScriptVariableInfo));
+
+        scriptCodePos        = cached.scriptCodeEnd;
+        jumpTablePos         = cached.jumpTableEnd;
+        scriptCodeOffset     = cached.scriptCodeOffset;
+        jumpTableOffset      = cached.jumpTableOffset;
+        scriptFunctionCount  = cached.functionCount;
+        scriptValueListCount = cached.valueCount;
+
+#if RETRO_USE_SCRIPT_NAME_LOOKUP
+        ClearScriptNameLookups();
+#endif
+    }
+
+    free(buffer);
+    return valid;
+}
+
+void RSDK::Legacy::v4::SaveScriptCache(const char *scriptPath, int32 scriptID, ScriptCacheHeader *header)
+{
+    if (!useScriptCache || header->signature != LEGACY_v4_SCRIPTCACHE_SIGNATURE)
+        return;
+
+    char cachePath[0x200];
+    GetScriptCachePath(cachePath, (int32)sizeof(cachePath), scriptPath);
+
+    std::error_code err;
+    fs::create_directories(fs::path(cachePath).parent_path(), err);
+
+    FileIO *file = fOpen(cachePath, "wb");
+    if (!file) {
+        PrintLog(PRINT_NORMAL, "WARNING: Failed to write script cache for %s", scriptPath);
+        return;
+    }
+
+    header->scriptCodeEnd    = scriptCodePos;
+    header->jumpTableEnd     = jumpTablePos;
+    header->scriptCodeOffset = scriptCodeOffset;
+    header->jumpTableOffset  = jumpTableOffset;
+    header->functionCount    = scriptFunctionCount;
+    header->valueCount       = scriptValueListCount;
+
+    ObjectScript *script = &objectScriptList[scriptID];
+    fWrite(header, sizeof(ScriptCacheHeader), 1, file);
+    fWrite(&scriptCode[header->scriptCodeStart], sizeof(int32), header->scriptCodeEnd - header->scriptCodeStart, file);
+    fWrite(&jumpTable[header->jumpTableStart], sizeof(int32), header->jumpTableEnd - header->jumpTableStart, file);
+    fWrite(&script->eventUpdate, sizeof(ScriptPtr), 1, file);
+    fWrite(&script->eventDraw, sizeof(ScriptPtr), 1, file);
+    fWrite(&script->eventStartup, sizeof(ScriptPtr), 1, file);
+    fWrite(scriptFunctionList, sizeof(ScriptFunction), header->functionCount, file);
+    fWrite(scriptValueList, sizeof(ScriptVariableInfo), header->valueCount, file);
+    fClose(file);
+}
+#endif
+
 void RSDK::Legacy::v4::ParseScriptFile(char *scriptName, int32 scriptID)
 {
     jumpTableStackPos = 0;
@@ -2617,6 +2624,10 @@ void RSDK::Legacy::v4::ParseScriptFile(char *scriptName, int32 scriptID)
         MEM_ZERO(scriptValueList[v]);
     }
 
+#if RETRO_USE_SCRIPT_NAME_LOOKUP
+    ClearScriptNameLookups();
+#endif
+
     FileInfo info;
     InitFileInfo(&info);
 
@@ -2633,6 +2644,13 @@ void RSDK::Legacy::v4::ParseScriptFile(char *scriptName, int32 scriptID)
         char curChar     = 0;
         int32 switchDeep = 0;
 
+#if RETRO_USE_SCRIPT_CACHE
+        ScriptCacheHeader cacheHeader;
+        bool32 cacheLoaded = LoadScriptCache(scriptPath, &info, scriptID, &cacheHeader);
+        if (cacheLoaded)
+            readMode = READMODE_EOF;
+#endif
+
         while (readMode < READMODE_EOF) {
             int32 textPos               = 0;
             readMode                    = READMODE_NORMAL;
@@ -2733,11 +2751,15 @@ void RSDK::Legacy::v4::ParseScriptFile(char *scriptName, int32 scriptID)
                         char funcName[0x40];
                         for (textPos = 15; scriptText[textPos]; ++textPos) funcName[textPos - 15] = scriptText[textPos];
                         funcName[textPos - 15] = 0;
+#if RETRO_USE_SCRIPT_NAME_LOOKUP
+                        int32 funcID = FindLastScriptFunction(funcName);
+#else
                         int32 funcID           = -1;
                         for (int32 f = 0; f < scriptFunctionCount; ++f) {
                             if (StrComp(funcName, scriptFunctionList[f].name))
                                 funcID = f;
                         }
+#endif
 
                         if (scriptFunctionCount < LEGACY_v4_FUNCTION_COUNT && funcID == -1) {
                             StrCopy(scriptFunctionList[scriptFunctionCount++].name, funcName);
@@ -2753,11 +2775,15 @@ void RSDK::Legacy::v4::ParseScriptFile(char *scriptName, int32 scriptID)
                         for (textPos = 14; scriptText[textPos]; ++textPos) funcName[textPos - 14] = scriptText[textPos];
 
                         funcName[textPos - 14] = 0;
+#if RETRO_USE_SCRIPT_NAME_LOOKUP
+                        int32 funcID = FindLastScriptFunction(funcName);
+#else
                         int32 funcID           = -1;
                         for (int32 f = 0; f < scriptFunctionCount; ++f) {
                             if (StrComp(funcName, scriptFunctionList[f].name))
                                 funcID = f;
                         }
+#endif
 
                         if (funcID <= -1) {
                             if (scriptFunctionCount >= LEGACY_v4_FUNCTION_COUNT) {
@@ -2791,11 +2817,15 @@ void RSDK::Legacy::v4::ParseScriptFile(char *scriptName, int32 scriptID)
                         for (textPos = 15; scriptText[textPos]; ++textPos) funcName[textPos - 15] = scriptText[textPos];
 
                         funcName[textPos - 15] = 0;
+#if RETRO_USE_SCRIPT_NAME_LOOKUP
+                        int32 funcID = FindLastScriptFunction(funcName);
+#else
                         int32 funcID           = -1;
                         for (int32 f = 0; f < scriptFunctionCount; ++f) {
                             if (StrComp(funcName, scriptFunctionList[f].name))
                                 funcID = f;
                         }
+#endif
 
                         if (funcID <= -1) {
                             if (scriptFunctionCount >= LEGACY_v4_FUNCTION_COUNT) {
@@ -2924,6 +2954,20 @@ void RSDK::Legacy::v4::ParseScriptFile(char *scriptName, int32 scriptID)
         }
 
         CloseFile(&info);
+
+#if RETRO_USE_SCRIPT_CACHE
+        if (!cacheLoaded && gameMode != ENGINE_SCRIPTERROR)
+            SaveScriptCache(scriptPath, scriptID, &cacheHeader);
+#endif
+
+#if RETRO_USE_PREDECODED_SCRIPTS
+        ObjectScript *script = &objectScriptList[scriptID];
+        DecodeScriptCode(script->eventUpdate.scriptCodePtr);
+        DecodeScriptCode(script->eventDraw.scriptCodePtr);
+        DecodeScriptCode(script->eventStartup.scriptCodePtr);
+
+        for (int32 f = 0; f < scriptFunctionCount; ++f) DecodeScriptCode(scriptFunctionList[f].ptr.scriptCodePtr);
+#endif
     }
 }
 #endif
@@ -3076,6 +3120,17 @@ void RSDK::Legacy::v4::LoadBytecode(int32 scriptID, bool32 globalCode)
         }
 
         CloseFile(&info);
+
+#if RETRO_USE_PREDECODED_SCRIPTS
+        for (int32 s = 0; s < scriptCount; ++s) {
+            ObjectScript *script = &objectScriptList[scriptID + s];
+            DecodeScriptCode(script->eventUpdate.scriptCodePtr);
+            DecodeScriptCode(script->eventDraw.scriptCodePtr);
+            DecodeScriptCode(script->eventStartup.scriptCodePtr);
+        }
+
+        for (int32 f = 0; f < functionCount; ++f) DecodeScriptCode(scriptFunctionList[f].ptr.scriptCodePtr);
+#endif
     }
 }
 
@@ -3100,6 +3155,12 @@ void RSDK::Legacy::v4::ClearScriptData()
     jumpTablePos     = 0;
     jumpTableOffset  = 0;
 
+#if RETRO_USE_PREDECODED_SCRIPTS
+    memset(scriptInstructionList, 0, sizeof(scriptInstructionList));
+    scriptOperandPos = 0;
+    scriptStringPos  = 0;
+#endif
+
 #if LEGACY_RETRO_USE_COMPILER
     scriptFunctionCount = 0;
 
@@ -3109,6 +3170,10 @@ void RSDK::Legacy::v4::ClearScriptData()
     for (int32 v = LEGACY_v4_COMMON_SCRIPT_VAR_COUNT; v < LEGACY_v4_SCRIPT_VAR_COUNT; ++v) {
         MEM_ZERO(scriptValueList[v]);
     }
+
+#if RETRO_USE_SCRIPT_NAME_LOOKUP
+    ClearScriptNameLookups();
+#endif
 #endif
 
     ClearAnimationData();
@@ -3139,91 +3204,524 @@ void RSDK::Legacy::v4::ClearScriptData()
     SetObjectTypeName("Blank Object", OBJ_TYPE_BLANKOBJECT);
 }
 
-void RSDK::Legacy::v4::ProcessScript(int32 scriptCodeStart, int32 jumpTableStart, uint8 scriptEvent)
+#if RETRO_USE_PREDECODED_SCRIPTS
+namespace RSDK
+{
+namespace Legacy
+{
+namespace v4
 {
-    bool running        = true;
-    int32 scriptCodePtr = scriptCodeStart;
-    jumpTableStackPos   = 0;
-    functionStackPos    = 0;
-    foreachStackPos     = 0;
 
-    while (running) {
-        int32 opcode           = scriptCode[scriptCodePtr++];
-        int32 opcodeSize       = functions[opcode].opcodeSize;
-        int32 scriptCodeOffset = scriptCodePtr;
+#if RETRO_USE_FUSED_SCRIPT_OPCODES
+// the entity variables that are a straight int32 field read & write, as an index into Entity + 1
+inline uint8 GetOperandEntityField(int32 variable)
+{
+    if (variable >= VAR_OBJECTVALUE0 && variable <= VAR_OBJECTVALUE47)
+        return offsetof(Entity, values) / sizeof(int32) + (variable - VAR_OBJECTVALUE0) + 1;
+
+    switch (variable) {
+        default: return 0;
+        case VAR_OBJECTXPOS: return offsetof(Entity, xpos) / sizeof(int32) + 1;
+        case VAR_OBJECTYPOS: return offsetof(Entity, ypos) / sizeof(int32) + 1;
+        case VAR_OBJECTXVEL: return offsetof(Entity, xvel) / sizeof(int32) + 1;
+        case VAR_OBJECTYVEL: return offsetof(Entity, yvel) / sizeof(int32) + 1;
+        case VAR_OBJECTSPEED: return offsetof(Entity, speed) / sizeof(int32) + 1;
+        case VAR_OBJECTSTATE: return offsetof(Entity, state) / sizeof(int32) + 1;
+        case VAR_OBJECTROTATION: return offsetof(Entity, rotation) / sizeof(int32) + 1;
+        case VAR_OBJECTSCALE: return offsetof(Entity, scale) / sizeof(int32) + 1;
+        case VAR_OBJECTALPHA: return offsetof(Entity, alpha) / sizeof(int32) + 1;
+        case VAR_OBJECTANIMATIONSPEED: return offsetof(Entity, animationSpeed) / sizeof(int32) + 1;
+        case VAR_OBJECTANIMATIONTIMER: return offsetof(Entity, animationTimer) / sizeof(int32) + 1;
+        case VAR_OBJECTANGLE: return offsetof(Entity, angle) / sizeof(int32) + 1;
+        case VAR_OBJECTLOOKPOSX: return offsetof(Entity, lookPosX) / sizeof(int32) + 1;
+        case VAR_OBJECTLOOKPOSY: return offsetof(Entity, lookPosY) / sizeof(int32) + 1;
+    }
+}
+#endif
 
-        scriptText[0] = '\0';
+// reads the operands the same way ProcessScript used to, returns where the next opcode starts
+inline int32 DecodeScriptOperands(int32 scriptCodePtr, ScriptOperand *operands, int32 count)
+{
+    for (int32 i = 0; i < count; ++i) {
+        ScriptOperand *operand = &operands[i];
+        MEM_ZERO(*operand);
 
-        // Get Values
-        for (int32 i = 0; i < opcodeSize; ++i) {
-            int32 opcodeType = scriptCode[scriptCodePtr++];
+        operand->type = scriptCode[scriptCodePtr++];
+        switch (operand->type) {
+            default: break;
 
-            if (opcodeType == SCRIPTVAR_VAR) {
-                int32 arrayVal = 0;
-                switch (scriptCode[scriptCodePtr++]) {
-                    case VARARR_NONE: arrayVal = objectEntityPos; break;
+            case SCRIPTVAR_VAR:
+                operand->arrayMode = scriptCode[scriptCodePtr++];
+                switch (operand->arrayMode) {
+                    default: break;
                     case VARARR_ARRAY:
-                        if (scriptCode[scriptCodePtr++] == 1)
-                            arrayVal = scriptEng.arrayPosition[scriptCode[scriptCodePtr++]];
-                        else
-                            arrayVal = scriptCode[scriptCodePtr++];
-                        break;
                     case VARARR_ENTNOPLUS1:
-                        if (scriptCode[scriptCodePtr++] == 1)
-                            arrayVal = scriptEng.arrayPosition[scriptCode[scriptCodePtr++]] + objectEntityPos;
-                        else
-                            arrayVal = scriptCode[scriptCodePtr++] + objectEntityPos;
-                        break;
                     case VARARR_ENTNOMINUS1:
-                        if (scriptCode[scriptCodePtr++] == 1)
-                            arrayVal = objectEntityPos - scriptEng.arrayPosition[scriptCode[scriptCodePtr++]];
-                        else
-                            arrayVal = objectEntityPos - scriptCode[scriptCodePtr++];
+                        operand->indexIsArrayPos = scriptCode[scriptCodePtr++] == 1;
+                        operand->index           = scriptCode[scriptCodePtr++];
                         break;
-                    default: break;
                 }
+                operand->value = scriptCode[scriptCodePtr++];
 
-                // Variables
-                switch (scriptCode[scriptCodePtr++]) {
+                switch (operand->value) {
                     default: break;
-                    case VAR_TEMP0: scriptEng.operands[i] = scriptEng.temp[0]; break;
-                    case VAR_TEMP1: scriptEng.operands[i] = scriptEng.temp[1]; break;
-                    case VAR_TEMP2: scriptEng.operands[i] = scriptEng.temp[2]; break;
-                    case VAR_TEMP3: scriptEng.operands[i] = scriptEng.temp[3]; break;
-                    case VAR_TEMP4: scriptEng.operands[i] = scriptEng.temp[4]; break;
-                    case VAR_TEMP5: scriptEng.operands[i] = scriptEng.temp[5]; break;
-                    case VAR_TEMP6: scriptEng.operands[i] = scriptEng.temp[6]; break;
-                    case VAR_TEMP7: scriptEng.operands[i] = scriptEng.temp[7]; break;
-                    case VAR_CHECKRESULT: scriptEng.operands[i] = scriptEng.checkResult; break;
-                    case VAR_ARRAYPOS0: scriptEng.operands[i] = scriptEng.arrayPosition[0]; break;
-                    case VAR_ARRAYPOS1: scriptEng.operands[i] = scriptEng.arrayPosition[1]; break;
-                    case VAR_ARRAYPOS2: scriptEng.operands[i] = scriptEng.arrayPosition[2]; break;
-                    case VAR_ARRAYPOS3: scriptEng.operands[i] = scriptEng.arrayPosition[3]; break;
-                    case VAR_ARRAYPOS4: scriptEng.operands[i] = scriptEng.arrayPosition[4]; break;
-                    case VAR_ARRAYPOS5: scriptEng.operands[i] = scriptEng.arrayPosition[5]; break;
-                    case VAR_ARRAYPOS6: scriptEng.operands[i] = scriptEng.arrayPosition[6]; break;
-                    case VAR_ARRAYPOS7: scriptEng.operands[i] = scriptEng.arrayPosition[7]; break;
-                    case VAR_GLOBAL: scriptEng.operands[i] = globalVariables[arrayVal].value; break;
-                    case VAR_LOCAL: scriptEng.operands[i] = scriptCode[arrayVal]; break;
-                    case VAR_OBJECTENTITYPOS: scriptEng.operands[i] = arrayVal; break;
-                    case VAR_OBJECTGROUPID: {
-                        scriptEng.operands[i] = objectEntityList[arrayVal].groupID;
-                        break;
-                    }
-                    case VAR_OBJECTTYPE: {
-                        scriptEng.operands[i] = objectEntityList[arrayVal].type;
-                        break;
-                    }
-                    case VAR_OBJECTPROPERTYVALUE: {
-                        scriptEng.operands[i] = objectEntityList[arrayVal].propertyValue;
-                        break;
-                    }
-                    case VAR_OBJECTXPOS: {
-                        scriptEng.operands[i] = objectEntityList[arrayVal].xpos;
-                        break;
-                    }
-                    case VAR_OBJECTYPOS: {
-                        scriptEng.operands[i] = objectEntityList[arrayVal].ypos;
+                    case VAR_TEMP0:
+                    case VAR_TEMP1:
+                    case VAR_TEMP2:
+                    case VAR_TEMP3:
+                    case VAR_TEMP4:
+                    case VAR_TEMP5:
+                    case VAR_TEMP6:
+                    case VAR_TEMP7: operand->ptr = &scriptEng.temp[operand->value - VAR_TEMP0]; break;
+                    case VAR_CHECKRESULT: operand->ptr = &scriptEng.checkResult; break;
+                    case VAR_ARRAYPOS0:
+                    case VAR_ARRAYPOS1:
+                    case VAR_ARRAYPOS2:
+                    case VAR_ARRAYPOS3:
+                    case VAR_ARRAYPOS4:
+                    case VAR_ARRAYPOS5:
+                    case VAR_ARRAYPOS6:
+                    case VAR_ARRAYPOS7: operand->ptr = &scriptEng.arrayPosition[operand->value - VAR_ARRAYPOS0]; break;
+                    case VAR_GLOBAL:
+                        if (operand->arrayMode == VARARR_ARRAY && !operand->indexIsArrayPos)
+                            operand->ptr = &globalVariables[operand->index].value;
+                        break;
+                    case VAR_LOCAL:
+                        if (operand->arrayMode == VARARR_ARRAY && !operand->indexIsArrayPos)
+                            operand->ptr = &scriptCode[operand->index];
+                        break;
+                }
+
+#if RETRO_USE_FUSED_SCRIPT_OPCODES
+                operand->entityField = GetOperandEntityField(operand->value);
+#endif
+                break;
+
+            case SCRIPTVAR_INTCONST: operand->value = scriptCode[scriptCodePtr++]; break;
+
+            case SCRIPTVAR_STRCONST:
+                operand->index     = scriptCode[scriptCodePtr++];
+                operand->value     = scriptCodePtr;
+                operand->stringPos = -1;
+                if (operand->index > 0)
+                    scriptCodePtr += operand->index >> 2;
+                scriptCodePtr++;
+                break;
+        }
+    }
+
+    return scriptCodePtr;
+}
+
+inline int32 GetOperandArrayPos(ScriptOperand *operand)
+{
+    int32 index = operand->indexIsArrayPos ? scriptEng.arrayPosition[operand->index] : operand->index;
+
+    switch (operand->arrayMode) {
+        default: return 0;
+        case VARARR_NONE: return objectEntityPos;
+        case VARARR_ARRAY: return index;
+        case VARARR_ENTNOPLUS1: return objectEntityPos + index;
+        case VARARR_ENTNOMINUS1: return objectEntityPos - index;
+    }
+}
+
+#if RETRO_USE_FUSED_SCRIPT_OPCODES
+inline bool32 IsFusedOperand(ScriptOperand *operand, bool32 writable)
+{
+    if (operand->type == SCRIPTVAR_INTCONST)
+        return !writable;
+
+    return operand->type == SCRIPTVAR_VAR && (operand->ptr || operand->entityField);
+}
+
+inline int32 *GetFusedOperandPtr(ScriptOperand *operand)
+{
+    if (operand->ptr)
+        return operand->ptr;
+
+    return (int32 *)&objectEntityList[GetOperandArrayPos(operand)] + (operand->entityField - 1);
+}
+
+// checks if an opcode can skip the generic operand read & write-back, this covers the arithmetic & compare/branch opcodes that make up most of
+// what scripts run, anything else (or anything with an operand that isn't a constant, fixed variable or plain entity field) goes the normal way
+// (this is decided as each opcode gets decoded, rather than by rewriting scriptCode when it's loaded, since the jump tables point straight into scriptCode)
+inline bool32 CanFuseInstruction(int32 opcode, ScriptOperand *operands)
+{
+    switch (opcode) {
+        default: return false;
+
+        case FUNC_INC:
+        case FUNC_DEC:
+        case FUNC_FLIPSIGN: return IsFusedOperand(&operands[0], true);
+
+        case FUNC_EQUAL:
+        case FUNC_ADD:
+        case FUNC_SUB:
+        case FUNC_MUL:
+        case FUNC_DIV:
+        case FUNC_SHR:
+        case FUNC_SHL:
+        case FUNC_AND:
+        case FUNC_OR:
+        case FUNC_XOR:
+        case FUNC_MOD:
+            if (!IsFusedOperand(&operands[0], true) || !IsFusedOperand(&operands[1], false))
+                return false;
+
+            // writing an arrayPos moves where the source gets written back to, so that has to go the normal way
+            return !(operands[0].value >= VAR_ARRAYPOS0 && operands[0].value <= VAR_ARRAYPOS7 && operands[1].type == SCRIPTVAR_VAR
+                     && operands[1].indexIsArrayPos);
+
+        case FUNC_CHECKEQUAL:
+        case FUNC_CHECKGREATER:
+        case FUNC_CHECKLOWER:
+        case FUNC_CHECKNOTEQUAL: return IsFusedOperand(&operands[0], false) && IsFusedOperand(&operands[1], false);
+
+        case FUNC_IFEQUAL:
+        case FUNC_IFGREATER:
+        case FUNC_IFGREATEROREQUAL:
+        case FUNC_IFLOWER:
+        case FUNC_IFLOWEROREQUAL:
+        case FUNC_IFNOTEQUAL:
+        case FUNC_WEQUAL:
+        case FUNC_WGREATER:
+        case FUNC_WGREATEROREQUAL:
+        case FUNC_WLOWER:
+        case FUNC_WLOWEROREQUAL:
+        case FUNC_WNOTEQUAL:
+            return IsFusedOperand(&operands[0], false) && IsFusedOperand(&operands[1], false) && IsFusedOperand(&operands[2], false);
+    }
+}
+
+// runs a fused opcode with the same results (including what gets written back) as the generic path, returns where to carry on from
+inline int32 RunFusedInstruction(int32 opcode, ScriptOperand *operands, int32 nextCodePtr, int32 scriptCodeStart, int32 jumpTableStart)
+{
+    int32 values[3];
+    int32 *dst = NULL;
+    int32 *src = NULL;
+
+    switch (opcode) {
+        default: break;
+
+        case FUNC_INC:
+        case FUNC_DEC:
+        case FUNC_FLIPSIGN:
+            dst = GetFusedOperandPtr(&operands[0]);
+            switch (opcode) {
+                default: break;
+                case FUNC_INC: ++*dst; break;
+                case FUNC_DEC: --*dst; break;
+                case FUNC_FLIPSIGN: *dst = -*dst; break;
+            }
+            break;
+
+        case FUNC_EQUAL:
+        case FUNC_ADD:
+        case FUNC_SUB:
+        case FUNC_MUL:
+        case FUNC_DIV:
+        case FUNC_SHR:
+        case FUNC_SHL:
+        case FUNC_AND:
+        case FUNC_OR:
+        case FUNC_XOR:
+        case FUNC_MOD: {
+            dst = GetFusedOperandPtr(&operands[0]);
+            if (operands[1].type == SCRIPTVAR_VAR) {
+                src       = GetFusedOperandPtr(&operands[1]);
+                values[1] = *src;
+            }
+            else {
+                values[1] = operands[1].value;
+            }
+
+            values[0] = *dst;
+            switch (opcode) {
+                default: break;
+                case FUNC_EQUAL: values[0] = values[1]; break;
+                case FUNC_ADD: values[0] += values[1]; break;
+                case FUNC_SUB: values[0] -= values[1]; break;
+                case FUNC_MUL: values[0] *= values[1]; break;
+                case FUNC_DIV: values[0] /= values[1]; break;
+                case FUNC_SHR: values[0] >>= values[1]; break;
+                case FUNC_SHL: values[0] <<= values[1]; break;
+                case FUNC_AND: values[0] &= values[1]; break;
+                case FUNC_OR: values[0] |= values[1]; break;
+                case FUNC_XOR: values[0] ^= values[1]; break;
+                case FUNC_MOD: values[0] %= values[1]; break;
+            }
+
+            // the source gets written back after the destination, which only matters if they're the same variable
+            *dst = values[0];
+            if (src == dst)
+                *dst = values[1];
+            break;
+        }
+
+        case FUNC_CHECKEQUAL:
+        case FUNC_CHECKGREATER:
+        case FUNC_CHECKLOWER:
+        case FUNC_CHECKNOTEQUAL:
+            for (int32 i = 0; i < 2; ++i)
+                values[i] = operands[i].type == SCRIPTVAR_INTCONST ? operands[i].value : *GetFusedOperandPtr(&operands[i]);
+
+            switch (opcode) {
+                default: break;
+                case FUNC_CHECKEQUAL: scriptEng.checkResult = values[0] == values[1]; break;
+                case FUNC_CHECKGREATER: scriptEng.checkResult = values[0] > values[1]; break;
+                case FUNC_CHECKLOWER: scriptEng.checkResult = values[0] < values[1]; break;
+                case FUNC_CHECKNOTEQUAL: scriptEng.checkResult = values[0] != values[1]; break;
+            }
+            break;
+
+        case FUNC_IFEQUAL:
+        case FUNC_IFGREATER:
+        case FUNC_IFGREATEROREQUAL:
+        case FUNC_IFLOWER:
+        case FUNC_IFLOWEROREQUAL:
+        case FUNC_IFNOTEQUAL:
+        case FUNC_WEQUAL:
+        case FUNC_WGREATER:
+        case FUNC_WGREATEROREQUAL:
+        case FUNC_WLOWER:
+        case FUNC_WLOWEROREQUAL:
+        case FUNC_WNOTEQUAL: {
+            for (int32 i = 0; i < 3; ++i)
+                values[i] = operands[i].type == SCRIPTVAR_INTCONST ? operands[i].value : *GetFusedOperandPtr(&operands[i]);
+
+            bool32 passed = false;
+            switch (opcode) {
+                default: break;
+                case FUNC_IFEQUAL:
+                case FUNC_WEQUAL: passed = values[1] == values[2]; break;
+                case FUNC_IFGREATER:
+                case FUNC_WGREATER: passed = values[1] > values[2]; break;
+                case FUNC_IFGREATEROREQUAL:
+                case FUNC_WGREATEROREQUAL: passed = values[1] >= values[2]; break;
+                case FUNC_IFLOWER:
+                case FUNC_WLOWER: passed = values[1] < values[2]; break;
+                case FUNC_IFLOWEROREQUAL:
+                case FUNC_WLOWEROREQUAL: passed = values[1] <= values[2]; break;
+                case FUNC_IFNOTEQUAL:
+                case FUNC_WNOTEQUAL: passed = values[1] != values[2]; break;
+            }
+
+            if (opcode <= FUNC_IFNOTEQUAL) {
+                jumpTableStack[++jumpTableStackPos] = values[0];
+                if (!passed)
+                    return scriptCodeStart + jumpTable[jumpTableStart + values[0]];
+            }
+            else {
+                if (!passed)
+                    return scriptCodeStart + jumpTable[jumpTableStart + values[0] + 1];
+                jumpTableStack[++jumpTableStackPos] = values[0];
+            }
+            break;
+        }
+    }
+
+    return nextCodePtr;
+}
+#endif
+
+} // namespace v4
+} // namespace Legacy
+} // namespace RSDK
+
+bool32 RSDK::Legacy::v4::DecodeScriptInstruction(int32 scriptCodePtr)
+{
+    int32 opcodeSize = functions[scriptCode[scriptCodePtr]].opcodeSize;
+    if (scriptOperandPos + opcodeSize > LEGACY_v4_OPERAND_COUNT)
+        return false;
+
+    ScriptInstruction *instruction = &scriptInstructionList[scriptCodePtr];
+    instruction->operandPos        = scriptOperandPos;
+    instruction->nextCodePtr       = DecodeScriptOperands(scriptCodePtr + 1, &scriptOperandList[scriptOperandPos], opcodeSize);
+#if RETRO_USE_FUSED_SCRIPT_OPCODES
+    instruction->fused = CanFuseInstruction(scriptCode[scriptCodePtr], &scriptOperandList[scriptOperandPos]);
+#endif
+
+    // unpack any string constants now, rather than every time the opcode runs
+    for (int32 i = 0; i < opcodeSize; ++i) {
+        ScriptOperand *operand = &scriptOperandList[scriptOperandPos + i];
+        if (operand->type != SCRIPTVAR_STRCONST || operand->index < 0 || scriptStringPos + operand->index + 1 > LEGACY_v4_STRING_COUNT)
+            continue;
+
+        char *string = &scriptStringList[scriptStringPos];
+        for (int32 c = 0; c < operand->index; ++c) string[c] = scriptCode[operand->value + (c >> 2)] >> (8 * (3 - (c & 3)));
+        string[operand->index] = 0;
+
+        operand->stringPos = scriptStringPos;
+        scriptStringPos += operand->index + 1;
+    }
+
+    scriptOperandPos += opcodeSize;
+    return true;
+}
+
+void RSDK::Legacy::v4::DecodeScriptCode(int32 scriptCodePtr)
+{
+    while (scriptCodePtr >= 0 && scriptCodePtr < LEGACY_v4_SCRIPTCODE_COUNT) {
+        ScriptInstruction *instruction = &scriptInstructionList[scriptCodePtr];
+        if (!instruction->nextCodePtr && !DecodeScriptInstruction(scriptCodePtr))
+            break;
+
+        int32 opcode = scriptCode[scriptCodePtr];
+        if (opcode == FUNC_END || opcode == FUNC_RETURN)
+            break;
+
+        scriptCodePtr = instruction->nextCodePtr;
+    }
+}
+#endif
+
+namespace RSDK
+{
+namespace Legacy
+{
+namespace v4
+{
+
+// what ProcessScript keeps about the opcode it's running, so its operands can be written back once its handler's done
+struct ScriptOpcodeState {
+    int32 opcodeSize;
+#if RETRO_USE_PREDECODED_SCRIPTS
+    int32 nextCodePtr;
+    ScriptOperand *operands;
+    ScriptOperand operandBuffer[0x10];
+#else
+    int32 scriptCodeOffset;
+#endif
+};
+
+// fetches the opcode at scriptCodePtr (running any fused opcodes on the way) & reads its operands into scriptEng.operands
+LEGACY_SCRIPT_INLINE int32 ReadScriptOpcode(ScriptOpcodeState *state, int32 &scriptCodePtr, int32 scriptCodeStart, int32 jumpTableStart)
+{
+    while (true) {
+        int32 opcode     = scriptCode[scriptCodePtr++];
+        int32 opcodeSize = functions[opcode].opcodeSize;
+#if !RETRO_USE_PREDECODED_SCRIPTS
+        int32 scriptCodeOffset = scriptCodePtr;
+#endif
+
+#if RETRO_USE_SCRIPT_PROFILER
+        ProfileScriptOpcode(opcode);
+#endif
+
+#if RETRO_USE_PREDECODED_SCRIPTS
+        ScriptOperand *operands = NULL;
+        int32 nextCodePtr       = 0;
+
+        ScriptInstruction *instruction = &scriptInstructionList[scriptCodePtr - 1];
+        if (instruction->nextCodePtr || DecodeScriptInstruction(scriptCodePtr - 1)) {
+            operands    = &scriptOperandList[instruction->operandPos];
+            nextCodePtr = instruction->nextCodePtr;
+        }
+        else {
+            // no room left to keep it, so it'll have to be decoded every time
+            operands    = state->operandBuffer;
+            nextCodePtr = DecodeScriptOperands(scriptCodePtr, operands, opcodeSize);
+        }
+
+#if RETRO_USE_FUSED_SCRIPT_OPCODES
+        if (instruction->fused) {
+            scriptCodePtr = RunFusedInstruction(opcode, operands, nextCodePtr, scriptCodeStart, jumpTableStart);
+            continue;
+        }
+#endif
+#endif
+
+        scriptText[0] = '\0';
+
+        // Get Values
+        for (int32 i = 0; i < opcodeSize; ++i) {
+#if RETRO_USE_PREDECODED_SCRIPTS
+            ScriptOperand *operand = &operands[i];
+            if (operand->ptr) {
+                scriptEng.operands[i] = *operand->ptr;
+                continue;
+            }
+
+            int32 opcodeType = operand->type;
+#else
+            int32 opcodeType = scriptCode[scriptCodePtr++];
+#endif
+
+            if (opcodeType == SCRIPTVAR_VAR) {
+#if RETRO_USE_PREDECODED_SCRIPTS
+                int32 arrayVal = GetOperandArrayPos(operand);
+#else
+                int32 arrayVal = 0;
+                switch (scriptCode[scriptCodePtr++]) {
+                    case VARARR_NONE: arrayVal = objectEntityPos; break;
+                    case VARARR_ARRAY:
+                        if (scriptCode[scriptCodePtr++] == 1)
+                            arrayVal = scriptEng.arrayPosition[scriptCode[scriptCodePtr++]];
+                        else
+                            arrayVal = scriptCode[scriptCodePtr++];
+                        break;
+                    case VARARR_ENTNOPLUS1:
+                        if (scriptCode[scriptCodePtr++] == 1)
+                            arrayVal = scriptEng.arrayPosition[scriptCode[scriptCodePtr++]] + objectEntityPos;
+                        else
+                            arrayVal = scriptCode[scriptCodePtr++] + objectEntityPos;
+                        break;
+                    case VARARR_ENTNOMINUS1:
+                        if (scriptCode[scriptCodePtr++] == 1)
+                            arrayVal = objectEntityPos - scriptEng.arrayPosition[scriptCode[scriptCodePtr++]];
+                        else
+                            arrayVal = objectEntityPos - scriptCode[scriptCodePtr++];
+                        break;
+                    default: break;
+                }
+#endif
+
+                // Variables
+#if RETRO_USE_PREDECODED_SCRIPTS
+                switch (operand->value) {
+#else
+                switch (scriptCode[scriptCodePtr++]) {
+#endif
+                    default: break;
+                    case VAR_TEMP0: scriptEng.operands[i] = scriptEng.temp[0]; break;
+                    case VAR_TEMP1: scriptEng.operands[i] = scriptEng.temp[1]; break;
+                    case VAR_TEMP2: scriptEng.operands[i] = scriptEng.temp[2]; break;
+                    case VAR_TEMP3: scriptEng.operands[i] = scriptEng.temp[3]; break;
+                    case VAR_TEMP4: scriptEng.operands[i] = scriptEng.temp[4]; break;
+                    case VAR_TEMP5: scriptEng.operands[i] = scriptEng.temp[5]; break;
+                    case VAR_TEMP6: scriptEng.operands[i] = scriptEng.temp[6]; break;
+                    case VAR_TEMP7: scriptEng.operands[i] = scriptEng.temp[7]; break;
+                    case VAR_CHECKRESULT: scriptEng.operands[i] = scriptEng.checkResult; break;
+                    case VAR_ARRAYPOS0: scriptEng.operands[i] = scriptEng.arrayPosition[0]; break;
+                    case VAR_ARRAYPOS1: scriptEng.operands[i] = scriptEng.arrayPosition[1]; break;
+                    case VAR_ARRAYPOS2: scriptEng.operands[i] = scriptEng.arrayPosition[2]; break;
+                    case VAR_ARRAYPOS3: scriptEng.operands[i] = scriptEng.arrayPosition[3]; break;
+                    case VAR_ARRAYPOS4: scriptEng.operands[i] = scriptEng.arrayPosition[4]; break;
+                    case VAR_ARRAYPOS5: scriptEng.operands[i] = scriptEng.arrayPosition[5]; break;
+                    case VAR_ARRAYPOS6: scriptEng.operands[i] = scriptEng.arrayPosition[6]; break;
+                    case VAR_ARRAYPOS7: scriptEng.operands[i] = scriptEng.arrayPosition[7]; break;
+                    case VAR_GLOBAL: scriptEng.operands[i] = globalVariables[arrayVal].value; break;
+                    case VAR_LOCAL: scriptEng.operands[i] = scriptCode[arrayVal]; break;
+                    case VAR_OBJECTENTITYPOS: scriptEng.operands[i] = arrayVal; break;
+                    case VAR_OBJECTGROUPID: {
+                        scriptEng.operands[i] = objectEntityList[arrayVal].groupID;
+                        break;
+                    }
+                    case VAR_OBJECTTYPE: {
+                        scriptEng.operands[i] = objectEntityList[arrayVal].type;
+                        break;
+                    }
+                    case VAR_OBJECTPROPERTYVALUE: {
+                        scriptEng.operands[i] = objectEntityList[arrayVal].propertyValue;
+                        break;
+                    }
+                    case VAR_OBJECTXPOS: {
+                        scriptEng.operands[i] = objectEntityList[arrayVal].xpos;
+                        break;
+                    }
+                    case VAR_OBJECTYPOS: {
+                        scriptEng.operands[i] = objectEntityList[arrayVal].ypos;
                         break;
                     }
                     case VAR_OBJECTIXPOS: {
@@ -3859,10 +4357,24 @@ void RSDK::Legacy::v4::ProcessScript(int32 scriptCodeStart, int32 jumpTableStart
                 }
             }
             else if (opcodeType == SCRIPTVAR_INTCONST) { // int32 constant
+#if RETRO_USE_PREDECODED_SCRIPTS
+                scriptEng.operands[i] = operand->value;
+#else
                 scriptEng.operands[i] = scriptCode[scriptCodePtr++];
+#endif
             }
             else if (opcodeType == SCRIPTVAR_STRCONST) { // string constant
+#if RETRO_USE_PREDECODED_SCRIPTS
+                if (operand->stringPos >= 0) {
+                    memcpy(scriptText, &scriptStringList[operand->stringPos], operand->index + 1);
+                    continue;
+                }
+
+                scriptCodePtr      = operand->value;
+                int32 strLen       = operand->index;
+#else
                 int32 strLen       = scriptCode[scriptCodePtr++];
+#endif
                 scriptText[strLen] = 0;
                 for (int32 c = 0; c < strLen; ++c) {
                     switch (c % 4) {
@@ -3889,2126 +4401,2268 @@ void RSDK::Legacy::v4::ProcessScript(int32 scriptCodeStart, int32 jumpTableStart
             }
         }
 
-        ObjectScript *scriptInfo = &objectScriptList[objectEntityList[objectEntityPos].type];
-        Entity *entity           = &objectEntityList[objectEntityPos];
-        SpriteFrame *spriteFrame = nullptr;
+        state->opcodeSize = opcodeSize;
+#if RETRO_USE_PREDECODED_SCRIPTS
+        scriptCodePtr      = nextCodePtr;
+        state->nextCodePtr = nextCodePtr;
+        state->operands    = operands;
+#else
+        state->scriptCodeOffset = scriptCodeOffset;
+#endif
+        return opcode;
+    }
+}
 
-        // Functions
-        switch (opcode) {
-            default: break;
-            case FUNC_END: running = false; break;
-            case FUNC_EQUAL: scriptEng.operands[0] = scriptEng.operands[1]; break;
-            case FUNC_ADD: scriptEng.operands[0] += scriptEng.operands[1]; break;
-            case FUNC_SUB: scriptEng.operands[0] -= scriptEng.operands[1]; break;
-            case FUNC_INC: ++scriptEng.operands[0]; break;
-            case FUNC_DEC: --scriptEng.operands[0]; break;
-            case FUNC_MUL: scriptEng.operands[0] *= scriptEng.operands[1]; break;
-            case FUNC_DIV: scriptEng.operands[0] /= scriptEng.operands[1]; break;
-            case FUNC_SHR: scriptEng.operands[0] >>= scriptEng.operands[1]; break;
-            case FUNC_SHL: scriptEng.operands[0] <<= scriptEng.operands[1]; break;
-            case FUNC_AND: scriptEng.operands[0] &= scriptEng.operands[1]; break;
-            case FUNC_OR: scriptEng.operands[0] |= scriptEng.operands[1]; break;
-            case FUNC_XOR: scriptEng.operands[0] ^= scriptEng.operands[1]; break;
-            case FUNC_MOD: scriptEng.operands[0] %= scriptEng.operands[1]; break;
-            case FUNC_FLIPSIGN: scriptEng.operands[0] = -scriptEng.operands[0]; break;
-            case FUNC_CHECKEQUAL:
-                scriptEng.checkResult = scriptEng.operands[0] == scriptEng.operands[1];
-                opcodeSize            = 0;
-                break;
-            case FUNC_CHECKGREATER:
-                scriptEng.checkResult = scriptEng.operands[0] > scriptEng.operands[1];
-                opcodeSize            = 0;
-                break;
-            case FUNC_CHECKLOWER:
-                scriptEng.checkResult = scriptEng.operands[0] < scriptEng.operands[1];
-                opcodeSize            = 0;
-                break;
-            case FUNC_CHECKNOTEQUAL:
-                scriptEng.checkResult = scriptEng.operands[0] != scriptEng.operands[1];
-                opcodeSize            = 0;
-                break;
-            case FUNC_IFEQUAL:
-                if (scriptEng.operands[1] != scriptEng.operands[2])
-                    scriptCodePtr = scriptCodeStart + jumpTable[jumpTableStart + scriptEng.operands[0]];
-                jumpTableStack[++jumpTableStackPos] = scriptEng.operands[0];
-                opcodeSize                          = 0;
-                break;
-            case FUNC_IFGREATER:
-                if (scriptEng.operands[1] <= scriptEng.operands[2])
-                    scriptCodePtr = scriptCodeStart + jumpTable[jumpTableStart + scriptEng.operands[0]];
-                jumpTableStack[++jumpTableStackPos] = scriptEng.operands[0];
-                opcodeSize                          = 0;
-                break;
-            case FUNC_IFGREATEROREQUAL:
-                if (scriptEng.operands[1] < scriptEng.operands[2])
-                    scriptCodePtr = scriptCodeStart + jumpTable[jumpTableStart + scriptEng.operands[0]];
-                jumpTableStack[++jumpTableStackPos] = scriptEng.operands[0];
-                opcodeSize                          = 0;
-                break;
-            case FUNC_IFLOWER:
-                if (scriptEng.operands[1] >= scriptEng.operands[2])
-                    scriptCodePtr = scriptCodeStart + jumpTable[jumpTableStart + scriptEng.operands[0]];
-                jumpTableStack[++jumpTableStackPos] = scriptEng.operands[0];
-                opcodeSize                          = 0;
-                break;
-            case FUNC_IFLOWEROREQUAL:
-                if (scriptEng.operands[1] > scriptEng.operands[2])
-                    scriptCodePtr = scriptCodeStart + jumpTable[jumpTableStart + scriptEng.operands[0]];
-                jumpTableStack[++jumpTableStackPos] = scriptEng.operands[0];
-                opcodeSize                          = 0;
-                break;
-            case FUNC_IFNOTEQUAL:
-                if (scriptEng.operands[1] == scriptEng.operands[2])
-                    scriptCodePtr = scriptCodeStart + jumpTable[jumpTableStart + scriptEng.operands[0]];
-                jumpTableStack[++jumpTableStackPos] = scriptEng.operands[0];
-                opcodeSize                          = 0;
-                break;
-            case FUNC_ELSE:
-                opcodeSize    = 0;
-                scriptCodePtr = scriptCodeStart + jumpTable[jumpTableStart + jumpTableStack[jumpTableStackPos--] + 1];
-                break;
-            case FUNC_ENDIF:
-                opcodeSize = 0;
-                --jumpTableStackPos;
-                break;
-            case FUNC_WEQUAL:
-                if (scriptEng.operands[1] != scriptEng.operands[2])
-                    scriptCodePtr = scriptCodeStart + jumpTable[jumpTableStart + scriptEng.operands[0] + 1];
-                else
-                    jumpTableStack[++jumpTableStackPos] = scriptEng.operands[0];
-                opcodeSize = 0;
-                break;
-            case FUNC_WGREATER:
-                if (scriptEng.operands[1] <= scriptEng.operands[2])
-                    scriptCodePtr = scriptCodeStart + jumpTable[jumpTableStart + scriptEng.operands[0] + 1];
-                else
-                    jumpTableStack[++jumpTableStackPos] = scriptEng.operands[0];
-                opcodeSize = 0;
-                break;
-            case FUNC_WGREATEROREQUAL:
-                if (scriptEng.operands[1] < scriptEng.operands[2])
-                    scriptCodePtr = scriptCodeStart + jumpTable[jumpTableStart + scriptEng.operands[0] + 1];
-                else
-                    jumpTableStack[++jumpTableStackPos] = scriptEng.operands[0];
-                opcodeSize = 0;
-                break;
-            case FUNC_WLOWER:
-                if (scriptEng.operands[1] >= scriptEng.operands[2])
-                    scriptCodePtr = scriptCodeStart + jumpTable[jumpTableStart + scriptEng.operands[0] + 1];
-                else
-                    jumpTableStack[++jumpTableStackPos] = scriptEng.operands[0];
-                opcodeSize = 0;
-                break;
-            case FUNC_WLOWEROREQUAL:
-                if (scriptEng.operands[1] > scriptEng.operands[2])
-                    scriptCodePtr = scriptCodeStart + jumpTable[jumpTableStart + scriptEng.operands[0] + 1];
-                else
-                    jumpTableStack[++jumpTableStackPos] = scriptEng.operands[0];
-                opcodeSize = 0;
-                break;
-            case FUNC_WNOTEQUAL:
-                if (scriptEng.operands[1] == scriptEng.operands[2])
-                    scriptCodePtr = scriptCodeStart + jumpTable[jumpTableStart + scriptEng.operands[0] + 1];
-                else
-                    jumpTableStack[++jumpTableStackPos] = scriptEng.operands[0];
-                opcodeSize = 0;
-                break;
-            case FUNC_LOOP:
-                opcodeSize    = 0;
-                scriptCodePtr = scriptCodeStart + jumpTable[jumpTableStart + jumpTableStack[jumpTableStackPos--]];
-                break;
-            case FUNC_FOREACHACTIVE: {
-                int32 groupID = scriptEng.operands[1];
-                if (groupID < LEGACY_v4_TYPEGROUP_COUNT) {
-                    int32 loop                    = foreachStack[++foreachStackPos] + 1;
-                    foreachStack[foreachStackPos] = loop;
-                    if (loop >= objectTypeGroupList[groupID].listSize) {
-                        opcodeSize                      = 0;
-                        foreachStack[foreachStackPos--] = -1;
-                        scriptCodePtr                   = scriptCodeStart + jumpTable[jumpTableStart + scriptEng.operands[0] + 1];
-                        break;
-                    }
-                    else {
-                        scriptEng.operands[2]               = objectTypeGroupList[groupID].entityRefs[loop];
-                        jumpTableStack[++jumpTableStackPos] = scriptEng.operands[0];
-                    }
-                }
-                else {
-                    opcodeSize    = 0;
-                    scriptCodePtr = scriptCodeStart + jumpTable[jumpTableStart + scriptEng.operands[0] + 1];
-                }
-                break;
+// writes the operands back to wherever they were read from, once the opcode's handler has run
+LEGACY_SCRIPT_INLINE void WriteScriptOperands(ScriptOpcodeState *state, int32 &scriptCodePtr)
+{
+    int32 opcodeSize = state->opcodeSize;
+#if RETRO_USE_PREDECODED_SCRIPTS
+    int32 nextCodePtr       = state->nextCodePtr;
+    ScriptOperand *operands = state->operands;
+#else
+    int32 scriptCodeOffset = state->scriptCodeOffset;
+#endif
+
+
+    // Set Values
+#if RETRO_USE_PREDECODED_SCRIPTS
+    if (opcodeSize > 0)
+        scriptCodePtr = nextCodePtr;
+#else
+    if (opcodeSize > 0)
+        scriptCodePtr -= scriptCodePtr - scriptCodeOffset;
+#endif
+    for (int32 i = 0; i < opcodeSize; ++i) {
+#if RETRO_USE_PREDECODED_SCRIPTS
+        ScriptOperand *operand = &operands[i];
+        if (operand->ptr) {
+            *operand->ptr = scriptEng.operands[i];
+            continue;
+        }
+
+        int32 opcodeType = operand->type;
+#else
+        int32 opcodeType = scriptCode[scriptCodePtr++];
+#endif
+        if (opcodeType == SCRIPTVAR_VAR) {
+#if RETRO_USE_PREDECODED_SCRIPTS
+            int32 arrayVal = GetOperandArrayPos(operand);
+#else
+            int32 arrayVal = 0;
+            switch (scriptCode[scriptCodePtr++]) { // variable
+                case VARARR_NONE: arrayVal = objectEntityPos; break;
+                case VARARR_ARRAY:
+                    if (scriptCode[scriptCodePtr++] == 1)
+                        arrayVal = scriptEng.arrayPosition[scriptCode[scriptCodePtr++]];
+                    else
+                        arrayVal = scriptCode[scriptCodePtr++];
+                    break;
+                case VARARR_ENTNOPLUS1:
+                    if (scriptCode[scriptCodePtr++] == 1)
+                        arrayVal = objectEntityPos + scriptEng.arrayPosition[scriptCode[scriptCodePtr++]];
+                    else
+                        arrayVal = objectEntityPos + scriptCode[scriptCodePtr++];
+                    break;
+                case VARARR_ENTNOMINUS1:
+                    if (scriptCode[scriptCodePtr++] == 1)
+                        arrayVal = objectEntityPos - scriptEng.arrayPosition[scriptCode[scriptCodePtr++]];
+                    else
+                        arrayVal = objectEntityPos - scriptCode[scriptCodePtr++];
+                    break;
+                default: break;
             }
-            case FUNC_FOREACHALL: {
-                int32 objType = scriptEng.operands[1];
-                if (objType < LEGACY_v4_OBJECT_COUNT) {
-                    int32 loop                    = foreachStack[++foreachStackPos] + 1;
-                    foreachStack[foreachStackPos] = loop;
+#endif
 
-                    if (scriptEvent == EVENT_SETUP) {
-                        while (true) {
-                            if (loop >= LEGACY_v4_TEMPENTITY_START) {
-                                opcodeSize                      = 0;
-                                foreachStack[foreachStackPos--] = -1;
-                                scriptCodePtr                   = scriptCodeStart + jumpTable[jumpTableStart + scriptEng.operands[0] + 1];
-                                break;
-                            }
-                            else if (objType == objectEntityList[loop].type) {
-                                scriptEng.operands[2]               = loop;
-                                jumpTableStack[++jumpTableStackPos] = scriptEng.operands[0];
-                                break;
-                            }
-                            else {
-                                foreachStack[foreachStackPos] = ++loop;
-                            }
-                        }
-                    }
-                    else {
-                        while (true) {
-                            if (loop >= LEGACY_v4_ENTITY_COUNT) {
-                                opcodeSize                      = 0;
-                                foreachStack[foreachStackPos--] = -1;
-                                scriptCodePtr                   = scriptCodeStart + jumpTable[jumpTableStart + scriptEng.operands[0] + 1];
-                                break;
-                            }
-                            else if (objType == objectEntityList[loop].type) {
-                                scriptEng.operands[2]               = loop;
-                                jumpTableStack[++jumpTableStackPos] = scriptEng.operands[0];
-                                break;
-                            }
-                            else {
-                                foreachStack[foreachStackPos] = ++loop;
-                            }
-                        }
-                    }
+            // Variables
+#if RETRO_USE_PREDECODED_SCRIPTS
+            switch (operand->value) {
+#else
+            switch (scriptCode[scriptCodePtr++]) {
+#endif
+                default: break;
+                case VAR_TEMP0: scriptEng.temp[0] = scriptEng.operands[i]; break;
+                case VAR_TEMP1: scriptEng.temp[1] = scriptEng.operands[i]; break;
+                case VAR_TEMP2: scriptEng.temp[2] = scriptEng.operands[i]; break;
+                case VAR_TEMP3: scriptEng.temp[3] = scriptEng.operands[i]; break;
+                case VAR_TEMP4: scriptEng.temp[4] = scriptEng.operands[i]; break;
+                case VAR_TEMP5: scriptEng.temp[5] = scriptEng.operands[i]; break;
+                case VAR_TEMP6: scriptEng.temp[6] = scriptEng.operands[i]; break;
+                case VAR_TEMP7: scriptEng.temp[7] = scriptEng.operands[i]; break;
+                case VAR_CHECKRESULT: scriptEng.checkResult = scriptEng.operands[i]; break;
+                case VAR_ARRAYPOS0: scriptEng.arrayPosition[0] = scriptEng.operands[i]; break;
+                case VAR_ARRAYPOS1: scriptEng.arrayPosition[1] = scriptEng.operands[i]; break;
+                case VAR_ARRAYPOS2: scriptEng.arrayPosition[2] = scriptEng.operands[i]; break;
+                case VAR_ARRAYPOS3: scriptEng.arrayPosition[3] = scriptEng.operands[i]; break;
+                case VAR_ARRAYPOS4: scriptEng.arrayPosition[4] = scriptEng.operands[i]; break;
+                case VAR_ARRAYPOS5: scriptEng.arrayPosition[5] = scriptEng.operands[i]; break;
+                case VAR_ARRAYPOS6: scriptEng.arrayPosition[6] = scriptEng.operands[i]; break;
+                case VAR_ARRAYPOS7: scriptEng.arrayPosition[7] = scriptEng.operands[i]; break;
+                case VAR_GLOBAL: globalVariables[arrayVal].value = scriptEng.operands[i]; break;
+                case VAR_LOCAL: scriptCode[arrayVal] = scriptEng.operands[i]; break;
+                case VAR_OBJECTENTITYPOS: break;
+                case VAR_OBJECTGROUPID: {
+                    objectEntityList[arrayVal].groupID = scriptEng.operands[i];
+                    break;
                 }
-                else {
-                    opcodeSize    = 0;
-                    scriptCodePtr = scriptCodeStart + jumpTable[jumpTableStart + scriptEng.operands[0] + 1];
+                case VAR_OBJECTTYPE: {
+                    objectEntityList[arrayVal].type = scriptEng.operands[i];
+                    break;
                 }
-                break;
-            }
-            case FUNC_NEXT:
-                opcodeSize    = 0;
-                scriptCodePtr = scriptCodeStart + jumpTable[jumpTableStart + jumpTableStack[jumpTableStackPos--]];
-                --foreachStackPos;
-                break;
-            case FUNC_SWITCH:
-                jumpTableStack[++jumpTableStackPos] = scriptEng.operands[0];
-                if (scriptEng.operands[1] < jumpTable[jumpTableStart + scriptEng.operands[0]]
-                    || scriptEng.operands[1] > jumpTable[jumpTableStart + scriptEng.operands[0] + 1])
-                    scriptCodePtr = scriptCodeStart + jumpTable[jumpTableStart + scriptEng.operands[0] + 2];
-                else
-                    scriptCodePtr = scriptCodeStart
-                                    + jumpTable[jumpTableStart + scriptEng.operands[0] + 4
-                                                + (scriptEng.operands[1] - jumpTable[jumpTableStart + scriptEng.operands[0]])];
-                opcodeSize = 0;
-                break;
-            case FUNC_BREAK:
-                opcodeSize    = 0;
-                scriptCodePtr = scriptCodeStart + jumpTable[jumpTableStart + jumpTableStack[jumpTableStackPos--] + 3];
-                break;
-            case FUNC_ENDSWITCH:
-                opcodeSize = 0;
-                --jumpTableStackPos;
-                break;
-            case FUNC_RAND: scriptEng.operands[0] = rand() % scriptEng.operands[1]; break;
-            case FUNC_SIN: {
-                scriptEng.operands[0] = Sin512(scriptEng.operands[1]);
-                break;
-            }
-            case FUNC_COS: {
-                scriptEng.operands[0] = Cos512(scriptEng.operands[1]);
-                break;
-            }
-            case FUNC_SIN256: {
-                scriptEng.operands[0] = Sin256(scriptEng.operands[1]);
-                break;
-            }
-            case FUNC_COS256: {
-                scriptEng.operands[0] = Cos256(scriptEng.operands[1]);
-                break;
-            }
-            case FUNC_ATAN2: {
-                scriptEng.operands[0] = ArcTanLookup(scriptEng.operands[1], scriptEng.operands[2]);
-                break;
-            }
-            case FUNC_INTERPOLATE:
-                scriptEng.operands[0] =
-                    (scriptEng.operands[2] * (0x100 - scriptEng.operands[3]) + scriptEng.operands[3] * scriptEng.operands[1]) >> 8;
-                break;
-            case FUNC_INTERPOLATEXY:
-                scriptEng.operands[0] =
-                    (scriptEng.operands[3] * (0x100 - scriptEng.operands[6]) >> 8) + ((scriptEng.operands[6] * scriptEng.operands[2]) >> 8);
-                scriptEng.operands[1] =
-                    (scriptEng.operands[5] * (0x100 - scriptEng.operands[6]) >> 8) + (scriptEng.operands[6] * scriptEng.operands[4] >> 8);
-                break;
-            case FUNC_LOADSPRITESHEET:
-                opcodeSize                = 0;
-                scriptInfo->spriteSheetID = AddGraphicsFile(scriptText);
-                break;
-            case FUNC_REMOVESPRITESHEET:
-                opcodeSize = 0;
-                RemoveGraphicsFile(scriptText, -1);
-                break;
-            case FUNC_DRAWSPRITE:
-                opcodeSize  = 0;
-                spriteFrame = &scriptFrames[scriptInfo->frameListOffset + scriptEng.operands[0]];
-                DrawSprite((entity->xpos >> 16) - xScrollOffset + spriteFrame->pivotX, (entity->ypos >> 16) - yScrollOffset + spriteFrame->pivotY,
-                           spriteFrame->width, spriteFrame->height, spriteFrame->sprX, spriteFrame->sprY, scriptInfo->spriteSheetID);
-                break;
-            case FUNC_DRAWSPRITEXY:
-                opcodeSize  = 0;
-                spriteFrame = &scriptFrames[scriptInfo->frameListOffset + scriptEng.operands[0]];
-                DrawSprite((scriptEng.operands[1] >> 16) - xScrollOffset + spriteFrame->pivotX,
-                           (scriptEng.operands[2] >> 16) - yScrollOffset + spriteFrame->pivotY, spriteFrame->width, spriteFrame->height,
-                           spriteFrame->sprX, spriteFrame->sprY, scriptInfo->spriteSheetID);
-                break;
-            case FUNC_DRAWSPRITESCREENXY:
-                opcodeSize  = 0;
-                spriteFrame = &scriptFrames[scriptInfo->frameListOffset + scriptEng.operands[0]];
-                DrawSprite(scriptEng.operands[1] + spriteFrame->pivotX, scriptEng.operands[2] + spriteFrame->pivotY, spriteFrame->width,
-                           spriteFrame->height, spriteFrame->sprX, spriteFrame->sprY, scriptInfo->spriteSheetID);
-                break;
-            case FUNC_DRAWTINTRECT:
-                opcodeSize = 0;
-                DrawTintRectangle(scriptEng.operands[0], scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]);
-                break;
-            case FUNC_DRAWNUMBERS: {
-                opcodeSize = 0;
-                int32 i    = 10;
-                if (scriptEng.operands[6]) {
-                    while (scriptEng.operands[4] > 0) {
-                        int32 frameID = scriptEng.operands[3] % i / (i / 10) + scriptEng.operands[0];
-                        spriteFrame   = &scriptFrames[scriptInfo->frameListOffset + frameID];
-                        DrawSprite(spriteFrame->pivotX + scriptEng.operands[1], spriteFrame->pivotY + scriptEng.operands[2], spriteFrame->width,
-                                   spriteFrame->height, spriteFrame->sprX, spriteFrame->sprY, scriptInfo->spriteSheetID);
-                        scriptEng.operands[1] -= scriptEng.operands[5];
-                        i *= 10;
-                        --scriptEng.operands[4];
-                    }
+                case VAR_OBJECTPROPERTYVALUE: {
+                    objectEntityList[arrayVal].propertyValue = scriptEng.operands[i];
+                    break;
                 }
-                else {
-                    int32 extra = 10;
-                    if (scriptEng.operands[3])
-                        extra = 10 * scriptEng.operands[3];
-                    while (scriptEng.operands[4] > 0) {
-                        if (extra >= i) {
-                            int32 frameID = scriptEng.operands[3] % i / (i / 10) + scriptEng.operands[0];
-                            spriteFrame   = &scriptFrames[scriptInfo->frameListOffset + frameID];
-                            DrawSprite(spriteFrame->pivotX + scriptEng.operands[1], spriteFrame->pivotY + scriptEng.operands[2], spriteFrame->width,
-                                       spriteFrame->height, spriteFrame->sprX, spriteFrame->sprY, scriptInfo->spriteSheetID);
-                        }
-                        scriptEng.operands[1] -= scriptEng.operands[5];
-                        i *= 10;
-                        --scriptEng.operands[4];
-                    }
+                case VAR_OBJECTXPOS: {
+                    objectEntityList[arrayVal].xpos = scriptEng.operands[i];
+                    break;
                 }
-                break;
-            }
-            case FUNC_DRAWACTNAME: {
-                opcodeSize   = 0;
-                int32 charID = 0;
-                switch (scriptEng.operands[3]) { // Draw Mode
-                    case 0:                      // Draw Word 1 (but aligned from the right instead of left)
-                        charID = 0;
-
-                        for (charID = 0;; ++charID) {
-                            int32 nextChar = titleCardText[charID + 1];
-                            if (nextChar == '-' || !nextChar)
-                                break;
-                        }
-
-                        while (charID >= 0) {
-                            int32 character = titleCardText[charID];
-                            if (character == ' ')
-                                character = -1; // special space char
-                            if (character == '-')
-                                character = 0;
-                            if (character >= '0' && character <= '9')
-                                character -= 22;
-                            if (character > '9' && character < 'f')
-                                character -= 'A';
-
-                            if (character <= -1) {
-                                scriptEng.operands[1] -= scriptEng.operands[5] + scriptEng.operands[6]; // spaceWidth + spacing
-                            }
-                            else {
-                                character += scriptEng.operands[0];
-                                spriteFrame = &scriptFrames[scriptInfo->frameListOffset + character];
-
-                                scriptEng.operands[1] -= spriteFrame->width + scriptEng.operands[6];
-
-                                DrawSprite(scriptEng.operands[1] + spriteFrame->pivotX, scriptEng.operands[2] + spriteFrame->pivotY,
-                                           spriteFrame->width, spriteFrame->height, spriteFrame->sprX, spriteFrame->sprY, scriptInfo->spriteSheetID);
-                            }
-                            charID--;
-                        }
-                        break;
-
-                    case 1: // Draw Word 1
-                        charID = 0;
-
-                        // Draw the first letter as a capital letter, the rest are lowercase
-                        // (if scriptEng.operands[4] is trueotherwise they're all uppercase)
-                        if (scriptEng.operands[4] == 1 && titleCardText[charID] != 0) {
-                            int32 character = titleCardText[charID];
-                            if (character == ' ')
-                                character = 0;
-                            if (character == '-')
-                                character = 0;
-                            if (character >= '0' && character <= '9')
-                                character -= 22;
-                            if (character > '9' && character < 'f')
-                                character -= 'A';
-
-                            if (character <= -1) {
-                                scriptEng.operands[1] += scriptEng.operands[5] + scriptEng.operands[6]; // spaceWidth + spacing
-                            }
-                            else {
-                                character += scriptEng.operands[0];
-                                spriteFrame = &scriptFrames[scriptInfo->frameListOffset + character];
-                                DrawSprite(scriptEng.operands[1] + spriteFrame->pivotX, scriptEng.operands[2] + spriteFrame->pivotY,
-                                           spriteFrame->width, spriteFrame->height, spriteFrame->sprX, spriteFrame->sprY, scriptInfo->spriteSheetID);
-                                scriptEng.operands[1] += spriteFrame->width + scriptEng.operands[6];
-                            }
-
-                            scriptEng.operands[0] += 26;
-                            charID++;
-                        }
-
-                        while (titleCardText[charID] != 0 && titleCardText[charID] != '-') {
-                            int32 character = titleCardText[charID];
-                            if (character == ' ')
-                                character = 0;
-                            if (character == '-')
-                                character = 0;
-                            if (character > '/' && character < ':')
-                                character -= 22;
-                            if (character > '9' && character < 'f')
-                                character -= 'A';
-
-                            if (character <= -1) {
-                                scriptEng.operands[1] += scriptEng.operands[5] + scriptEng.operands[6]; // spaceWidth + spacing
-                            }
-                            else {
-                                character += scriptEng.operands[0];
-                                spriteFrame = &scriptFrames[scriptInfo->frameListOffset + character];
-                                DrawSprite(scriptEng.operands[1] + spriteFrame->pivotX, scriptEng.operands[2] + spriteFrame->pivotY,
-                                           spriteFrame->width, spriteFrame->height, spriteFrame->sprX, spriteFrame->sprY, scriptInfo->spriteSheetID);
-                                scriptEng.operands[1] += spriteFrame->width + scriptEng.operands[6];
-                            }
-                            charID++;
-                        }
-                        break;
-
-                    case 2: // Draw Word 2
-                        charID = titleCardWord2;
-
-                        // Draw the first letter as a capital letter, the rest are lowercase
-                        // (if scriptEng.operands[4] is true, otherwise they're all uppercase)
-                        if (scriptEng.operands[4] == 1 && titleCardText[charID] != 0) {
-                            int32 character = titleCardText[charID];
-                            if (character == ' ')
-                                character = 0;
-                            if (character == '-')
-                                character = 0;
-                            if (character >= '0' && character <= '9')
-                                character -= 22;
-                            if (character > '9' && character < 'f')
-                                character -= 'A';
-
-                            if (character <= -1) {
-                                scriptEng.operands[1] += scriptEng.operands[5] + scriptEng.operands[6]; // spaceWidth + spacing
-                            }
-                            else {
-                                character += scriptEng.operands[0];
-                                spriteFrame = &scriptFrames[scriptInfo->frameListOffset + character];
-                                DrawSprite(scriptEng.operands[1] + spriteFrame->pivotX, scriptEng.operands[2] + spriteFrame->pivotY,
-                                           spriteFrame->width, spriteFrame->height, spriteFrame->sprX, spriteFrame->sprY, scriptInfo->spriteSheetID);
-                                scriptEng.operands[1] += spriteFrame->width + scriptEng.operands[6];
-                            }
-                            scriptEng.operands[0] += 26;
-                            charID++;
-                        }
-
-                        while (titleCardText[charID] != 0) {
-                            int32 character = titleCardText[charID];
-                            if (character == ' ')
-                                character = 0;
-                            if (character == '-')
-                                character = 0;
-                            if (character >= '0' && character <= '9')
-                                character -= 22;
-                            if (character > '9' && character < 'f')
-                                character -= 'A';
-
-                            if (character <= -1) {
-                                scriptEng.operands[1] += scriptEng.operands[5] + scriptEng.operands[6]; // spaceWidth + spacing
-                            }
-                            else {
-                                character += scriptEng.operands[0];
-                                spriteFrame = &scriptFrames[scriptInfo->frameListOffset + character];
-                                DrawSprite(scriptEng.operands[1] + spriteFrame->pivotX, scriptEng.operands[2] + spriteFrame->pivotY,
-                                           spriteFrame->width, spriteFrame->height, spriteFrame->sprX, spriteFrame->sprY, scriptInfo->spriteSheetID);
-                                scriptEng.operands[1] += spriteFrame->width + scriptEng.operands[6];
-                            }
-                            charID++;
-                        }
-                        break;
+                case VAR_OBJECTYPOS: {
+                    objectEntityList[arrayVal].ypos = scriptEng.operands[i];
+                    break;
                 }
-                break;
-            }
-            case FUNC_DRAWMENU:
-                opcodeSize        = 0;
-                textMenuSurfaceNo = scriptInfo->spriteSheetID;
-                DrawTextMenu(&gameMenu[scriptEng.operands[0]], scriptEng.operands[1], scriptEng.operands[2]);
-                break;
-            case FUNC_SPRITEFRAME:
-                opcodeSize = 0;
-                if (scriptEvent == EVENT_SETUP && scriptFrameCount < LEGACY_SPRITEFRAME_COUNT) {
-                    scriptFrames[scriptFrameCount].pivotX = scriptEng.operands[0];
-                    scriptFrames[scriptFrameCount].pivotY = scriptEng.operands[1];
-                    scriptFrames[scriptFrameCount].width  = scriptEng.operands[2];
-                    scriptFrames[scriptFrameCount].height = scriptEng.operands[3];
-                    scriptFrames[scriptFrameCount].sprX   = scriptEng.operands[4];
-                    scriptFrames[scriptFrameCount].sprY   = scriptEng.operands[5];
-                    ++scriptFrameCount;
+                case VAR_OBJECTIXPOS: {
+                    objectEntityList[arrayVal].xpos = scriptEng.operands[i] << 16;
+                    break;
                 }
-                break;
-            case FUNC_EDITFRAME: {
-                opcodeSize  = 0;
-                spriteFrame = &scriptFrames[scriptInfo->frameListOffset + scriptEng.operands[0]];
-
-                spriteFrame->pivotX = scriptEng.operands[1];
-                spriteFrame->pivotY = scriptEng.operands[2];
-                spriteFrame->width  = scriptEng.operands[3];
-                spriteFrame->height = scriptEng.operands[4];
-                spriteFrame->sprX   = scriptEng.operands[5];
-                spriteFrame->sprY   = scriptEng.operands[6];
-            } break;
-            case FUNC_LOADPALETTE:
-                opcodeSize = 0;
-                LoadPalette(scriptText, scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3], scriptEng.operands[4]);
-                break;
-            case FUNC_ROTATEPALETTE:
-                opcodeSize = 0;
-                RotatePalette(scriptEng.operands[0], scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]);
-                break;
-            case FUNC_SETSCREENFADE:
-                opcodeSize = 0;
-                SetFade(scriptEng.operands[0], scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]);
-                break;
-            case FUNC_SETACTIVEPALETTE:
-                opcodeSize = 0;
-                SetActivePalette(scriptEng.operands[0], scriptEng.operands[1], scriptEng.operands[2]);
-                break;
-            case FUNC_SETPALETTEFADE:
-                SetPaletteFade(scriptEng.operands[0], scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3], scriptEng.operands[4],
-                               scriptEng.operands[5]);
-                break;
-            case FUNC_SETPALETTEENTRY: SetPaletteEntryPacked(scriptEng.operands[0], scriptEng.operands[1], scriptEng.operands[2]); break;
-            case FUNC_GETPALETTEENTRY: scriptEng.operands[2] = GetPaletteEntryPacked(scriptEng.operands[0], scriptEng.operands[1]); break;
-            case FUNC_COPYPALETTE:
-                opcodeSize = 0;
-                CopyPalette(scriptEng.operands[0], scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3], scriptEng.operands[4]);
-                break;
-            case FUNC_CLEARSCREEN:
-                opcodeSize = 0;
-                ClearScreen(scriptEng.operands[0]);
-                break;
-            case FUNC_DRAWSPRITEFX:
-                opcodeSize  = 0;
-                spriteFrame = &scriptFrames[scriptInfo->frameListOffset + scriptEng.operands[0]];
-                switch (scriptEng.operands[1]) {
-                    default: break;
-
-                    case FX_SCALE:
-                        DrawSpriteScaled(entity->direction, (scriptEng.operands[2] >> 16) - xScrollOffset,
-                                         (scriptEng.operands[3] >> 16) - yScrollOffset, -spriteFrame->pivotX, -spriteFrame->pivotY, entity->scale,
-                                         entity->scale, spriteFrame->width, spriteFrame->height, spriteFrame->sprX, spriteFrame->sprY,
-                                         scriptInfo->spriteSheetID);
-                        break;
-
-                    case FX_ROTATE:
-                        DrawSpriteRotated(entity->direction, (scriptEng.operands[2] >> 16) - xScrollOffset,
-                                          (scriptEng.operands[3] >> 16) - yScrollOffset, -spriteFrame->pivotX, -spriteFrame->pivotY,
-                                          spriteFrame->sprX, spriteFrame->sprY, spriteFrame->width, spriteFrame->height, entity->rotation,
-                                          scriptInfo->spriteSheetID);
-                        break;
-
-                    case FX_ROTOZOOM:
-                        DrawSpriteRotozoom(entity->direction, (scriptEng.operands[2] >> 16) - xScrollOffset,
-                                           (scriptEng.operands[3] >> 16) - yScrollOffset, -spriteFrame->pivotX, -spriteFrame->pivotY,
-                                           spriteFrame->sprX, spriteFrame->sprY, spriteFrame->width, spriteFrame->height, entity->rotation,
-                                           entity->scale, scriptInfo->spriteSheetID);
-                        break;
-
-                    case FX_INK:
-                        switch (entity->inkEffect) {
-                            case INK_NONE:
-                                DrawSprite((scriptEng.operands[2] >> 16) - xScrollOffset + spriteFrame->pivotX,
-                                           (scriptEng.operands[3] >> 16) - yScrollOffset + spriteFrame->pivotY, spriteFrame->width,
-                                           spriteFrame->height, spriteFrame->sprX, spriteFrame->sprY, scriptInfo->spriteSheetID);
-                                break;
-
-                            case INK_BLEND:
-                                DrawBlendedSprite((scriptEng.operands[2] >> 16) - xScrollOffset + spriteFrame->pivotX,
-                                                  (scriptEng.operands[3] >> 16) - yScrollOffset + spriteFrame->pivotY, spriteFrame->width,
-                                                  spriteFrame->height, spriteFrame->sprX, spriteFrame->sprY, scriptInfo->spriteSheetID);
-                                break;
-
-                            case INK_ALPHA:
-                                DrawAlphaBlendedSprite((scriptEng.operands[2] >> 16) - xScrollOffset + spriteFrame->pivotX,
-                                                       (scriptEng.operands[3] >> 16) - yScrollOffset + spriteFrame->pivotY, spriteFrame->width,
-                                                       spriteFrame->height, spriteFrame->sprX, spriteFrame->sprY, entity->alpha,
-                                                       scriptInfo->spriteSheetID);
-                                break;
-
-                            case INK_ADD:
-                                DrawAdditiveBlendedSprite((scriptEng.operands[2] >> 16) - xScrollOffset + spriteFrame->pivotX,
-                                                          (scriptEng.operands[3] >> 16) - yScrollOffset + spriteFrame->pivotY, spriteFrame->width,
-                                                          spriteFrame->height, spriteFrame->sprX, spriteFrame->sprY, entity->alpha,
-                                                          scriptInfo->spriteSheetID);
-                                break;
-
-                            case INK_SUB:
-                                DrawSubtractiveBlendedSprite((scriptEng.operands[2] >> 16) - xScrollOffset + spriteFrame->pivotX,
-                                                             (scriptEng.operands[3] >> 16) - yScrollOffset + spriteFrame->pivotY, spriteFrame->width,
-                                                             spriteFrame->height, spriteFrame->sprX, spriteFrame->sprY, entity->alpha,
-                                                             scriptInfo->spriteSheetID);
-                                break;
-                        }
-                        break;
-                    case FX_TINT:
-                        if (entity->inkEffect == INK_ALPHA) {
-                            DrawScaledTintMask(entity->direction, (scriptEng.operands[2] >> 16) - xScrollOffset,
-                                               (scriptEng.operands[3] >> 16) - yScrollOffset, -spriteFrame->pivotX, -spriteFrame->pivotY,
-                                               entity->scale, entity->scale, spriteFrame->width, spriteFrame->height, spriteFrame->sprX,
-                                               spriteFrame->sprY, scriptInfo->spriteSheetID);
-                        }
-                        else {
-                            DrawSpriteScaled(entity->direction, (scriptEng.operands[2] >> 16) - xScrollOffset,
-                                             (scriptEng.operands[3] >> 16) - yScrollOffset, -spriteFrame->pivotX, -spriteFrame->pivotY, entity->scale,
-                                             entity->scale, spriteFrame->width, spriteFrame->height, spriteFrame->sprX, spriteFrame->sprY,
-                                             scriptInfo->spriteSheetID);
-                        }
-                        break;
-
-                    case FX_FLIP:
-                        switch (entity->direction) {
-                            default:
-                            case FLIP_NONE:
-                                DrawSpriteFlipped((scriptEng.operands[2] >> 16) - xScrollOffset + spriteFrame->pivotX,
-                                                  (scriptEng.operands[3] >> 16) - yScrollOffset + spriteFrame->pivotY, spriteFrame->width,
-                                                  spriteFrame->height, spriteFrame->sprX, spriteFrame->sprY, FLIP_NONE, scriptInfo->spriteSheetID);
-                                break;
-
-                            case FLIP_X:
-                                DrawSpriteFlipped((scriptEng.operands[2] >> 16) - xScrollOffset - spriteFrame->width - spriteFrame->pivotX,
-                                                  (scriptEng.operands[3] >> 16) - yScrollOffset + spriteFrame->pivotY, spriteFrame->width,
-                                                  spriteFrame->height, spriteFrame->sprX, spriteFrame->sprY, FLIP_X, scriptInfo->spriteSheetID);
-                                break;
-
-                            case FLIP_Y:
-                                DrawSpriteFlipped((scriptEng.operands[2] >> 16) - xScrollOffset + spriteFrame->pivotX,
-                                                  (scriptEng.operands[3] >> 16) - yScrollOffset - spriteFrame->height - spriteFrame->pivotY,
-                                                  spriteFrame->width, spriteFrame->height, spriteFrame->sprX, spriteFrame->sprY, FLIP_Y,
-                                                  scriptInfo->spriteSheetID);
-                                break;
-
-                            case FLIP_XY:
-                                DrawSpriteFlipped((scriptEng.operands[2] >> 16) - xScrollOffset - spriteFrame->width - spriteFrame->pivotX,
-                                                  (scriptEng.operands[3] >> 16) - yScrollOffset - spriteFrame->height - spriteFrame->pivotY,
-                                                  spriteFrame->width, spriteFrame->height, spriteFrame->sprX, spriteFrame->sprY, FLIP_XY,
-                                                  scriptInfo->spriteSheetID);
-                                break;
-                        }
-                        break;
+                case VAR_OBJECTIYPOS: {
+                    objectEntityList[arrayVal].ypos = scriptEng.operands[i] << 16;
+                    break;
+                }
+                case VAR_OBJECTXVEL: {
+                    objectEntityList[arrayVal].xvel = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTYVEL: {
+                    objectEntityList[arrayVal].yvel = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTSPEED: {
+                    objectEntityList[arrayVal].speed = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTSTATE: {
+                    objectEntityList[arrayVal].state = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTROTATION: {
+                    objectEntityList[arrayVal].rotation = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTSCALE: {
+                    objectEntityList[arrayVal].scale = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTPRIORITY: {
+                    objectEntityList[arrayVal].priority = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTDRAWORDER: {
+                    objectEntityList[arrayVal].drawOrder = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTDIRECTION: {
+                    objectEntityList[arrayVal].direction = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTINKEFFECT: {
+                    objectEntityList[arrayVal].inkEffect = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTALPHA: {
+                    objectEntityList[arrayVal].alpha = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTFRAME: {
+                    objectEntityList[arrayVal].frame = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTANIMATION: {
+                    objectEntityList[arrayVal].animation = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTPREVANIMATION: {
+                    objectEntityList[arrayVal].prevAnimation = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTANIMATIONSPEED: {
+                    objectEntityList[arrayVal].animationSpeed = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTANIMATIONTIMER: {
+                    objectEntityList[arrayVal].animationTimer = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTANGLE: {
+                    objectEntityList[arrayVal].angle = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTLOOKPOSX: {
+                    objectEntityList[arrayVal].lookPosX = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTLOOKPOSY: {
+                    objectEntityList[arrayVal].lookPosY = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTCOLLISIONMODE: {
+                    objectEntityList[arrayVal].collisionMode = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTCOLLISIONPLANE: {
+                    objectEntityList[arrayVal].collisionPlane = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTCONTROLMODE: {
+                    objectEntityList[arrayVal].controlMode = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTCONTROLLOCK: {
+                    objectEntityList[arrayVal].controlLock = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTPUSHING: {
+                    objectEntityList[arrayVal].pushing = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTVISIBLE: {
+                    objectEntityList[arrayVal].visible = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTTILECOLLISIONS: {
+                    objectEntityList[arrayVal].tileCollisions = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTINTERACTION: {
+                    objectEntityList[arrayVal].objectInteractions = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTGRAVITY: {
+                    objectEntityList[arrayVal].gravity = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTUP: {
+                    objectEntityList[arrayVal].up = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTDOWN: {
+                    objectEntityList[arrayVal].down = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTLEFT: {
+                    objectEntityList[arrayVal].left = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTRIGHT: {
+                    objectEntityList[arrayVal].right = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTJUMPPRESS: {
+                    objectEntityList[arrayVal].jumpPress = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTJUMPHOLD: {
+                    objectEntityList[arrayVal].jumpHold = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTSCROLLTRACKING: {
+                    objectEntityList[arrayVal].scrollTracking = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTFLOORSENSORL: {
+                    objectEntityList[arrayVal].floorSensors[0] = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTFLOORSENSORC: {
+                    objectEntityList[arrayVal].floorSensors[1] = scriptEng.operands[i];
+                    break;
                 }
-                break;
-            case FUNC_DRAWSPRITESCREENFX:
-                opcodeSize  = 0;
-                spriteFrame = &scriptFrames[scriptInfo->frameListOffset + scriptEng.operands[0]];
-
-                switch (scriptEng.operands[1]) {
-                    default: break;
-
-                    case FX_SCALE:
-                        DrawSpriteScaled(entity->direction, scriptEng.operands[2], scriptEng.operands[3], -spriteFrame->pivotX, -spriteFrame->pivotY,
-                                         entity->scale, entity->scale, spriteFrame->width, spriteFrame->height, spriteFrame->sprX, spriteFrame->sprY,
-                                         scriptInfo->spriteSheetID);
-                        break;
-
-                    case FX_ROTATE:
-                        DrawSpriteRotated(entity->direction, scriptEng.operands[2], scriptEng.operands[3], -spriteFrame->pivotX, -spriteFrame->pivotY,
-                                          spriteFrame->sprX, spriteFrame->sprY, spriteFrame->width, spriteFrame->height, entity->rotation,
-                                          scriptInfo->spriteSheetID);
-                        break;
-
-                    case FX_ROTOZOOM:
-                        DrawSpriteRotozoom(entity->direction, scriptEng.operands[2], scriptEng.operands[3], -spriteFrame->pivotX,
-                                           -spriteFrame->pivotY, spriteFrame->sprX, spriteFrame->sprY, spriteFrame->width, spriteFrame->height,
-                                           entity->rotation, entity->scale, scriptInfo->spriteSheetID);
-                        break;
-
-                    case FX_INK:
-                        switch (entity->inkEffect) {
-                            case INK_NONE:
-                                DrawSprite(scriptEng.operands[2] + spriteFrame->pivotX, scriptEng.operands[3] + spriteFrame->pivotY,
-                                           spriteFrame->width, spriteFrame->height, spriteFrame->sprX, spriteFrame->sprY, scriptInfo->spriteSheetID);
-                                break;
-
-                            case INK_BLEND:
-                                DrawBlendedSprite(scriptEng.operands[2] + spriteFrame->pivotX, scriptEng.operands[3] + spriteFrame->pivotY,
-                                                  spriteFrame->width, spriteFrame->height, spriteFrame->sprX, spriteFrame->sprY,
-                                                  scriptInfo->spriteSheetID);
-                                break;
-
-                            case INK_ALPHA:
-                                DrawAlphaBlendedSprite(scriptEng.operands[2] + spriteFrame->pivotX, scriptEng.operands[3] + spriteFrame->pivotY,
-                                                       spriteFrame->width, spriteFrame->height, spriteFrame->sprX, spriteFrame->sprY, entity->alpha,
-                                                       scriptInfo->spriteSheetID);
-                                break;
-
-                            case INK_ADD:
-                                DrawAdditiveBlendedSprite(scriptEng.operands[2] + spriteFrame->pivotX, scriptEng.operands[3] + spriteFrame->pivotY,
-                                                          spriteFrame->width, spriteFrame->height, spriteFrame->sprX, spriteFrame->sprY,
-                                                          entity->alpha, scriptInfo->spriteSheetID);
-                                break;
-
-                            case INK_SUB:
-                                DrawSubtractiveBlendedSprite(scriptEng.operands[2] + spriteFrame->pivotX, scriptEng.operands[3] + spriteFrame->pivotY,
-                                                             spriteFrame->width, spriteFrame->height, spriteFrame->sprX, spriteFrame->sprY,
-                                                             entity->alpha, scriptInfo->spriteSheetID);
-                                break;
-                        }
-                        break;
-
-                    case FX_TINT:
-                        if (entity->inkEffect == INK_ALPHA) {
-                            DrawScaledTintMask(entity->direction, scriptEng.operands[2], scriptEng.operands[3], -spriteFrame->pivotX,
-                                               -spriteFrame->pivotY, entity->scale, entity->scale, spriteFrame->width, spriteFrame->height,
-                                               spriteFrame->sprX, spriteFrame->sprY, scriptInfo->spriteSheetID);
-                        }
-                        else {
-                            DrawSpriteScaled(entity->direction, scriptEng.operands[2], scriptEng.operands[3], -spriteFrame->pivotX,
-                                             -spriteFrame->pivotY, entity->scale, entity->scale, spriteFrame->width, spriteFrame->height,
-                                             spriteFrame->sprX, spriteFrame->sprY, scriptInfo->spriteSheetID);
-                        }
-                        break;
-
-                    case FX_FLIP:
-                        switch (entity->direction) {
-                            default:
-                            case FLIP_NONE:
-                                DrawSpriteFlipped(scriptEng.operands[2] + spriteFrame->pivotX, scriptEng.operands[3] + spriteFrame->pivotY,
-                                                  spriteFrame->width, spriteFrame->height, spriteFrame->sprX, spriteFrame->sprY, FLIP_NONE,
-                                                  scriptInfo->spriteSheetID);
-                                break;
-
-                            case FLIP_X:
-                                DrawSpriteFlipped(scriptEng.operands[2] - spriteFrame->width - spriteFrame->pivotX,
-                                                  scriptEng.operands[3] + spriteFrame->pivotY, spriteFrame->width, spriteFrame->height,
-                                                  spriteFrame->sprX, spriteFrame->sprY, FLIP_X, scriptInfo->spriteSheetID);
-                                break;
-
-                            case FLIP_Y:
-                                DrawSpriteFlipped(scriptEng.operands[2] + spriteFrame->pivotX,
-                                                  scriptEng.operands[3] - spriteFrame->height - spriteFrame->pivotY, spriteFrame->width,
-                                                  spriteFrame->height, spriteFrame->sprX, spriteFrame->sprY, FLIP_Y, scriptInfo->spriteSheetID);
-                                break;
-
-                            case FLIP_XY:
-                                DrawSpriteFlipped(scriptEng.operands[2] - spriteFrame->width - spriteFrame->pivotX,
-                                                  scriptEng.operands[3] - spriteFrame->height - spriteFrame->pivotY, spriteFrame->width,
-                                                  spriteFrame->height, spriteFrame->sprX, spriteFrame->sprY, FLIP_XY, scriptInfo->spriteSheetID);
-                                break;
-                        }
-                        break;
+                case VAR_OBJECTFLOORSENSORR: {
+                    objectEntityList[arrayVal].floorSensors[2] = scriptEng.operands[i];
+                    break;
                 }
-                break;
-
-            case FUNC_LOADANIMATION:
-                opcodeSize           = 0;
-                scriptInfo->animFile = AddAnimationFile(scriptText);
-                break;
-
-            case FUNC_SETUPMENU: {
-                opcodeSize     = 0;
-                TextMenu *menu = &gameMenu[scriptEng.operands[0]];
-                SetupTextMenu(menu, scriptEng.operands[1]);
-                menu->selectionCount = scriptEng.operands[2];
-                menu->alignment      = scriptEng.operands[3];
-                break;
-            }
-            case FUNC_ADDMENUENTRY: {
-                opcodeSize                           = 0;
-                TextMenu *menu                       = &gameMenu[scriptEng.operands[0]];
-                menu->entryHighlight[menu->rowCount] = scriptEng.operands[2];
-                AddTextMenuEntry(menu, scriptText);
-                break;
-            }
-            case FUNC_EDITMENUENTRY: {
-                opcodeSize     = 0;
-                TextMenu *menu = &gameMenu[scriptEng.operands[0]];
-                EditTextMenuEntry(menu, scriptText, scriptEng.operands[2]);
-                menu->entryHighlight[scriptEng.operands[2]] = scriptEng.operands[3];
-                break;
-            }
-            case FUNC_LOADSTAGE:
-                opcodeSize = 0;
-                stageMode  = STAGEMODE_LOAD;
-                break;
-            case FUNC_DRAWRECT:
-                opcodeSize = 0;
-                DrawRectangle(scriptEng.operands[0], scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3], scriptEng.operands[4],
-                              scriptEng.operands[5], scriptEng.operands[6], scriptEng.operands[7]);
-                break;
-            case FUNC_RESETOBJECTENTITY: {
-                opcodeSize     = 0;
-                Entity *newEnt = &objectEntityList[scriptEng.operands[0]];
-                memset(newEnt, 0, sizeof(Entity));
-                newEnt->type               = scriptEng.operands[1];
-                newEnt->propertyValue      = scriptEng.operands[2];
-                newEnt->xpos               = scriptEng.operands[3];
-                newEnt->ypos               = scriptEng.operands[4];
-                newEnt->direction          = FLIP_NONE;
-                newEnt->priority           = PRIORITY_BOUNDS;
-                newEnt->drawOrder          = 3;
-                newEnt->scale              = 512;
-                newEnt->inkEffect          = INK_NONE;
-                newEnt->objectInteractions = true;
-                newEnt->visible            = true;
-                newEnt->tileCollisions     = true;
-                break;
-            }
-            case FUNC_BOXCOLLISIONTEST:
-                opcodeSize = 0;
-                switch (scriptEng.operands[0]) {
-                    default: break;
-                    case C_TOUCH:
-                        TouchCollision(&objectEntityList[scriptEng.operands[1]], scriptEng.operands[2], scriptEng.operands[3], scriptEng.operands[4],
-                                       scriptEng.operands[5], &objectEntityList[scriptEng.operands[6]], scriptEng.operands[7], scriptEng.operands[8],
-                                       scriptEng.operands[9], scriptEng.operands[10]);
-                        break;
-                    case C_SOLID:
-                        BoxCollision(&objectEntityList[scriptEng.operands[1]], scriptEng.operands[2], scriptEng.operands[3], scriptEng.operands[4],
-                                     scriptEng.operands[5], &objectEntityList[scriptEng.operands[6]], scriptEng.operands[7], scriptEng.operands[8],
-                                     scriptEng.operands[9], scriptEng.operands[10]);
-                        break;
-                    case C_SOLID2:
-                        BoxCollision2(&objectEntityList[scriptEng.operands[1]], scriptEng.operands[2], scriptEng.operands[3], scriptEng.operands[4],
-                                      scriptEng.operands[5], &objectEntityList[scriptEng.operands[6]], scriptEng.operands[7], scriptEng.operands[8],
-                                      scriptEng.operands[9], scriptEng.operands[10]);
-                        break;
-                    case C_PLATFORM:
-                        PlatformCollision(&objectEntityList[scriptEng.operands[1]], scriptEng.operands[2], scriptEng.operands[3],
-                                          scriptEng.operands[4], scriptEng.operands[5], &objectEntityList[scriptEng.operands[6]],
-                                          scriptEng.operands[7], scriptEng.operands[8], scriptEng.operands[9], scriptEng.operands[10]);
-                        break;
+                case VAR_OBJECTFLOORSENSORLC: {
+                    objectEntityList[arrayVal].floorSensors[3] = scriptEng.operands[i];
+                    break;
                 }
-                break;
-            case FUNC_CREATETEMPOBJECT: {
-                opcodeSize = 0;
-                if (objectEntityList[scriptEng.arrayPosition[8]].type > OBJ_TYPE_BLANKOBJECT
-                    && ++scriptEng.arrayPosition[8] == LEGACY_v4_ENTITY_COUNT)
-                    scriptEng.arrayPosition[8] = LEGACY_v4_TEMPENTITY_START;
-                Entity *temp = &objectEntityList[scriptEng.arrayPosition[8]];
-                memset(temp, 0, sizeof(Entity));
-                temp->type               = scriptEng.operands[0];
-                temp->propertyValue      = scriptEng.operands[1];
-                temp->xpos               = scriptEng.operands[2];
-                temp->ypos               = scriptEng.operands[3];
-                temp->direction          = FLIP_NONE;
-                temp->priority           = PRIORITY_ACTIVE;
-                temp->drawOrder          = 3;
-                temp->scale              = 512;
-                temp->inkEffect          = INK_NONE;
-                temp->objectInteractions = true;
-                temp->visible            = true;
-                temp->tileCollisions     = true;
-                break;
-            }
-            case FUNC_PROCESSOBJECTMOVEMENT:
-                opcodeSize = 0;
-                if (entity->tileCollisions) {
-                    ProcessTileCollisions(entity);
+                case VAR_OBJECTFLOORSENSORRC: {
+                    objectEntityList[arrayVal].floorSensors[4] = scriptEng.operands[i];
+                    break;
                 }
-                else {
-                    entity->xpos += entity->xvel;
-                    entity->ypos += entity->yvel;
+                case VAR_OBJECTCOLLISIONLEFT: {
+                    break;
                 }
-                break;
-            case FUNC_PROCESSOBJECTCONTROL:
-                opcodeSize = 0;
-                ProcessObjectControl(entity);
-                break;
-            case FUNC_PROCESSANIMATION:
-                opcodeSize = 0;
-                ProcessObjectAnimation(scriptInfo, entity);
-                break;
-            case FUNC_DRAWOBJECTANIMATION:
-                opcodeSize = 0;
-                if (entity->visible)
-                    DrawObjectAnimation(scriptInfo, entity, (entity->xpos >> 16) - xScrollOffset, (entity->ypos >> 16) - yScrollOffset);
-                break;
-            case FUNC_SETMUSICTRACK:
-                opcodeSize = 0;
-                if (scriptEng.operands[2] <= 1)
-                    SetMusicTrack(scriptText, scriptEng.operands[1], scriptEng.operands[2], 0);
-                else
-                    SetMusicTrack(scriptText, scriptEng.operands[1], true, scriptEng.operands[2]);
-                break;
-            case FUNC_PLAYMUSIC:
-                opcodeSize = 0;
-                PlayMusic(scriptEng.operands[0]);
-                break;
-            case FUNC_STOPMUSIC:
-                opcodeSize = 0;
-                StopMusic();
-                break;
-            case FUNC_PAUSEMUSIC:
-                opcodeSize = 0;
-                // PauseSound();
-                break;
-            case FUNC_RESUMEMUSIC:
-                opcodeSize = 0;
-                // ResumeSound();
-                break;
-            case FUNC_SWAPMUSICTRACK:
-                opcodeSize = 0;
-                if (scriptEng.operands[2] <= 1)
-                    SwapMusicTrack(scriptText, scriptEng.operands[1], 0, scriptEng.operands[3]);
-                else
-                    SwapMusicTrack(scriptText, scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]);
-                break;
-            case FUNC_PLAYSFX:
-                opcodeSize = 0;
-                PlaySfx(scriptEng.operands[0], scriptEng.operands[1]);
-                break;
-            case FUNC_STOPSFX:
-                opcodeSize = 0;
-                StopSfx(scriptEng.operands[0]);
-                break;
-            case FUNC_SETSFXATTRIBUTES:
-                opcodeSize = 0;
-                SetSfxAttributes(scriptEng.operands[0], scriptEng.operands[1], scriptEng.operands[2]);
-                break;
-            case FUNC_OBJECTTILECOLLISION:
-                opcodeSize = 0;
-                switch (scriptEng.operands[0]) {
-                    default: break;
-                    case CSIDE_FLOOR: ObjectFloorCollision(scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]); break;
-                    case CSIDE_LWALL: ObjectLWallCollision(scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]); break;
-                    case CSIDE_RWALL: ObjectRWallCollision(scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]); break;
-                    case CSIDE_ROOF: ObjectRoofCollision(scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]); break;
+                case VAR_OBJECTCOLLISIONTOP: {
+                    break;
+                }
+                case VAR_OBJECTCOLLISIONRIGHT: {
+                    break;
                 }
-                break;
-            case FUNC_OBJECTTILEGRIP:
-                opcodeSize = 0;
-                switch (scriptEng.operands[0]) {
-                    default: break;
-                    case CSIDE_FLOOR: ObjectFloorGrip(scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]); break;
-                    case CSIDE_LWALL: ObjectLWallGrip(scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]); break;
-                    case CSIDE_RWALL: ObjectRWallGrip(scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]); break;
-                    case CSIDE_ROOF: ObjectRoofGrip(scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]); break;
+                case VAR_OBJECTCOLLISIONBOTTOM: {
+                    break;
                 }
-                break;
-            case FUNC_NOT: scriptEng.operands[0] = ~scriptEng.operands[0]; break;
-            case FUNC_DRAW3DSCENE:
-                opcodeSize = 0;
-                TransformVertexBuffer();
-                Sort3DDrawList();
-                Draw3DScene(scriptInfo->spriteSheetID);
-                break;
-            case FUNC_SETIDENTITYMATRIX:
-                opcodeSize = 0;
-                switch (scriptEng.operands[0]) {
-                    case MAT_WORLD: SetIdentityMatrix(&matWorld); break;
-                    case MAT_VIEW: SetIdentityMatrix(&matView); break;
-                    case MAT_TEMP: SetIdentityMatrix(&matTemp); break;
+                case VAR_OBJECTOUTOFBOUNDS: {
+                    break;
                 }
-                break;
-            case FUNC_MATRIXMULTIPLY:
-                opcodeSize = 0;
-                switch (scriptEng.operands[0]) {
-                    case MAT_WORLD:
-                        switch (scriptEng.operands[1]) {
-                            case MAT_WORLD: MatrixMultiply(&matWorld, &matWorld); break;
-                            case MAT_VIEW: MatrixMultiply(&matWorld, &matView); break;
-                            case MAT_TEMP: MatrixMultiply(&matWorld, &matTemp); break;
-                        }
-                        break;
-
-                    case MAT_VIEW:
-                        switch (scriptEng.operands[1]) {
-                            case MAT_WORLD: MatrixMultiply(&matView, &matWorld); break;
-                            case MAT_VIEW: MatrixMultiply(&matView, &matView); break;
-                            case MAT_TEMP: MatrixMultiply(&matView, &matTemp); break;
-                        }
-                        break;
-
-                    case MAT_TEMP:
-                        switch (scriptEng.operands[1]) {
-                            case MAT_WORLD: MatrixMultiply(&matTemp, &matWorld); break;
-                            case MAT_VIEW: MatrixMultiply(&matTemp, &matView); break;
-                            case MAT_TEMP: MatrixMultiply(&matTemp, &matTemp); break;
-                        }
-                        break;
+                case VAR_OBJECTSPRITESHEET: {
+                    objectScriptList[objectEntityList[arrayVal].type].spriteSheetID = scriptEng.operands[i];
+                    break;
                 }
-                break;
-            case FUNC_MATRIXTRANSLATEXYZ:
-                opcodeSize = 0;
-                switch (scriptEng.operands[0]) {
-                    case MAT_WORLD: MatrixTranslateXYZ(&matWorld, scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]); break;
-                    case MAT_VIEW: MatrixTranslateXYZ(&matView, scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]); break;
-                    case MAT_TEMP: MatrixTranslateXYZ(&matTemp, scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]); break;
+                case VAR_OBJECTVALUE0: {
+                    objectEntityList[arrayVal].values[0] = scriptEng.operands[i];
+                    break;
                 }
-                break;
-            case FUNC_MATRIXSCALEXYZ:
-                opcodeSize = 0;
-                switch (scriptEng.operands[0]) {
-                    case MAT_WORLD: MatrixScaleXYZ(&matWorld, scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]); break;
-                    case MAT_VIEW: MatrixScaleXYZ(&matView, scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]); break;
-                    case MAT_TEMP: MatrixScaleXYZ(&matTemp, scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]); break;
+                case VAR_OBJECTVALUE1: {
+                    objectEntityList[arrayVal].values[1] = scriptEng.operands[i];
+                    break;
                 }
-                break;
-            case FUNC_MATRIXROTATEX:
-                opcodeSize = 0;
-                switch (scriptEng.operands[0]) {
-                    case MAT_WORLD: MatrixRotateX(&matWorld, scriptEng.operands[1]); break;
-                    case MAT_VIEW: MatrixRotateX(&matView, scriptEng.operands[1]); break;
-                    case MAT_TEMP: MatrixRotateX(&matTemp, scriptEng.operands[1]); break;
+                case VAR_OBJECTVALUE2: {
+                    objectEntityList[arrayVal].values[2] = scriptEng.operands[i];
+                    break;
                 }
-                break;
-            case FUNC_MATRIXROTATEY:
-                opcodeSize = 0;
-                switch (scriptEng.operands[0]) {
-                    case MAT_WORLD: MatrixRotateY(&matWorld, scriptEng.operands[1]); break;
-                    case MAT_VIEW: MatrixRotateY(&matView, scriptEng.operands[1]); break;
-                    case MAT_TEMP: MatrixRotateY(&matTemp, scriptEng.operands[1]); break;
+                case VAR_OBJECTVALUE3: {
+                    objectEntityList[arrayVal].values[3] = scriptEng.operands[i];
+                    break;
                 }
-                break;
-            case FUNC_MATRIXROTATEZ:
-                opcodeSize = 0;
-                switch (scriptEng.operands[0]) {
-                    case MAT_WORLD: MatrixRotateZ(&matWorld, scriptEng.operands[1]); break;
-                    case MAT_VIEW: MatrixRotateZ(&matView, scriptEng.operands[1]); break;
-                    case MAT_TEMP: MatrixRotateZ(&matTemp, scriptEng.operands[1]); break;
+                case VAR_OBJECTVALUE4: {
+                    objectEntityList[arrayVal].values[4] = scriptEng.operands[i];
+                    break;
                 }
-                break;
-            case FUNC_MATRIXROTATEXYZ:
-                opcodeSize = 0;
-                switch (scriptEng.operands[0]) {
-                    case MAT_WORLD: MatrixRotateXYZ(&matWorld, scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]); break;
-                    case MAT_VIEW: MatrixRotateXYZ(&matView, scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]); break;
-                    case MAT_TEMP: MatrixRotateXYZ(&matTemp, scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]); break;
+                case VAR_OBJECTVALUE5: {
+                    objectEntityList[arrayVal].values[5] = scriptEng.operands[i];
+                    break;
                 }
-                break;
-            case FUNC_MATRIXINVERSE:
-                opcodeSize = 0;
-                switch (scriptEng.operands[0]) {
-                    case MAT_WORLD: MatrixInverse(&matWorld); break;
-                    case MAT_VIEW: MatrixInverse(&matView); break;
-                    case MAT_TEMP: MatrixInverse(&matTemp); break;
+                case VAR_OBJECTVALUE6: {
+                    objectEntityList[arrayVal].values[6] = scriptEng.operands[i];
+                    break;
                 }
-                break;
-            case FUNC_TRANSFORMVERTICES:
-                opcodeSize = 0;
-                switch (scriptEng.operands[0]) {
-                    case MAT_WORLD: TransformVertices(&matWorld, scriptEng.operands[1], scriptEng.operands[2]); break;
-                    case MAT_VIEW: TransformVertices(&matView, scriptEng.operands[1], scriptEng.operands[2]); break;
-                    case MAT_TEMP: TransformVertices(&matTemp, scriptEng.operands[1], scriptEng.operands[2]); break;
+                case VAR_OBJECTVALUE7: {
+                    objectEntityList[arrayVal].values[7] = scriptEng.operands[i];
+                    break;
                 }
-                break;
-            case FUNC_CALLFUNCTION: {
-                opcodeSize                        = 0;
-                functionStack[functionStackPos++] = scriptCodePtr;
-                functionStack[functionStackPos++] = jumpTableStart;
-                functionStack[functionStackPos++] = scriptCodeStart;
-                scriptCodeStart                   = scriptFunctionList[scriptEng.operands[0]].ptr.scriptCodePtr;
-                jumpTableStart                    = scriptFunctionList[scriptEng.operands[0]].ptr.jumpTablePtr;
-                scriptCodePtr                     = scriptCodeStart;
-                break;
-            }
-            case FUNC_RETURN:
-                opcodeSize = 0;
-                if (!functionStackPos) { // event, stop running
-                    running = false;
+                case VAR_OBJECTVALUE8: {
+                    objectEntityList[arrayVal].values[8] = scriptEng.operands[i];
+                    break;
                 }
-                else { // function, jump out
-                    scriptCodeStart = functionStack[--functionStackPos];
-                    jumpTableStart  = functionStack[--functionStackPos];
-                    scriptCodePtr   = functionStack[--functionStackPos];
+                case VAR_OBJECTVALUE9: {
+                    objectEntityList[arrayVal].values[9] = scriptEng.operands[i];
+                    break;
                 }
-                break;
-            case FUNC_SETLAYERDEFORMATION:
-                opcodeSize = 0;
-                SetLayerDeformation(scriptEng.operands[0], scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3], scriptEng.operands[4],
-                                    scriptEng.operands[5]);
-                break;
-            case FUNC_CHECKTOUCHRECT:
-                opcodeSize            = 0;
-                scriptEng.checkResult = -1;
-
-                for (int32 f = 0; f < touchInfo.count; ++f) {
-                    if (touchInfo.down[f]) {
-                        int32 touchX = (int32)(touchInfo.x[f] * SCREEN_XSIZE);
-                        int32 touchY = (int32)(touchInfo.y[f] * SCREEN_YSIZE);
-
-                        if (touchX > scriptEng.operands[0] && touchX < scriptEng.operands[2] && touchY > scriptEng.operands[1]
-                            && touchY < scriptEng.operands[3]) {
-                            scriptEng.checkResult = f;
-                        }
-                    }
+                case VAR_OBJECTVALUE10: {
+                    objectEntityList[arrayVal].values[10] = scriptEng.operands[i];
+                    break;
                 }
-                break;
-            case FUNC_GETTILELAYERENTRY:
-                scriptEng.operands[0] = stageLayouts[scriptEng.operands[1]].tiles[scriptEng.operands[2] + 0x100 * scriptEng.operands[3]];
-                break;
-            case FUNC_SETTILELAYERENTRY:
-                stageLayouts[scriptEng.operands[1]].tiles[scriptEng.operands[2] + 0x100 * scriptEng.operands[3]] = scriptEng.operands[0];
-                break;
-            case FUNC_GETBIT: scriptEng.operands[0] = (scriptEng.operands[1] & (1 << scriptEng.operands[2])) >> scriptEng.operands[2]; break;
-            case FUNC_SETBIT:
-                if (scriptEng.operands[2] <= 0)
-                    scriptEng.operands[0] &= ~(1 << scriptEng.operands[1]);
-                else
-                    scriptEng.operands[0] |= 1 << scriptEng.operands[1];
-                break;
-            case FUNC_CLEARDRAWLIST:
-                opcodeSize                                      = 0;
-                drawListEntries[scriptEng.operands[0]].listSize = 0;
-                break;
-            case FUNC_ADDDRAWLISTENTITYREF: {
-                opcodeSize                                                                                           = 0;
-                drawListEntries[scriptEng.operands[0]].entityRefs[drawListEntries[scriptEng.operands[0]].listSize++] = scriptEng.operands[1];
-                break;
-            }
-            case FUNC_GETDRAWLISTENTITYREF: scriptEng.operands[0] = drawListEntries[scriptEng.operands[1]].entityRefs[scriptEng.operands[2]]; break;
-            case FUNC_SETDRAWLISTENTITYREF:
-                opcodeSize                                                               = 0;
-                drawListEntries[scriptEng.operands[1]].entityRefs[scriptEng.operands[2]] = scriptEng.operands[0];
-                break;
-            case FUNC_GET16X16TILEINFO: {
-                scriptEng.operands[4] = scriptEng.operands[1] >> 7;
-                scriptEng.operands[5] = scriptEng.operands[2] >> 7;
-                scriptEng.operands[6] = stageLayouts[0].tiles[scriptEng.operands[4] + (scriptEng.operands[5] << 8)] << 6;
-                scriptEng.operands[6] += ((scriptEng.operands[1] & 0x7F) >> 4) + 8 * ((scriptEng.operands[2] & 0x7F) >> 4);
-                int32 index = tiles128x128.tileIndex[scriptEng.operands[6]];
-                switch (scriptEng.operands[3]) {
-                    case TILEINFO_INDEX: scriptEng.operands[0] = tiles128x128.tileIndex[scriptEng.operands[6]]; break;
-                    case TILEINFO_DIRECTION: scriptEng.operands[0] = tiles128x128.direction[scriptEng.operands[6]]; break;
-                    case TILEINFO_VISUALPLANE: scriptEng.operands[0] = tiles128x128.visualPlane[scriptEng.operands[6]]; break;
-                    case TILEINFO_SOLIDITYA: scriptEng.operands[0] = tiles128x128.collisionFlags[0][scriptEng.operands[6]]; break;
-                    case TILEINFO_SOLIDITYB: scriptEng.operands[0] = tiles128x128.collisionFlags[1][scriptEng.operands[6]]; break;
-                    case TILEINFO_FLAGSA: scriptEng.operands[0] = collisionMasks[0].flags[index]; break;
-                    case TILEINFO_ANGLEA: scriptEng.operands[0] = collisionMasks[0].angles[index]; break;
-                    case TILEINFO_FLAGSB: scriptEng.operands[0] = collisionMasks[1].flags[index]; break;
-                    case TILEINFO_ANGLEB: scriptEng.operands[0] = collisionMasks[1].angles[index]; break;
-                    default: break;
+                case VAR_OBJECTVALUE11: {
+                    objectEntityList[arrayVal].values[11] = scriptEng.operands[i];
+                    break;
                 }
-                break;
-            }
-            case FUNC_SET16X16TILEINFO: {
-                scriptEng.operands[4] = scriptEng.operands[1] >> 7;
-                scriptEng.operands[5] = scriptEng.operands[2] >> 7;
-                scriptEng.operands[6] = stageLayouts[0].tiles[scriptEng.operands[4] + (scriptEng.operands[5] << 8)] << 6;
-                scriptEng.operands[6] += ((scriptEng.operands[1] & 0x7F) >> 4) + 8 * ((scriptEng.operands[2] & 0x7F) >> 4);
-                switch (scriptEng.operands[3]) {
-                    case TILEINFO_INDEX:
-                        tiles128x128.tileIndex[scriptEng.operands[6]]  = scriptEng.operands[0];
-                        tiles128x128.gfxDataPos[scriptEng.operands[6]] = scriptEng.operands[0] << 8;
-                        break;
-                    case TILEINFO_DIRECTION: tiles128x128.direction[scriptEng.operands[6]] = scriptEng.operands[0]; break;
-                    case TILEINFO_VISUALPLANE: tiles128x128.visualPlane[scriptEng.operands[6]] = scriptEng.operands[0]; break;
-                    case TILEINFO_SOLIDITYA: tiles128x128.collisionFlags[0][scriptEng.operands[6]] = scriptEng.operands[0]; break;
-                    case TILEINFO_SOLIDITYB: tiles128x128.collisionFlags[1][scriptEng.operands[6]] = scriptEng.operands[0]; break;
-                    case TILEINFO_FLAGSA: collisionMasks[1].flags[tiles128x128.tileIndex[scriptEng.operands[6]]] = scriptEng.operands[0]; break;
-                    case TILEINFO_ANGLEA: collisionMasks[1].angles[tiles128x128.tileIndex[scriptEng.operands[6]]] = scriptEng.operands[0]; break;
-                    default: break;
+                case VAR_OBJECTVALUE12: {
+                    objectEntityList[arrayVal].values[12] = scriptEng.operands[i];
+                    break;
                 }
-                break;
-            }
-            case FUNC_COPY16X16TILE:
-                opcodeSize = 0;
-                Copy16x16Tile(scriptEng.operands[0], scriptEng.operands[1]);
-                break;
-            case FUNC_GETANIMATIONBYNAME: {
-                AnimationFile *animFile = scriptInfo->animFile;
-                scriptEng.operands[0]   = -1;
-                int32 id                = 0;
-                while (scriptEng.operands[0] == -1) {
-                    SpriteAnimation *anim = &animationList[animFile->aniListOffset + id];
-                    if (StrComp(scriptText, anim->name))
-                        scriptEng.operands[0] = id;
-                    else if (++id == animFile->animCount)
-                        scriptEng.operands[0] = 0;
+                case VAR_OBJECTVALUE13: {
+                    objectEntityList[arrayVal].values[13] = scriptEng.operands[i];
+                    break;
                 }
-                break;
-            }
-            case FUNC_READSAVERAM:
-                opcodeSize            = 0;
-                scriptEng.checkResult = ReadSaveRAM();
-                break;
-            case FUNC_WRITESAVERAM:
-                opcodeSize            = 0;
-                scriptEng.checkResult = WriteSaveRAM();
-                break;
-            case FUNC_LOADTEXTFILE: {
-                opcodeSize     = 0;
-                TextMenu *menu = &gameMenu[scriptEng.operands[0]];
-                LoadTextFile(menu, scriptText);
-                break;
-            }
-            case FUNC_GETTEXTINFO: {
-                TextMenu *menu = &gameMenu[scriptEng.operands[1]];
-                switch (scriptEng.operands[2]) {
-                    case TEXTINFO_TEXTDATA:
-                        scriptEng.operands[0] = menu->textData[menu->entryStart[scriptEng.operands[3]] + scriptEng.operands[4]];
-                        break;
-                    case TEXTINFO_TEXTSIZE: scriptEng.operands[0] = menu->entrySize[scriptEng.operands[3]]; break;
-                    case TEXTINFO_ROWCOUNT: scriptEng.operands[0] = menu->rowCount; break;
+                case VAR_OBJECTVALUE14: {
+                    objectEntityList[arrayVal].values[14] = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTVALUE15: {
+                    objectEntityList[arrayVal].values[15] = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTVALUE16: {
+                    objectEntityList[arrayVal].values[16] = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTVALUE17: {
+                    objectEntityList[arrayVal].values[17] = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTVALUE18: {
+                    objectEntityList[arrayVal].values[18] = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTVALUE19: {
+                    objectEntityList[arrayVal].values[19] = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTVALUE20: {
+                    objectEntityList[arrayVal].values[20] = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTVALUE21: {
+                    objectEntityList[arrayVal].values[21] = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTVALUE22: {
+                    objectEntityList[arrayVal].values[22] = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTVALUE23: {
+                    objectEntityList[arrayVal].values[23] = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTVALUE24: {
+                    objectEntityList[arrayVal].values[24] = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTVALUE25: {
+                    objectEntityList[arrayVal].values[25] = scriptEng.operands[i];
+                    break;
                 }
-                break;
-            }
-            case FUNC_GETVERSIONNUMBER: {
-                opcodeSize                           = 0;
-                TextMenu *menu                       = &gameMenu[scriptEng.operands[0]];
-                menu->entryHighlight[menu->rowCount] = scriptEng.operands[1];
-                AddTextMenuEntry(menu, gameVerInfo.version);
-                break;
-            }
-            case FUNC_GETTABLEVALUE: {
-                int32 arrPos = scriptEng.operands[1];
-                if (arrPos >= 0) {
-                    int32 pos     = scriptEng.operands[2];
-                    int32 arrSize = scriptCode[pos];
-                    if (arrPos < arrSize)
-                        scriptEng.operands[0] = scriptCode[pos + arrPos + 1];
+                case VAR_OBJECTVALUE26: {
+                    objectEntityList[arrayVal].values[26] = scriptEng.operands[i];
+                    break;
                 }
-                break;
-            }
-            case FUNC_SETTABLEVALUE: {
-                opcodeSize   = 0;
-                int32 arrPos = scriptEng.operands[1];
-                if (arrPos >= 0) {
-                    int32 pos     = scriptEng.operands[2];
-                    int32 arrSize = scriptCode[pos];
-                    if (arrPos < arrSize)
-                        scriptCode[pos + arrPos + 1] = scriptEng.operands[0];
+                case VAR_OBJECTVALUE27: {
+                    objectEntityList[arrayVal].values[27] = scriptEng.operands[i];
+                    break;
                 }
-                break;
-            }
-            case FUNC_CHECKCURRENTSTAGEFOLDER:
-                opcodeSize            = 0;
-                scriptEng.checkResult = StrComp(sceneInfo.listData[sceneInfo.listPos].folder, scriptText);
-
-                // Mission Mode stuff
-                if (!scriptEng.checkResult) {
-                    int32 targetLength  = strlen(sceneInfo.listData[sceneInfo.listPos].folder);
-                    int32 currentLength = strlen(scriptText);
-                    if (targetLength > currentLength) {
-                        scriptEng.checkResult = StrComp(&sceneInfo.listData[sceneInfo.listPos].folder[targetLength - currentLength], scriptText);
-                    }
+                case VAR_OBJECTVALUE28: {
+                    objectEntityList[arrayVal].values[28] = scriptEng.operands[i];
+                    break;
                 }
-                break;
-            case FUNC_ABS: {
-                scriptEng.operands[0] = abs(scriptEng.operands[0]);
-                break;
-            }
-            case FUNC_CALLNATIVEFUNCTION:
-                opcodeSize = 0;
-                if (scriptEng.operands[0] >= 0 && scriptEng.operands[0] < LEGACY_v4_NATIIVEFUNCTION_COUNT) {
-                    void (*func)(void) = (void (*)(void))nativeFunction[scriptEng.operands[0]];
-                    if (func)
-                        func();
+                case VAR_OBJECTVALUE29: {
+                    objectEntityList[arrayVal].values[29] = scriptEng.operands[i];
+                    break;
                 }
-                break;
-            case FUNC_CALLNATIVEFUNCTION2:
-                if (scriptEng.operands[0] >= 0 && scriptEng.operands[0] < LEGACY_v4_NATIIVEFUNCTION_COUNT) {
-                    if (StrLength(scriptText)) {
-                        void (*func)(int32 *, char *) = (void (*)(int32 *, char *))nativeFunction[scriptEng.operands[0]];
-                        if (func)
-                            func(&scriptEng.operands[2], scriptText);
-                    }
-                    else {
-                        void (*func)(int32 *, int32 *) = (void (*)(int32 *, int32 *))nativeFunction[scriptEng.operands[0]];
-                        if (func)
-                            func(&scriptEng.operands[1], &scriptEng.operands[2]);
-                    }
+                case VAR_OBJECTVALUE30: {
+                    objectEntityList[arrayVal].values[30] = scriptEng.operands[i];
+                    break;
                 }
-                break;
-            case FUNC_CALLNATIVEFUNCTION4:
-                if (scriptEng.operands[0] >= 0 && scriptEng.operands[0] < LEGACY_v4_NATIIVEFUNCTION_COUNT) {
-                    if (StrLength(scriptText)) {
-                        void (*func)(int32 *, char *, int32 *, int32 *) =
-                            (void (*)(int32 *, char *, int32 *, int32 *))nativeFunction[scriptEng.operands[0]];
-                        if (func)
-                            func(&scriptEng.operands[1], scriptText, &scriptEng.operands[3], &scriptEng.operands[4]);
-                    }
-                    else {
-                        void (*func)(int32 *, int32 *, int32 *, int32 *) =
-                            (void (*)(int32 *, int32 *, int32 *, int32 *))nativeFunction[scriptEng.operands[0]];
-                        if (func)
-                            func(&scriptEng.operands[1], &scriptEng.operands[2], &scriptEng.operands[3], &scriptEng.operands[4]);
-                    }
+                case VAR_OBJECTVALUE31: {
+                    objectEntityList[arrayVal].values[31] = scriptEng.operands[i];
+                    break;
                 }
-                break;
-            case FUNC_SETOBJECTRANGE: {
-                // FUNCTION PARAMS:
-                // scriptEng.operands[0] = range
-
-                opcodeSize       = 0;
-                int32 offset     = (scriptEng.operands[0] >> 1) - SCREEN_CENTERX;
-                OBJECT_BORDER_X1 = offset + 0x80;
-                OBJECT_BORDER_X2 = scriptEng.operands[0] + 0x80 - offset;
-                OBJECT_BORDER_X3 = offset + 0x20;
-                OBJECT_BORDER_X4 = scriptEng.operands[0] + 0x20 - offset;
-                break;
-            }
-            case FUNC_GETOBJECTVALUE: {
-                // FUNCTION PARAMS:
-                // scriptEng.operands[0] = result
-                // scriptEng.operands[1] = valueID
-                // scriptEng.operands[2] = entitySlot
-
-                if (scriptEng.operands[1] < 48)
-                    scriptEng.operands[0] = objectEntityList[scriptEng.operands[2]].values[scriptEng.operands[1]];
-                break;
-            }
-            case FUNC_SETOBJECTVALUE: {
-                // FUNCTION PARAMS:
-                // scriptEng.operands[0] = value
-                // scriptEng.operands[1] = valueID
-                // scriptEng.operands[2] = entitySlot
-
-                opcodeSize = 0;
-                if (scriptEng.operands[1] < 48)
-                    objectEntityList[scriptEng.operands[2]].values[scriptEng.operands[1]] = scriptEng.operands[0];
-                break;
-            }
-            case FUNC_COPYOBJECT: {
-                // FUNCTION PARAMS:
-                // scriptEng.operands[0] = destSlot
-                // scriptEng.operands[1] = srcSlot
-                // scriptEng.operands[2] = count
-
-                Entity *dstList = &objectEntityList[scriptEng.operands[0]];
-                Entity *srcList = &objectEntityList[scriptEng.operands[1]];
-                for (int32 i = 0; i < scriptEng.operands[2]; ++i) memcpy(&dstList[i], &srcList[i], sizeof(Entity));
-                break;
-            }
-            case FUNC_PRINT: {
-                // FUNCTION PARAMS:
-                // scriptEng.operands[0] = message (can be a regular value or a string depending on scriptEng.operands[1])
-                // scriptEng.operands[1] = isInt
-                // scriptEng.operands[2] = useEndLine
-
-                useEndLine = false;
-                if (scriptEng.operands[1])
-                    PrintLog(PRINT_NORMAL, "%d", scriptEng.operands[0]);
-                else
-                    PrintLog(PRINT_NORMAL, "%s", scriptText);
-
-                if (scriptEng.operands[2])
-                    PrintLog(PRINT_NORMAL, "\n");
-                useEndLine = true;
-                break;
-            }
-
-            // Extras for origins 2PVS
-            case FUNC_CHECKCAMERAPROXIMITY:
-                scriptEng.checkResult = false;
-
-                // FUNCTION PARAMS:
-                // scriptEng.operands[0] = pos.x
-                // scriptEng.operands[1] = pos.y
-                // scriptEng.operands[2] = range.x
-                // scriptEng.operands[3] = range.y
-                //
-                // FUNCTION NOTES:
-                // - Sets scriptEng.checkResult
-
-                if (scriptEng.operands[2] > 0 && scriptEng.operands[3] > 0) {
-                    for (int32 s = 0; s < videoSettings.screenCount; ++s) {
-                        int32 sx = abs(scriptEng.operands[0] - cameras[s].xpos);
-                        int32 sy = abs(scriptEng.operands[1] - cameras[s].ypos);
-
-                        if (sx < scriptEng.operands[2] && sy < scriptEng.operands[3]) {
-                            scriptEng.checkResult = true;
-                            break;
-                        }
-                    }
+                case VAR_OBJECTVALUE32: {
+                    objectEntityList[arrayVal].values[32] = scriptEng.operands[i];
+                    break;
                 }
-                else {
-                    if (scriptEng.operands[2] > 0) {
-                        for (int32 s = 0; s < videoSettings.screenCount; ++s) {
-                            int32 sx = abs(scriptEng.operands[0] - cameras[s].xpos);
-
-                            if (sx < scriptEng.operands[2]) {
-                                scriptEng.checkResult = true;
-                                break;
-                            }
-                        }
-                    }
-                    else if (scriptEng.operands[3] > 0) {
-                        for (int32 s = 0; s < videoSettings.screenCount; ++s) {
-                            int32 sy = abs(scriptEng.operands[1] - cameras[s].ypos);
-
-                            if (sy < scriptEng.operands[3]) {
-                                scriptEng.checkResult = true;
-                                break;
-                            }
-                        }
-                    }
+                case VAR_OBJECTVALUE33: {
+                    objectEntityList[arrayVal].values[33] = scriptEng.operands[i];
+                    break;
                 }
-                break;
-
-            case FUNC_SETSCREENCOUNT:
-                // FUNCTION PARAMS:
-                // scriptEng.operands[0] = screenCount
-
-                RSDK::SetVideoSetting(VIDEOSETTING_SCREENCOUNT, scriptEng.operands[0]);
-                break;
-
-            case FUNC_SETSCREENVERTICES:
-                // FUNCTION PARAMS:
-                // scriptEng.operands[0] = startVert2P_S1
-                // scriptEng.operands[1] = startVert2P_S2
-                // scriptEng.operands[2] = startVert3P_S1
-                // scriptEng.operands[3] = startVert3P_S2
-                // scriptEng.operands[4] = startVert3P_S3
-
-                RSDK::SetScreenVertices(scriptEng.operands[0], scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3],
-                                        scriptEng.operands[4]);
-                break;
-
-            case FUNC_GETINPUTDEVICEID:
-                // FUNCTION PARAMS:
-                // scriptEng.operands[0] = deviceID
-                // scriptEng.operands[1] = inputSlot
-                //
-                // FUNCTION NOTES:
-                // - Assigns the device's id to scriptEng.operands[0]
-
-                scriptEng.operands[0] = GetInputDeviceID(scriptEng.operands[1]);
-                break;
-
-            case FUNC_GETFILTEREDINPUTDEVICEID:
-                // FUNCTION PARAMS:
-                // scriptEng.operands[0] = deviceID
-                // scriptEng.operands[1] = confirmOnly
-                // scriptEng.operands[2] = unassignedOnly
-                // scriptEng.operands[3] = maxInactiveTimer
-                //
-                // FUNCTION NOTES:
-                // - Assigns the filtered device's id to scriptEng.operands[0]
-
-                scriptEng.operands[0] = GetFilteredInputDeviceID(scriptEng.operands[1], scriptEng.operands[2] > 0, scriptEng.operands[3]);
-                break;
-
-            case FUNC_GETINPUTDEVICETYPE:
-                // FUNCTION PARAMS:
-                // scriptEng.operands[0] = deviceType
-                // scriptEng.operands[1] = deviceID
-                //
-                // FUNCTION NOTES:
-                // - Assigns the device's type to scriptEng.operands[0]
-
-                scriptEng.operands[0] = GetInputDeviceType(scriptEng.operands[1]);
-                break;
-
-            case FUNC_ISINPUTDEVICEASSIGNED:
-                // FUNCTION PARAMS:
-                // scriptEng.operands[0] = deviceID
-
-                scriptEng.checkResult = IsInputDeviceAssigned(scriptEng.operands[0]);
-                break;
-
-            case FUNC_ASSIGNINPUTSLOTTODEVICE:
-                // FUNCTION PARAMS:
-                // scriptEng.operands[0] = inputSlot
-                // scriptEng.operands[1] = deviceID
-
-                AssignInputSlotToDevice(scriptEng.operands[0], scriptEng.operands[1]);
-                break;
-
-            case FUNC_ISSLOTASSIGNED:
-                // FUNCTION PARAMS:
-                // scriptEng.operands[0] = inputSlot
-                //
-                // FUNCTION NOTES:
-                // - Sets scriptEng.checkResult
-
-                scriptEng.checkResult = IsInputSlotAssigned(scriptEng.operands[0]);
-                break;
-
-            case FUNC_RESETINPUTSLOTASSIGNMENTS:
-                // FUNCTION PARAMS:
-                // None
+                case VAR_OBJECTVALUE34: {
+                    objectEntityList[arrayVal].values[34] = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTVALUE35: {
+                    objectEntityList[arrayVal].values[35] = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTVALUE36: {
+                    objectEntityList[arrayVal].values[36] = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTVALUE37: {
+                    objectEntityList[arrayVal].values[37] = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTVALUE38: {
+                    objectEntityList[arrayVal].values[38] = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTVALUE39: {
+                    objectEntityList[arrayVal].values[39] = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTVALUE40: {
+                    objectEntityList[arrayVal].values[40] = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTVALUE41: {
+                    objectEntityList[arrayVal].values[41] = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTVALUE42: {
+                    objectEntityList[arrayVal].values[42] = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTVALUE43: {
+                    objectEntityList[arrayVal].values[43] = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTVALUE44: {
+                    objectEntityList[arrayVal].values[44] = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTVALUE45: {
+                    objectEntityList[arrayVal].values[45] = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTVALUE46: {
+                    objectEntityList[arrayVal].values[46] = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_OBJECTVALUE47: {
+                    objectEntityList[arrayVal].values[47] = scriptEng.operands[i];
+                    break;
+                }
+                case VAR_STAGESTATE: stageMode = scriptEng.operands[i]; break;
+                case VAR_STAGEACTIVELIST: {
+                    int32 listID = scriptEng.operands[i];
+                    if (listID < sceneInfo.categoryCount) {
+                        int32 prevListPos = sceneInfo.listCategory[sceneInfo.activeCategory].sceneOffsetStart;
 
-                ResetInputSlotAssignments();
-                break;
-        }
+                        sceneInfo.activeCategory = listID;
+                        SceneListInfo *list      = &sceneInfo.listCategory[sceneInfo.activeCategory];
 
-        // Set Values
-        if (opcodeSize > 0)
-            scriptCodePtr -= scriptCodePtr - scriptCodeOffset;
-        for (int32 i = 0; i < opcodeSize; ++i) {
-            int32 opcodeType = scriptCode[scriptCodePtr++];
-            if (opcodeType == SCRIPTVAR_VAR) {
-                int32 arrayVal = 0;
-                switch (scriptCode[scriptCodePtr++]) { // variable
-                    case VARARR_NONE: arrayVal = objectEntityPos; break;
-                    case VARARR_ARRAY:
-                        if (scriptCode[scriptCodePtr++] == 1)
-                            arrayVal = scriptEng.arrayPosition[scriptCode[scriptCodePtr++]];
-                        else
-                            arrayVal = scriptCode[scriptCodePtr++];
-                        break;
-                    case VARARR_ENTNOPLUS1:
-                        if (scriptCode[scriptCodePtr++] == 1)
-                            arrayVal = objectEntityPos + scriptEng.arrayPosition[scriptCode[scriptCodePtr++]];
-                        else
-                            arrayVal = objectEntityPos + scriptCode[scriptCodePtr++];
-                        break;
-                    case VARARR_ENTNOMINUS1:
-                        if (scriptCode[scriptCodePtr++] == 1)
-                            arrayVal = objectEntityPos - scriptEng.arrayPosition[scriptCode[scriptCodePtr++]];
-                        else
-                            arrayVal = objectEntityPos - scriptCode[scriptCodePtr++];
-                        break;
-                    default: break;
+                        sceneInfo.listPos = list->sceneOffsetStart + RSDK::sceneInfo.listPos - prevListPos;
+                        if (sceneInfo.listPos >= list->sceneOffsetEnd)
+                            sceneInfo.listPos = list->sceneOffsetEnd;
+                    }
+                    break;
                 }
+                case VAR_STAGELISTPOS: {
+                    SceneListInfo *list = &sceneInfo.listCategory[sceneInfo.activeCategory];
 
-                // Variables
-                switch (scriptCode[scriptCodePtr++]) {
-                    default: break;
-                    case VAR_TEMP0: scriptEng.temp[0] = scriptEng.operands[i]; break;
-                    case VAR_TEMP1: scriptEng.temp[1] = scriptEng.operands[i]; break;
-                    case VAR_TEMP2: scriptEng.temp[2] = scriptEng.operands[i]; break;
-                    case VAR_TEMP3: scriptEng.temp[3] = scriptEng.operands[i]; break;
-                    case VAR_TEMP4: scriptEng.temp[4] = scriptEng.operands[i]; break;
-                    case VAR_TEMP5: scriptEng.temp[5] = scriptEng.operands[i]; break;
-                    case VAR_TEMP6: scriptEng.temp[6] = scriptEng.operands[i]; break;
-                    case VAR_TEMP7: scriptEng.temp[7] = scriptEng.operands[i]; break;
-                    case VAR_CHECKRESULT: scriptEng.checkResult = scriptEng.operands[i]; break;
-                    case VAR_ARRAYPOS0: scriptEng.arrayPosition[0] = scriptEng.operands[i]; break;
-                    case VAR_ARRAYPOS1: scriptEng.arrayPosition[1] = scriptEng.operands[i]; break;
-                    case VAR_ARRAYPOS2: scriptEng.arrayPosition[2] = scriptEng.operands[i]; break;
-                    case VAR_ARRAYPOS3: scriptEng.arrayPosition[3] = scriptEng.operands[i]; break;
-                    case VAR_ARRAYPOS4: scriptEng.arrayPosition[4] = scriptEng.operands[i]; break;
-                    case VAR_ARRAYPOS5: scriptEng.arrayPosition[5] = scriptEng.operands[i]; break;
-                    case VAR_ARRAYPOS6: scriptEng.arrayPosition[6] = scriptEng.operands[i]; break;
-                    case VAR_ARRAYPOS7: scriptEng.arrayPosition[7] = scriptEng.operands[i]; break;
-                    case VAR_GLOBAL: globalVariables[arrayVal].value = scriptEng.operands[i]; break;
-                    case VAR_LOCAL: scriptCode[arrayVal] = scriptEng.operands[i]; break;
-                    case VAR_OBJECTENTITYPOS: break;
-                    case VAR_OBJECTGROUPID: {
-                        objectEntityList[arrayVal].groupID = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTTYPE: {
-                        objectEntityList[arrayVal].type = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTPROPERTYVALUE: {
-                        objectEntityList[arrayVal].propertyValue = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTXPOS: {
-                        objectEntityList[arrayVal].xpos = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTYPOS: {
-                        objectEntityList[arrayVal].ypos = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTIXPOS: {
-                        objectEntityList[arrayVal].xpos = scriptEng.operands[i] << 16;
-                        break;
-                    }
-                    case VAR_OBJECTIYPOS: {
-                        objectEntityList[arrayVal].ypos = scriptEng.operands[i] << 16;
-                        break;
-                    }
-                    case VAR_OBJECTXVEL: {
-                        objectEntityList[arrayVal].xvel = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTYVEL: {
-                        objectEntityList[arrayVal].yvel = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTSPEED: {
-                        objectEntityList[arrayVal].speed = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTSTATE: {
-                        objectEntityList[arrayVal].state = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTROTATION: {
-                        objectEntityList[arrayVal].rotation = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTSCALE: {
-                        objectEntityList[arrayVal].scale = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTPRIORITY: {
-                        objectEntityList[arrayVal].priority = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTDRAWORDER: {
-                        objectEntityList[arrayVal].drawOrder = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTDIRECTION: {
-                        objectEntityList[arrayVal].direction = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTINKEFFECT: {
-                        objectEntityList[arrayVal].inkEffect = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTALPHA: {
-                        objectEntityList[arrayVal].alpha = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTFRAME: {
-                        objectEntityList[arrayVal].frame = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTANIMATION: {
-                        objectEntityList[arrayVal].animation = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTPREVANIMATION: {
-                        objectEntityList[arrayVal].prevAnimation = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTANIMATIONSPEED: {
-                        objectEntityList[arrayVal].animationSpeed = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTANIMATIONTIMER: {
-                        objectEntityList[arrayVal].animationTimer = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTANGLE: {
-                        objectEntityList[arrayVal].angle = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTLOOKPOSX: {
-                        objectEntityList[arrayVal].lookPosX = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTLOOKPOSY: {
-                        objectEntityList[arrayVal].lookPosY = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTCOLLISIONMODE: {
-                        objectEntityList[arrayVal].collisionMode = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTCOLLISIONPLANE: {
-                        objectEntityList[arrayVal].collisionPlane = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTCONTROLMODE: {
-                        objectEntityList[arrayVal].controlMode = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTCONTROLLOCK: {
-                        objectEntityList[arrayVal].controlLock = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTPUSHING: {
-                        objectEntityList[arrayVal].pushing = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTVISIBLE: {
-                        objectEntityList[arrayVal].visible = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTTILECOLLISIONS: {
-                        objectEntityList[arrayVal].tileCollisions = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTINTERACTION: {
-                        objectEntityList[arrayVal].objectInteractions = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTGRAVITY: {
-                        objectEntityList[arrayVal].gravity = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTUP: {
-                        objectEntityList[arrayVal].up = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTDOWN: {
-                        objectEntityList[arrayVal].down = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTLEFT: {
-                        objectEntityList[arrayVal].left = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTRIGHT: {
-                        objectEntityList[arrayVal].right = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTJUMPPRESS: {
-                        objectEntityList[arrayVal].jumpPress = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTJUMPHOLD: {
-                        objectEntityList[arrayVal].jumpHold = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTSCROLLTRACKING: {
-                        objectEntityList[arrayVal].scrollTracking = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTFLOORSENSORL: {
-                        objectEntityList[arrayVal].floorSensors[0] = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTFLOORSENSORC: {
-                        objectEntityList[arrayVal].floorSensors[1] = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTFLOORSENSORR: {
-                        objectEntityList[arrayVal].floorSensors[2] = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTFLOORSENSORLC: {
-                        objectEntityList[arrayVal].floorSensors[3] = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTFLOORSENSORRC: {
-                        objectEntityList[arrayVal].floorSensors[4] = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTCOLLISIONLEFT: {
-                        break;
-                    }
-                    case VAR_OBJECTCOLLISIONTOP: {
-                        break;
-                    }
-                    case VAR_OBJECTCOLLISIONRIGHT: {
-                        break;
-                    }
-                    case VAR_OBJECTCOLLISIONBOTTOM: {
-                        break;
-                    }
-                    case VAR_OBJECTOUTOFBOUNDS: {
-                        break;
-                    }
-                    case VAR_OBJECTSPRITESHEET: {
-                        objectScriptList[objectEntityList[arrayVal].type].spriteSheetID = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTVALUE0: {
-                        objectEntityList[arrayVal].values[0] = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTVALUE1: {
-                        objectEntityList[arrayVal].values[1] = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTVALUE2: {
-                        objectEntityList[arrayVal].values[2] = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTVALUE3: {
-                        objectEntityList[arrayVal].values[3] = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTVALUE4: {
-                        objectEntityList[arrayVal].values[4] = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTVALUE5: {
-                        objectEntityList[arrayVal].values[5] = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTVALUE6: {
-                        objectEntityList[arrayVal].values[6] = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTVALUE7: {
-                        objectEntityList[arrayVal].values[7] = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTVALUE8: {
-                        objectEntityList[arrayVal].values[8] = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTVALUE9: {
-                        objectEntityList[arrayVal].values[9] = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTVALUE10: {
-                        objectEntityList[arrayVal].values[10] = scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_OBJECTVALUE11: {
-                        objectEntityList[arrayVal].values[11] = scriptEng.operands[i];
-                        break;
+                    if (list->sceneOffsetStart + scriptEng.operands[i] < list->sceneOffsetEnd)
+                        sceneInfo.listPos = list->sceneOffsetStart + scriptEng.operands[i];
+                    break;
+                }
+                case VAR_STAGETIMEENABLED: timeEnabled = scriptEng.operands[i]; break;
+                case VAR_STAGEMILLISECONDS: stageMilliseconds = scriptEng.operands[i]; break;
+                case VAR_STAGESECONDS: stageSeconds = scriptEng.operands[i]; break;
+                case VAR_STAGEMINUTES: stageMinutes = scriptEng.operands[i]; break;
+                case VAR_STAGEACTNUM: actID = scriptEng.operands[i]; break;
+                case VAR_STAGEPAUSEENABLED: pauseEnabled = scriptEng.operands[i]; break;
+                case VAR_STAGELISTSIZE: break;
+                case VAR_STAGENEWXBOUNDARY1: newXBoundary1 = scriptEng.operands[i]; break;
+                case VAR_STAGENEWXBOUNDARY2: newXBoundary2 = scriptEng.operands[i]; break;
+                case VAR_STAGENEWYBOUNDARY1: newYBoundary1 = scriptEng.operands[i]; break;
+                case VAR_STAGENEWYBOUNDARY2: newYBoundary2 = scriptEng.operands[i]; break;
+                case VAR_STAGECURXBOUNDARY1:
+                    if (curXBoundary1 != scriptEng.operands[i]) {
+                        curXBoundary1 = scriptEng.operands[i];
+                        newXBoundary1 = scriptEng.operands[i];
                     }
-                    case VAR_OBJECTVALUE12: {
-                        objectEntityList[arrayVal].values[12] = scriptEng.operands[i];
-                        break;
+                    break;
+                case VAR_STAGECURXBOUNDARY2:
+                    if (curXBoundary2 != scriptEng.operands[i]) {
+                        curXBoundary2 = scriptEng.operands[i];
+                        newXBoundary2 = scriptEng.operands[i];
                     }
-                    case VAR_OBJECTVALUE13: {
-                        objectEntityList[arrayVal].values[13] = scriptEng.operands[i];
-                        break;
+                    break;
+                case VAR_STAGECURYBOUNDARY1:
+                    if (curYBoundary1 != scriptEng.operands[i]) {
+                        curYBoundary1 = scriptEng.operands[i];
+                        newYBoundary1 = scriptEng.operands[i];
                     }
-                    case VAR_OBJECTVALUE14: {
-                        objectEntityList[arrayVal].values[14] = scriptEng.operands[i];
-                        break;
+                    break;
+                case VAR_STAGECURYBOUNDARY2:
+                    if (curYBoundary2 != scriptEng.operands[i]) {
+                        curYBoundary2 = scriptEng.operands[i];
+                        newYBoundary2 = scriptEng.operands[i];
                     }
-                    case VAR_OBJECTVALUE15: {
-                        objectEntityList[arrayVal].values[15] = scriptEng.operands[i];
+                    break;
+                case VAR_STAGEDEFORMATIONDATA0: bgDeformationData0[arrayVal] = scriptEng.operands[i]; break;
+                case VAR_STAGEDEFORMATIONDATA1: bgDeformationData1[arrayVal] = scriptEng.operands[i]; break;
+                case VAR_STAGEDEFORMATIONDATA2: bgDeformationData2[arrayVal] = scriptEng.operands[i]; break;
+                case VAR_STAGEDEFORMATIONDATA3: bgDeformationData3[arrayVal] = scriptEng.operands[i]; break;
+                case VAR_STAGEWATERLEVEL: waterLevel = scriptEng.operands[i]; break;
+                case VAR_STAGEACTIVELAYER: activeTileLayers[arrayVal] = scriptEng.operands[i]; break;
+                case VAR_STAGEMIDPOINT: tLayerMidPoint = scriptEng.operands[i]; break;
+                case VAR_STAGEPLAYERLISTPOS: playerListPos = scriptEng.operands[i]; break;
+                case VAR_STAGEDEBUGMODE: debugMode = scriptEng.operands[i]; break;
+                case VAR_STAGEENTITYPOS: objectEntityPos = scriptEng.operands[i]; break;
+                case VAR_SCREENCAMERAENABLED: currentCamera->enabled = scriptEng.operands[i]; break;
+                case VAR_SCREENCAMERATARGET: currentCamera->target = scriptEng.operands[i]; break;
+                case VAR_SCREENCAMERASTYLE: currentCamera->style = scriptEng.operands[i]; break;
+                case VAR_SCREENCAMERAX: currentCamera->xpos = scriptEng.operands[i]; break;
+                case VAR_SCREENCAMERAY: currentCamera->ypos = scriptEng.operands[i]; break;
+                case VAR_SCREENDRAWLISTSIZE: drawListEntries[arrayVal].listSize = scriptEng.operands[i]; break;
+                case VAR_SCREENXCENTER: break;
+                case VAR_SCREENYCENTER: break;
+                case VAR_SCREENXSIZE: break;
+                case VAR_SCREENYSIZE: break;
+                case VAR_SCREENXOFFSET: xScrollOffset = scriptEng.operands[i]; break;
+                case VAR_SCREENYOFFSET: yScrollOffset = scriptEng.operands[i]; break;
+                case VAR_SCREENSHAKEX: cameraShakeX = scriptEng.operands[i]; break;
+                case VAR_SCREENSHAKEY: cameraShakeY = scriptEng.operands[i]; break;
+                case VAR_SCREENADJUSTCAMERAY: currentCamera->adjustY = scriptEng.operands[i]; break;
+                case VAR_TOUCHSCREENDOWN: break;
+                case VAR_TOUCHSCREENXPOS: break;
+                case VAR_TOUCHSCREENYPOS: break;
+                case VAR_MUSICVOLUME: SetMusicVolume(scriptEng.operands[i]); break;
+                case VAR_MUSICCURRENTTRACK: break;
+                case VAR_MUSICPOSITION: break;
+                case VAR_KEYDOWNUP: controller[arrayVal].keyUp.down = scriptEng.operands[i]; break;
+                case VAR_KEYDOWNDOWN: controller[arrayVal].keyDown.down = scriptEng.operands[i]; break;
+                case VAR_KEYDOWNLEFT: controller[arrayVal].keyLeft.down = scriptEng.operands[i]; break;
+                case VAR_KEYDOWNRIGHT: controller[arrayVal].keyRight.down = scriptEng.operands[i]; break;
+                case VAR_KEYDOWNBUTTONA: controller[arrayVal].keyA.down = scriptEng.operands[i]; break;
+                case VAR_KEYDOWNBUTTONB: controller[arrayVal].keyB.down = scriptEng.operands[i]; break;
+                case VAR_KEYDOWNBUTTONC: controller[arrayVal].keyC.down = scriptEng.operands[i]; break;
+                case VAR_KEYDOWNBUTTONX: controller[arrayVal].keyX.down = scriptEng.operands[i]; break;
+                case VAR_KEYDOWNBUTTONY: controller[arrayVal].keyY.down = scriptEng.operands[i]; break;
+                case VAR_KEYDOWNBUTTONZ: controller[arrayVal].keyZ.down = scriptEng.operands[i]; break;
+                case VAR_KEYDOWNBUTTONL: triggerL[arrayVal].keyBumper.down = scriptEng.operands[i]; break;
+                case VAR_KEYDOWNBUTTONR: triggerR[arrayVal].keyBumper.down = scriptEng.operands[i]; break;
+                case VAR_KEYDOWNSTART: controller[arrayVal].keyStart.down = scriptEng.operands[i]; break;
+                case VAR_KEYDOWNSELECT: controller[arrayVal].keySelect.down = scriptEng.operands[i]; break;
+                case VAR_KEYPRESSUP: controller[arrayVal].keyUp.press = scriptEng.operands[i]; break;
+                case VAR_KEYPRESSDOWN: controller[arrayVal].keyDown.press = scriptEng.operands[i]; break;
+                case VAR_KEYPRESSLEFT: controller[arrayVal].keyLeft.press = scriptEng.operands[i]; break;
+                case VAR_KEYPRESSRIGHT: controller[arrayVal].keyRight.press = scriptEng.operands[i]; break;
+                case VAR_KEYPRESSBUTTONA: controller[arrayVal].keyA.press = scriptEng.operands[i]; break;
+                case VAR_KEYPRESSBUTTONB: controller[arrayVal].keyB.press = scriptEng.operands[i]; break;
+                case VAR_KEYPRESSBUTTONC: controller[arrayVal].keyC.press = scriptEng.operands[i]; break;
+                case VAR_KEYPRESSBUTTONX: controller[arrayVal].keyX.press = scriptEng.operands[i]; break;
+                case VAR_KEYPRESSBUTTONY: controller[arrayVal].keyY.press = scriptEng.operands[i]; break;
+                case VAR_KEYPRESSBUTTONZ: controller[arrayVal].keyZ.press = scriptEng.operands[i]; break;
+                case VAR_KEYPRESSBUTTONL: triggerL[arrayVal].keyBumper.press = scriptEng.operands[i]; break;
+                case VAR_KEYPRESSBUTTONR: triggerR[arrayVal].keyBumper.press = scriptEng.operands[i]; break;
+                case VAR_KEYPRESSSTART: controller[arrayVal].keyStart.press = scriptEng.operands[i]; break;
+                case VAR_KEYPRESSSELECT: controller[arrayVal].keySelect.press = scriptEng.operands[i]; break;
+                case VAR_MENU1SELECTION: gameMenu[0].selection1 = scriptEng.operands[i]; break;
+                case VAR_MENU2SELECTION: gameMenu[1].selection1 = scriptEng.operands[i]; break;
+                case VAR_TILELAYERXSIZE: stageLayouts[arrayVal].xsize = scriptEng.operands[i]; break;
+                case VAR_TILELAYERYSIZE: stageLayouts[arrayVal].ysize = scriptEng.operands[i]; break;
+                case VAR_TILELAYERTYPE: stageLayouts[arrayVal].type = scriptEng.operands[i]; break;
+                case VAR_TILELAYERANGLE: {
+                    int32 angle = scriptEng.operands[i] + 0x200;
+                    if (scriptEng.operands[i] >= 0)
+                        angle = scriptEng.operands[i];
+                    stageLayouts[arrayVal].angle = angle & 0x1FF;
+                    break;
+                }
+                case VAR_TILELAYERXPOS: stageLayouts[arrayVal].xpos = scriptEng.operands[i]; break;
+                case VAR_TILELAYERYPOS: stageLayouts[arrayVal].ypos = scriptEng.operands[i]; break;
+                case VAR_TILELAYERZPOS: stageLayouts[arrayVal].zpos = scriptEng.operands[i]; break;
+                case VAR_TILELAYERPARALLAXFACTOR: stageLayouts[arrayVal].parallaxFactor = scriptEng.operands[i]; break;
+                case VAR_TILELAYERSCROLLSPEED: stageLayouts[arrayVal].scrollSpeed = scriptEng.operands[i]; break;
+                case VAR_TILELAYERSCROLLPOS: stageLayouts[arrayVal].scrollPos = scriptEng.operands[i]; break;
+                case VAR_TILELAYERDEFORMATIONOFFSET: stageLayouts[arrayVal].deformationOffset = scriptEng.operands[i]; break;
+                case VAR_TILELAYERDEFORMATIONOFFSETW: stageLayouts[arrayVal].deformationOffsetW = scriptEng.operands[i]; break;
+                case VAR_HPARALLAXPARALLAXFACTOR: hParallax.parallaxFactor[arrayVal] = scriptEng.operands[i]; break;
+                case VAR_HPARALLAXSCROLLSPEED: hParallax.scrollSpeed[arrayVal] = scriptEng.operands[i]; break;
+                case VAR_HPARALLAXSCROLLPOS: hParallax.scrollPos[arrayVal] = scriptEng.operands[i]; break;
+                case VAR_VPARALLAXPARALLAXFACTOR: vParallax.parallaxFactor[arrayVal] = scriptEng.operands[i]; break;
+                case VAR_VPARALLAXSCROLLSPEED: vParallax.scrollSpeed[arrayVal] = scriptEng.operands[i]; break;
+                case VAR_VPARALLAXSCROLLPOS: vParallax.scrollPos[arrayVal] = scriptEng.operands[i]; break;
+                case VAR_SCENE3DVERTEXCOUNT: vertexCount = scriptEng.operands[i]; break;
+                case VAR_SCENE3DFACECOUNT: faceCount = scriptEng.operands[i]; break;
+                case VAR_SCENE3DPROJECTIONX: projectionX = scriptEng.operands[i]; break;
+                case VAR_SCENE3DPROJECTIONY: projectionY = scriptEng.operands[i]; break;
+                case VAR_SCENE3DFOGCOLOR: fogColor = scriptEng.operands[i]; break;
+                case VAR_SCENE3DFOGSTRENGTH: fogStrength = scriptEng.operands[i]; break;
+                case VAR_VERTEXBUFFERX: vertexBuffer[arrayVal].x = scriptEng.operands[i]; break;
+                case VAR_VERTEXBUFFERY: vertexBuffer[arrayVal].y = scriptEng.operands[i]; break;
+                case VAR_VERTEXBUFFERZ: vertexBuffer[arrayVal].z = scriptEng.operands[i]; break;
+                case VAR_VERTEXBUFFERU: vertexBuffer[arrayVal].u = scriptEng.operands[i]; break;
+                case VAR_VERTEXBUFFERV: vertexBuffer[arrayVal].v = scriptEng.operands[i]; break;
+                case VAR_FACEBUFFERA: faceBuffer[arrayVal].a = scriptEng.operands[i]; break;
+                case VAR_FACEBUFFERB: faceBuffer[arrayVal].b = scriptEng.operands[i]; break;
+                case VAR_FACEBUFFERC: faceBuffer[arrayVal].c = scriptEng.operands[i]; break;
+                case VAR_FACEBUFFERD: faceBuffer[arrayVal].d = scriptEng.operands[i]; break;
+                case VAR_FACEBUFFERFLAG: faceBuffer[arrayVal].flag = scriptEng.operands[i]; break;
+                case VAR_FACEBUFFERCOLOR: faceBuffer[arrayVal].color = scriptEng.operands[i]; break;
+                case VAR_SAVERAM: saveRAM[arrayVal] = scriptEng.operands[i]; break;
+                case VAR_ENGINESTATE: gameMode = scriptEng.operands[i]; break;
+                case VAR_ENGINELANGUAGE: language = scriptEng.operands[i]; break;
+                case VAR_ENGINEONLINEACTIVE: onlineActive = scriptEng.operands[i]; break;
+                case VAR_ENGINESFXVOLUME:
+                    sfxVolume = scriptEng.operands[i];
+                    // SetGameVolumes(bgmVolume, sfxVolume);
+                    break;
+                case VAR_ENGINEBGMVOLUME:
+                    bgmVolume = scriptEng.operands[i];
+                    // SetGameVolumes(bgmVolume, sfxVolume);
+                    break;
+                case VAR_ENGINETRIALMODE: trialMode = scriptEng.operands[i]; break;
+                case VAR_ENGINEDEVICETYPE: break;
+
+                // Origins Extras
+                case VAR_SCREENCURRENTID: break;
+                case VAR_CAMERAENABLED: cameras[arrayVal].enabled = scriptEng.operands[i]; break;
+                case VAR_CAMERATARGET: cameras[arrayVal].target = scriptEng.operands[i]; break;
+                case VAR_CAMERASTYLE: cameras[arrayVal].style = scriptEng.operands[i]; break;
+                case VAR_CAMERAXPOS: cameras[arrayVal].xpos = scriptEng.operands[i]; break;
+                case VAR_CAMERAYPOS: cameras[arrayVal].ypos = scriptEng.operands[i]; break;
+                case VAR_CAMERAADJUSTY: cameras[arrayVal].adjustY = scriptEng.operands[i]; break;
+
+#if LEGACY_RETRO_USE_HAPTICS
+                case VAR_HAPTICSENABLED: hapticsEnabled = scriptEng.operands[i]; break;
+#endif
+            }
+        }
+#if !RETRO_USE_PREDECODED_SCRIPTS
+        else if (opcodeType == SCRIPTVAR_INTCONST) { // int32 constant
+            scriptCodePtr++;
+        }
+        else if (opcodeType == SCRIPTVAR_STRCONST) { // string constant
+            int32 strLen = scriptCode[scriptCodePtr++];
+            for (int32 c = 0; c < strLen; ++c) {
+                switch (c % 4) {
+                    case 0: break;
+                    case 1: break;
+                    case 2: break;
+                    case 3: ++scriptCodePtr; break;
+                    default: break;
+                }
+            }
+            scriptCodePtr++;
+        }
+#endif
+    }
+}
+
+} // namespace v4
+} // namespace Legacy
+} // namespace RSDK
+
+#if RETRO_USE_COMPUTED_GOTO
+// each handler writes back its own operands, then reads in the next opcode & jumps straight to its handler, rather than going back round to the switch
+#define LEGACY_SCRIPT_NEXT                                                                                                                            \
+    WriteScriptOperands(&opcodeState, scriptCodePtr);                                                                                                 \
+    if (!running)                                                                                                                                     \
+        return;                                                                                                                                       \
+    opcode      = ReadScriptOpcode(&opcodeState, scriptCodePtr, scriptCodeStart, jumpTableStart);                                                     \
+    scriptInfo  = &objectScriptList[objectEntityList[objectEntityPos].type];                                                                          \
+    entity      = &objectEntityList[objectEntityPos];                                                                                                 \
+    spriteFrame = nullptr;                                                                                                                            \
+    goto *((uint32)opcode < FUNC_MAX_CNT ? opcodeHandlers[opcode] : &&DEFAULT_HANDLER)
+#else
+#define LEGACY_SCRIPT_NEXT break
+#endif
+
+void RSDK::Legacy::v4::ProcessScript(int32 scriptCodeStart, int32 jumpTableStart, uint8 scriptEvent)
+{
+#if RETRO_USE_COMPUTED_GOTO
+    static const void *const opcodeHandlers[FUNC_MAX_CNT] = {
+        &&FUNC_END_HANDLER, &&FUNC_EQUAL_HANDLER, &&FUNC_ADD_HANDLER, &&FUNC_SUB_HANDLER, &&FUNC_INC_HANDLER, &&FUNC_DEC_HANDLER, &&FUNC_MUL_HANDLER,
+        &&FUNC_DIV_HANDLER, &&FUNC_SHR_HANDLER, &&FUNC_SHL_HANDLER, &&FUNC_AND_HANDLER, &&FUNC_OR_HANDLER, &&FUNC_XOR_HANDLER, &&FUNC_MOD_HANDLER,
+        &&FUNC_FLIPSIGN_HANDLER, &&FUNC_CHECKEQUAL_HANDLER, &&FUNC_CHECKGREATER_HANDLER, &&FUNC_CHECKLOWER_HANDLER, &&FUNC_CHECKNOTEQUAL_HANDLER,
+        &&FUNC_IFEQUAL_HANDLER, &&FUNC_IFGREATER_HANDLER, &&FUNC_IFGREATEROREQUAL_HANDLER, &&FUNC_IFLOWER_HANDLER, &&FUNC_IFLOWEROREQUAL_HANDLER,
+        &&FUNC_IFNOTEQUAL_HANDLER, &&FUNC_ELSE_HANDLER, &&FUNC_ENDIF_HANDLER, &&FUNC_WEQUAL_HANDLER, &&FUNC_WGREATER_HANDLER,
+        &&FUNC_WGREATEROREQUAL_HANDLER, &&FUNC_WLOWER_HANDLER, &&FUNC_WLOWEROREQUAL_HANDLER, &&FUNC_WNOTEQUAL_HANDLER, &&FUNC_LOOP_HANDLER,
+        &&FUNC_FOREACHACTIVE_HANDLER, &&FUNC_FOREACHALL_HANDLER, &&FUNC_NEXT_HANDLER, &&FUNC_SWITCH_HANDLER, &&FUNC_BREAK_HANDLER,
+        &&FUNC_ENDSWITCH_HANDLER, &&FUNC_RAND_HANDLER, &&FUNC_SIN_HANDLER, &&FUNC_COS_HANDLER, &&FUNC_SIN256_HANDLER, &&FUNC_COS256_HANDLER,
+        &&FUNC_ATAN2_HANDLER, &&FUNC_INTERPOLATE_HANDLER, &&FUNC_INTERPOLATEXY_HANDLER, &&FUNC_LOADSPRITESHEET_HANDLER,
+        &&FUNC_REMOVESPRITESHEET_HANDLER, &&FUNC_DRAWSPRITE_HANDLER, &&FUNC_DRAWSPRITEXY_HANDLER, &&FUNC_DRAWSPRITESCREENXY_HANDLER,
+        &&FUNC_DRAWTINTRECT_HANDLER, &&FUNC_DRAWNUMBERS_HANDLER, &&FUNC_DRAWACTNAME_HANDLER, &&FUNC_DRAWMENU_HANDLER, &&FUNC_SPRITEFRAME_HANDLER,
+        &&FUNC_EDITFRAME_HANDLER, &&FUNC_LOADPALETTE_HANDLER, &&FUNC_ROTATEPALETTE_HANDLER, &&FUNC_SETSCREENFADE_HANDLER,
+        &&FUNC_SETACTIVEPALETTE_HANDLER, &&FUNC_SETPALETTEFADE_HANDLER, &&FUNC_SETPALETTEENTRY_HANDLER, &&FUNC_GETPALETTEENTRY_HANDLER,
+        &&FUNC_COPYPALETTE_HANDLER, &&FUNC_CLEARSCREEN_HANDLER, &&FUNC_DRAWSPRITEFX_HANDLER, &&FUNC_DRAWSPRITESCREENFX_HANDLER,
+        &&FUNC_LOADANIMATION_HANDLER, &&FUNC_SETUPMENU_HANDLER, &&FUNC_ADDMENUENTRY_HANDLER, &&FUNC_EDITMENUENTRY_HANDLER, &&FUNC_LOADSTAGE_HANDLER,
+        &&FUNC_DRAWRECT_HANDLER, &&FUNC_RESETOBJECTENTITY_HANDLER, &&FUNC_BOXCOLLISIONTEST_HANDLER, &&FUNC_CREATETEMPOBJECT_HANDLER,
+        &&FUNC_PROCESSOBJECTMOVEMENT_HANDLER, &&FUNC_PROCESSOBJECTCONTROL_HANDLER, &&FUNC_PROCESSANIMATION_HANDLER,
+        &&FUNC_DRAWOBJECTANIMATION_HANDLER, &&FUNC_SETMUSICTRACK_HANDLER, &&FUNC_PLAYMUSIC_HANDLER, &&FUNC_STOPMUSIC_HANDLER,
+        &&FUNC_PAUSEMUSIC_HANDLER, &&FUNC_RESUMEMUSIC_HANDLER, &&FUNC_SWAPMUSICTRACK_HANDLER, &&FUNC_PLAYSFX_HANDLER, &&FUNC_STOPSFX_HANDLER,
+        &&FUNC_SETSFXATTRIBUTES_HANDLER, &&FUNC_OBJECTTILECOLLISION_HANDLER, &&FUNC_OBJECTTILEGRIP_HANDLER, &&FUNC_NOT_HANDLER,
+        &&FUNC_DRAW3DSCENE_HANDLER, &&FUNC_SETIDENTITYMATRIX_HANDLER, &&FUNC_MATRIXMULTIPLY_HANDLER, &&FUNC_MATRIXTRANSLATEXYZ_HANDLER,
+        &&FUNC_MATRIXSCALEXYZ_HANDLER, &&FUNC_MATRIXROTATEX_HANDLER, &&FUNC_MATRIXROTATEY_HANDLER, &&FUNC_MATRIXROTATEZ_HANDLER,
+        &&FUNC_MATRIXROTATEXYZ_HANDLER, &&FUNC_MATRIXINVERSE_HANDLER, &&FUNC_TRANSFORMVERTICES_HANDLER, &&FUNC_CALLFUNCTION_HANDLER,
+        &&FUNC_RETURN_HANDLER, &&FUNC_SETLAYERDEFORMATION_HANDLER, &&FUNC_CHECKTOUCHRECT_HANDLER, &&FUNC_GETTILELAYERENTRY_HANDLER,
+        &&FUNC_SETTILELAYERENTRY_HANDLER, &&FUNC_GETBIT_HANDLER, &&FUNC_SETBIT_HANDLER, &&FUNC_CLEARDRAWLIST_HANDLER,
+        &&FUNC_ADDDRAWLISTENTITYREF_HANDLER, &&FUNC_GETDRAWLISTENTITYREF_HANDLER, &&FUNC_SETDRAWLISTENTITYREF_HANDLER,
+        &&FUNC_GET16X16TILEINFO_HANDLER, &&FUNC_SET16X16TILEINFO_HANDLER, &&FUNC_COPY16X16TILE_HANDLER, &&FUNC_GETANIMATIONBYNAME_HANDLER,
+        &&FUNC_READSAVERAM_HANDLER, &&FUNC_WRITESAVERAM_HANDLER, &&FUNC_LOADTEXTFILE_HANDLER, &&FUNC_GETTEXTINFO_HANDLER,
+        &&FUNC_GETVERSIONNUMBER_HANDLER, &&FUNC_GETTABLEVALUE_HANDLER, &&FUNC_SETTABLEVALUE_HANDLER, &&FUNC_CHECKCURRENTSTAGEFOLDER_HANDLER,
+        &&FUNC_ABS_HANDLER, &&FUNC_CALLNATIVEFUNCTION_HANDLER, &&FUNC_CALLNATIVEFUNCTION2_HANDLER, &&FUNC_CALLNATIVEFUNCTION4_HANDLER,
+        &&FUNC_SETOBJECTRANGE_HANDLER, &&FUNC_GETOBJECTVALUE_HANDLER, &&FUNC_SETOBJECTVALUE_HANDLER, &&FUNC_COPYOBJECT_HANDLER, &&FUNC_PRINT_HANDLER,
+        &&FUNC_CHECKCAMERAPROXIMITY_HANDLER, &&FUNC_SETSCREENCOUNT_HANDLER, &&FUNC_SETSCREENVERTICES_HANDLER, &&FUNC_GETINPUTDEVICEID_HANDLER,
+        &&FUNC_GETFILTEREDINPUTDEVICEID_HANDLER, &&FUNC_GETINPUTDEVICETYPE_HANDLER, &&FUNC_ISINPUTDEVICEASSIGNED_HANDLER,
+        &&FUNC_ASSIGNINPUTSLOTTODEVICE_HANDLER, &&FUNC_ISSLOTASSIGNED_HANDLER, &&FUNC_RESETINPUTSLOTASSIGNMENTS_HANDLER
+    };
+#endif
+
+#if RETRO_USE_SCRIPT_PROFILER
+    ScriptProfileScope profile(objectEntityList[objectEntityPos].type, scriptEvent);
+#endif
+
+    bool running        = true;
+    int32 scriptCodePtr = scriptCodeStart;
+    jumpTableStackPos   = 0;
+    functionStackPos    = 0;
+    foreachStackPos     = 0;
+
+    ScriptOpcodeState opcodeState;
+    int32 &opcodeSize = opcodeState.opcodeSize;
+
+    while (running) {
+        int32 opcode = ReadScriptOpcode(&opcodeState, scriptCodePtr, scriptCodeStart, jumpTableStart);
+
+        ObjectScript *scriptInfo = &objectScriptList[objectEntityList[objectEntityPos].type];
+        Entity *entity           = &objectEntityList[objectEntityPos];
+        SpriteFrame *spriteFrame = nullptr;
+
+        // Functions
+#if RETRO_USE_COMPUTED_GOTO
+        goto *((uint32)opcode < FUNC_MAX_CNT ? opcodeHandlers[opcode] : &&DEFAULT_HANDLER);
+#endif
+        switch (opcode) {
+            LEGACY_SCRIPT_DEFAULT: LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_END): running = false; LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_EQUAL): scriptEng.operands[0] = scriptEng.operands[1]; LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_ADD): scriptEng.operands[0] += scriptEng.operands[1]; LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_SUB): scriptEng.operands[0] -= scriptEng.operands[1]; LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_INC): ++scriptEng.operands[0]; LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_DEC): --scriptEng.operands[0]; LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_MUL): scriptEng.operands[0] *= scriptEng.operands[1]; LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_DIV): scriptEng.operands[0] /= scriptEng.operands[1]; LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_SHR): scriptEng.operands[0] >>= scriptEng.operands[1]; LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_SHL): scriptEng.operands[0] <<= scriptEng.operands[1]; LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_AND): scriptEng.operands[0] &= scriptEng.operands[1]; LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_OR): scriptEng.operands[0] |= scriptEng.operands[1]; LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_XOR): scriptEng.operands[0] ^= scriptEng.operands[1]; LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_MOD): scriptEng.operands[0] %= scriptEng.operands[1]; LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_FLIPSIGN): scriptEng.operands[0] = -scriptEng.operands[0]; LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_CHECKEQUAL):
+                scriptEng.checkResult = scriptEng.operands[0] == scriptEng.operands[1];
+                opcodeSize            = 0;
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_CHECKGREATER):
+                scriptEng.checkResult = scriptEng.operands[0] > scriptEng.operands[1];
+                opcodeSize            = 0;
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_CHECKLOWER):
+                scriptEng.checkResult = scriptEng.operands[0] < scriptEng.operands[1];
+                opcodeSize            = 0;
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_CHECKNOTEQUAL):
+                scriptEng.checkResult = scriptEng.operands[0] != scriptEng.operands[1];
+                opcodeSize            = 0;
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_IFEQUAL):
+                if (scriptEng.operands[1] != scriptEng.operands[2])
+                    scriptCodePtr = scriptCodeStart + jumpTable[jumpTableStart + scriptEng.operands[0]];
+                jumpTableStack[++jumpTableStackPos] = scriptEng.operands[0];
+                opcodeSize                          = 0;
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_IFGREATER):
+                if (scriptEng.operands[1] <= scriptEng.operands[2])
+                    scriptCodePtr = scriptCodeStart + jumpTable[jumpTableStart + scriptEng.operands[0]];
+                jumpTableStack[++jumpTableStackPos] = scriptEng.operands[0];
+                opcodeSize                          = 0;
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_IFGREATEROREQUAL):
+                if (scriptEng.operands[1] < scriptEng.operands[2])
+                    scriptCodePtr = scriptCodeStart + jumpTable[jumpTableStart + scriptEng.operands[0]];
+                jumpTableStack[++jumpTableStackPos] = scriptEng.operands[0];
+                opcodeSize                          = 0;
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_IFLOWER):
+                if (scriptEng.operands[1] >= scriptEng.operands[2])
+                    scriptCodePtr = scriptCodeStart + jumpTable[jumpTableStart + scriptEng.operands[0]];
+                jumpTableStack[++jumpTableStackPos] = scriptEng.operands[0];
+                opcodeSize                          = 0;
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_IFLOWEROREQUAL):
+                if (scriptEng.operands[1] > scriptEng.operands[2])
+                    scriptCodePtr = scriptCodeStart + jumpTable[jumpTableStart + scriptEng.operands[0]];
+                jumpTableStack[++jumpTableStackPos] = scriptEng.operands[0];
+                opcodeSize                          = 0;
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_IFNOTEQUAL):
+                if (scriptEng.operands[1] == scriptEng.operands[2])
+                    scriptCodePtr = scriptCodeStart + jumpTable[jumpTableStart + scriptEng.operands[0]];
+                jumpTableStack[++jumpTableStackPos] = scriptEng.operands[0];
+                opcodeSize                          = 0;
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_ELSE):
+                opcodeSize    = 0;
+                scriptCodePtr = scriptCodeStart + jumpTable[jumpTableStart + jumpTableStack[jumpTableStackPos--] + 1];
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_ENDIF):
+                opcodeSize = 0;
+                --jumpTableStackPos;
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_WEQUAL):
+                if (scriptEng.operands[1] != scriptEng.operands[2])
+                    scriptCodePtr = scriptCodeStart + jumpTable[jumpTableStart + scriptEng.operands[0] + 1];
+                else
+                    jumpTableStack[++jumpTableStackPos] = scriptEng.operands[0];
+                opcodeSize = 0;
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_WGREATER):
+                if (scriptEng.operands[1] <= scriptEng.operands[2])
+                    scriptCodePtr = scriptCodeStart + jumpTable[jumpTableStart + scriptEng.operands[0] + 1];
+                else
+                    jumpTableStack[++jumpTableStackPos] = scriptEng.operands[0];
+                opcodeSize = 0;
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_WGREATEROREQUAL):
+                if (scriptEng.operands[1] < scriptEng.operands[2])
+                    scriptCodePtr = scriptCodeStart + jumpTable[jumpTableStart + scriptEng.operands[0] + 1];
+                else
+                    jumpTableStack[++jumpTableStackPos] = scriptEng.operands[0];
+                opcodeSize = 0;
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_WLOWER):
+                if (scriptEng.operands[1] >= scriptEng.operands[2])
+                    scriptCodePtr = scriptCodeStart + jumpTable[jumpTableStart + scriptEng.operands[0] + 1];
+                else
+                    jumpTableStack[++jumpTableStackPos] = scriptEng.operands[0];
+                opcodeSize = 0;
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_WLOWEROREQUAL):
+                if (scriptEng.operands[1] > scriptEng.operands[2])
+                    scriptCodePtr = scriptCodeStart + jumpTable[jumpTableStart + scriptEng.operands[0] + 1];
+                else
+                    jumpTableStack[++jumpTableStackPos] = scriptEng.operands[0];
+                opcodeSize = 0;
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_WNOTEQUAL):
+                if (scriptEng.operands[1] == scriptEng.operands[2])
+                    scriptCodePtr = scriptCodeStart + jumpTable[jumpTableStart + scriptEng.operands[0] + 1];
+                else
+                    jumpTableStack[++jumpTableStackPos] = scriptEng.operands[0];
+                opcodeSize = 0;
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_LOOP):
+                opcodeSize    = 0;
+                scriptCodePtr = scriptCodeStart + jumpTable[jumpTableStart + jumpTableStack[jumpTableStackPos--]];
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_FOREACHACTIVE): {
+                int32 groupID = scriptEng.operands[1];
+                if (groupID < LEGACY_v4_TYPEGROUP_COUNT) {
+                    int32 loop                    = foreachStack[++foreachStackPos] + 1;
+                    foreachStack[foreachStackPos] = loop;
+                    if (loop >= objectTypeGroupList[groupID].listSize) {
+                        opcodeSize                      = 0;
+                        foreachStack[foreachStackPos--] = -1;
+                        scriptCodePtr                   = scriptCodeStart + jumpTable[jumpTableStart + scriptEng.operands[0] + 1];
                         break;
                     }
-                    case VAR_OBJECTVALUE16: {
-                        objectEntityList[arrayVal].values[16] = scriptEng.operands[i];
-                        break;
+                    else {
+                        scriptEng.operands[2]               = objectTypeGroupList[groupID].entityRefs[loop];
+                        jumpTableStack[++jumpTableStackPos] = scriptEng.operands[0];
                     }
-                    case VAR_OBJECTVALUE17: {
-                        objectEntityList[arrayVal].values[17] = scriptEng.operands[i];
-                        break;
+                }
+                else {
+                    opcodeSize    = 0;
+                    scriptCodePtr = scriptCodeStart + jumpTable[jumpTableStart + scriptEng.operands[0] + 1];
+                }
+                LEGACY_SCRIPT_NEXT;
+            }
+            LEGACY_SCRIPT_CASE(FUNC_FOREACHALL): {
+                int32 objType = scriptEng.operands[1];
+                if (objType < LEGACY_v4_OBJECT_COUNT) {
+                    int32 loop                    = foreachStack[++foreachStackPos] + 1;
+                    foreachStack[foreachStackPos] = loop;
+
+                    if (scriptEvent == EVENT_SETUP) {
+                        while (true) {
+                            if (loop >= LEGACY_v4_TEMPENTITY_START) {
+                                opcodeSize                      = 0;
+                                foreachStack[foreachStackPos--] = -1;
+                                scriptCodePtr                   = scriptCodeStart + jumpTable[jumpTableStart + scriptEng.operands[0] + 1];
+                                break;
+                            }
+                            else if (objType == objectEntityList[loop].type) {
+                                scriptEng.operands[2]               = loop;
+                                jumpTableStack[++jumpTableStackPos] = scriptEng.operands[0];
+                                break;
+                            }
+                            else {
+                                foreachStack[foreachStackPos] = ++loop;
+                            }
+                        }
                     }
-                    case VAR_OBJECTVALUE18: {
-                        objectEntityList[arrayVal].values[18] = scriptEng.operands[i];
-                        break;
+                    else {
+                        while (true) {
+                            if (loop >= LEGACY_v4_ENTITY_COUNT) {
+                                opcodeSize                      = 0;
+                                foreachStack[foreachStackPos--] = -1;
+                                scriptCodePtr                   = scriptCodeStart + jumpTable[jumpTableStart + scriptEng.operands[0] + 1];
+                                break;
+                            }
+                            else if (objType == objectEntityList[loop].type) {
+                                scriptEng.operands[2]               = loop;
+                                jumpTableStack[++jumpTableStackPos] = scriptEng.operands[0];
+                                break;
+                            }
+                            else {
+                                foreachStack[foreachStackPos] = ++loop;
+                            }
+                        }
                     }
-                    case VAR_OBJECTVALUE19: {
-                        objectEntityList[arrayVal].values[19] = scriptEng.operands[i];
-                        break;
+                }
+                else {
+                    opcodeSize    = 0;
+                    scriptCodePtr = scriptCodeStart + jumpTable[jumpTableStart + scriptEng.operands[0] + 1];
+                }
+                LEGACY_SCRIPT_NEXT;
+            }
+            LEGACY_SCRIPT_CASE(FUNC_NEXT):
+                opcodeSize    = 0;
+                scriptCodePtr = scriptCodeStart + jumpTable[jumpTableStart + jumpTableStack[jumpTableStackPos--]];
+                --foreachStackPos;
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_SWITCH):
+                jumpTableStack[++jumpTableStackPos] = scriptEng.operands[0];
+                if (scriptEng.operands[1] < jumpTable[jumpTableStart + scriptEng.operands[0]]
+                    || scriptEng.operands[1] > jumpTable[jumpTableStart + scriptEng.operands[0] + 1])
+                    scriptCodePtr = scriptCodeStart + jumpTable[jumpTableStart + scriptEng.operands[0] + 2];
+                else
+                    scriptCodePtr = scriptCodeStart
+                                    + jumpTable[jumpTableStart + scriptEng.operands[0] + 4
+                                                + (scriptEng.operands[1] - jumpTable[jumpTableStart + scriptEng.operands[0]])];
+                opcodeSize = 0;
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_BREAK):
+                opcodeSize    = 0;
+                scriptCodePtr = scriptCodeStart + jumpTable[jumpTableStart + jumpTableStack[jumpTableStackPos--] + 3];
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_ENDSWITCH):
+                opcodeSize = 0;
+                --jumpTableStackPos;
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_RAND): scriptEng.operands[0] = rand() % scriptEng.operands[1]; LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_SIN): {
+                scriptEng.operands[0] = Sin512(scriptEng.operands[1]);
+                LEGACY_SCRIPT_NEXT;
+            }
+            LEGACY_SCRIPT_CASE(FUNC_COS): {
+                scriptEng.operands[0] = Cos512(scriptEng.operands[1]);
+                LEGACY_SCRIPT_NEXT;
+            }
+            LEGACY_SCRIPT_CASE(FUNC_SIN256): {
+                scriptEng.operands[0] = Sin256(scriptEng.operands[1]);
+                LEGACY_SCRIPT_NEXT;
+            }
+            LEGACY_SCRIPT_CASE(FUNC_COS256): {
+                scriptEng.operands[0] = Cos256(scriptEng.operands[1]);
+                LEGACY_SCRIPT_NEXT;
+            }
+            LEGACY_SCRIPT_CASE(FUNC_ATAN2): {
+                scriptEng.operands[0] = ArcTanLookup(scriptEng.operands[1], scriptEng.operands[2]);
+                LEGACY_SCRIPT_NEXT;
+            }
+            LEGACY_SCRIPT_CASE(FUNC_INTERPOLATE):
+                scriptEng.operands[0] =
+                    (scriptEng.operands[2] * (0x100 - scriptEng.operands[3]) + scriptEng.operands[3] * scriptEng.operands[1]) >> 8;
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_INTERPOLATEXY):
+                scriptEng.operands[0] =
+                    (scriptEng.operands[3] * (0x100 - scriptEng.operands[6]) >> 8) + ((scriptEng.operands[6] * scriptEng.operands[2]) >> 8);
+                scriptEng.operands[1] =
+                    (scriptEng.operands[5] * (0x100 - scriptEng.operands[6]) >> 8) + (scriptEng.operands[6] * scriptEng.operands[4] >> 8);
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_LOADSPRITESHEET):
+                opcodeSize                = 0;
+                scriptInfo->spriteSheetID = AddGraphicsFile(scriptText);
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_REMOVESPRITESHEET):
+                opcodeSize = 0;
+                RemoveGraphicsFile(scriptText, -1);
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_DRAWSPRITE):
+                opcodeSize  = 0;
+                spriteFrame = &scriptFrames[scriptInfo->frameListOffset + scriptEng.operands[0]];
+                DrawSprite((entity->xpos >> 16) - xScrollOffset + spriteFrame->pivotX, (entity->ypos >> 16) - yScrollOffset + spriteFrame->pivotY,
+                           spriteFrame->width, spriteFrame->height, spriteFrame->sprX, spriteFrame->sprY, scriptInfo->spriteSheetID);
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_DRAWSPRITEXY):
+                opcodeSize  = 0;
+                spriteFrame = &scriptFrames[scriptInfo->frameListOffset + scriptEng.operands[0]];
+                DrawSprite((scriptEng.operands[1] >> 16) - xScrollOffset + spriteFrame->pivotX,
+                           (scriptEng.operands[2] >> 16) - yScrollOffset + spriteFrame->pivotY, spriteFrame->width, spriteFrame->height,
+                           spriteFrame->sprX, spriteFrame->sprY, scriptInfo->spriteSheetID);
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_DRAWSPRITESCREENXY):
+                opcodeSize  = 0;
+                spriteFrame = &scriptFrames[scriptInfo->frameListOffset + scriptEng.operands[0]];
+                DrawSprite(scriptEng.operands[1] + spriteFrame->pivotX, scriptEng.operands[2] + spriteFrame->pivotY, spriteFrame->width,
+                           spriteFrame->height, spriteFrame->sprX, spriteFrame->sprY, scriptInfo->spriteSheetID);
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_DRAWTINTRECT):
+                opcodeSize = 0;
+                DrawTintRectangle(scriptEng.operands[0], scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]);
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_DRAWNUMBERS): {
+                opcodeSize = 0;
+                int32 i    = 10;
+                if (scriptEng.operands[6]) {
+                    while (scriptEng.operands[4] > 0) {
+                        int32 frameID = scriptEng.operands[3] % i / (i / 10) + scriptEng.operands[0];
+                        spriteFrame   = &scriptFrames[scriptInfo->frameListOffset + frameID];
+                        DrawSprite(spriteFrame->pivotX + scriptEng.operands[1], spriteFrame->pivotY + scriptEng.operands[2], spriteFrame->width,
+                                   spriteFrame->height, spriteFrame->sprX, spriteFrame->sprY, scriptInfo->spriteSheetID);
+                        scriptEng.operands[1] -= scriptEng.operands[5];
+                        i *= 10;
+                        --scriptEng.operands[4];
+                    }
+                }
+                else {
+                    int32 extra = 10;
+                    if (scriptEng.operands[3])
+                        extra = 10 * scriptEng.operands[3];
+                    while (scriptEng.operands[4] > 0) {
+                        if (extra >= i) {
+                            int32 frameID = scriptEng.operands[3] % i / (i / 10) + scriptEng.operands[0];
+                            spriteFrame   = &scriptFrames[scriptInfo->frameListOffset + frameID];
+                            DrawSprite(spriteFrame->pivotX + scriptEng.operands[1], spriteFrame->pivotY + scriptEng.operands[2], spriteFrame->width,
+                                       spriteFrame->height, spriteFrame->sprX, spriteFrame->sprY, scriptInfo->spriteSheetID);
+                        }
+                        scriptEng.operands[1] -= scriptEng.operands[5];
+                        i *= 10;
+                        --scriptEng.operands[4];
                     }
-                    case VAR_OBJECTVALUE20: {
-                        objectEntityList[arrayVal].values[20] = scriptEng.operands[i];
+                }
+                LEGACY_SCRIPT_NEXT;
+            }
+            LEGACY_SCRIPT_CASE(FUNC_DRAWACTNAME): {
+                opcodeSize   = 0;
+                int32 charID = 0;
+                switch (scriptEng.operands[3]) { // Draw Mode
+                    case 0:                      // Draw Word 1 (but aligned from the right instead of left)
+                        charID = 0;
+
+                        for (charID = 0;; ++charID) {
+                            int32 nextChar = titleCardText[charID + 1];
+                            if (nextChar == '-' || !nextChar)
+                                break;
+                        }
+
+                        while (charID >= 0) {
+                            int32 character = titleCardText[charID];
+                            if (character == ' ')
+                                character = -1; // special space char
+                            if (character == '-')
+                                character = 0;
+                            if (character >= '0' && character <= '9')
+                                character -= 22;
+                            if (character > '9' && character < 'f')
+                                character -= 'A';
+
+                            if (character <= -1) {
+                                scriptEng.operands[1] -= scriptEng.operands[5] + scriptEng.operands[6]; // spaceWidth + spacing
+                            }
+                            else {
+                                character += scriptEng.operands[0];
+                                spriteFrame = &scriptFrames[scriptInfo->frameListOffset + character];
+
+                                scriptEng.operands[1] -= spriteFrame->width + scriptEng.operands[6];
+
+                                DrawSprite(scriptEng.operands[1] + spriteFrame->pivotX, scriptEng.operands[2] + spriteFrame->pivotY,
+                                           spriteFrame->width, spriteFrame->height, spriteFrame->sprX, spriteFrame->sprY, scriptInfo->spriteSheetID);
+                            }
+                            charID--;
+                        }
                         break;
-                    }
-                    case VAR_OBJECTVALUE21: {
-                        objectEntityList[arrayVal].values[21] = scriptEng.operands[i];
+
+                    case 1: // Draw Word 1
+                        charID = 0;
+
+                        // Draw the first letter as a capital letter, the rest are lowercase
+                        // (if scriptEng.operands[4] is trueotherwise they're all uppercase)
+                        if (scriptEng.operands[4] == 1 && titleCardText[charID] != 0) {
+                            int32 character = titleCardText[charID];
+                            if (character == ' ')
+                                character = 0;
+                            if (character == '-')
+                                character = 0;
+                            if (character >= '0' && character <= '9')
+                                character -= 22;
+                            if (character > '9' && character < 'f')
+                                character -= 'A';
+
+                            if (character <= -1) {
+                                scriptEng.operands[1] += scriptEng.operands[5] + scriptEng.operands[6]; // spaceWidth + spacing
+                            }
+                            else {
+                                character += scriptEng.operands[0];
+                                spriteFrame = &scriptFrames[scriptInfo->frameListOffset + character];
+                                DrawSprite(scriptEng.operands[1] + spriteFrame->pivotX, scriptEng.operands[2] + spriteFrame->pivotY,
+                                           spriteFrame->width, spriteFrame->height, spriteFrame->sprX, spriteFrame->sprY, scriptInfo->spriteSheetID);
+                                scriptEng.operands[1] += spriteFrame->width + scriptEng.operands[6];
+                            }
+
+                            scriptEng.operands[0] += 26;
+                            charID++;
+                        }
+
+                        while (titleCardText[charID] != 0 && titleCardText[charID] != '-') {
+                            int32 character = titleCardText[charID];
+                            if (character == ' ')
+                                character = 0;
+                            if (character == '-')
+                                character = 0;
+                            if (character > '/' && character < ':')
+                                character -= 22;
+                            if (character > '9' && character < 'f')
+                                character -= 'A';
+
+                            if (character <= -1) {
+                                scriptEng.operands[1] += scriptEng.operands[5] + scriptEng.operands[6]; // spaceWidth + spacing
+                            }
+                            else {
+                                character += scriptEng.operands[0];
+                                spriteFrame = &scriptFrames[scriptInfo->frameListOffset + character];
+                                DrawSprite(scriptEng.operands[1] + spriteFrame->pivotX, scriptEng.operands[2] + spriteFrame->pivotY,
+                                           spriteFrame->width, spriteFrame->height, spriteFrame->sprX, spriteFrame->sprY, scriptInfo->spriteSheetID);
+                                scriptEng.operands[1] += spriteFrame->width + scriptEng.operands[6];
+                            }
+                            charID++;
+                        }
                         break;
-                    }
-                    case VAR_OBJECTVALUE22: {
-                        objectEntityList[arrayVal].values[22] = scriptEng.operands[i];
+
+                    case 2: // Draw Word 2
+                        charID = titleCardWord2;
+
+                        // Draw the first letter as a capital letter, the rest are lowercase
+                        // (if scriptEng.operands[4] is true, otherwise they're all uppercase)
+                        if (scriptEng.operands[4] == 1 && titleCardText[charID] != 0) {
+                            int32 character = titleCardText[charID];
+                            if (character == ' ')
+                                character = 0;
+                            if (character == '-')
+                                character = 0;
+                            if (character >= '0' && character <= '9')
+                                character -= 22;
+                            if (character > '9' && character < 'f')
+                                character -= 'A';
+
+                            if (character <= -1) {
+                                scriptEng.operands[1] += scriptEng.operands[5] + scriptEng.operands[6]; // spaceWidth + spacing
+                            }
+                            else {
+                                character += scriptEng.operands[0];
+                                spriteFrame = &scriptFrames[scriptInfo->frameListOffset + character];
+                                DrawSprite(scriptEng.operands[1] + spriteFrame->pivotX, scriptEng.operands[2] + spriteFrame->pivotY,
+                                           spriteFrame->width, spriteFrame->height, spriteFrame->sprX, spriteFrame->sprY, scriptInfo->spriteSheetID);
+                                scriptEng.operands[1] += spriteFrame->width + scriptEng.operands[6];
+                            }
+                            scriptEng.operands[0] += 26;
+                            charID++;
+                        }
+
+                        while (titleCardText[charID] != 0) {
+                            int32 character = titleCardText[charID];
+                            if (character == ' ')
+                                character = 0;
+                            if (character == '-')
+                                character = 0;
+                            if (character >= '0' && character <= '9')
+                                character -= 22;
+                            if (character > '9' && character < 'f')
+                                character -= 'A';
+
+                            if (character <= -1) {
+                                scriptEng.operands[1] += scriptEng.operands[5] + scriptEng.operands[6]; // spaceWidth + spacing
+                            }
+                            else {
+                                character += scriptEng.operands[0];
+                                spriteFrame = &scriptFrames[scriptInfo->frameListOffset + character];
+                                DrawSprite(scriptEng.operands[1] + spriteFrame->pivotX, scriptEng.operands[2] + spriteFrame->pivotY,
+                                           spriteFrame->width, spriteFrame->height, spriteFrame->sprX, spriteFrame->sprY, scriptInfo->spriteSheetID);
+                                scriptEng.operands[1] += spriteFrame->width + scriptEng.operands[6];
+                            }
+                            charID++;
+                        }
                         break;
-                    }
-                    case VAR_OBJECTVALUE23: {
-                        objectEntityList[arrayVal].values[23] = scriptEng.operands[i];
+                }
+                LEGACY_SCRIPT_NEXT;
+            }
+            LEGACY_SCRIPT_CASE(FUNC_DRAWMENU):
+                opcodeSize        = 0;
+                textMenuSurfaceNo = scriptInfo->spriteSheetID;
+                DrawTextMenu(&gameMenu[scriptEng.operands[0]], scriptEng.operands[1], scriptEng.operands[2]);
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_SPRITEFRAME):
+                opcodeSize = 0;
+                if (scriptEvent == EVENT_SETUP && scriptFrameCount < LEGACY_SPRITEFRAME_COUNT) {
+                    scriptFrames[scriptFrameCount].pivotX = scriptEng.operands[0];
+                    scriptFrames[scriptFrameCount].pivotY = scriptEng.operands[1];
+                    scriptFrames[scriptFrameCount].width  = scriptEng.operands[2];
+                    scriptFrames[scriptFrameCount].height = scriptEng.operands[3];
+                    scriptFrames[scriptFrameCount].sprX   = scriptEng.operands[4];
+                    scriptFrames[scriptFrameCount].sprY   = scriptEng.operands[5];
+                    ++scriptFrameCount;
+                }
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_EDITFRAME): {
+                opcodeSize  = 0;
+                spriteFrame = &scriptFrames[scriptInfo->frameListOffset + scriptEng.operands[0]];
+
+                spriteFrame->pivotX = scriptEng.operands[1];
+                spriteFrame->pivotY = scriptEng.operands[2];
+                spriteFrame->width  = scriptEng.operands[3];
+                spriteFrame->height = scriptEng.operands[4];
+                spriteFrame->sprX   = scriptEng.operands[5];
+                spriteFrame->sprY   = scriptEng.operands[6];
+            } break;
+            LEGACY_SCRIPT_CASE(FUNC_LOADPALETTE):
+                opcodeSize = 0;
+                LoadPalette(scriptText, scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3], scriptEng.operands[4]);
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_ROTATEPALETTE):
+                opcodeSize = 0;
+                RotatePalette(scriptEng.operands[0], scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]);
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_SETSCREENFADE):
+                opcodeSize = 0;
+                SetFade(scriptEng.operands[0], scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]);
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_SETACTIVEPALETTE):
+                opcodeSize = 0;
+                SetActivePalette(scriptEng.operands[0], scriptEng.operands[1], scriptEng.operands[2]);
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_SETPALETTEFADE):
+                SetPaletteFade(scriptEng.operands[0], scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3], scriptEng.operands[4],
+                               scriptEng.operands[5]);
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_SETPALETTEENTRY): SetPaletteEntryPacked(scriptEng.operands[0], scriptEng.operands[1], scriptEng.operands[2]); LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_GETPALETTEENTRY): scriptEng.operands[2] = GetPaletteEntryPacked(scriptEng.operands[0], scriptEng.operands[1]); LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_COPYPALETTE):
+                opcodeSize = 0;
+                CopyPalette(scriptEng.operands[0], scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3], scriptEng.operands[4]);
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_CLEARSCREEN):
+                opcodeSize = 0;
+                ClearScreen(scriptEng.operands[0]);
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_DRAWSPRITEFX):
+                opcodeSize  = 0;
+                spriteFrame = &scriptFrames[scriptInfo->frameListOffset + scriptEng.operands[0]];
+                switch (scriptEng.operands[1]) {
+                    default: break;
+
+                    case FX_SCALE:
+                        DrawSpriteScaled(entity->direction, (scriptEng.operands[2] >> 16) - xScrollOffset,
+                                         (scriptEng.operands[3] >> 16) - yScrollOffset, -spriteFrame->pivotX, -spriteFrame->pivotY, entity->scale,
+                                         entity->scale, spriteFrame->width, spriteFrame->height, spriteFrame->sprX, spriteFrame->sprY,
+                                         scriptInfo->spriteSheetID);
                         break;
-                    }
-                    case VAR_OBJECTVALUE24: {
-                        objectEntityList[arrayVal].values[24] = scriptEng.operands[i];
+
+                    case FX_ROTATE:
+                        DrawSpriteRotated(entity->direction, (scriptEng.operands[2] >> 16) - xScrollOffset,
+                                          (scriptEng.operands[3] >> 16) - yScrollOffset, -spriteFrame->pivotX, -spriteFrame->pivotY,
+                                          spriteFrame->sprX, spriteFrame->sprY, spriteFrame->width, spriteFrame->height, entity->rotation,
+                                          scriptInfo->spriteSheetID);
                         break;
-                    }
-                    case VAR_OBJECTVALUE25: {
-                        objectEntityList[arrayVal].values[25] = scriptEng.operands[i];
+
+                    case FX_ROTOZOOM:
+                        DrawSpriteRotozoom(entity->direction, (scriptEng.operands[2] >> 16) - xScrollOffset,
+                                           (scriptEng.operands[3] >> 16) - yScrollOffset, -spriteFrame->pivotX, -spriteFrame->pivotY,
+                                           spriteFrame->sprX, spriteFrame->sprY, spriteFrame->width, spriteFrame->height, entity->rotation,
+                                           entity->scale, scriptInfo->spriteSheetID);
                         break;
-                    }
-                    case VAR_OBJECTVALUE26: {
-                        objectEntityList[arrayVal].values[26] = scriptEng.operands[i];
+
+                    case FX_INK:
+                        switch (entity->inkEffect) {
+                            case INK_NONE:
+                                DrawSprite((scriptEng.operands[2] >> 16) - xScrollOffset + spriteFrame->pivotX,
+                                           (scriptEng.operands[3] >> 16) - yScrollOffset + spriteFrame->pivotY, spriteFrame->width,
+                                           spriteFrame->height, spriteFrame->sprX, spriteFrame->sprY, scriptInfo->spriteSheetID);
+                                break;
+
+                            case INK_BLEND:
+                                DrawBlendedSprite((scriptEng.operands[2] >> 16) - xScrollOffset + spriteFrame->pivotX,
+                                                  (scriptEng.operands[3] >> 16) - yScrollOffset + spriteFrame->pivotY, spriteFrame->width,
+                                                  spriteFrame->height, spriteFrame->sprX, spriteFrame->sprY, scriptInfo->spriteSheetID);
+                                break;
+
+                            case INK_ALPHA:
+                                DrawAlphaBlendedSprite((scriptEng.operands[2] >> 16) - xScrollOffset + spriteFrame->pivotX,
+                                                       (scriptEng.operands[3] >> 16) - yScrollOffset + spriteFrame->pivotY, spriteFrame->width,
+                                                       spriteFrame->height, spriteFrame->sprX, spriteFrame->sprY, entity->alpha,
+                                                       scriptInfo->spriteSheetID);
+                                break;
+
+                            case INK_ADD:
+                                DrawAdditiveBlendedSprite((scriptEng.operands[2] >> 16) - xScrollOffset + spriteFrame->pivotX,
+                                                          (scriptEng.operands[3] >> 16) - yScrollOffset + spriteFrame->pivotY, spriteFrame->width,
+                                                          spriteFrame->height, spriteFrame->sprX, spriteFrame->sprY, entity->alpha,
+                                                          scriptInfo->spriteSheetID);
+                                break;
+
+                            case INK_SUB:
+                                DrawSubtractiveBlendedSprite((scriptEng.operands[2] >> 16) - xScrollOffset + spriteFrame->pivotX,
+                                                             (scriptEng.operands[3] >> 16) - yScrollOffset + spriteFrame->pivotY, spriteFrame->width,
+                                                             spriteFrame->height, spriteFrame->sprX, spriteFrame->sprY, entity->alpha,
+                                                             scriptInfo->spriteSheetID);
+                                break;
+                        }
                         break;
-                    }
-                    case VAR_OBJECTVALUE27: {
-                        objectEntityList[arrayVal].values[27] = scriptEng.operands[i];
+                    case FX_TINT:
+                        if (entity->inkEffect == INK_ALPHA) {
+                            DrawScaledTintMask(entity->direction, (scriptEng.operands[2] >> 16) - xScrollOffset,
+                                               (scriptEng.operands[3] >> 16) - yScrollOffset, -spriteFrame->pivotX, -spriteFrame->pivotY,
+                                               entity->scale, entity->scale, spriteFrame->width, spriteFrame->height, spriteFrame->sprX,
+                                               spriteFrame->sprY, scriptInfo->spriteSheetID);
+                        }
+                        else {
+                            DrawSpriteScaled(entity->direction, (scriptEng.operands[2] >> 16) - xScrollOffset,
+                                             (scriptEng.operands[3] >> 16) - yScrollOffset, -spriteFrame->pivotX, -spriteFrame->pivotY, entity->scale,
+                                             entity->scale, spriteFrame->width, spriteFrame->height, spriteFrame->sprX, spriteFrame->sprY,
+                                             scriptInfo->spriteSheetID);
+                        }
                         break;
-                    }
-                    case VAR_OBJECTVALUE28: {
-                        objectEntityList[arrayVal].values[28] = scriptEng.operands[i];
+
+                    case FX_FLIP:
+                        switch (entity->direction) {
+                            default:
+                            case FLIP_NONE:
+                                DrawSpriteFlipped((scriptEng.operands[2] >> 16) - xScrollOffset + spriteFrame->pivotX,
+                                                  (scriptEng.operands[3] >> 16) - yScrollOffset + spriteFrame->pivotY, spriteFrame->width,
+                                                  spriteFrame->height, spriteFrame->sprX, spriteFrame->sprY, FLIP_NONE, scriptInfo->spriteSheetID);
+                                break;
+
+                            case FLIP_X:
+                                DrawSpriteFlipped((scriptEng.operands[2] >> 16) - xScrollOffset - spriteFrame->width - spriteFrame->pivotX,
+                                                  (scriptEng.operands[3] >> 16) - yScrollOffset + spriteFrame->pivotY, spriteFrame->width,
+                                                  spriteFrame->height, spriteFrame->sprX, spriteFrame->sprY, FLIP_X, scriptInfo->spriteSheetID);
+                                break;
+
+                            case FLIP_Y:
+                                DrawSpriteFlipped((scriptEng.operands[2] >> 16) - xScrollOffset + spriteFrame->pivotX,
+                                                  (scriptEng.operands[3] >> 16) - yScrollOffset - spriteFrame->height - spriteFrame->pivotY,
+                                                  spriteFrame->width, spriteFrame->height, spriteFrame->sprX, spriteFrame->sprY, FLIP_Y,
+                                                  scriptInfo->spriteSheetID);
+                                break;
+
+                            case FLIP_XY:
+                                DrawSpriteFlipped((scriptEng.operands[2] >> 16) - xScrollOffset - spriteFrame->width - spriteFrame->pivotX,
+                                                  (scriptEng.operands[3] >> 16) - yScrollOffset - spriteFrame->height - spriteFrame->pivotY,
+                                                  spriteFrame->width, spriteFrame->height, spriteFrame->sprX, spriteFrame->sprY, FLIP_XY,
+                                                  scriptInfo->spriteSheetID);
+                                break;
+                        }
                         break;
-                    }
-                    case VAR_OBJECTVALUE29: {
-                        objectEntityList[arrayVal].values[29] = scriptEng.operands[i];
+                }
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_DRAWSPRITESCREENFX):
+                opcodeSize  = 0;
+                spriteFrame = &scriptFrames[scriptInfo->frameListOffset + scriptEng.operands[0]];
+
+                switch (scriptEng.operands[1]) {
+                    default: break;
+
+                    case FX_SCALE:
+                        DrawSpriteScaled(entity->direction, scriptEng.operands[2], scriptEng.operands[3], -spriteFrame->pivotX, -spriteFrame->pivotY,
+                                         entity->scale, entity->scale, spriteFrame->width, spriteFrame->height, spriteFrame->sprX, spriteFrame->sprY,
+                                         scriptInfo->spriteSheetID);
                         break;
-                    }
-                    case VAR_OBJECTVALUE30: {
-                        objectEntityList[arrayVal].values[30] = scriptEng.operands[i];
+
+                    case FX_ROTATE:
+                        DrawSpriteRotated(entity->direction, scriptEng.operands[2], scriptEng.operands[3], -spriteFrame->pivotX, -spriteFrame->pivotY,
+                                          spriteFrame->sprX, spriteFrame->sprY, spriteFrame->width, spriteFrame->height, entity->rotation,
+                                          scriptInfo->spriteSheetID);
                         break;
-                    }
-                    case VAR_OBJECTVALUE31: {
-                        objectEntityList[arrayVal].values[31] = scriptEng.operands[i];
+
+                    case FX_ROTOZOOM:
+                        DrawSpriteRotozoom(entity->direction, scriptEng.operands[2], scriptEng.operands[3], -spriteFrame->pivotX,
+                                           -spriteFrame->pivotY, spriteFrame->sprX, spriteFrame->sprY, spriteFrame->width, spriteFrame->height,
+                                           entity->rotation, entity->scale, scriptInfo->spriteSheetID);
                         break;
-                    }
-                    case VAR_OBJECTVALUE32: {
-                        objectEntityList[arrayVal].values[32] = scriptEng.operands[i];
+
+                    case FX_INK:
+                        switch (entity->inkEffect) {
+                            case INK_NONE:
+                                DrawSprite(scriptEng.operands[2] + spriteFrame->pivotX, scriptEng.operands[3] + spriteFrame->pivotY,
+                                           spriteFrame->width, spriteFrame->height, spriteFrame->sprX, spriteFrame->sprY, scriptInfo->spriteSheetID);
+                                break;
+
+                            case INK_BLEND:
+                                DrawBlendedSprite(scriptEng.operands[2] + spriteFrame->pivotX, scriptEng.operands[3] + spriteFrame->pivotY,
+                                                  spriteFrame->width, spriteFrame->height, spriteFrame->sprX, spriteFrame->sprY,
+                                                  scriptInfo->spriteSheetID);
+                                break;
+
+                            case INK_ALPHA:
+                                DrawAlphaBlendedSprite(scriptEng.operands[2] + spriteFrame->pivotX, scriptEng.operands[3] + spriteFrame->pivotY,
+                                                       spriteFrame->width, spriteFrame->height, spriteFrame->sprX, spriteFrame->sprY, entity->alpha,
+                                                       scriptInfo->spriteSheetID);
+                                break;
+
+                            case INK_ADD:
+                                DrawAdditiveBlendedSprite(scriptEng.operands[2] + spriteFrame->pivotX, scriptEng.operands[3] + spriteFrame->pivotY,
+                                                          spriteFrame->width, spriteFrame->height, spriteFrame->sprX, spriteFrame->sprY,
+                                                          entity->alpha, scriptInfo->spriteSheetID);
+                                break;
+
+                            case INK_SUB:
+                                DrawSubtractiveBlendedSprite(scriptEng.operands[2] + spriteFrame->pivotX, scriptEng.operands[3] + spriteFrame->pivotY,
+                                                             spriteFrame->width, spriteFrame->height, spriteFrame->sprX, spriteFrame->sprY,
+                                                             entity->alpha, scriptInfo->spriteSheetID);
+                                break;
+                        }
                         break;
-                    }
-                    case VAR_OBJECTVALUE33: {
-                        objectEntityList[arrayVal].values[33] = scriptEng.operands[i];
+
+                    case FX_TINT:
+                        if (entity->inkEffect == INK_ALPHA) {
+                            DrawScaledTintMask(entity->direction, scriptEng.operands[2], scriptEng.operands[3], -spriteFrame->pivotX,
+                                               -spriteFrame->pivotY, entity->scale, entity->scale, spriteFrame->width, spriteFrame->height,
+                                               spriteFrame->sprX, spriteFrame->sprY, scriptInfo->spriteSheetID);
+                        }
+                        else {
+                            DrawSpriteScaled(entity->direction, scriptEng.operands[2], scriptEng.operands[3], -spriteFrame->pivotX,
+                                             -spriteFrame->pivotY, entity->scale, entity->scale, spriteFrame->width, spriteFrame->height,
+                                             spriteFrame->sprX, spriteFrame->sprY, scriptInfo->spriteSheetID);
+                        }
                         break;
-                    }
-                    case VAR_OBJECTVALUE34: {
-                        objectEntityList[arrayVal].values[34] = scriptEng.operands[i];
+
+                    case FX_FLIP:
+                        switch (entity->direction) {
+                            default:
+                            case FLIP_NONE:
+                                DrawSpriteFlipped(scriptEng.operands[2] + spriteFrame->pivotX, scriptEng.operands[3] + spriteFrame->pivotY,
+                                                  spriteFrame->width, spriteFrame->height, spriteFrame->sprX, spriteFrame->sprY, FLIP_NONE,
+                                                  scriptInfo->spriteSheetID);
+                                break;
+
+                            case FLIP_X:
+                                DrawSpriteFlipped(scriptEng.operands[2] - spriteFrame->width - spriteFrame->pivotX,
+                                                  scriptEng.operands[3] + spriteFrame->pivotY, spriteFrame->width, spriteFrame->height,
+                                                  spriteFrame->sprX, spriteFrame->sprY, FLIP_X, scriptInfo->spriteSheetID);
+                                break;
+
+                            case FLIP_Y:
+                                DrawSpriteFlipped(scriptEng.operands[2] + spriteFrame->pivotX,
+                                                  scriptEng.operands[3] - spriteFrame->height - spriteFrame->pivotY, spriteFrame->width,
+                                                  spriteFrame->height, spriteFrame->sprX, spriteFrame->sprY, FLIP_Y, scriptInfo->spriteSheetID);
+                                break;
+
+                            case FLIP_XY:
+                                DrawSpriteFlipped(scriptEng.operands[2] - spriteFrame->width - spriteFrame->pivotX,
+                                                  scriptEng.operands[3] - spriteFrame->height - spriteFrame->pivotY, spriteFrame->width,
+                                                  spriteFrame->height, spriteFrame->sprX, spriteFrame->sprY, FLIP_XY, scriptInfo->spriteSheetID);
+                                break;
+                        }
                         break;
-                    }
-                    case VAR_OBJECTVALUE35: {
-                        objectEntityList[arrayVal].values[35] = scriptEng.operands[i];
+                }
+                LEGACY_SCRIPT_NEXT;
+
+            LEGACY_SCRIPT_CASE(FUNC_LOADANIMATION):
+                opcodeSize           = 0;
+                scriptInfo->animFile = AddAnimationFile(scriptText);
+                LEGACY_SCRIPT_NEXT;
+
+            LEGACY_SCRIPT_CASE(FUNC_SETUPMENU): {
+                opcodeSize     = 0;
+                TextMenu *menu = &gameMenu[scriptEng.operands[0]];
+                SetupTextMenu(menu, scriptEng.operands[1]);
+                menu->selectionCount = scriptEng.operands[2];
+                menu->alignment      = scriptEng.operands[3];
+                LEGACY_SCRIPT_NEXT;
+            }
+            LEGACY_SCRIPT_CASE(FUNC_ADDMENUENTRY): {
+                opcodeSize                           = 0;
+                TextMenu *menu                       = &gameMenu[scriptEng.operands[0]];
+                menu->entryHighlight[menu->rowCount] = scriptEng.operands[2];
+                AddTextMenuEntry(menu, scriptText);
+                LEGACY_SCRIPT_NEXT;
+            }
+            LEGACY_SCRIPT_CASE(FUNC_EDITMENUENTRY): {
+                opcodeSize     = 0;
+                TextMenu *menu = &gameMenu[scriptEng.operands[0]];
+                EditTextMenuEntry(menu, scriptText, scriptEng.operands[2]);
+                menu->entryHighlight[scriptEng.operands[2]] = scriptEng.operands[3];
+                LEGACY_SCRIPT_NEXT;
+            }
+            LEGACY_SCRIPT_CASE(FUNC_LOADSTAGE):
+                opcodeSize = 0;
+                stageMode  = STAGEMODE_LOAD;
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_DRAWRECT):
+                opcodeSize = 0;
+                DrawRectangle(scriptEng.operands[0], scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3], scriptEng.operands[4],
+                              scriptEng.operands[5], scriptEng.operands[6], scriptEng.operands[7]);
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_RESETOBJECTENTITY): {
+                opcodeSize     = 0;
+                Entity *newEnt = &objectEntityList[scriptEng.operands[0]];
+                memset(newEnt, 0, sizeof(Entity));
+                newEnt->type               = scriptEng.operands[1];
+                newEnt->propertyValue      = scriptEng.operands[2];
+                newEnt->xpos               = scriptEng.operands[3];
+                newEnt->ypos               = scriptEng.operands[4];
+                newEnt->direction          = FLIP_NONE;
+                newEnt->priority           = PRIORITY_BOUNDS;
+                newEnt->drawOrder          = 3;
+                newEnt->scale              = 512;
+                newEnt->inkEffect          = INK_NONE;
+                newEnt->objectInteractions = true;
+                newEnt->visible            = true;
+                newEnt->tileCollisions     = true;
+                LEGACY_SCRIPT_NEXT;
+            }
+            LEGACY_SCRIPT_CASE(FUNC_BOXCOLLISIONTEST):
+                opcodeSize = 0;
+                switch (scriptEng.operands[0]) {
+                    default: break;
+                    case C_TOUCH:
+                        TouchCollision(&objectEntityList[scriptEng.operands[1]], scriptEng.operands[2], scriptEng.operands[3], scriptEng.operands[4],
+                                       scriptEng.operands[5], &objectEntityList[scriptEng.operands[6]], scriptEng.operands[7], scriptEng.operands[8],
+                                       scriptEng.operands[9], scriptEng.operands[10]);
                         break;
-                    }
-                    case VAR_OBJECTVALUE36: {
-                        objectEntityList[arrayVal].values[36] = scriptEng.operands[i];
+                    case C_SOLID:
+                        BoxCollision(&objectEntityList[scriptEng.operands[1]], scriptEng.operands[2], scriptEng.operands[3], scriptEng.operands[4],
+                                     scriptEng.operands[5], &objectEntityList[scriptEng.operands[6]], scriptEng.operands[7], scriptEng.operands[8],
+                                     scriptEng.operands[9], scriptEng.operands[10]);
                         break;
-                    }
-                    case VAR_OBJECTVALUE37: {
-                        objectEntityList[arrayVal].values[37] = scriptEng.operands[i];
+                    case C_SOLID2:
+                        BoxCollision2(&objectEntityList[scriptEng.operands[1]], scriptEng.operands[2], scriptEng.operands[3], scriptEng.operands[4],
+                                      scriptEng.operands[5], &objectEntityList[scriptEng.operands[6]], scriptEng.operands[7], scriptEng.operands[8],
+                                      scriptEng.operands[9], scriptEng.operands[10]);
                         break;
-                    }
-                    case VAR_OBJECTVALUE38: {
-                        objectEntityList[arrayVal].values[38] = scriptEng.operands[i];
+                    case C_PLATFORM:
+                        PlatformCollision(&objectEntityList[scriptEng.operands[1]], scriptEng.operands[2], scriptEng.operands[3],
+                                          scriptEng.operands[4], scriptEng.operands[5], &objectEntityList[scriptEng.operands[6]],
+                                          scriptEng.operands[7], scriptEng.operands[8], scriptEng.operands[9], scriptEng.operands[10]);
                         break;
-                    }
-                    case VAR_OBJECTVALUE39: {
-                        objectEntityList[arrayVal].values[39] = scriptEng.operands[i];
+                }
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_CREATETEMPOBJECT): {
+                opcodeSize = 0;
+                if (objectEntityList[scriptEng.arrayPosition[8]].type > OBJ_TYPE_BLANKOBJECT
+                    && ++scriptEng.arrayPosition[8] == LEGACY_v4_ENTITY_COUNT)
+                    scriptEng.arrayPosition[8] = LEGACY_v4_TEMPENTITY_START;
+                Entity *temp = &objectEntityList[scriptEng.arrayPosition[8]];
+                memset(temp, 0, sizeof(Entity));
+                temp->type               = scriptEng.operands[0];
+                temp->propertyValue      = scriptEng.operands[1];
+                temp->xpos               = scriptEng.operands[2];
+                temp->ypos               = scriptEng.operands[3];
+                temp->direction          = FLIP_NONE;
+                temp->priority           = PRIORITY_ACTIVE;
+                temp->drawOrder          = 3;
+                temp->scale              = 512;
+                temp->inkEffect          = INK_NONE;
+                temp->objectInteractions = true;
+                temp->visible            = true;
+                temp->tileCollisions     = true;
+                LEGACY_SCRIPT_NEXT;
+            }
+            LEGACY_SCRIPT_CASE(FUNC_PROCESSOBJECTMOVEMENT):
+                opcodeSize = 0;
+                if (entity->tileCollisions) {
+                    ProcessTileCollisions(entity);
+                }
+                else {
+                    entity->xpos += entity->xvel;
+                    entity->ypos += entity->yvel;
+                }
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_PROCESSOBJECTCONTROL):
+                opcodeSize = 0;
+                ProcessObjectControl(entity);
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_PROCESSANIMATION):
+                opcodeSize = 0;
+                ProcessObjectAnimation(scriptInfo, entity);
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_DRAWOBJECTANIMATION):
+                opcodeSize = 0;
+                if (entity->visible)
+                    DrawObjectAnimation(scriptInfo, entity, (entity->xpos >> 16) - xScrollOffset, (entity->ypos >> 16) - yScrollOffset);
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_SETMUSICTRACK):
+                opcodeSize = 0;
+                if (scriptEng.operands[2] <= 1)
+                    SetMusicTrack(scriptText, scriptEng.operands[1], scriptEng.operands[2], 0);
+                else
+                    SetMusicTrack(scriptText, scriptEng.operands[1], true, scriptEng.operands[2]);
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_PLAYMUSIC):
+                opcodeSize = 0;
+                PlayMusic(scriptEng.operands[0]);
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_STOPMUSIC):
+                opcodeSize = 0;
+                StopMusic();
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_PAUSEMUSIC):
+                opcodeSize = 0;
+                // PauseSound();
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_RESUMEMUSIC):
+                opcodeSize = 0;
+                // ResumeSound();
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_SWAPMUSICTRACK):
+                opcodeSize = 0;
+                if (scriptEng.operands[2] <= 1)
+                    SwapMusicTrack(scriptText, scriptEng.operands[1], 0, scriptEng.operands[3]);
+                else
+                    SwapMusicTrack(scriptText, scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]);
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_PLAYSFX):
+                opcodeSize = 0;
+                PlaySfx(scriptEng.operands[0], scriptEng.operands[1]);
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_STOPSFX):
+                opcodeSize = 0;
+                StopSfx(scriptEng.operands[0]);
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_SETSFXATTRIBUTES):
+                opcodeSize = 0;
+                SetSfxAttributes(scriptEng.operands[0], scriptEng.operands[1], scriptEng.operands[2]);
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_OBJECTTILECOLLISION):
+                opcodeSize = 0;
+                switch (scriptEng.operands[0]) {
+                    default: break;
+                    case CSIDE_FLOOR: ObjectFloorCollision(scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]); break;
+                    case CSIDE_LWALL: ObjectLWallCollision(scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]); break;
+                    case CSIDE_RWALL: ObjectRWallCollision(scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]); break;
+                    case CSIDE_ROOF: ObjectRoofCollision(scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]); break;
+                }
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_OBJECTTILEGRIP):
+                opcodeSize = 0;
+                switch (scriptEng.operands[0]) {
+                    default: break;
+                    case CSIDE_FLOOR: ObjectFloorGrip(scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]); break;
+                    case CSIDE_LWALL: ObjectLWallGrip(scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]); break;
+                    case CSIDE_RWALL: ObjectRWallGrip(scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]); break;
+                    case CSIDE_ROOF: ObjectRoofGrip(scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]); break;
+                }
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_NOT): scriptEng.operands[0] = ~scriptEng.operands[0]; LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_DRAW3DSCENE):
+                opcodeSize = 0;
+                TransformVertexBuffer();
+                Sort3DDrawList();
+                Draw3DScene(scriptInfo->spriteSheetID);
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_SETIDENTITYMATRIX):
+                opcodeSize = 0;
+                switch (scriptEng.operands[0]) {
+                    case MAT_WORLD: SetIdentityMatrix(&matWorld); break;
+                    case MAT_VIEW: SetIdentityMatrix(&matView); break;
+                    case MAT_TEMP: SetIdentityMatrix(&matTemp); break;
+                }
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_MATRIXMULTIPLY):
+                opcodeSize = 0;
+                switch (scriptEng.operands[0]) {
+                    case MAT_WORLD:
+                        switch (scriptEng.operands[1]) {
+                            case MAT_WORLD: MatrixMultiply(&matWorld, &matWorld); break;
+                            case MAT_VIEW: MatrixMultiply(&matWorld, &matView); break;
+                            case MAT_TEMP: MatrixMultiply(&matWorld, &matTemp); break;
+                        }
                         break;
-                    }
-                    case VAR_OBJECTVALUE40: {
-                        objectEntityList[arrayVal].values[40] = scriptEng.operands[i];
+
+                    case MAT_VIEW:
+                        switch (scriptEng.operands[1]) {
+                            case MAT_WORLD: MatrixMultiply(&matView, &matWorld); break;
+                            case MAT_VIEW: MatrixMultiply(&matView, &matView); break;
+                            case MAT_TEMP: MatrixMultiply(&matView, &matTemp); break;
+                        }
                         break;
-                    }
-                    case VAR_OBJECTVALUE41: {
-                        objectEntityList[arrayVal].values[41] = scriptEng.operands[i];
+
+                    case MAT_TEMP:
+                        switch (scriptEng.operands[1]) {
+                            case MAT_WORLD: MatrixMultiply(&matTemp, &matWorld); break;
+                            case MAT_VIEW: MatrixMultiply(&matTemp, &matView); break;
+                            case MAT_TEMP: MatrixMultiply(&matTemp, &matTemp); break;
+                        }
                         break;
+                }
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_MATRIXTRANSLATEXYZ):
+                opcodeSize = 0;
+                switch (scriptEng.operands[0]) {
+                    case MAT_WORLD: MatrixTranslateXYZ(&matWorld, scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]); break;
+                    case MAT_VIEW: MatrixTranslateXYZ(&matView, scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]); break;
+                    case MAT_TEMP: MatrixTranslateXYZ(&matTemp, scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]); break;
+                }
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_MATRIXSCALEXYZ):
+                opcodeSize = 0;
+                switch (scriptEng.operands[0]) {
+                    case MAT_WORLD: MatrixScaleXYZ(&matWorld, scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]); break;
+                    case MAT_VIEW: MatrixScaleXYZ(&matView, scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]); break;
+                    case MAT_TEMP: MatrixScaleXYZ(&matTemp, scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]); break;
+                }
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_MATRIXROTATEX):
+                opcodeSize = 0;
+                switch (scriptEng.operands[0]) {
+                    case MAT_WORLD: MatrixRotateX(&matWorld, scriptEng.operands[1]); break;
+                    case MAT_VIEW: MatrixRotateX(&matView, scriptEng.operands[1]); break;
+                    case MAT_TEMP: MatrixRotateX(&matTemp, scriptEng.operands[1]); break;
+                }
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_MATRIXROTATEY):
+                opcodeSize = 0;
+                switch (scriptEng.operands[0]) {
+                    case MAT_WORLD: MatrixRotateY(&matWorld, scriptEng.operands[1]); break;
+                    case MAT_VIEW: MatrixRotateY(&matView, scriptEng.operands[1]); break;
+                    case MAT_TEMP: MatrixRotateY(&matTemp, scriptEng.operands[1]); break;
+                }
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_MATRIXROTATEZ):
+                opcodeSize = 0;
+                switch (scriptEng.operands[0]) {
+                    case MAT_WORLD: MatrixRotateZ(&matWorld, scriptEng.operands[1]); break;
+                    case MAT_VIEW: MatrixRotateZ(&matView, scriptEng.operands[1]); break;
+                    case MAT_TEMP: MatrixRotateZ(&matTemp, scriptEng.operands[1]); break;
+                }
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_MATRIXROTATEXYZ):
+                opcodeSize = 0;
+                switch (scriptEng.operands[0]) {
+                    case MAT_WORLD: MatrixRotateXYZ(&matWorld, scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]); break;
+                    case MAT_VIEW: MatrixRotateXYZ(&matView, scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]); break;
+                    case MAT_TEMP: MatrixRotateXYZ(&matTemp, scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]); break;
+                }
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_MATRIXINVERSE):
+                opcodeSize = 0;
+                switch (scriptEng.operands[0]) {
+                    case MAT_WORLD: MatrixInverse(&matWorld); break;
+                    case MAT_VIEW: MatrixInverse(&matView); break;
+                    case MAT_TEMP: MatrixInverse(&matTemp); break;
+                }
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_TRANSFORMVERTICES):
+                opcodeSize = 0;
+                switch (scriptEng.operands[0]) {
+                    case MAT_WORLD: TransformVertices(&matWorld, scriptEng.operands[1], scriptEng.operands[2]); break;
+                    case MAT_VIEW: TransformVertices(&matView, scriptEng.operands[1], scriptEng.operands[2]); break;
+                    case MAT_TEMP: TransformVertices(&matTemp, scriptEng.operands[1], scriptEng.operands[2]); break;
+                }
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_CALLFUNCTION): {
+                opcodeSize                        = 0;
+                functionStack[functionStackPos++] = scriptCodePtr;
+                functionStack[functionStackPos++] = jumpTableStart;
+                functionStack[functionStackPos++] = scriptCodeStart;
+                scriptCodeStart                   = scriptFunctionList[scriptEng.operands[0]].ptr.scriptCodePtr;
+                jumpTableStart                    = scriptFunctionList[scriptEng.operands[0]].ptr.jumpTablePtr;
+                scriptCodePtr                     = scriptCodeStart;
+                LEGACY_SCRIPT_NEXT;
+            }
+            LEGACY_SCRIPT_CASE(FUNC_RETURN):
+                opcodeSize = 0;
+                if (!functionStackPos) { // event, stop running
+                    running = false;
+                }
+                else { // function, jump out
+                    scriptCodeStart = functionStack[--functionStackPos];
+                    jumpTableStart  = functionStack[--functionStackPos];
+                    scriptCodePtr   = functionStack[--functionStackPos];
+                }
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_SETLAYERDEFORMATION):
+                opcodeSize = 0;
+                SetLayerDeformation(scriptEng.operands[0], scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3], scriptEng.operands[4],
+                                    scriptEng.operands[5]);
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_CHECKTOUCHRECT):
+                opcodeSize            = 0;
+                scriptEng.checkResult = -1;
+
+                for (int32 f = 0; f < touchInfo.count; ++f) {
+                    if (touchInfo.down[f]) {
+                        int32 touchX = (int32)(touchInfo.x[f] * SCREEN_XSIZE);
+                        int32 touchY = (int32)(touchInfo.y[f] * SCREEN_YSIZE);
+
+                        if (touchX > scriptEng.operands[0] && touchX < scriptEng.operands[2] && touchY > scriptEng.operands[1]
+                            && touchY < scriptEng.operands[3]) {
+                            scriptEng.checkResult = f;
+                        }
                     }
-                    case VAR_OBJECTVALUE42: {
-                        objectEntityList[arrayVal].values[42] = scriptEng.operands[i];
+                }
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_GETTILELAYERENTRY):
+                scriptEng.operands[0] = stageLayouts[scriptEng.operands[1]].tiles[scriptEng.operands[2] + 0x100 * scriptEng.operands[3]];
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_SETTILELAYERENTRY):
+                stageLayouts[scriptEng.operands[1]].tiles[scriptEng.operands[2] + 0x100 * scriptEng.operands[3]] = scriptEng.operands[0];
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_GETBIT): scriptEng.operands[0] = (scriptEng.operands[1] & (1 << scriptEng.operands[2])) >> scriptEng.operands[2]; LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_SETBIT):
+                if (scriptEng.operands[2] <= 0)
+                    scriptEng.operands[0] &= ~(1 << scriptEng.operands[1]);
+                else
+                    scriptEng.operands[0] |= 1 << scriptEng.operands[1];
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_CLEARDRAWLIST):
+                opcodeSize                                      = 0;
+                drawListEntries[scriptEng.operands[0]].listSize = 0;
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_ADDDRAWLISTENTITYREF): {
+                opcodeSize                                                                                           = 0;
+                drawListEntries[scriptEng.operands[0]].entityRefs[drawListEntries[scriptEng.operands[0]].listSize++] = scriptEng.operands[1];
+                LEGACY_SCRIPT_NEXT;
+            }
+            LEGACY_SCRIPT_CASE(FUNC_GETDRAWLISTENTITYREF): scriptEng.operands[0] = drawListEntries[scriptEng.operands[1]].entityRefs[scriptEng.operands[2]]; LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_SETDRAWLISTENTITYREF):
+                opcodeSize                                                               = 0;
+                drawListEntries[scriptEng.operands[1]].entityRefs[scriptEng.operands[2]] = scriptEng.operands[0];
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_GET16X16TILEINFO): {
+                scriptEng.operands[4] = scriptEng.operands[1] >> 7;
+                scriptEng.operands[5] = scriptEng.operands[2] >> 7;
+                scriptEng.operands[6] = stageLayouts[0].tiles[scriptEng.operands[4] + (scriptEng.operands[5] << 8)] << 6;
+                scriptEng.operands[6] += ((scriptEng.operands[1] & 0x7F) >> 4) + 8 * ((scriptEng.operands[2] & 0x7F) >> 4);
+                int32 index = tiles128x128.tileIndex[scriptEng.operands[6]];
+                switch (scriptEng.operands[3]) {
+                    case TILEINFO_INDEX: scriptEng.operands[0] = tiles128x128.tileIndex[scriptEng.operands[6]]; break;
+                    case TILEINFO_DIRECTION: scriptEng.operands[0] = tiles128x128.direction[scriptEng.operands[6]]; break;
+                    case TILEINFO_VISUALPLANE: scriptEng.operands[0] = tiles128x128.visualPlane[scriptEng.operands[6]]; break;
+                    case TILEINFO_SOLIDITYA: scriptEng.operands[0] = tiles128x128.collisionFlags[0][scriptEng.operands[6]]; break;
+                    case TILEINFO_SOLIDITYB: scriptEng.operands[0] = tiles128x128.collisionFlags[1][scriptEng.operands[6]]; break;
+                    case TILEINFO_FLAGSA: scriptEng.operands[0] = collisionMasks[0].flags[index]; break;
+                    case TILEINFO_ANGLEA: scriptEng.operands[0] = collisionMasks[0].angles[index]; break;
+                    case TILEINFO_FLAGSB: scriptEng.operands[0] = collisionMasks[1].flags[index]; break;
+                    case TILEINFO_ANGLEB: scriptEng.operands[0] = collisionMasks[1].angles[index]; break;
+                    default: break;
+                }
+                LEGACY_SCRIPT_NEXT;
+            }
+            LEGACY_SCRIPT_CASE(FUNC_SET16X16TILEINFO): {
+                scriptEng.operands[4] = scriptEng.operands[1] >> 7;
+                scriptEng.operands[5] = scriptEng.operands[2] >> 7;
+                scriptEng.operands[6] = stageLayouts[0].tiles[scriptEng.operands[4] + (scriptEng.operands[5] << 8)] << 6;
+                scriptEng.operands[6] += ((scriptEng.operands[1] & 0x7F) >> 4) + 8 * ((scriptEng.operands[2] & 0x7F) >> 4);
+                switch (scriptEng.operands[3]) {
+                    case TILEINFO_INDEX:
+                        tiles128x128.tileIndex[scriptEng.operands[6]]  = scriptEng.operands[0];
+                        tiles128x128.gfxDataPos[scriptEng.operands[6]] = scriptEng.operands[0] << 8;
+#if RETRO_USE_FAST_3D_FLOOR
+                        floor3DTileOffsetsDirty = true;
+#endif
                         break;
-                    }
-                    case VAR_OBJECTVALUE43: {
-                        objectEntityList[arrayVal].values[43] = scriptEng.operands[i];
+                    case TILEINFO_DIRECTION:
+                        tiles128x128.direction[scriptEng.operands[6]] = scriptEng.operands[0];
+#if RETRO_USE_FAST_3D_FLOOR
+                        floor3DTileOffsetsDirty = true;
+#endif
                         break;
-                    }
-                    case VAR_OBJECTVALUE44: {
-                        objectEntityList[arrayVal].values[44] = scriptEng.operands[i];
+                    case TILEINFO_VISUALPLANE: tiles128x128.visualPlane[scriptEng.operands[6]] = scriptEng.operands[0]; break;
+                    case TILEINFO_SOLIDITYA: tiles128x128.collisionFlags[0][scriptEng.operands[6]] = scriptEng.operands[0]; break;
+                    case TILEINFO_SOLIDITYB: tiles128x128.collisionFlags[1][scriptEng.operands[6]] = scriptEng.operands[0]; break;
+                    case TILEINFO_FLAGSA: collisionMasks[1].flags[tiles128x128.tileIndex[scriptEng.operands[6]]] = scriptEng.operands[0]; break;
+                    case TILEINFO_ANGLEA: collisionMasks[1].angles[tiles128x128.tileIndex[scriptEng.operands[6]]] = scriptEng.operands[0]; break;
+                    default: break;
+                }
+                LEGACY_SCRIPT_NEXT;
+            }
+            LEGACY_SCRIPT_CASE(FUNC_COPY16X16TILE):
+                opcodeSize = 0;
+                Copy16x16Tile(scriptEng.operands[0], scriptEng.operands[1]);
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_GETANIMATIONBYNAME): {
+                AnimationFile *animFile = scriptInfo->animFile;
+                scriptEng.operands[0]   = -1;
+                int32 id                = 0;
+                while (scriptEng.operands[0] == -1) {
+                    SpriteAnimation *anim = &animationList[animFile->aniListOffset + id];
+                    if (StrComp(scriptText, anim->name))
+                        scriptEng.operands[0] = id;
+                    else if (++id == animFile->animCount)
+                        scriptEng.operands[0] = 0;
+                }
+                LEGACY_SCRIPT_NEXT;
+            }
+            LEGACY_SCRIPT_CASE(FUNC_READSAVERAM):
+                opcodeSize            = 0;
+                scriptEng.checkResult = ReadSaveRAM();
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_WRITESAVERAM):
+                opcodeSize            = 0;
+                scriptEng.checkResult = WriteSaveRAM();
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_LOADTEXTFILE): {
+                opcodeSize     = 0;
+                TextMenu *menu = &gameMenu[scriptEng.operands[0]];
+                LoadTextFile(menu, scriptText);
+                LEGACY_SCRIPT_NEXT;
+            }
+            LEGACY_SCRIPT_CASE(FUNC_GETTEXTINFO): {
+                TextMenu *menu = &gameMenu[scriptEng.operands[1]];
+                switch (scriptEng.operands[2]) {
+                    case TEXTINFO_TEXTDATA:
+                        scriptEng.operands[0] = menu->textData[menu->entryStart[scriptEng.operands[3]] + scriptEng.operands[4]];
                         break;
+                    case TEXTINFO_TEXTSIZE: scriptEng.operands[0] = menu->entrySize[scriptEng.operands[3]]; break;
+                    case TEXTINFO_ROWCOUNT: scriptEng.operands[0] = menu->rowCount; break;
+                }
+                LEGACY_SCRIPT_NEXT;
+            }
+            LEGACY_SCRIPT_CASE(FUNC_GETVERSIONNUMBER): {
+                opcodeSize                           = 0;
+                TextMenu *menu                       = &gameMenu[scriptEng.operands[0]];
+                menu->entryHighlight[menu->rowCount] = scriptEng.operands[1];
+                AddTextMenuEntry(menu, gameVerInfo.version);
+                LEGACY_SCRIPT_NEXT;
+            }
+            LEGACY_SCRIPT_CASE(FUNC_GETTABLEVALUE): {
+                int32 arrPos = scriptEng.operands[1];
+                if (arrPos >= 0) {
+                    int32 pos     = scriptEng.operands[2];
+                    int32 arrSize = scriptCode[pos];
+                    if (arrPos < arrSize)
+                        scriptEng.operands[0] = scriptCode[pos + arrPos + 1];
+                }
+                LEGACY_SCRIPT_NEXT;
+            }
+            LEGACY_SCRIPT_CASE(FUNC_SETTABLEVALUE): {
+                opcodeSize   = 0;
+                int32 arrPos = scriptEng.operands[1];
+                if (arrPos >= 0) {
+                    int32 pos     = scriptEng.operands[2];
+                    int32 arrSize = scriptCode[pos];
+                    if (arrPos < arrSize)
+                        scriptCode[pos + arrPos + 1] = scriptEng.operands[0];
+                }
+                LEGACY_SCRIPT_NEXT;
+            }
+            LEGACY_SCRIPT_CASE(FUNC_CHECKCURRENTSTAGEFOLDER):
+                opcodeSize            = 0;
+                scriptEng.checkResult = StrComp(sceneInfo.listData[sceneInfo.listPos].folder, scriptText);
+
+                // Mission Mode stuff
+                if (!scriptEng.checkResult) {
+                    int32 targetLength  = strlen(sceneInfo.listData[sceneInfo.listPos].folder);
+                    int32 currentLength = strlen(scriptText);
+                    if (targetLength > currentLength) {
+                        scriptEng.checkResult = StrComp(&sceneInfo.listData[sceneInfo.listPos].folder[targetLength - currentLength], scriptText);
                     }
-                    case VAR_OBJECTVALUE45: {
-                        objectEntityList[arrayVal].values[45] = scriptEng.operands[i];
-                        break;
+                }
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_ABS): {
+                scriptEng.operands[0] = abs(scriptEng.operands[0]);
+                LEGACY_SCRIPT_NEXT;
+            }
+            LEGACY_SCRIPT_CASE(FUNC_CALLNATIVEFUNCTION):
+                opcodeSize = 0;
+                if (scriptEng.operands[0] >= 0 && scriptEng.operands[0] < LEGACY_v4_NATIIVEFUNCTION_COUNT) {
+                    void (*func)(void) = (void (*)(void))nativeFunction[scriptEng.operands[0]];
+                    if (func)
+                        func();
+                }
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_CALLNATIVEFUNCTION2):
+                if (scriptEng.operands[0] >= 0 && scriptEng.operands[0] < LEGACY_v4_NATIIVEFUNCTION_COUNT) {
+                    if (StrLength(scriptText)) {
+                        void (*func)(int32 *, char *) = (void (*)(int32 *, char *))nativeFunction[scriptEng.operands[0]];
+                        if (func)
+                            func(&scriptEng.operands[2], scriptText);
                     }
-                    case VAR_OBJECTVALUE46: {
-                        objectEntityList[arrayVal].values[46] = scriptEng.operands[i];
-                        break;
+                    else {
+                        void (*func)(int32 *, int32 *) = (void (*)(int32 *, int32 *))nativeFunction[scriptEng.operands[0]];
+                        if (func)
+                            func(&scriptEng.operands[1], &scriptEng.operands[2]);
                     }
-                    case VAR_OBJECTVALUE47: {
-                        objectEntityList[arrayVal].values[47] = scriptEng.operands[i];
-                        break;
+                }
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_CALLNATIVEFUNCTION4):
+                if (scriptEng.operands[0] >= 0 && scriptEng.operands[0] < LEGACY_v4_NATIIVEFUNCTION_COUNT) {
+                    if (StrLength(scriptText)) {
+                        void (*func)(int32 *, char *, int32 *, int32 *) =
+                            (void (*)(int32 *, char *, int32 *, int32 *))nativeFunction[scriptEng.operands[0]];
+                        if (func)
+                            func(&scriptEng.operands[1], scriptText, &scriptEng.operands[3], &scriptEng.operands[4]);
+                    }
+                    else {
+                        void (*func)(int32 *, int32 *, int32 *, int32 *) =
+                            (void (*)(int32 *, int32 *, int32 *, int32 *))nativeFunction[scriptEng.operands[0]];
+                        if (func)
+                            func(&scriptEng.operands[1], &scriptEng.operands[2], &scriptEng.operands[3], &scriptEng.operands[4]);
                     }
-                    case VAR_STAGESTATE: stageMode = scriptEng.operands[i]; break;
-                    case VAR_STAGEACTIVELIST: {
-                        int32 listID = scriptEng.operands[i];
-                        if (listID < sceneInfo.categoryCount) {
-                            int32 prevListPos = sceneInfo.listCategory[sceneInfo.activeCategory].sceneOffsetStart;
+                }
+                LEGACY_SCRIPT_NEXT;
+            LEGACY_SCRIPT_CASE(FUNC_SETOBJECTRANGE): {
+                // FUNCTION PARAMS:
+                // scriptEng.operands[0] = range
 
-                            sceneInfo.activeCategory = listID;
-                            SceneListInfo *list      = &sceneInfo.listCategory[sceneInfo.activeCategory];
+                opcodeSize       = 0;
+                int32 offset     = (scriptEng.operands[0] >> 1) - SCREEN_CENTERX;
+                OBJECT_BORDER_X1 = offset + 0x80;
+                OBJECT_BORDER_X2 = scriptEng.operands[0] + 0x80 - offset;
+                OBJECT_BORDER_X3 = offset + 0x20;
+                OBJECT_BORDER_X4 = scriptEng.operands[0] + 0x20 - offset;
+                LEGACY_SCRIPT_NEXT;
+            }
+            LEGACY_SCRIPT_CASE(FUNC_GETOBJECTVALUE): {
+                // FUNCTION PARAMS:
+                // scriptEng.operands[0] = result
+                // scriptEng.operands[1] = valueID
+                // scriptEng.operands[2] = entitySlot
 
-                            sceneInfo.listPos = list->sceneOffsetStart + RSDK::sceneInfo.listPos - prevListPos;
-                            if (sceneInfo.listPos >= list->sceneOffsetEnd)
-                                sceneInfo.listPos = list->sceneOffsetEnd;
-                        }
-                        break;
-                    }
-                    case VAR_STAGELISTPOS: {
-                        SceneListInfo *list = &sceneInfo.listCategory[sceneInfo.activeCategory];
-
-                        if (list->sceneOffsetStart + scriptEng.operands[i] < list->sceneOffsetEnd)
-                            sceneInfo.listPos = list->sceneOffsetStart + scriptEng.operands[i];
-                        break;
-                    }
-                    case VAR_STAGETIMEENABLED: timeEnabled = scriptEng.operands[i]; break;
-                    case VAR_STAGEMILLISECONDS: stageMilliseconds = scriptEng.operands[i]; break;
-                    case VAR_STAGESECONDS: stageSeconds = scriptEng.operands[i]; break;
-                    case VAR_STAGEMINUTES: stageMinutes = scriptEng.operands[i]; break;
-                    case VAR_STAGEACTNUM: actID = scriptEng.operands[i]; break;
-                    case VAR_STAGEPAUSEENABLED: pauseEnabled = scriptEng.operands[i]; break;
-                    case VAR_STAGELISTSIZE: break;
-                    case VAR_STAGENEWXBOUNDARY1: newXBoundary1 = scriptEng.operands[i]; break;
-                    case VAR_STAGENEWXBOUNDARY2: newXBoundary2 = scriptEng.operands[i]; break;
-                    case VAR_STAGENEWYBOUNDARY1: newYBoundary1 = scriptEng.operands[i]; break;
-                    case VAR_STAGENEWYBOUNDARY2: newYBoundary2 = scriptEng.operands[i]; break;
-                    case VAR_STAGECURXBOUNDARY1:
-                        if (curXBoundary1 != scriptEng.operands[i]) {
-                            curXBoundary1 = scriptEng.operands[i];
-                            newXBoundary1 = scriptEng.operands[i];
-                        }
-                        break;
-                    case VAR_STAGECURXBOUNDARY2:
-                        if (curXBoundary2 != scriptEng.operands[i]) {
-                            curXBoundary2 = scriptEng.operands[i];
-                            newXBoundary2 = scriptEng.operands[i];
-                        }
-                        break;
-                    case VAR_STAGECURYBOUNDARY1:
-                        if (curYBoundary1 != scriptEng.operands[i]) {
-                            curYBoundary1 = scriptEng.operands[i];
-                            newYBoundary1 = scriptEng.operands[i];
-                        }
-                        break;
-                    case VAR_STAGECURYBOUNDARY2:
-                        if (curYBoundary2 != scriptEng.operands[i]) {
-                            curYBoundary2 = scriptEng.operands[i];
-                            newYBoundary2 = scriptEng.operands[i];
-                        }
-                        break;
-                    case VAR_STAGEDEFORMATIONDATA0: bgDeformationData0[arrayVal] = scriptEng.operands[i]; break;
-                    case VAR_STAGEDEFORMATIONDATA1: bgDeformationData1[arrayVal] = scriptEng.operands[i]; break;
-                    case VAR_STAGEDEFORMATIONDATA2: bgDeformationData2[arrayVal] = scriptEng.operands[i]; break;
-                    case VAR_STAGEDEFORMATIONDATA3: bgDeformationData3[arrayVal] = scriptEng.operands[i]; break;
-                    case VAR_STAGEWATERLEVEL: waterLevel = scriptEng.operands[i]; break;
-                    case VAR_STAGEACTIVELAYER: activeTileLayers[arrayVal] = scriptEng.operands[i]; break;
-                    case VAR_STAGEMIDPOINT: tLayerMidPoint = scriptEng.operands[i]; break;
-                    case VAR_STAGEPLAYERLISTPOS: playerListPos = scriptEng.operands[i]; break;
-                    case VAR_STAGEDEBUGMODE: debugMode = scriptEng.operands[i]; break;
-                    case VAR_STAGEENTITYPOS: objectEntityPos = scriptEng.operands[i]; break;
-                    case VAR_SCREENCAMERAENABLED: currentCamera->enabled = scriptEng.operands[i]; break;
-                    case VAR_SCREENCAMERATARGET: currentCamera->target = scriptEng.operands[i]; break;
-                    case VAR_SCREENCAMERASTYLE: currentCamera->style = scriptEng.operands[i]; break;
-                    case VAR_SCREENCAMERAX: currentCamera->xpos = scriptEng.operands[i]; break;
-                    case VAR_SCREENCAMERAY: currentCamera->ypos = scriptEng.operands[i]; break;
-                    case VAR_SCREENDRAWLISTSIZE: drawListEntries[arrayVal].listSize = scriptEng.operands[i]; break;
-                    case VAR_SCREENXCENTER: break;
-                    case VAR_SCREENYCENTER: break;
-                    case VAR_SCREENXSIZE: break;
-                    case VAR_SCREENYSIZE: break;
-                    case VAR_SCREENXOFFSET: xScrollOffset = scriptEng.operands[i]; break;
-                    case VAR_SCREENYOFFSET: yScrollOffset = scriptEng.operands[i]; break;
-                    case VAR_SCREENSHAKEX: cameraShakeX = scriptEng.operands[i]; break;
-                    case VAR_SCREENSHAKEY: cameraShakeY = scriptEng.operands[i]; break;
-                    case VAR_SCREENADJUSTCAMERAY: currentCamera->adjustY = scriptEng.operands[i]; break;
-                    case VAR_TOUCHSCREENDOWN: break;
-                    case VAR_TOUCHSCREENXPOS: break;
-                    case VAR_TOUCHSCREENYPOS: break;
-                    case VAR_MUSICVOLUME: SetMusicVolume(scriptEng.operands[i]); break;
-                    case VAR_MUSICCURRENTTRACK: break;
-                    case VAR_MUSICPOSITION: break;
-                    case VAR_KEYDOWNUP: controller[arrayVal].keyUp.down = scriptEng.operands[i]; break;
-                    case VAR_KEYDOWNDOWN: controller[arrayVal].keyDown.down = scriptEng.operands[i]; break;
-                    case VAR_KEYDOWNLEFT: controller[arrayVal].keyLeft.down = scriptEng.operands[i]; break;
-                    case VAR_KEYDOWNRIGHT: controller[arrayVal].keyRight.down = scriptEng.operands[i]; break;
-                    case VAR_KEYDOWNBUTTONA: controller[arrayVal].keyA.down = scriptEng.operands[i]; break;
-                    case VAR_KEYDOWNBUTTONB: controller[arrayVal].keyB.down = scriptEng.operands[i]; break;
-                    case VAR_KEYDOWNBUTTONC: controller[arrayVal].keyC.down = scriptEng.operands[i]; break;
-                    case VAR_KEYDOWNBUTTONX: controller[arrayVal].keyX.down = scriptEng.operands[i]; break;
-                    case VAR_KEYDOWNBUTTONY: controller[arrayVal].keyY.down = scriptEng.operands[i]; break;
-                    case VAR_KEYDOWNBUTTONZ: controller[arrayVal].keyZ.down = scriptEng.operands[i]; break;
-                    case VAR_KEYDOWNBUTTONL: triggerL[arrayVal].keyBumper.down = scriptEng.operands[i]; break;
-                    case VAR_KEYDOWNBUTTONR: triggerR[arrayVal].keyBumper.down = scriptEng.operands[i]; break;
-                    case VAR_KEYDOWNSTART: controller[arrayVal].keyStart.down = scriptEng.operands[i]; break;
-                    case VAR_KEYDOWNSELECT: controller[arrayVal].keySelect.down = scriptEng.operands[i]; break;
-                    case VAR_KEYPRESSUP: controller[arrayVal].keyUp.press = scriptEng.operands[i]; break;
-                    case VAR_KEYPRESSDOWN: controller[arrayVal].keyDown.press = scriptEng.operands[i]; break;
-                    case VAR_KEYPRESSLEFT: controller[arrayVal].keyLeft.press = scriptEng.operands[i]; break;
-                    case VAR_KEYPRESSRIGHT: controller[arrayVal].keyRight.press = scriptEng.operands[i]; break;
-                    case VAR_KEYPRESSBUTTONA: controller[arrayVal].keyA.press = scriptEng.operands[i]; break;
-                    case VAR_KEYPRESSBUTTONB: controller[arrayVal].keyB.press = scriptEng.operands[i]; break;
-                    case VAR_KEYPRESSBUTTONC: controller[arrayVal].keyC.press = scriptEng.operands[i]; break;
-                    case VAR_KEYPRESSBUTTONX: controller[arrayVal].keyX.press = scriptEng.operands[i]; break;
-                    case VAR_KEYPRESSBUTTONY: controller[arrayVal].keyY.press = scriptEng.operands[i]; break;
-                    case VAR_KEYPRESSBUTTONZ: controller[arrayVal].keyZ.press = scriptEng.operands[i]; break;
-                    case VAR_KEYPRESSBUTTONL: triggerL[arrayVal].keyBumper.press = scriptEng.operands[i]; break;
-                    case VAR_KEYPRESSBUTTONR: triggerR[arrayVal].keyBumper.press = scriptEng.operands[i]; break;
-                    case VAR_KEYPRESSSTART: controller[arrayVal].keyStart.press = scriptEng.operands[i]; break;
-                    case VAR_KEYPRESSSELECT: controller[arrayVal].keySelect.press = scriptEng.operands[i]; break;
-                    case VAR_MENU1SELECTION: gameMenu[0].selection1 = scriptEng.operands[i]; break;
-                    case VAR_MENU2SELECTION: gameMenu[1].selection1 = scriptEng.operands[i]; break;
-                    case VAR_TILELAYERXSIZE: stageLayouts[arrayVal].xsize = scriptEng.operands[i]; break;
-                    case VAR_TILELAYERYSIZE: stageLayouts[arrayVal].ysize = scriptEng.operands[i]; break;
-                    case VAR_TILELAYERTYPE: stageLayouts[arrayVal].type = scriptEng.operands[i]; break;
-                    case VAR_TILELAYERANGLE: {
-                        int32 angle = scriptEng.operands[i] + 0x200;
-                        if (scriptEng.operands[i] >= 0)
-                            angle = scriptEng.operands[i];
-                        stageLayouts[arrayVal].angle = angle & 0x1FF;
-                        break;
-                    }
-                    case VAR_TILELAYERXPOS: stageLayouts[arrayVal].xpos = scriptEng.operands[i]; break;
-                    case VAR_TILELAYERYPOS: stageLayouts[arrayVal].ypos = scriptEng.operands[i]; break;
-                    case VAR_TILELAYERZPOS: stageLayouts[arrayVal].zpos = scriptEng.operands[i]; break;
-                    case VAR_TILELAYERPARALLAXFACTOR: stageLayouts[arrayVal].parallaxFactor = scriptEng.operands[i]; break;
-                    case VAR_TILELAYERSCROLLSPEED: stageLayouts[arrayVal].scrollSpeed = scriptEng.operands[i]; break;
-                    case VAR_TILELAYERSCROLLPOS: stageLayouts[arrayVal].scrollPos = scriptEng.operands[i]; break;
-                    case VAR_TILELAYERDEFORMATIONOFFSET: stageLayouts[arrayVal].deformationOffset = scriptEng.operands[i]; break;
-                    case VAR_TILELAYERDEFORMATIONOFFSETW: stageLayouts[arrayVal].deformationOffsetW = scriptEng.operands[i]; break;
-                    case VAR_HPARALLAXPARALLAXFACTOR: hParallax.parallaxFactor[arrayVal] = scriptEng.operands[i]; break;
-                    case VAR_HPARALLAXSCROLLSPEED: hParallax.scrollSpeed[arrayVal] = scriptEng.operands[i]; break;
-                    case VAR_HPARALLAXSCROLLPOS: hParallax.scrollPos[arrayVal] = scriptEng.operands[i]; break;
-                    case VAR_VPARALLAXPARALLAXFACTOR: vParallax.parallaxFactor[arrayVal] = scriptEng.operands[i]; break;
-                    case VAR_VPARALLAXSCROLLSPEED: vParallax.scrollSpeed[arrayVal] = scriptEng.operands[i]; break;
-                    case VAR_VPARALLAXSCROLLPOS: vParallax.scrollPos[arrayVal] = scriptEng.operands[i]; break;
-                    case VAR_SCENE3DVERTEXCOUNT: vertexCount = scriptEng.operands[i]; break;
-                    case VAR_SCENE3DFACECOUNT: faceCount = scriptEng.operands[i]; break;
-                    case VAR_SCENE3DPROJECTIONX: projectionX = scriptEng.operands[i]; break;
-                    case VAR_SCENE3DPROJECTIONY: projectionY = scriptEng.operands[i]; break;
-                    case VAR_SCENE3DFOGCOLOR: fogColor = scriptEng.operands[i]; break;
-                    case VAR_SCENE3DFOGSTRENGTH: fogStrength = scriptEng.operands[i]; break;
-                    case VAR_VERTEXBUFFERX: vertexBuffer[arrayVal].x = scriptEng.operands[i]; break;
-                    case VAR_VERTEXBUFFERY: vertexBuffer[arrayVal].y = scriptEng.operands[i]; break;
-                    case VAR_VERTEXBUFFERZ: vertexBuffer[arrayVal].z = scriptEng.operands[i]; break;
-                    case VAR_VERTEXBUFFERU: vertexBuffer[arrayVal].u = scriptEng.operands[i]; break;
-                    case VAR_VERTEXBUFFERV: vertexBuffer[arrayVal].v = scriptEng.operands[i]; break;
-                    case VAR_FACEBUFFERA: faceBuffer[arrayVal].a = scriptEng.operands[i]; break;
-                    case VAR_FACEBUFFERB: faceBuffer[arrayVal].b = scriptEng.operands[i]; break;
-                    case VAR_FACEBUFFERC: faceBuffer[arrayVal].c = scriptEng.operands[i]; break;
-                    case VAR_FACEBUFFERD: faceBuffer[arrayVal].d = scriptEng.operands[i]; break;
-                    case VAR_FACEBUFFERFLAG: faceBuffer[arrayVal].flag = scriptEng.operands[i]; break;
-                    case VAR_FACEBUFFERCOLOR: faceBuffer[arrayVal].color = scriptEng.operands[i]; break;
-                    case VAR_SAVERAM: saveRAM[arrayVal] = scriptEng.operands[i]; break;
-                    case VAR_ENGINESTATE: gameMode = scriptEng.operands[i]; break;
-                    case VAR_ENGINELANGUAGE: language = scriptEng.operands[i]; break;
-                    case VAR_ENGINEONLINEACTIVE: onlineActive = scriptEng.operands[i]; break;
-                    case VAR_ENGINESFXVOLUME:
-                        sfxVolume = scriptEng.operands[i];
-                        // SetGameVolumes(bgmVolume, sfxVolume);
-                        break;
-                    case VAR_ENGINEBGMVOLUME:
-                        bgmVolume = scriptEng.operands[i];
-                        // SetGameVolumes(bgmVolume, sfxVolume);
-                        break;
-                    case VAR_ENGINETRIALMODE: trialMode = scriptEng.operands[i]; break;
-                    case VAR_ENGINEDEVICETYPE: break;
+                if (scriptEng.operands[1] < 48)
+                    scriptEng.operands[0] = objectEntityList[scriptEng.operands[2]].values[scriptEng.operands[1]];
+                LEGACY_SCRIPT_NEXT;
+            }
+            LEGACY_SCRIPT_CASE(FUNC_SETOBJECTVALUE): {
+                // FUNCTION PARAMS:
+                // scriptEng.operands[0] = value
+                // scriptEng.operands[1] = valueID
+                // scriptEng.operands[2] = entitySlot
 
-                    // Origins Extras
-                    case VAR_SCREENCURRENTID: break;
-                    case VAR_CAMERAENABLED: cameras[arrayVal].enabled = scriptEng.operands[i]; break;
-                    case VAR_CAMERATARGET: cameras[arrayVal].target = scriptEng.operands[i]; break;
-                    case VAR_CAMERASTYLE: cameras[arrayVal].style = scriptEng.operands[i]; break;
-                    case VAR_CAMERAXPOS: cameras[arrayVal].xpos = scriptEng.operands[i]; break;
-                    case VAR_CAMERAYPOS: cameras[arrayVal].ypos = scriptEng.operands[i]; break;
-                    case VAR_CAMERAADJUSTY: cameras[arrayVal].adjustY = scriptEng.operands[i]; break;
+                opcodeSize = 0;
+                if (scriptEng.operands[1] < 48)
+                    objectEntityList[scriptEng.operands[2]].values[scriptEng.operands[1]] = scriptEng.operands[0];
+                LEGACY_SCRIPT_NEXT;
+            }
+            LEGACY_SCRIPT_CASE(FUNC_COPYOBJECT): {
+                // FUNCTION PARAMS:
+                // scriptEng.operands[0] = destSlot
+                // scriptEng.operands[1] = srcSlot
+                // scriptEng.operands[2] = count
 
-#if LEGACY_RETRO_USE_HAPTICS
-                    case VAR_HAPTICSENABLED: hapticsEnabled = scriptEng.operands[i]; break;
-#endif
-                }
+                Entity *dstList = &objectEntityList[scriptEng.operands[0]];
+                Entity *srcList = &objectEntityList[scriptEng.operands[1]];
+                for (int32 i = 0; i < scriptEng.operands[2]; ++i) memcpy(&dstList[i], &srcList[i], sizeof(Entity));
+                LEGACY_SCRIPT_NEXT;
             }
-            else if (opcodeType == SCRIPTVAR_INTCONST) { // int32 constant
-                scriptCodePtr++;
+            LEGACY_SCRIPT_CASE(FUNC_PRINT): {
+                // FUNCTION PARAMS:
+                // scriptEng.operands[0] = message (can be a regular value or a string depending on scriptEng.operands[1])
+                // scriptEng.operands[1] = isInt
+                // scriptEng.operands[2] = useEndLine
+
+                useEndLine = false;
+                if (scriptEng.operands[1])
+                    PrintLog(PRINT_NORMAL, "%d", scriptEng.operands[0]);
+                else
+                    PrintLog(PRINT_NORMAL, "%s", scriptText);
+
+                if (scriptEng.operands[2])
+                    PrintLog(PRINT_NORMAL, "\n");
+                useEndLine = true;
+                LEGACY_SCRIPT_NEXT;
             }
-            else if (opcodeType == SCRIPTVAR_STRCONST) { // string constant
-                int32 strLen = scriptCode[scriptCodePtr++];
-                for (int32 c = 0; c < strLen; ++c) {
-                    switch (c % 4) {
-                        case 0: break;
-                        case 1: break;
-                        case 2: break;
-                        case 3: ++scriptCodePtr; break;
-                        default: break;
+
+            // Extras for origins 2PVS
+            LEGACY_SCRIPT_CASE(FUNC_CHECKCAMERAPROXIMITY):
+                scriptEng.checkResult = false;
+
+                // FUNCTION PARAMS:
+                // scriptEng.operands[0] = pos.x
+                // scriptEng.operands[1] = pos.y
+                // scriptEng.operands[2] = range.x
+                // scriptEng.operands[3] = range.y
+                //
+                // FUNCTION NOTES:
+                // - Sets scriptEng.checkResult
+
+                if (scriptEng.operands[2] > 0 && scriptEng.operands[3] > 0) {
+                    for (int32 s = 0; s < videoSettings.screenCount; ++s) {
+                        int32 sx = abs(scriptEng.operands[0] - cameras[s].xpos);
+                        int32 sy = abs(scriptEng.operands[1] - cameras[s].ypos);
+
+                        if (sx < scriptEng.operands[2] && sy < scriptEng.operands[3]) {
+                            scriptEng.checkResult = true;
+                            break;
+                        }
                     }
                 }
-                scriptCodePtr++;
-            }
+                else {
+                    if (scriptEng.operands[2] > 0) {
+                        for (int32 s = 0; s < videoSettings.screenCount; ++s) {
+                            int32 sx = abs(scriptEng.operands[0] - cameras[s].xpos);
+
+                            if (sx < scriptEng.operands[2]) {
+                                scriptEng.checkResult = true;
+                                break;
+                            }
+                        }
+                    }
+                    else if (scriptEng.operands[3] > 0) {
+                        for (int32 s = 0; s < videoSettings.screenCount; ++s) {
+                            int32 sy = abs(scriptEng.operands[1] - cameras[s].ypos);
+
+                            if (sy < scriptEng.operands[3]) {
+                                scriptEng.checkResult = true;
+                                break;
+                            }
+                        }
+                    }
+                }
+                LEGACY_SCRIPT_NEXT;
+
+            LEGACY_SCRIPT_CASE(FUNC_SETSCREENCOUNT):
+                // FUNCTION PARAMS:
+                // scriptEng.operands[0] = screenCount
+
+                RSDK::SetVideoSetting(VIDEOSETTING_SCREENCOUNT, scriptEng.operands[0]);
+                LEGACY_SCRIPT_NEXT;
+
+            LEGACY_SCRIPT_CASE(FUNC_SETSCREENVERTICES):
+                // FUNCTION PARAMS:
+                // scriptEng.operands[0] = startVert2P_S1
+                // scriptEng.operands[1] = startVert2P_S2
+                // scriptEng.operands[2] = startVert3P_S1
+                // scriptEng.operands[3] = startVert3P_S2
+                // scriptEng.operands[4] = startVert3P_S3
+
+                RSDK::SetScreenVertices(scriptEng.operands[0], scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3],
+                                        scriptEng.operands[4]);
+                LEGACY_SCRIPT_NEXT;
+
+            LEGACY_SCRIPT_CASE(FUNC_GETINPUTDEVICEID):
+                // FUNCTION PARAMS:
+                // scriptEng.operands[0] = deviceID
+                // scriptEng.operands[1] = inputSlot
+                //
+                // FUNCTION NOTES:
+                // - Assigns the device's id to scriptEng.operands[0]
+
+                scriptEng.operands[0] = GetInputDeviceID(scriptEng.operands[1]);
+                LEGACY_SCRIPT_NEXT;
+
+            LEGACY_SCRIPT_CASE(FUNC_GETFILTEREDINPUTDEVICEID):
+                // FUNCTION PARAMS:
+                // scriptEng.operands[0] = deviceID
+                // scriptEng.operands[1] = confirmOnly
+                // scriptEng.operands[2] = unassignedOnly
+                // scriptEng.operands[3] = maxInactiveTimer
+                //
+                // FUNCTION NOTES:
+                // - Assigns the filtered device's id to scriptEng.operands[0]
+
+                scriptEng.operands[0] = GetFilteredInputDeviceID(scriptEng.operands[1], scriptEng.operands[2] > 0, scriptEng.operands[3]);
+                LEGACY_SCRIPT_NEXT;
+
+            LEGACY_SCRIPT_CASE(FUNC_GETINPUTDEVICETYPE):
+                // FUNCTION PARAMS:
+                // scriptEng.operands[0] = deviceType
+                // scriptEng.operands[1] = deviceID
+                //
+                // FUNCTION NOTES:
+                // - Assigns the device's type to scriptEng.operands[0]
+
+                scriptEng.operands[0] = GetInputDeviceType(scriptEng.operands[1]);
+                LEGACY_SCRIPT_NEXT;
+
+            LEGACY_SCRIPT_CASE(FUNC_ISINPUTDEVICEASSIGNED):
+                // FUNCTION PARAMS:
+                // scriptEng.operands[0] = deviceID
+
+                scriptEng.checkResult = IsInputDeviceAssigned(scriptEng.operands[0]);
+                LEGACY_SCRIPT_NEXT;
+
+            LEGACY_SCRIPT_CASE(FUNC_ASSIGNINPUTSLOTTODEVICE):
+                // FUNCTION PARAMS:
+                // scriptEng.operands[0] = inputSlot
+                // scriptEng.operands[1] = deviceID
+
+                AssignInputSlotToDevice(scriptEng.operands[0], scriptEng.operands[1]);
+                LEGACY_SCRIPT_NEXT;
+
+            LEGACY_SCRIPT_CASE(FUNC_ISSLOTASSIGNED):
+                // FUNCTION PARAMS:
+                // scriptEng.operands[0] = inputSlot
+                //
+                // FUNCTION NOTES:
+                // - Sets scriptEng.checkResult
+
+                scriptEng.checkResult = IsInputSlotAssigned(scriptEng.operands[0]);
+                LEGACY_SCRIPT_NEXT;
+
+            LEGACY_SCRIPT_CASE(FUNC_RESETINPUTSLOTASSIGNMENTS):
+                // FUNCTION PARAMS:
+                // None
+
+                ResetInputSlotAssignments();
+                LEGACY_SCRIPT_NEXT;
         }
+
+        // Set Values
+        WriteScriptOperands(&opcodeState, scriptCodePtr);
     }
 }
+
+#undef LEGACY_SCRIPT_NEXT
@@ -45,6 +45,33 @@ struct ScriptEngine {
 
 enum ScriptSubs { EVENT_MAIN = 0, EVENT_DRAW = 1, EVENT_SETUP = 2 };
 
+#if RETRO_USE_PREDECODED_SCRIPTS
+#define LEGACY_v4_OPERAND_COUNT (0x20000)
+#define LEGACY_v4_STRING_COUNT  (0x40000)
+
+// an operand with everything that doesn't change between runs already read out of scriptCode
+struct ScriptOperand {
+    int32 *ptr;      // set for anything that doesn't depend on the entity or array positions (temp0, arrayPos0, global[5], etc)
+    int32 value;     // the VAR_ id, int constant, or where a string constant's chars start
+    int32 index;     // the array index (or arrayPosition slot), or a string constant's length
+    int32 stringPos; // where a string constant's unpacked chars start in scriptStringList, -1 if it couldn't be kept
+    uint8 type;      // SCRIPTVAR_ type
+    uint8 arrayMode; // VARARR_ type
+    uint8 indexIsArrayPos;
+#if RETRO_USE_FUSED_SCRIPT_OPCODES
+    uint8 entityField; // the int32 slot in Entity a variable reads & writes directly + 1, 0 if it needs the generic path
+#endif
+};
+
+struct ScriptInstruction {
+    int32 nextCodePtr; // 0 if this opcode hasn't been decoded yet
+    int32 operandPos;
+#if RETRO_USE_FUSED_SCRIPT_OPCODES
+    bool32 fused; // every operand can be read & written without the generic path, so the opcode can run straight off them
+#endif
+};
+#endif
+
 extern ObjectScript objectScriptList[LEGACY_v4_OBJECT_COUNT];
 extern ScriptFunction scriptFunctionList[LEGACY_v4_FUNCTION_COUNT];
 
@@ -66,6 +93,14 @@ extern int32 foreachStackPos;
 extern ScriptEngine scriptEng;
 extern char scriptText[0x4000];
 
+#if RETRO_USE_PREDECODED_SCRIPTS
+extern ScriptInstruction scriptInstructionList[LEGACY_v4_SCRIPTCODE_COUNT];
+extern ScriptOperand scriptOperandList[LEGACY_v4_OPERAND_COUNT];
+extern int32 scriptOperandPos;
+extern char scriptStringList[LEGACY_v4_STRING_COUNT];
+extern int32 scriptStringPos;
+#endif
+
 #if LEGACY_RETRO_USE_COMPILER
 extern int32 scriptFunctionCount;
 extern char scriptFunctionNames[LEGACY_v4_FUNCTION_COUNT][0x40];
@@ -87,9 +122,43 @@ void CopyAliasStr(char *dest, char *text, bool32 arrayIndex);
 bool32 CheckOpcodeType(char *text); // Never actually used
 
 void ParseScriptFile(char *scriptName, int32 scriptID);
+
+#if RETRO_USE_SCRIPT_CACHE
+#define LEGACY_v4_SCRIPTCACHE_SIGNATURE (0x43535352) // "RSSC"
+// bump this whenever the compiler's output changes, so caches from older builds get thrown out
+#define LEGACY_v4_SCRIPTCACHE_VERSION (1)
+
+struct ScriptCacheHeader {
+    uint32 signature;
+    uint32 version;
+    uint64 sourceHash;  // the script text
+    uint64 contextHash; // everything else the compiler reads from (aliases, functions, type/sfx/var names, platform, etc)
+    int32 sourceSize;
+    int32 scriptCodeStart;
+    int32 scriptCodeEnd;
+    int32 jumpTableStart;
+    int32 jumpTableEnd;
+    int32 scriptCodeOffset;
+    int32 jumpTableOffset;
+    int32 functionCount;
+    int32 valueCount;
+};
+
+extern bool32 useScriptCache;
+
+// fills in header with the cache keys for this script, then loads the cached compiler output if there's a valid one
+bool32 LoadScriptCache(const char *scriptPath, FileInfo *info, int32 scriptID, ScriptCacheHeader *header);
+void SaveScriptCache(const char *scriptPath, int32 scriptID, ScriptCacheHeader *header);
+#endif
 #endif
 void LoadBytecode(int32 scriptID, bool32 globalCode);
 
+#if RETRO_USE_PREDECODED_SCRIPTS
+bool32 DecodeScriptInstruction(int32 scriptCodePtr);
+// decodes every opcode from scriptCodePtr up to the end of the event/function, anything past an early return gets decoded when it's first run
+void DecodeScriptCode(int32 scriptCodePtr);
+#endif
+
 void ProcessScript(int32 scriptCodeStart, int32 jumpTableStart, uint8 scriptEvent);
 
 void ClearScriptData();
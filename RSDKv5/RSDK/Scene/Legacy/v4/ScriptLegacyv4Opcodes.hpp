@@ -0,0 +1,435 @@
+#ifndef SCRIPTLEGACYV4OPCODES_H
+#define SCRIPTLEGACYV4OPCODES_H
+
+// the bytecode's operand types, variables & opcodes, kept in their own header so the self tests can write scripts straight into scriptCode
+
+namespace RSDK
+{
+namespace Legacy
+{
+namespace v4
+{
+
+enum ScriptVarTypes { SCRIPTVAR_VAR = 1, SCRIPTVAR_INTCONST = 2, SCRIPTVAR_STRCONST = 3 };
+enum ScriptVarArrTypes { VARARR_NONE = 0, VARARR_ARRAY = 1, VARARR_ENTNOPLUS1 = 2, VARARR_ENTNOMINUS1 = 3 };
+
+enum ScrVar {
+    VAR_TEMP0,
+    VAR_TEMP1,
+    VAR_TEMP2,
+    VAR_TEMP3,
+    VAR_TEMP4,
+    VAR_TEMP5,
+    VAR_TEMP6,
+    VAR_TEMP7,
+    VAR_CHECKRESULT,
+    VAR_ARRAYPOS0,
+    VAR_ARRAYPOS1,
+    VAR_ARRAYPOS2,
+    VAR_ARRAYPOS3,
+    VAR_ARRAYPOS4,
+    VAR_ARRAYPOS5,
+    VAR_ARRAYPOS6,
+    VAR_ARRAYPOS7,
+    VAR_GLOBAL,
+    VAR_LOCAL,
+    VAR_OBJECTENTITYPOS,
+    VAR_OBJECTGROUPID,
+    VAR_OBJECTTYPE,
+    VAR_OBJECTPROPERTYVALUE,
+    VAR_OBJECTXPOS,
+    VAR_OBJECTYPOS,
+    VAR_OBJECTIXPOS,
+    VAR_OBJECTIYPOS,
+    VAR_OBJECTXVEL,
+    VAR_OBJECTYVEL,
+    VAR_OBJECTSPEED,
+    VAR_OBJECTSTATE,
+    VAR_OBJECTROTATION,
+    VAR_OBJECTSCALE,
+    VAR_OBJECTPRIORITY,
+    VAR_OBJECTDRAWORDER,
+    VAR_OBJECTDIRECTION,
+    VAR_OBJECTINKEFFECT,
+    VAR_OBJECTALPHA,
+    VAR_OBJECTFRAME,
+    VAR_OBJECTANIMATION,
+    VAR_OBJECTPREVANIMATION,
+    VAR_OBJECTANIMATIONSPEED,
+    VAR_OBJECTANIMATIONTIMER,
+    VAR_OBJECTANGLE,
+    VAR_OBJECTLOOKPOSX,
+    VAR_OBJECTLOOKPOSY,
+    VAR_OBJECTCOLLISIONMODE,
+    VAR_OBJECTCOLLISIONPLANE,
+    VAR_OBJECTCONTROLMODE,
+    VAR_OBJECTCONTROLLOCK,
+    VAR_OBJECTPUSHING,
+    VAR_OBJECTVISIBLE,
+    VAR_OBJECTTILECOLLISIONS,
+    VAR_OBJECTINTERACTION,
+    VAR_OBJECTGRAVITY,
+    VAR_OBJECTUP,
+    VAR_OBJECTDOWN,
+    VAR_OBJECTLEFT,
+    VAR_OBJECTRIGHT,
+    VAR_OBJECTJUMPPRESS,
+    VAR_OBJECTJUMPHOLD,
+    VAR_OBJECTSCROLLTRACKING,
+    VAR_OBJECTFLOORSENSORL,
+    VAR_OBJECTFLOORSENSORC,
+    VAR_OBJECTFLOORSENSORR,
+    VAR_OBJECTFLOORSENSORLC,
+    VAR_OBJECTFLOORSENSORRC,
+    VAR_OBJECTCOLLISIONLEFT,
+    VAR_OBJECTCOLLISIONTOP,
+    VAR_OBJECTCOLLISIONRIGHT,
+    VAR_OBJECTCOLLISIONBOTTOM,
+    VAR_OBJECTOUTOFBOUNDS,
+    VAR_OBJECTSPRITESHEET,
+    VAR_OBJECTVALUE0,
+    VAR_OBJECTVALUE1,
+    VAR_OBJECTVALUE2,
+    VAR_OBJECTVALUE3,
+    VAR_OBJECTVALUE4,
+    VAR_OBJECTVALUE5,
+    VAR_OBJECTVALUE6,
+    VAR_OBJECTVALUE7,
+    VAR_OBJECTVALUE8,
+    VAR_OBJECTVALUE9,
+    VAR_OBJECTVALUE10,
+    VAR_OBJECTVALUE11,
+    VAR_OBJECTVALUE12,
+    VAR_OBJECTVALUE13,
+    VAR_OBJECTVALUE14,
+    VAR_OBJECTVALUE15,
+    VAR_OBJECTVALUE16,
+    VAR_OBJECTVALUE17,
+    VAR_OBJECTVALUE18,
+    VAR_OBJECTVALUE19,
+    VAR_OBJECTVALUE20,
+    VAR_OBJECTVALUE21,
+    VAR_OBJECTVALUE22,
+    VAR_OBJECTVALUE23,
+    VAR_OBJECTVALUE24,
+    VAR_OBJECTVALUE25,
+    VAR_OBJECTVALUE26,
+    VAR_OBJECTVALUE27,
+    VAR_OBJECTVALUE28,
+    VAR_OBJECTVALUE29,
+    VAR_OBJECTVALUE30,
+    VAR_OBJECTVALUE31,
+    VAR_OBJECTVALUE32,
+    VAR_OBJECTVALUE33,
+    VAR_OBJECTVALUE34,
+    VAR_OBJECTVALUE35,
+    VAR_OBJECTVALUE36,
+    VAR_OBJECTVALUE37,
+    VAR_OBJECTVALUE38,
+    VAR_OBJECTVALUE39,
+    VAR_OBJECTVALUE40,
+    VAR_OBJECTVALUE41,
+    VAR_OBJECTVALUE42,
+    VAR_OBJECTVALUE43,
+    VAR_OBJECTVALUE44,
+    VAR_OBJECTVALUE45,
+    VAR_OBJECTVALUE46,
+    VAR_OBJECTVALUE47,
+    VAR_STAGESTATE,
+    VAR_STAGEACTIVELIST,
+    VAR_STAGELISTPOS,
+    VAR_STAGETIMEENABLED,
+    VAR_STAGEMILLISECONDS,
+    VAR_STAGESECONDS,
+    VAR_STAGEMINUTES,
+    VAR_STAGEACTNUM,
+    VAR_STAGEPAUSEENABLED,
+    VAR_STAGELISTSIZE,
+    VAR_STAGENEWXBOUNDARY1,
+    VAR_STAGENEWXBOUNDARY2,
+    VAR_STAGENEWYBOUNDARY1,
+    VAR_STAGENEWYBOUNDARY2,
+    VAR_STAGECURXBOUNDARY1,
+    VAR_STAGECURXBOUNDARY2,
+    VAR_STAGECURYBOUNDARY1,
+    VAR_STAGECURYBOUNDARY2,
+    VAR_STAGEDEFORMATIONDATA0,
+    VAR_STAGEDEFORMATIONDATA1,
+    VAR_STAGEDEFORMATIONDATA2,
+    VAR_STAGEDEFORMATIONDATA3,
+    VAR_STAGEWATERLEVEL,
+    VAR_STAGEACTIVELAYER,
+    VAR_STAGEMIDPOINT,
+    VAR_STAGEPLAYERLISTPOS,
+    VAR_STAGEDEBUGMODE,
+    VAR_STAGEENTITYPOS,
+    VAR_SCREENCAMERAENABLED,
+    VAR_SCREENCAMERATARGET,
+    VAR_SCREENCAMERASTYLE,
+    VAR_SCREENCAMERAX,
+    VAR_SCREENCAMERAY,
+    VAR_SCREENDRAWLISTSIZE,
+    VAR_SCREENXCENTER,
+    VAR_SCREENYCENTER,
+    VAR_SCREENXSIZE,
+    VAR_SCREENYSIZE,
+    VAR_SCREENXOFFSET,
+    VAR_SCREENYOFFSET,
+    VAR_SCREENSHAKEX,
+    VAR_SCREENSHAKEY,
+    VAR_SCREENADJUSTCAMERAY,
+    VAR_TOUCHSCREENDOWN,
+    VAR_TOUCHSCREENXPOS,
+    VAR_TOUCHSCREENYPOS,
+    VAR_MUSICVOLUME,
+    VAR_MUSICCURRENTTRACK,
+    VAR_MUSICPOSITION,
+    VAR_KEYDOWNUP,
+    VAR_KEYDOWNDOWN,
+    VAR_KEYDOWNLEFT,
+    VAR_KEYDOWNRIGHT,
+    VAR_KEYDOWNBUTTONA,
+    VAR_KEYDOWNBUTTONB,
+    VAR_KEYDOWNBUTTONC,
+    VAR_KEYDOWNBUTTONX,
+    VAR_KEYDOWNBUTTONY,
+    VAR_KEYDOWNBUTTONZ,
+    VAR_KEYDOWNBUTTONL,
+    VAR_KEYDOWNBUTTONR,
+    VAR_KEYDOWNSTART,
+    VAR_KEYDOWNSELECT,
+    VAR_KEYPRESSUP,
+    VAR_KEYPRESSDOWN,
+    VAR_KEYPRESSLEFT,
+    VAR_KEYPRESSRIGHT,
+    VAR_KEYPRESSBUTTONA,
+    VAR_KEYPRESSBUTTONB,
+    VAR_KEYPRESSBUTTONC,
+    VAR_KEYPRESSBUTTONX,
+    VAR_KEYPRESSBUTTONY,
+    VAR_KEYPRESSBUTTONZ,
+    VAR_KEYPRESSBUTTONL,
+    VAR_KEYPRESSBUTTONR,
+    VAR_KEYPRESSSTART,
+    VAR_KEYPRESSSELECT,
+    VAR_MENU1SELECTION,
+    VAR_MENU2SELECTION,
+    VAR_TILELAYERXSIZE,
+    VAR_TILELAYERYSIZE,
+    VAR_TILELAYERTYPE,
+    VAR_TILELAYERANGLE,
+    VAR_TILELAYERXPOS,
+    VAR_TILELAYERYPOS,
+    VAR_TILELAYERZPOS,
+    VAR_TILELAYERPARALLAXFACTOR,
+    VAR_TILELAYERSCROLLSPEED,
+    VAR_TILELAYERSCROLLPOS,
+    VAR_TILELAYERDEFORMATIONOFFSET,
+    VAR_TILELAYERDEFORMATIONOFFSETW,
+    VAR_HPARALLAXPARALLAXFACTOR,
+    VAR_HPARALLAXSCROLLSPEED,
+    VAR_HPARALLAXSCROLLPOS,
+    VAR_VPARALLAXPARALLAXFACTOR,
+    VAR_VPARALLAXSCROLLSPEED,
+    VAR_VPARALLAXSCROLLPOS,
+    VAR_SCENE3DVERTEXCOUNT,
+    VAR_SCENE3DFACECOUNT,
+    VAR_SCENE3DPROJECTIONX,
+    VAR_SCENE3DPROJECTIONY,
+    VAR_SCENE3DFOGCOLOR,
+    VAR_SCENE3DFOGSTRENGTH,
+    VAR_VERTEXBUFFERX,
+    VAR_VERTEXBUFFERY,
+    VAR_VERTEXBUFFERZ,
+    VAR_VERTEXBUFFERU,
+    VAR_VERTEXBUFFERV,
+    VAR_FACEBUFFERA,
+    VAR_FACEBUFFERB,
+    VAR_FACEBUFFERC,
+    VAR_FACEBUFFERD,
+    VAR_FACEBUFFERFLAG,
+    VAR_FACEBUFFERCOLOR,
+    VAR_SAVERAM,
+    VAR_ENGINESTATE,
+    VAR_ENGINELANGUAGE,
+    VAR_ENGINEONLINEACTIVE,
+    VAR_ENGINESFXVOLUME,
+    VAR_ENGINEBGMVOLUME,
+    VAR_ENGINETRIALMODE,
+    VAR_ENGINEDEVICETYPE,
+
+    // Extras
+    VAR_SCREENCURRENTID,
+    VAR_CAMERAENABLED,
+    VAR_CAMERATARGET,
+    VAR_CAMERASTYLE,
+    VAR_CAMERAXPOS,
+    VAR_CAMERAYPOS,
+    VAR_CAMERAADJUSTY,
+
+#if LEGACY_RETRO_USE_HAPTICS
+    VAR_HAPTICSENABLED,
+#endif
+    VAR_MAX_CNT
+};
+
+enum ScrFunc {
+    FUNC_END,
+    FUNC_EQUAL,
+    FUNC_ADD,
+    FUNC_SUB,
+    FUNC_INC,
+    FUNC_DEC,
+    FUNC_MUL,
+    FUNC_DIV,
+    FUNC_SHR,
+    FUNC_SHL,
+    FUNC_AND,
+    FUNC_OR,
+    FUNC_XOR,
+    FUNC_MOD,
+    FUNC_FLIPSIGN,
+    FUNC_CHECKEQUAL,
+    FUNC_CHECKGREATER,
+    FUNC_CHECKLOWER,
+    FUNC_CHECKNOTEQUAL,
+    FUNC_IFEQUAL,
+    FUNC_IFGREATER,
+    FUNC_IFGREATEROREQUAL,
+    FUNC_IFLOWER,
+    FUNC_IFLOWEROREQUAL,
+    FUNC_IFNOTEQUAL,
+    FUNC_ELSE,
+    FUNC_ENDIF,
+    FUNC_WEQUAL,
+    FUNC_WGREATER,
+    FUNC_WGREATEROREQUAL,
+    FUNC_WLOWER,
+    FUNC_WLOWEROREQUAL,
+    FUNC_WNOTEQUAL,
+    FUNC_LOOP,
+    FUNC_FOREACHACTIVE,
+    FUNC_FOREACHALL,
+    FUNC_NEXT,
+    FUNC_SWITCH,
+    FUNC_BREAK,
+    FUNC_ENDSWITCH,
+    FUNC_RAND,
+    FUNC_SIN,
+    FUNC_COS,
+    FUNC_SIN256,
+    FUNC_COS256,
+    FUNC_ATAN2,
+    FUNC_INTERPOLATE,
+    FUNC_INTERPOLATEXY,
+    FUNC_LOADSPRITESHEET,
+    FUNC_REMOVESPRITESHEET,
+    FUNC_DRAWSPRITE,
+    FUNC_DRAWSPRITEXY,
+    FUNC_DRAWSPRITESCREENXY,
+    FUNC_DRAWTINTRECT,
+    FUNC_DRAWNUMBERS,
+    FUNC_DRAWACTNAME,
+    FUNC_DRAWMENU,
+    FUNC_SPRITEFRAME,
+    FUNC_EDITFRAME,
+    FUNC_LOADPALETTE,
+    FUNC_ROTATEPALETTE,
+    FUNC_SETSCREENFADE,
+    FUNC_SETACTIVEPALETTE,
+    FUNC_SETPALETTEFADE,
+    FUNC_SETPALETTEENTRY,
+    FUNC_GETPALETTEENTRY,
+    FUNC_COPYPALETTE,
+    FUNC_CLEARSCREEN,
+    FUNC_DRAWSPRITEFX,
+    FUNC_DRAWSPRITESCREENFX,
+    FUNC_LOADANIMATION,
+    FUNC_SETUPMENU,
+    FUNC_ADDMENUENTRY,
+    FUNC_EDITMENUENTRY,
+    FUNC_LOADSTAGE,
+    FUNC_DRAWRECT,
+    FUNC_RESETOBJECTENTITY,
+    FUNC_BOXCOLLISIONTEST,
+    FUNC_CREATETEMPOBJECT,
+    FUNC_PROCESSOBJECTMOVEMENT,
+    FUNC_PROCESSOBJECTCONTROL,
+    FUNC_PROCESSANIMATION,
+    FUNC_DRAWOBJECTANIMATION,
+    FUNC_SETMUSICTRACK,
+    FUNC_PLAYMUSIC,
+    FUNC_STOPMUSIC,
+    FUNC_PAUSEMUSIC,
+    FUNC_RESUMEMUSIC,
+    FUNC_SWAPMUSICTRACK,
+    FUNC_PLAYSFX,
+    FUNC_STOPSFX,
+    FUNC_SETSFXATTRIBUTES,
+    FUNC_OBJECTTILECOLLISION,
+    FUNC_OBJECTTILEGRIP,
+    FUNC_NOT,
+    FUNC_DRAW3DSCENE,
+    FUNC_SETIDENTITYMATRIX,
+    FUNC_MATRIXMULTIPLY,
+    FUNC_MATRIXTRANSLATEXYZ,
+    FUNC_MATRIXSCALEXYZ,
+    FUNC_MATRIXROTATEX,
+    FUNC_MATRIXROTATEY,
+    FUNC_MATRIXROTATEZ,
+    FUNC_MATRIXROTATEXYZ,
+    FUNC_MATRIXINVERSE,
+    FUNC_TRANSFORMVERTICES,
+    FUNC_CALLFUNCTION,
+    FUNC_RETURN,
+    FUNC_SETLAYERDEFORMATION,
+    FUNC_CHECKTOUCHRECT,
+    FUNC_GETTILELAYERENTRY,
+    FUNC_SETTILELAYERENTRY,
+    FUNC_GETBIT,
+    FUNC_SETBIT,
+    FUNC_CLEARDRAWLIST,
+    FUNC_ADDDRAWLISTENTITYREF,
+    FUNC_GETDRAWLISTENTITYREF,
+    FUNC_SETDRAWLISTENTITYREF,
+    FUNC_GET16X16TILEINFO,
+    FUNC_SET16X16TILEINFO,
+    FUNC_COPY16X16TILE,
+    FUNC_GETANIMATIONBYNAME,
+    FUNC_READSAVERAM,
+    FUNC_WRITESAVERAM,
+    FUNC_LOADTEXTFILE,
+    FUNC_GETTEXTINFO,
+    FUNC_GETVERSIONNUMBER,
+    FUNC_GETTABLEVALUE,
+    FUNC_SETTABLEVALUE,
+    FUNC_CHECKCURRENTSTAGEFOLDER,
+    FUNC_ABS,
+    FUNC_CALLNATIVEFUNCTION,
+    FUNC_CALLNATIVEFUNCTION2,
+    FUNC_CALLNATIVEFUNCTION4,
+    FUNC_SETOBJECTRANGE,
+    FUNC_GETOBJECTVALUE,
+    FUNC_SETOBJECTVALUE,
+    FUNC_COPYOBJECT,
+    FUNC_PRINT,
+
+    // Extras
+    FUNC_CHECKCAMERAPROXIMITY,
+    FUNC_SETSCREENCOUNT,
+    FUNC_SETSCREENVERTICES,
+    FUNC_GETINPUTDEVICEID,
+    FUNC_GETFILTEREDINPUTDEVICEID,
+    FUNC_GETINPUTDEVICETYPE,
+    FUNC_ISINPUTDEVICEASSIGNED,
+    FUNC_ASSIGNINPUTSLOTTODEVICE,
+    FUNC_ISSLOTASSIGNED,
+    FUNC_RESETINPUTSLOTASSIGNMENTS,
+    FUNC_MAX_CNT
+};
+
+} // namespace v4
+} // namespace Legacy
+} // namespace RSDK
+
+#endif
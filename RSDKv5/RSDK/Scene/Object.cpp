@@ -288,6 +288,10 @@ void RSDK::InitObjects()
     sceneInfo.createSlot = ENTITY_COUNT - 0x100;
     cameraCount          = 0;
 
+#if RETRO_USE_THREADED_SPRITES
+    BeginSpriteSheetDecoding();
+#endif
+
     for (int32 o = 0; o < sceneInfo.classCount; ++o) {
 #if RETRO_USE_MOD_LOADER
         currentObjectID = o;
@@ -301,6 +305,11 @@ void RSDK::InitObjects()
     RunModCallbacks(MODCB_ONSTAGELOAD, NULL);
 #endif
 
+#if RETRO_USE_THREADED_SPRITES
+    // entities are free to start drawing from here, so every sheet has to be ready
+    FinishSpriteSheetDecoding();
+#endif
+
     for (int32 e = 0; e < ENTITY_COUNT; ++e) {
         sceneInfo.entitySlot = e;
         sceneInfo.entity     = &objectEntityList[e];
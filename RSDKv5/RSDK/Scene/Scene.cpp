@@ -263,6 +263,9 @@ void RSDK::LoadSceneAssets()
 
     if (screens[0].size.y > 0)
         memset(gfxLineBuffer, 0, screens[0].size.y * sizeof(uint8));
+#if RETRO_USE_PALETTE_TRACKING
+    ++activePaletteGeneration;
+#endif
 
     memset(tileLayers, 0, LAYER_COUNT * sizeof(TileLayer));
 
@@ -277,6 +280,11 @@ void RSDK::LoadSceneAssets()
                 for (int32 c = 0; c < 0x10; ++c) fullPalette[b][(r << 4) + c] = stagePalette[b][(r << 4) + c];
             }
         }
+
+#if RETRO_USE_PALETTE_TRACKING
+        if (activeGlobalRows[b] || activeStageRows[b])
+            MarkPaletteChanged(b);
+#endif
     }
 
     FileInfo info;
@@ -881,6 +889,10 @@ void RSDK::LoadStageGIF(char *filepath)
             }
         }
 
+#if RETRO_USE_PALETTE_TRACKING
+        MarkPaletteChanged(0);
+#endif
+
         // Flip X
         uint8 *srcPixels = tilesetPixels;
         uint8 *dstPixels = &tilesetPixels[(FLIP_X * TILESET_SIZE) + (TILE_SIZE - 1)];
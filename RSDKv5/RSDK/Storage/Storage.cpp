@@ -48,7 +48,7 @@ void RSDK::ReleaseStorage()
     }
 }
 
-void RSDK::AllocateStorage(void **dataPtr, uint32 size, StorageDataSets dataSet, bool32 clear)
+void RSDK::AllocateStorage(void **dataPtr, uint32 size, StorageDataSets dataSet, bool32 clear, bool32 collect)
 {
     int32 **data = (int32 **)dataPtr;
     *data        = NULL;
@@ -61,6 +61,10 @@ void RSDK::AllocateStorage(void **dataPtr, uint32 size, StorageDataSets dataSet,
 
         if (storage->entryCount < STORAGE_ENTRY_COUNT) {
             if (size + sizeof(int32) * storage->usedStorage >= storage->storageLimit) {
+                // clearing unused storage moves every entry still in use, so callers that can't have that happen just get NULL back
+                if (!collect)
+                    return;
+
                 ClearUnusedStorage(dataSet);
 
                 if (size + sizeof(int32) * storage->usedStorage >= storage->storageLimit) {